@@ -56,8 +56,10 @@ uint8_t hdc1080_basic_init(void)
     DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
     DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
     DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
     DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
     DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
     
     /* hdc1080 init */
     res = hdc1080_init(&gs_handle);
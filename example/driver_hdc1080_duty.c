@@ -0,0 +1,364 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_duty.c
+ * @brief     driver hdc1080 duty source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_duty.h"
+
+static hdc1080_handle_t gs_handle;                                        /**< hdc1080 handle */
+static hdc1080_energy_t gs_energy;                                        /**< estimated energy */
+static uint32_t gs_wait_ms;                                               /**< conversion wait time */
+static uint32_t gs_period_ms;                                             /**< sample period */
+static uint32_t gs_next_ms;                                               /**< next sample tick */
+static hdc1080_temperature_resolution_t gs_temperature_resolution;        /**< temperature resolution */
+static hdc1080_humidity_resolution_t gs_humidity_resolution;              /**< humidity resolution */
+
+/**
+ * @brief     duty example init
+ * @param[in] temperature_resolution temperature resolution
+ * @param[in] humidity_resolution humidity resolution
+ * @param[in] period_ms sample period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip is set to the sequence mode and the heater is disabled
+ */
+uint8_t hdc1080_duty_init(hdc1080_temperature_resolution_t temperature_resolution,
+                          hdc1080_humidity_resolution_t humidity_resolution, uint32_t period_ms)
+{
+    uint8_t res;
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    hdc1080_energy_param_t param;
+    
+    /* get the conversion time */
+    res = hdc1080_get_conversion_time(temperature_resolution, humidity_resolution, 
+                                      (uint32_t *)&temperature_us, (uint32_t *)&humidity_us);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: resolution is invalid.\n");
+        
+        return 1;
+    }
+    gs_wait_ms = (temperature_us + humidity_us) / 1000 + 1;
+    
+    /* estimate the energy per sample */
+    (void)hdc1080_energy_init_param(&param);
+    res = hdc1080_energy_estimate(&param, HDC1080_MODE_SEQUENCE, temperature_resolution, humidity_resolution, 
+                                  period_ms, &gs_energy);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: period is too short.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t); 
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, hdc1080_interface_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, hdc1080_interface_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
+    
+    /* hdc1080 init */
+    res = hdc1080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* disable heater */
+    res = hdc1080_set_heater(&gs_handle, HDC1080_BOOL_FALSE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set heater failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* one trigger converts both channels */
+    res = hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set mode failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set temperature resolution */
+    res = hdc1080_set_temperature_resolution(&gs_handle, temperature_resolution);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set temperature resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set humidity resolution */
+    res = hdc1080_set_humidity_resolution(&gs_handle, humidity_resolution);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set humidity resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the first sample is taken at once */
+    gs_temperature_resolution = temperature_resolution;
+    gs_humidity_resolution = humidity_resolution;
+    gs_period_ms = period_ms;
+    gs_next_ms = hdc1080_interface_get_tick_ms();
+    
+    return 0;
+}
+
+/**
+ * @brief      duty example read one sample
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_hdc1080_duty_sample(uint16_t *temperature_raw, float *temperature, uint16_t *humidity_raw, float *humidity)
+{
+    uint32_t now;
+    
+    /* sleep until the sample slot */
+    hdc1080_interface_sleep_until_ms(gs_next_ms);
+    
+    /* start the conversion */
+    if (hdc1080_start_temperature_humidity(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* sleep across the conversion window */
+    hdc1080_interface_sleep_until_ms(hdc1080_interface_get_tick_ms() + gs_wait_ms);
+    
+    /* fetch the data */
+    if (hdc1080_fetch_temperature_humidity(&gs_handle, temperature_raw, temperature, 
+                                           humidity_raw, humidity) != 0)
+    {
+        return 1;
+    }
+    
+    /* schedule the next slot */
+    gs_next_ms += gs_period_ms;
+    now = hdc1080_interface_get_tick_ms();
+    if ((int32_t)(now - gs_next_ms) > 0)
+    {
+        gs_next_ms = now + gs_period_ms - ((now - gs_next_ms) % gs_period_ms);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      duty example read
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it sleeps until the next sample slot, triggers the conversion and sleeps across the conversion window,
+ *             a late call skips the missed slots instead of catching up
+ */
+uint8_t hdc1080_duty_read(float *temperature, float *humidity)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    
+    /* read one sample */
+    return a_hdc1080_duty_sample((uint16_t *)&temperature_raw, temperature, (uint16_t *)&humidity_raw, humidity);
+}
+
+/**
+ * @brief      duty example read and smooth
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *temperature pointer to a filtered temperature buffer
+ * @param[out] *humidity pointer to a filtered humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads like hdc1080_duty_read and smooths the raw codes before the conversion,
+ *             init the example with a fast resolution and let the filter remove the coarse steps
+ */
+uint8_t hdc1080_duty_read_filter(hdc1080_filter_t *filter, float *temperature, float *humidity)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature_s;
+    float humidity_s;
+    
+    /* read one sample */
+    if (a_hdc1080_duty_sample((uint16_t *)&temperature_raw, (float *)&temperature_s, 
+                              (uint16_t *)&humidity_raw, (float *)&humidity_s) != 0)
+    {
+        return 1;
+    }
+    
+    /* smooth the raw codes */
+    if (hdc1080_filter_update(filter, temperature_raw, humidity_raw, 
+                              (uint16_t *)&temperature_raw, (uint16_t *)&humidity_raw) != 0)
+    {
+        return 1;
+    }
+    
+    /* convert the filtered codes */
+    (void)hdc1080_temperature_convert_to_data(temperature_raw, temperature);
+    (void)hdc1080_humidity_convert_to_data(humidity_raw, humidity);
+    
+    return 0;
+}
+
+/**
+ * @brief      duty example read with an adaptive period
+ * @param[in]  *adaptive pointer to an adaptive structure
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @param[out] *decision pointer to a decision buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads like hdc1080_duty_read, then the controller sets the time to the next sample and,
+ *             if enabled, the resolution of the next sample, the energy estimate of the init period is kept
+ */
+uint8_t hdc1080_duty_read_adaptive(hdc1080_adaptive_t *adaptive, float *temperature, float *humidity,
+                                   hdc1080_adaptive_decision_t *decision)
+{
+    uint8_t res;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    uint32_t slot;
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    
+    /* read one sample */
+    slot = gs_next_ms;
+    if (a_hdc1080_duty_sample((uint16_t *)&temperature_raw, temperature, (uint16_t *)&humidity_raw, humidity) != 0)
+    {
+        return 1;
+    }
+    
+    /* decide the next sample */
+    if (hdc1080_adaptive_update(adaptive, slot, temperature_raw, humidity_raw, decision) != 0)
+    {
+        return 1;
+    }
+    
+    /* move the next slot to the new period */
+    gs_next_ms = gs_next_ms - gs_period_ms + decision->period_ms;
+    gs_period_ms = decision->period_ms;
+    
+    /* change the resolution */
+    if ((decision->temperature_resolution != gs_temperature_resolution) ||
+        (decision->humidity_resolution != gs_humidity_resolution))
+    {
+        res = hdc1080_set_temperature_resolution(&gs_handle, decision->temperature_resolution);
+        if (res != 0)
+        {
+            return 1;
+        }
+        res = hdc1080_set_humidity_resolution(&gs_handle, decision->humidity_resolution);
+        if (res != 0)
+        {
+            return 1;
+        }
+        res = hdc1080_get_conversion_time(decision->temperature_resolution, decision->humidity_resolution, 
+                                          (uint32_t *)&temperature_us, (uint32_t *)&humidity_us);
+        if (res != 0)
+        {
+            return 1;
+        }
+        gs_wait_ms = (temperature_us + humidity_us) / 1000 + 1;
+        gs_temperature_resolution = decision->temperature_resolution;
+        gs_humidity_resolution = decision->humidity_resolution;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      duty example get the estimated energy per sample
+ * @param[out] *energy pointer to an energy result structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       it uses the default energy model parameters
+ */
+uint8_t hdc1080_duty_get_energy(hdc1080_energy_t *energy)
+{
+    if (energy == NULL)
+    {
+        return 1;
+    }
+    
+    /* copy the estimate */
+    *energy = gs_energy;
+    
+    return 0;
+}
+
+/**
+ * @brief  duty example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_duty_deinit(void)
+{
+    /* deinit hdc1080 and close bus */
+    if (hdc1080_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
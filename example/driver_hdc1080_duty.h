@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_duty.h
+ * @brief     driver hdc1080 duty header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_DUTY_H
+#define DRIVER_HDC1080_DUTY_H
+
+#include "driver_hdc1080_interface.h"
+#include "driver_hdc1080_energy.h"
+#include "driver_hdc1080_filter.h"
+#include "driver_hdc1080_adaptive.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_example_driver hdc1080 example driver function
+ * @brief    hdc1080 example driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 duty example default definition
+ */
+#define HDC1080_DUTY_DEFAULT_TEMPERATURE_RESOLUTION         HDC1080_TEMPERATURE_RESOLUTION_14_BIT        /**< 14 bit */
+#define HDC1080_DUTY_DEFAULT_HUMIDITY_RESOLUTION            HDC1080_HUMIDITY_RESOLUTION_14_BIT           /**< 14 bit */
+#define HDC1080_DUTY_DEFAULT_PERIOD_MS                      5000                                         /**< 5s */
+#define HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_RESOLUTION  HDC1080_TEMPERATURE_RESOLUTION_11_BIT        /**< 11 bit */
+#define HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_RESOLUTION     HDC1080_HUMIDITY_RESOLUTION_8_BIT            /**< 8 bit */
+#define HDC1080_DUTY_DEFAULT_FILTER_EMA_SHIFT               2                                            /**< a new sample weighs 1/4 */
+#define HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_PROCESS     0.01f                                        /**< 0.01C per sample */
+#define HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_PROCESS        0.01f                                        /**< 0.01% per sample */
+#define HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_NOISE       0.055f                                       /**< 0.055C at 11 bit */
+#define HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_NOISE          0.15f                                        /**< 0.15% at 8 bit */
+#define HDC1080_DUTY_DEFAULT_ADAPTIVE_MIN_PERIOD_MS         1000                                         /**< 1s */
+#define HDC1080_DUTY_DEFAULT_ADAPTIVE_MAX_PERIOD_MS         60000                                        /**< 60s */
+#define HDC1080_DUTY_DEFAULT_ADAPTIVE_TEMPERATURE_BUDGET    0.2f                                         /**< 0.2C */
+#define HDC1080_DUTY_DEFAULT_ADAPTIVE_HUMIDITY_BUDGET       1.0f                                         /**< 1% */
+#define HDC1080_DUTY_DEFAULT_ADAPTIVE_RESOLUTION            HDC1080_BOOL_TRUE                            /**< adapt the resolution */
+
+/**
+ * @brief     duty example init
+ * @param[in] temperature_resolution temperature resolution
+ * @param[in] humidity_resolution humidity resolution
+ * @param[in] period_ms sample period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip is set to the sequence mode and the heater is disabled
+ */
+uint8_t hdc1080_duty_init(hdc1080_temperature_resolution_t temperature_resolution,
+                          hdc1080_humidity_resolution_t humidity_resolution, uint32_t period_ms);
+
+/**
+ * @brief  duty example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_duty_deinit(void);
+
+/**
+ * @brief      duty example read
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it sleeps until the next sample slot, triggers the conversion and sleeps across the conversion window,
+ *             a late call skips the missed slots instead of catching up
+ */
+uint8_t hdc1080_duty_read(float *temperature, float *humidity);
+
+/**
+ * @brief      duty example read and smooth
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *temperature pointer to a filtered temperature buffer
+ * @param[out] *humidity pointer to a filtered humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads like hdc1080_duty_read and smooths the raw codes before the conversion,
+ *             init the example with a fast resolution and let the filter remove the coarse steps
+ */
+uint8_t hdc1080_duty_read_filter(hdc1080_filter_t *filter, float *temperature, float *humidity);
+
+/**
+ * @brief      duty example read with an adaptive period
+ * @param[in]  *adaptive pointer to an adaptive structure
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @param[out] *decision pointer to a decision buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads like hdc1080_duty_read, then the controller sets the time to the next sample and,
+ *             if enabled, the resolution of the next sample, the energy estimate of the init period is kept
+ */
+uint8_t hdc1080_duty_read_adaptive(hdc1080_adaptive_t *adaptive, float *temperature, float *humidity,
+                                   hdc1080_adaptive_decision_t *decision);
+
+/**
+ * @brief      duty example get the estimated energy per sample
+ * @param[out] *energy pointer to an energy result structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       it uses the default energy model parameters
+ */
+uint8_t hdc1080_duty_get_energy(hdc1080_energy_t *energy);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
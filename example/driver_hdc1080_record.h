@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_record.h
+ * @brief     driver hdc1080 record header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_RECORD_H
+#define DRIVER_HDC1080_RECORD_H
+
+#include "driver_hdc1080_interface.h"
+#include "driver_hdc1080_trace.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_example_driver hdc1080 example driver function
+ * @brief    hdc1080 example driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 record example default definition
+ */
+#define HDC1080_RECORD_DEFAULT_HEATER                         HDC1080_BOOL_FALSE                           /**< disable heater */
+#define HDC1080_RECORD_DEFAULT_MODE                           HDC1080_MODE_SEQUENCE                        /**< temperature and humidity are acquired in sequence */
+#define HDC1080_RECORD_DEFAULT_TEMPERATURE_RESOLUTION         HDC1080_TEMPERATURE_RESOLUTION_14_BIT        /**< 14 bit */
+#define HDC1080_RECORD_DEFAULT_HUMIDITY_RESOLUTION            HDC1080_HUMIDITY_RESOLUTION_14_BIT           /**< 14 bit */
+
+/**
+ * @brief     record example init
+ * @param[in] *trace pointer to an hdc1080 trace handle structure, NULL records nothing
+ * @param[in] *buf pointer to a trace buffer
+ * @param[in] size trace buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every bus transaction is recorded until hdc1080_record_deinit, the trace can be replayed
+ *            by the linux hdc1080_trace_replay tool
+ */
+uint8_t hdc1080_record_init(hdc1080_trace_handle_t *trace, uint8_t *buf, uint32_t size);
+
+/**
+ * @brief  record example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   it stops the record
+ */
+uint8_t hdc1080_record_deinit(void);
+
+/**
+ * @brief      record example read
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc1080_record_read(float *temperature, float *humidity);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_report.c
+ * @brief     driver hdc1080 report source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_report.h"
+
+static hdc1080_handle_t gs_handle;        /**< hdc1080 handle */
+static hdc1080_cov_t gs_cov;              /**< change of value filter */
+static uint32_t gs_wait_ms;               /**< conversion wait time */
+
+/**
+ * @brief  report example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the chip is set to the sequence mode and the change of value filter is reset
+ */
+uint8_t hdc1080_report_init(void)
+{
+    uint8_t res;
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    
+    /* link interface function */
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t); 
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, hdc1080_interface_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, hdc1080_interface_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
+    
+    /* hdc1080 init */
+    res = hdc1080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set default heater */
+    res = hdc1080_set_heater(&gs_handle, HDC1080_REPORT_DEFAULT_HEATER);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set heater failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* one trigger converts both channels */
+    res = hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set mode failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default temperature resolution */
+    res = hdc1080_set_temperature_resolution(&gs_handle, HDC1080_REPORT_DEFAULT_TEMPERATURE_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set temperature resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default humidity resolution */
+    res = hdc1080_set_humidity_resolution(&gs_handle, HDC1080_REPORT_DEFAULT_HUMIDITY_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set humidity resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* wait the conversion time rounded up */
+    (void)hdc1080_get_conversion_time(HDC1080_REPORT_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_REPORT_DEFAULT_HUMIDITY_RESOLUTION,
+                                      (uint32_t *)&temperature_us, (uint32_t *)&humidity_us);
+    gs_wait_ms = (temperature_us + humidity_us) / 1000 + 1;
+    
+    /* cov init */
+    res = hdc1080_cov_init(&gs_cov, HDC1080_REPORT_DEFAULT_TEMPERATURE_DEADBAND, HDC1080_REPORT_DEFAULT_HUMIDITY_DEADBAND,
+                           HDC1080_REPORT_DEFAULT_TEMPERATURE_HYSTERESIS, HDC1080_REPORT_DEFAULT_HUMIDITY_HYSTERESIS,
+                           HDC1080_REPORT_DEFAULT_HEARTBEAT_MS);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: cov init failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      report example read
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @param[out] *report pointer to a report buffer, 0 means the sample is suppressed
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the filter works on the raw codes, a suppressed sample is never converted and the outputs
+ *             are only written when the sample is reported
+ */
+uint8_t hdc1080_report_read(float *temperature, float *humidity, uint8_t *report)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    
+    /* start the measurement */
+    if (hdc1080_start_temperature_humidity(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* wait the conversion */
+    hdc1080_interface_delay_ms(gs_wait_ms);
+    
+    /* fetch the raw codes only */
+    if (hdc1080_fetch_temperature_humidity(&gs_handle, (uint16_t *)&temperature_raw, NULL, 
+                                           (uint16_t *)&humidity_raw, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    /* filter the raw codes */
+    if (hdc1080_cov_check(&gs_cov, hdc1080_interface_get_tick_ms(), temperature_raw, humidity_raw, report) != 0)
+    {
+        return 1;
+    }
+    
+    /* convert only the reported sample */
+    if (*report != 0)
+    {
+        (void)hdc1080_temperature_convert_to_data(temperature_raw, temperature);
+        (void)hdc1080_humidity_convert_to_data(humidity_raw, humidity);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  report example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_report_deinit(void)
+{
+    /* deinit hdc1080 and close bus */
+    if (hdc1080_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
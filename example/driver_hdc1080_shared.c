@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_shared.c
+ * @brief     driver hdc1080 shared source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_shared.h"
+
+static hdc1080_handle_t gs_handle;        /**< hdc1080 handle */
+static hdc1080_cache_t gs_cache;          /**< coalescing read cache */
+
+/**
+ * @brief     shared example init
+ * @param[in] *lock pointer to a cache lock function address, NULL for one context
+ * @param[in] *unlock pointer to a cache unlock function address, NULL for one context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip is set to the sequence mode, link the lock when several threads read through
+ *            hdc1080_shared_read
+ */
+uint8_t hdc1080_shared_init(uint8_t (*lock)(void), void (*unlock)(void))
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t); 
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, hdc1080_interface_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, hdc1080_interface_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
+    
+    /* hdc1080 init */
+    res = hdc1080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set default heater */
+    res = hdc1080_set_heater(&gs_handle, HDC1080_SHARED_DEFAULT_HEATER);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set heater failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* one trigger converts both channels */
+    res = hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set mode failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default temperature resolution */
+    res = hdc1080_set_temperature_resolution(&gs_handle, HDC1080_SHARED_DEFAULT_TEMPERATURE_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set temperature resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default humidity resolution */
+    res = hdc1080_set_humidity_resolution(&gs_handle, HDC1080_SHARED_DEFAULT_HUMIDITY_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set humidity resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* init the read cache */
+    res = hdc1080_cache_init(&gs_cache, &gs_handle, HDC1080_SHARED_DEFAULT_TEMPERATURE_RESOLUTION,
+                             HDC1080_SHARED_DEFAULT_HUMIDITY_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: cache init failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set the cache lock */
+    res = hdc1080_cache_set_lock(&gs_cache, lock, unlock);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: cache set lock failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      shared example read
+ * @param[in]  max_age_ms max age of the sample in ms
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @param[out] *age_ms pointer to a sample age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a sample no older than max_age_ms is served without bus access, a caller that arrives while
+ *             a conversion is in flight sleeps until it is done and shares the result
+ */
+uint8_t hdc1080_shared_read(uint32_t max_age_ms, float *temperature, float *humidity, uint32_t *age_ms)
+{
+    uint8_t res;
+    uint32_t ready_ms;
+    hdc1080_cache_sample_t sample;
+    
+    /* ask for a young enough sample */
+    res = hdc1080_cache_request(&gs_cache, hdc1080_interface_get_tick_ms(), max_age_ms, &sample, &ready_ms);
+    
+    /* sleep until the shared conversion is done */
+    while (res == 4)
+    {
+        hdc1080_interface_sleep_until_ms(ready_ms);
+        res = hdc1080_cache_poll(&gs_cache, hdc1080_interface_get_tick_ms(), &sample);
+    }
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* output */
+    *temperature = sample.temperature;
+    *humidity = sample.humidity;
+    *age_ms = hdc1080_interface_get_tick_ms() - sample.timestamp_ms;
+    
+    return 0;
+}
+
+/**
+ * @brief  shared example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_shared_deinit(void)
+{
+    /* deinit hdc1080 and close bus */
+    if (hdc1080_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_shared.h
+ * @brief     driver hdc1080 shared header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_SHARED_H
+#define DRIVER_HDC1080_SHARED_H
+
+#include "driver_hdc1080_interface.h"
+#include "driver_hdc1080_cache.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_example_driver hdc1080 example driver function
+ * @brief    hdc1080 example driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 shared example default definition
+ */
+#define HDC1080_SHARED_DEFAULT_HEATER                         HDC1080_BOOL_FALSE                           /**< disable heater */
+#define HDC1080_SHARED_DEFAULT_TEMPERATURE_RESOLUTION         HDC1080_TEMPERATURE_RESOLUTION_14_BIT        /**< 14 bit */
+#define HDC1080_SHARED_DEFAULT_HUMIDITY_RESOLUTION            HDC1080_HUMIDITY_RESOLUTION_14_BIT           /**< 14 bit */
+
+/**
+ * @brief     shared example init
+ * @param[in] *lock pointer to a cache lock function address, NULL for one context
+ * @param[in] *unlock pointer to a cache unlock function address, NULL for one context
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the chip is set to the sequence mode, link the lock when several threads read through
+ *            hdc1080_shared_read
+ */
+uint8_t hdc1080_shared_init(uint8_t (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief  shared example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_shared_deinit(void);
+
+/**
+ * @brief      shared example read
+ * @param[in]  max_age_ms max age of the sample in ms
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @param[out] *age_ms pointer to a sample age buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a sample no older than max_age_ms is served without bus access, a caller that arrives while
+ *             a conversion is in flight sleeps until it is done and shares the result
+ */
+uint8_t hdc1080_shared_read(uint32_t max_age_ms, float *temperature, float *humidity, uint32_t *age_ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_stream.c
+ * @brief     driver hdc1080 stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_stream.h"
+
+static hdc1080_handle_t gs_handle;        /**< hdc1080 handle */
+static uint32_t gs_wait_ms;               /**< conversion wait time */
+static uint16_t gs_seq;                   /**< sequence number */
+
+/**
+ * @brief      stream example init
+ * @param[out] *period_ms pointer to a shortest sample period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the chip is set to the sequence mode
+ */
+uint8_t hdc1080_stream_init(uint32_t *period_ms)
+{
+    uint8_t res;
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    
+    /* link interface function */
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t); 
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, hdc1080_interface_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, hdc1080_interface_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
+    
+    /* hdc1080 init */
+    res = hdc1080_init(&gs_handle);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set default heater */
+    res = hdc1080_set_heater(&gs_handle, HDC1080_STREAM_DEFAULT_HEATER);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set heater failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* one trigger converts both channels */
+    res = hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set mode failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default temperature resolution */
+    res = hdc1080_set_temperature_resolution(&gs_handle, HDC1080_STREAM_DEFAULT_TEMPERATURE_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set temperature resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set default humidity resolution */
+    res = hdc1080_set_humidity_resolution(&gs_handle, HDC1080_STREAM_DEFAULT_HUMIDITY_RESOLUTION);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set humidity resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* wait the conversion time rounded up */
+    (void)hdc1080_get_conversion_time(HDC1080_STREAM_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_STREAM_DEFAULT_HUMIDITY_RESOLUTION,
+                                      (uint32_t *)&temperature_us, (uint32_t *)&humidity_us);
+    gs_wait_ms = (temperature_us + humidity_us) / 1000 + 1;
+    gs_seq = 0;
+    *period_ms = gs_wait_ms;
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example read
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *record pointer to a frame record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it triggers one measurement, waits the conversion time and fetches the raw data,
+ *             the sequence number increases for every call so a failed read shows as a gap
+ */
+uint8_t hdc1080_stream_read(uint32_t timestamp_ms, hdc1080_frame_record_t *record)
+{
+    /* set the record header */
+    record->seq = gs_seq;
+    record->timestamp_ms = timestamp_ms;
+    gs_seq++;
+    
+    /* start the measurement */
+    if (hdc1080_start_temperature_humidity(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* wait the conversion */
+    hdc1080_interface_delay_ms(gs_wait_ms);
+    
+    /* fetch the raw data without a float conversion */
+    if (hdc1080_fetch_temperature_humidity(&gs_handle, (uint16_t *)&record->temperature_raw, NULL,
+                                           (uint16_t *)&record->humidity_raw, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the serial id
+ * @param[out] *id pointer to a 6 bytes serial id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get serial id failed
+ * @note       it tags the blocks of the series format
+ */
+uint8_t hdc1080_stream_get_serial_id(uint8_t id[6])
+{
+    /* get the serial id */
+    if (hdc1080_get_serial_id(&gs_handle, id) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_stream_deinit(void)
+{
+    /* deinit hdc1080 and close bus */
+    if (hdc1080_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
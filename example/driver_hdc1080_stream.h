@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_stream.h
+ * @brief     driver hdc1080 stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_STREAM_H
+#define DRIVER_HDC1080_STREAM_H
+
+#include "driver_hdc1080_interface.h"
+#include "driver_hdc1080_frame.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_example_driver hdc1080 example driver function
+ * @brief    hdc1080 example driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 stream example default definition
+ */
+#define HDC1080_STREAM_DEFAULT_HEATER                         HDC1080_BOOL_FALSE                           /**< disable heater */
+#define HDC1080_STREAM_DEFAULT_TEMPERATURE_RESOLUTION         HDC1080_TEMPERATURE_RESOLUTION_14_BIT        /**< 14 bit */
+#define HDC1080_STREAM_DEFAULT_HUMIDITY_RESOLUTION            HDC1080_HUMIDITY_RESOLUTION_14_BIT           /**< 14 bit */
+#define HDC1080_STREAM_DEFAULT_SERIES_BLOCK_SIZE              256                                          /**< 256 bytes */
+
+/**
+ * @brief      stream example init
+ * @param[out] *period_ms pointer to a shortest sample period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the chip is set to the sequence mode
+ */
+uint8_t hdc1080_stream_init(uint32_t *period_ms);
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_stream_deinit(void);
+
+/**
+ * @brief      stream example read
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *record pointer to a frame record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it triggers one measurement, waits the conversion time and fetches the raw data,
+ *             the sequence number increases for every call so a failed read shows as a gap
+ */
+uint8_t hdc1080_stream_read(uint32_t timestamp_ms, hdc1080_frame_record_t *record);
+
+/**
+ * @brief      stream example get the serial id
+ * @param[out] *id pointer to a 6 bytes serial id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get serial id failed
+ * @note       it tags the blocks of the series format
+ */
+uint8_t hdc1080_stream_get_serial_id(uint8_t id[6]);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
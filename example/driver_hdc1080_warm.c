@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_warm.c
+ * @brief     driver hdc1080 warm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_warm.h"
+
+static hdc1080_handle_t gs_handle;        /**< hdc1080 handle */
+
+/**
+ * @brief      warm example init
+ * @param[out] *reset pointer to a bool value buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a chip that kept the default config over an mcu reset is used without the reset and the 100ms delay,
+ *             reset is set to HDC1080_BOOL_TRUE when the chip had to be reset and programmed
+ */
+uint8_t hdc1080_warm_init(hdc1080_bool_t *reset)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t); 
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, hdc1080_interface_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, hdc1080_interface_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
+    
+    /* hdc1080 init, the chip is only reset when it runs another config */
+    res = hdc1080_init_fast(&gs_handle, HDC1080_WARM_DEFAULT_MODE, HDC1080_WARM_DEFAULT_HEATER,
+                            HDC1080_WARM_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_WARM_DEFAULT_HUMIDITY_RESOLUTION,
+                            reset);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init fast failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      warm example read
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t hdc1080_warm_read(float *temperature, float *humidity)
+{
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    
+    /* read temperature and humidity */
+    if (hdc1080_read_temperature_humidity(&gs_handle, (uint16_t *)&temperature_raw, temperature, 
+                                         (uint16_t *)&humidity_raw, humidity) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  warm example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t hdc1080_warm_deinit(void)
+{
+    /* deinit hdc1080 and close bus */
+    if (hdc1080_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -92,6 +92,21 @@ uint8_t hdc1080_interface_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t
     return 0;
 }
 
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads without sending a register address
+ */
+uint8_t hdc1080_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
 /**
  * @brief     interface iic bus write
  * @param[in] addr iic device write address
@@ -118,6 +133,27 @@ void hdc1080_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief  interface get the tick
+ * @return current tick in ms
+ * @note   it wraps around after 2^32 ms
+ */
+uint32_t hdc1080_interface_get_tick_ms(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface sleep until the tick
+ * @param[in] tick wake up tick in ms
+ * @note      it returns at once when the tick has passed,
+ *            a low power port stops the core until the next interrupt instead of spinning
+ */
+void hdc1080_interface_sleep_until_ms(uint32_t tick)
+{
+
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -127,3 +163,23 @@ void hdc1080_interface_debug_print(const char *const fmt, ...)
 {
     
 }
+
+/**
+ * @brief     interface log debug message record
+ * @param[in] id debug message id
+ * @param[in] arg debug message argument
+ * @note      it must not block, only used when HDC1080_DEBUG_LEVEL is HDC1080_DEBUG_LEVEL_BINARY
+ */
+void hdc1080_interface_debug_log(uint8_t id, uint16_t arg)
+{
+    
+}
+
+/**
+ * @brief interface send the deferred debug records
+ * @note  call it from the main loop, only used when HDC1080_DEBUG_LEVEL is HDC1080_DEBUG_LEVEL_BINARY
+ */
+void hdc1080_interface_debug_flush(void)
+{
+    
+}
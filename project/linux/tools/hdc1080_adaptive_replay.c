@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_adaptive_replay.c
+ * @brief     hdc1080 adaptive sampling replay tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_adaptive.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief adaptive replay default definition
+ */
+#define ADAPTIVE_REPLAY_MIN_PERIOD_MS      1000         /**< min sample period */
+#define ADAPTIVE_REPLAY_MAX_PERIOD_MS      60000        /**< max sample period */
+#define ADAPTIVE_REPLAY_SYNTHETIC_LEN      86400        /**< synthetic trace length in s */
+
+/**
+ * @brief adaptive replay record structure definition
+ */
+typedef struct adaptive_replay_record_s
+{
+    uint32_t timestamp_ms;          /**< timestamp in ms */
+    uint16_t temperature_raw;       /**< raw temperature */
+    uint16_t humidity_raw;          /**< raw humidity */
+} adaptive_replay_record_t;
+
+/**
+ * @brief adaptive replay result structure definition
+ */
+typedef struct adaptive_replay_result_s
+{
+    uint32_t samples;              /**< taken samples */
+    uint32_t inside;               /**< records within the budget */
+    double conversion_ms;          /**< total conversion time in ms */
+    double max_temperature;        /**< max temperature error in C */
+    double max_humidity;           /**< max humidity error in % */
+} adaptive_replay_result_t;
+
+static adaptive_replay_record_t *gs_trace;        /**< trace buffer */
+static uint32_t gs_len;                           /**< trace length */
+
+/**
+ * @brief     load a trace in the hdc1080_decode csv format
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      seq,timestamp_ms,temperature_raw,humidity_raw,...
+ */
+static int a_load(const char *path)
+{
+    FILE *f;
+    char line[128];
+    uint32_t cap = 0;
+    unsigned int seq;
+    unsigned int ts;
+    unsigned int t;
+    unsigned int h;
+    
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "hdc1080_adaptive_replay: open %s failed.\n", path);
+        
+        return 1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        if (sscanf(line, "%u,%u,%u,%u", &seq, &ts, &t, &h) != 4)
+        {
+            continue;
+        }
+        if (gs_len == cap)
+        {
+            cap = (cap == 0) ? 4096 : cap * 2;
+            gs_trace = realloc(gs_trace, cap * sizeof(adaptive_replay_record_t));
+            if (gs_trace == NULL)
+            {
+                fclose(f);
+                
+                return 1;
+            }
+        }
+        gs_trace[gs_len].timestamp_ms = ts;
+        gs_trace[gs_len].temperature_raw = (uint16_t)t;
+        gs_trace[gs_len].humidity_raw = (uint16_t)h;
+        gs_len++;
+    }
+    fclose(f);
+    
+    return (gs_len < 2) ? 1 : 0;
+}
+
+/**
+ * @brief  make a synthetic day at a 1s period
+ * @return status code
+ *         - 0 success
+ *         - 1 make failed
+ * @note   a slow day cycle of the room with a window opened for 10 minutes three times
+ */
+static int a_synthetic(void)
+{
+    static const uint32_t events[3] = {8 * 3600, 13 * 3600, 19 * 3600};
+    uint32_t i;
+    uint32_t k;
+    double t;
+    double h;
+    double e;
+    
+    gs_len = ADAPTIVE_REPLAY_SYNTHETIC_LEN;
+    gs_trace = malloc(gs_len * sizeof(adaptive_replay_record_t));
+    if (gs_trace == NULL)
+    {
+        return 1;
+    }
+    for (i = 0; i < gs_len; i++)
+    {
+        t = 22.0 + 1.5 * sin((double)i * 6.2831853 / 86400.0);
+        h = 45.0 - 5.0 * sin((double)i * 6.2831853 / 86400.0);
+        for (k = 0; k < 3; k++)
+        {
+            if (i < events[k])
+            {
+                continue;
+            }
+            if (i < events[k] + 600)
+            {
+                e = 1.0 - exp(-(double)(i - events[k]) / 120.0);
+            }
+            else
+            {
+                e = (1.0 - exp(-600.0 / 120.0)) * exp(-(double)(i - events[k] - 600) / 600.0);
+            }
+            t -= 3.0 * e;
+            h += 8.0 * e;
+        }
+        gs_trace[i].timestamp_ms = i * 1000;
+        gs_trace[i].temperature_raw = (uint16_t)((t + 40.0) * 65536.0 / 165.0) & 0xFFFC;
+        gs_trace[i].humidity_raw = (uint16_t)(h * 65536.0 / 100.0) & 0xFFFC;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      replay the trace
+ * @param[in]  mode 0 every record, 1 adaptive period, 2 adaptive period and resolution
+ * @param[in]  min_period_ms min sample period in ms
+ * @param[in]  max_period_ms max sample period in ms
+ * @param[in]  temperature_budget temperature budget in C
+ * @param[in]  humidity_budget humidity budget in %
+ * @param[out] *result pointer to a result structure
+ * @note       a coarse resolution is emulated by cutting the low bits of the recorded codes, the value between
+ *             two samples is held
+ */
+static void a_replay(int mode, uint32_t min_period_ms, uint32_t max_period_ms, float temperature_budget,
+                     float humidity_budget, adaptive_replay_result_t *result)
+{
+    hdc1080_adaptive_t adaptive;
+    hdc1080_adaptive_decision_t decision;
+    uint32_t i;
+    uint32_t next_ms;
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    uint16_t temperature_mask = 0xFFFC;
+    uint16_t humidity_mask = 0xFFFC;
+    uint16_t held_t = 0;
+    uint16_t held_h = 0;
+    double err_t;
+    double err_h;
+    
+    memset(result, 0, sizeof(adaptive_replay_result_t));
+    (void)hdc1080_adaptive_init(&adaptive, min_period_ms, max_period_ms, temperature_budget, humidity_budget,
+                                (mode == 2) ? HDC1080_BOOL_TRUE : HDC1080_BOOL_FALSE);
+    decision.temperature_resolution = HDC1080_TEMPERATURE_RESOLUTION_14_BIT;
+    decision.humidity_resolution = HDC1080_HUMIDITY_RESOLUTION_14_BIT;
+    next_ms = gs_trace[0].timestamp_ms;
+    for (i = 0; i < gs_len; i++)
+    {
+        if ((mode == 0) || ((int32_t)(gs_trace[i].timestamp_ms - next_ms) >= 0))
+        {
+            (void)hdc1080_get_conversion_time(decision.temperature_resolution, decision.humidity_resolution,
+                                              &temperature_us, &humidity_us);
+            result->conversion_ms += (temperature_us + humidity_us) / 1000.0;
+            held_t = gs_trace[i].temperature_raw & temperature_mask;
+            held_h = gs_trace[i].humidity_raw & humidity_mask;
+            (void)hdc1080_adaptive_update(&adaptive, gs_trace[i].timestamp_ms, held_t, held_h, &decision);
+            next_ms = gs_trace[i].timestamp_ms + decision.period_ms;
+            temperature_mask = (decision.temperature_resolution == HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ? 0xFFE0 : 0xFFFC;
+            humidity_mask = (decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_8_BIT) ? 0xFF00 :
+                            ((decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_11_BIT) ? 0xFFE0 : 0xFFFC);
+            result->samples++;
+        }
+        err_t = fabs((double)gs_trace[i].temperature_raw - (double)held_t) * 165.0 / 65536.0;
+        err_h = fabs((double)gs_trace[i].humidity_raw - (double)held_h) * 100.0 / 65536.0;
+        if (err_t > result->max_temperature)
+        {
+            result->max_temperature = err_t;
+        }
+        if (err_h > result->max_humidity)
+        {
+            result->max_humidity = err_h;
+        }
+        if ((err_t <= temperature_budget) && (err_h <= humidity_budget))
+        {
+            result->inside++;
+        }
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_adaptive_replay [--min=<ms>] [--max=<ms>] [--temperature-budget=<c>]
+ *                   [--humidity-budget=<%>] [trace.csv]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int mode;
+    uint32_t min_period_ms = ADAPTIVE_REPLAY_MIN_PERIOD_MS;
+    uint32_t max_period_ms = ADAPTIVE_REPLAY_MAX_PERIOD_MS;
+    float temperature_budget = 0.2f;
+    float humidity_budget = 1.0f;
+    hdc1080_adaptive_t check;
+    adaptive_replay_result_t result;
+    static const char *const name[3] = {"fixed", "adaptive", "adaptive+res"};
+    const struct option long_options[] =
+    {
+        {"min", required_argument, NULL, 1},
+        {"max", required_argument, NULL, 2},
+        {"temperature-budget", required_argument, NULL, 3},
+        {"humidity-budget", required_argument, NULL, 4},
+        {NULL, 0, NULL, 0},
+    };
+    
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 1 :
+            {
+                min_period_ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 2 :
+            {
+                max_period_ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 3 :
+            {
+                temperature_budget = strtof(optarg, NULL);
+                
+                break;
+            }
+            case 4 :
+            {
+                humidity_budget = strtof(optarg, NULL);
+                
+                break;
+            }
+            default :
+            {
+                fprintf(stderr, "usage: hdc1080_adaptive_replay [--min=<ms>] [--max=<ms>] [--temperature-budget=<c>] "
+                        "[--humidity-budget=<%%>] [trace.csv]\n");
+                
+                return 1;
+            }
+        }
+    }
+    if (hdc1080_adaptive_init(&check, min_period_ms, max_period_ms, temperature_budget, humidity_budget, HDC1080_BOOL_TRUE) != 0)
+    {
+        fprintf(stderr, "hdc1080_adaptive_replay: periods or budgets are invalid.\n");
+        
+        return 1;
+    }
+    if (((optind < argc) ? a_load(argv[optind]) : a_synthetic()) != 0)
+    {
+        fprintf(stderr, "hdc1080_adaptive_replay: no trace.\n");
+        
+        return 1;
+    }
+    
+    printf("%s, %u records over %0.1fh.\n", (optind < argc) ? argv[optind] : "synthetic day", gs_len,
+           (gs_trace[gs_len - 1].timestamp_ms - gs_trace[0].timestamp_ms) / 3600000.0);
+    printf("budget %0.2fC and %0.2f%%, period %ums to %ums.\n", temperature_budget, humidity_budget,
+           min_period_ms, max_period_ms);
+    printf("%-12s  %8s  %8s  %14s  %12s  %13s  %16s\n", "mode", "samples", "saved(%)", "conversion(ms)",
+           "max t err(C)", "max rh err(%)", "within budget(%)");
+    for (mode = 0; mode < 3; mode++)
+    {
+        a_replay(mode, min_period_ms, max_period_ms, temperature_budget, humidity_budget, &result);
+        printf("%-12s  %8u  %8.2f  %14.1f  %12.4f  %13.4f  %16.2f\n", name[mode], result.samples,
+               100.0 - result.samples * 100.0 / gs_len, result.conversion_ms, result.max_temperature,
+               result.max_humidity, result.inside * 100.0 / gs_len);
+    }
+    free(gs_trace);
+    
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_aggregate_bench.c
+ * @brief     hdc1080 aggregate benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_hdc1080_aggregate.h"
+#include "driver_hdc1080_frame.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief aggregate bench default definition
+ */
+#define AGGREGATE_BENCH_SAMPLES       10000000        /**< sample number */
+#define AGGREGATE_BENCH_PERIOD_MS     1000            /**< sample period */
+#define AGGREGATE_BENCH_WINDOW_MS     60000           /**< window length */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief     run one configuration
+ * @param[in] samples sample number
+ * @param[in] period_ms sample period in ms
+ * @param[in] window_ms window length in ms
+ * @param[in] hop_ms window hop in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static int a_run(uint32_t samples, uint32_t period_ms, uint32_t window_ms, uint32_t hop_ms)
+{
+    static hdc1080_aggregate_t aggregate;
+    hdc1080_aggregate_summary_t summary;
+    hdc1080_frame_record_t record;
+    uint8_t frame[HDC1080_FRAME_MAX_SIZE];
+    uint16_t frame_len;
+    uint8_t ready;
+    uint32_t i;
+    uint32_t seed = 1;
+    uint32_t windows = 0;
+    uint64_t raw_bytes = 0;
+    double start;
+    double ns;
+    double check = 0.0;
+    float temperature;
+    float humidity;
+    
+    if (hdc1080_aggregate_init(&aggregate, window_ms, hop_ms) != 0)
+    {
+        fprintf(stderr, "hdc1080_aggregate_bench: window must be 1 to %d hops.\n", HDC1080_AGGREGATE_MAX_PANES);
+        
+        return 1;
+    }
+    
+    /* uplink bytes of the raw stream */
+    memset(&record, 0, sizeof(record));
+    for (i = 0; i < 256; i++)
+    {
+        record.seq = (uint16_t)i;
+        record.timestamp_ms = i * period_ms;
+        record.temperature_raw = (uint16_t)(26000 + i);
+        record.humidity_raw = (uint16_t)(36000 + i);
+        (void)hdc1080_frame_encode(&record, frame, sizeof(frame), &frame_len);
+        raw_bytes += frame_len;
+    }
+    
+    start = a_now_ns();
+    for (i = 0; i < samples; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        temperature = 25.0f + (float)(seed >> 24) / 64.0f;
+        humidity = 50.0f + (float)((seed >> 16) & 0xFF) / 32.0f;
+        (void)hdc1080_aggregate_add(&aggregate, i * period_ms, temperature, humidity, &summary, &ready);
+        if (ready != 0)
+        {
+            check += summary.temperature.stddev;
+            windows++;
+        }
+    }
+    ns = (a_now_ns() - start) / (double)samples;
+    
+    printf("%-8s  %10u  %8u  %9u  %8u  %11.1f  %13.2f  %9.1f\n", (hop_ms == window_ms) ? "tumbling" : "sliding",
+           window_ms, hop_ms, samples, windows, (double)samples / (double)(windows ? windows : 1),
+           (double)raw_bytes / 256.0 * samples / ((double)windows * sizeof(hdc1080_aggregate_summary_t)), ns);
+    
+    return (check >= 0.0) ? 0 : 1;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_aggregate_bench [--samples=<num>] [--period=<ms>] [--window=<ms>] [--hop=<ms>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t samples = AGGREGATE_BENCH_SAMPLES;
+    uint32_t period_ms = AGGREGATE_BENCH_PERIOD_MS;
+    uint32_t window_ms = AGGREGATE_BENCH_WINDOW_MS;
+    uint32_t hop_ms = 0;
+    const struct option long_options[] =
+    {
+        {"samples", required_argument, NULL, 1},
+        {"period", required_argument, NULL, 2},
+        {"window", required_argument, NULL, 3},
+        {"hop", required_argument, NULL, 4},
+        {NULL, 0, NULL, 0},
+    };
+    
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 1 :
+            {
+                samples = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 2 :
+            {
+                period_ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 3 :
+            {
+                window_ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 4 :
+            {
+                hop_ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            default :
+            {
+                fprintf(stderr, "usage: hdc1080_aggregate_bench [--samples=<num>] [--period=<ms>] [--window=<ms>] [--hop=<ms>]\n");
+                
+                return 1;
+            }
+        }
+    }
+    if ((samples == 0) || (period_ms == 0))
+    {
+        fprintf(stderr, "hdc1080_aggregate_bench: samples and period must not be 0.\n");
+        
+        return 1;
+    }
+    
+    printf("period %ums, summary %u bytes.\n", period_ms, (uint32_t)sizeof(hdc1080_aggregate_summary_t));
+    printf("%-8s  %10s  %8s  %9s  %8s  %11s  %13s  %9s\n", "mode", "window(ms)", "hop(ms)", "samples",
+           "windows", "samples/win", "uplink factor", "ns/sample");
+    if (hop_ms != 0)
+    {
+        return a_run(samples, period_ms, window_ms, hop_ms);
+    }
+    if (a_run(samples, period_ms, window_ms, window_ms) != 0)
+    {
+        return 1;
+    }
+    if ((window_ms % 6) == 0)
+    {
+        return a_run(samples, period_ms, window_ms, window_ms / 6);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,644 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_bus_stress.c
+ * @brief     hdc1080 shared bus stress tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "driver_hdc1080_arbiter.h"
+#include <getopt.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief bus stress tool definition
+ */
+#define BUS_STRESS_CONVERSION_US    7000        /**< simulated conversion time in us */
+#define BUS_STRESS_TRANSFER_US      150         /**< simulated transaction time in us */
+#define BUS_STRESS_MAX_THREADS      64          /**< max threads of one kind */
+
+/**
+ * @brief bus stress tool mode enumeration definition
+ */
+typedef enum
+{
+    BUS_STRESS_MODE_SPLIT  = 0,        /**< handle lock per call, bus lock per transaction */
+    BUS_STRESS_MODE_HOLD   = 1,        /**< bus held across the whole call */
+    BUS_STRESS_MODE_UNSAFE = 2,        /**< nothing is locked */
+} bus_stress_mode_t;
+
+/**
+ * @brief bus stress tool worker structure definition
+ */
+typedef struct bus_stress_worker_s
+{
+    pthread_t thread;              /**< thread */
+    uint32_t done;                 /**< finished operations */
+    uint32_t errors;               /**< failed operations */
+    uint32_t mismatches;           /**< reads with wrong data */
+    uint32_t wait_max_us;          /**< longest wait for the bus of a second device */
+} bus_stress_worker_t;
+
+static hdc1080_handle_t gs_handle;                                             /**< hdc1080 handle shared by all threads */
+static hdc1080_arbiter_t gs_arbiter;                                           /**< arbiter of the simulated bus */
+static pthread_mutex_t gs_bus_mutex = PTHREAD_MUTEX_INITIALIZER;               /**< bus mutex */
+static pthread_mutex_t gs_handle_mutex = PTHREAD_MUTEX_INITIALIZER;            /**< handle mutex */
+static pthread_mutex_t gs_wire = PTHREAD_MUTEX_INITIALIZER;                    /**< taken by the transaction on the wire */
+static pthread_mutex_t gs_count_mutex = PTHREAD_MUTEX_INITIALIZER;             /**< counter mutex */
+static uint32_t gs_collisions;                                                 /**< overlapped transactions */
+static uint32_t gs_naks;                                                       /**< reads before the conversion is finished */
+static uint8_t gs_pending;                                                     /**< triggered register, only changed on the wire */
+static uint32_t gs_ready_us;                                                   /**< end of the conversion, only changed on the wire */
+static uint32_t gs_times = 50;                                                 /**< reads per hdc1080 thread */
+static uint32_t gs_gap_us = 1000;                                              /**< gap between two transactions of a second device */
+static bus_stress_mode_t gs_mode = BUS_STRESS_MODE_SPLIT;                      /**< lock mode */
+static uint8_t gs_stop;                                                        /**< 1 stops the second devices, guarded by the counter mutex */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint32_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     sleep
+ * @param[in] us sleep time in us
+ * @note      none
+ */
+static void a_sleep_us(uint32_t us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (long)(us % 1000000) * 1000;
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief  check the stop flag
+ * @return 1 if the second devices should stop
+ * @note   none
+ */
+static uint8_t a_stopped(void)
+{
+    uint8_t stop;
+    
+    pthread_mutex_lock(&gs_count_mutex);
+    stop = gs_stop;
+    pthread_mutex_unlock(&gs_count_mutex);
+    
+    return stop;
+}
+
+/**
+ * @brief  take the wire for one transaction
+ * @return status code
+ *         - 0 success
+ *         - 1 another transaction is on the wire
+ * @note   an overlap is counted as a collision and the transaction fails
+ */
+static uint8_t a_wire_begin(void)
+{
+    if (pthread_mutex_trylock(&gs_wire) != 0)
+    {
+        pthread_mutex_lock(&gs_count_mutex);
+        gs_collisions++;
+        pthread_mutex_unlock(&gs_count_mutex);
+        
+        return 1;
+    }
+    a_sleep_us(BUS_STRESS_TRANSFER_US);
+    
+    return 0;
+}
+
+/**
+ * @brief mutex try lock
+ * @return status code
+ * @note  none
+ */
+static uint8_t a_bus_try_lock(void)
+{
+    return (pthread_mutex_trylock(&gs_bus_mutex) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief  mutex lock
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_bus_mutex_lock(void)
+{
+    return (pthread_mutex_lock(&gs_bus_mutex) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief mutex unlock
+ * @note  none
+ */
+static void a_bus_mutex_unlock(void)
+{
+    (void)pthread_mutex_unlock(&gs_bus_mutex);
+}
+
+/**
+ * @brief  bus lock hook
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_bus_lock(void)
+{
+    return hdc1080_arbiter_lock(&gs_arbiter);
+}
+
+/**
+ * @brief bus unlock hook
+ * @note  none
+ */
+static void a_bus_unlock(void)
+{
+    (void)hdc1080_arbiter_unlock(&gs_arbiter);
+}
+
+/**
+ * @brief  handle lock hook
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_handle_lock(void)
+{
+    return (pthread_mutex_lock(&gs_handle_mutex) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief handle unlock hook
+ * @note  none
+ */
+static void a_handle_unlock(void)
+{
+    (void)pthread_mutex_unlock(&gs_handle_mutex);
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      get a simulated register
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_reg_get(uint8_t reg, uint8_t *buf)
+{
+    uint16_t v;
+    
+    switch (reg)
+    {
+        case 0x00 : v = 0x6000; break;
+        case 0x01 : v = 0x6500; break;
+        case 0x02 : v = 0x1000; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : return 1;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    (void)addr;
+    if (a_wire_begin() != 0)
+    {
+        return 1;
+    }
+    res = (len == 2) ? a_reg_get(reg, buf) : 1;
+    pthread_mutex_unlock(&gs_wire);
+    
+    return res;
+}
+
+/**
+ * @brief      simulated read with wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       the wire is held across the conversion
+ */
+static uint8_t a_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    (void)addr;
+    if (a_wire_begin() != 0)
+    {
+        return 1;
+    }
+    a_sleep_us(BUS_STRESS_CONVERSION_US);
+    res = (len == 2) ? a_reg_get(reg, buf) : 1;
+    pthread_mutex_unlock(&gs_wire);
+    
+    return res;
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      a pointer write without data triggers a conversion
+ */
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    if (a_wire_begin() != 0)
+    {
+        return 1;
+    }
+    if (len == 0)
+    {
+        gs_pending = reg;
+        gs_ready_us = a_now_us() + BUS_STRESS_CONVERSION_US;
+    }
+    pthread_mutex_unlock(&gs_wire);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       the chip naks until the conversion is finished
+ */
+static uint8_t a_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    (void)addr;
+    if (a_wire_begin() != 0)
+    {
+        return 1;
+    }
+    if ((int32_t)(a_now_us() - gs_ready_us) < 0)
+    {
+        gs_naks++;
+        res = 1;
+    }
+    else if (len == 4)
+    {
+        res = (uint8_t)(a_reg_get(0x00, &buf[0]) | a_reg_get(0x01, &buf[2]));
+    }
+    else
+    {
+        res = (len == 2) ? a_reg_get(gs_pending, buf) : 1;
+    }
+    pthread_mutex_unlock(&gs_wire);
+    
+    return res;
+}
+
+/**
+ * @brief     delay
+ * @param[in] ms delay time
+ * @note      none
+ */
+static void a_delay_ms(uint32_t ms)
+{
+    a_sleep_us(ms * 1000);
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief      hdc1080 thread
+ * @param[in]  *arg pointer to a worker structure
+ * @return     NULL
+ * @note       every thread reads through the one shared handle
+ */
+static void *a_hdc1080_thread(void *arg)
+{
+    bus_stress_worker_t *worker = (bus_stress_worker_t *)arg;
+    uint32_t i;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    for (i = 0; i < gs_times; i++)
+    {
+        if ((i % 2) == 0)
+        {
+            humidity_raw = 0x6500;
+            if (hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature,
+                                                  &humidity_raw, &humidity) != 0)
+            {
+                worker->errors++;
+                
+                continue;
+            }
+        }
+        else
+        {
+            humidity_raw = 0x6500;
+            if (hdc1080_read_temperature(&gs_handle, &temperature_raw, &temperature) != 0)
+            {
+                worker->errors++;
+                
+                continue;
+            }
+        }
+        if ((temperature_raw != 0x6000) || (humidity_raw != 0x6500))
+        {
+            worker->mismatches++;
+        }
+        worker->done++;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief      second device thread
+ * @param[in]  *arg pointer to a worker structure
+ * @return     NULL
+ * @note       it runs short transactions on the same bus until the hdc1080 threads are finished
+ */
+static void *a_other_thread(void *arg)
+{
+    bus_stress_worker_t *worker = (bus_stress_worker_t *)arg;
+    uint32_t start_us;
+    uint32_t wait_us;
+    
+    while (a_stopped() == 0)
+    {
+        start_us = a_now_us();
+        if ((gs_mode != BUS_STRESS_MODE_UNSAFE) && (hdc1080_arbiter_lock(&gs_arbiter) != 0))
+        {
+            worker->errors++;
+            
+            continue;
+        }
+        wait_us = a_now_us() - start_us;
+        if (wait_us > worker->wait_max_us)
+        {
+            worker->wait_max_us = wait_us;
+        }
+        if (a_wire_begin() == 0)
+        {
+            pthread_mutex_unlock(&gs_wire);
+            worker->done++;
+        }
+        else
+        {
+            worker->errors++;
+        }
+        if (gs_mode != BUS_STRESS_MODE_UNSAFE)
+        {
+            (void)hdc1080_arbiter_unlock(&gs_arbiter);
+        }
+        a_sleep_us(gs_gap_us);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed or the bus was corrupted
+ * @note      usage: hdc1080_bus_stress [--threads=<n>] [--others=<n>] [--times=<n>] [--gap=<us>] [--hold | --unsafe]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t threads = 4;
+    uint32_t others = 2;
+    uint32_t start_us;
+    uint32_t elapsed_us;
+    uint32_t reads = 0;
+    uint32_t errors = 0;
+    uint32_t mismatches = 0;
+    uint32_t other_done = 0;
+    uint32_t other_errors = 0;
+    uint32_t other_wait_max_us = 0;
+    hdc1080_arbiter_stats_t stats;
+    static bus_stress_worker_t hdc1080_worker[BUS_STRESS_MAX_THREADS];
+    static bus_stress_worker_t other_worker[BUS_STRESS_MAX_THREADS];
+    const char *const mode_name[] = {"split", "hold", "unsafe"};
+    const struct option long_options[] =
+    {
+        {"threads", required_argument, NULL, 't'},
+        {"others", required_argument, NULL, 'o'},
+        {"times", required_argument, NULL, 'n'},
+        {"gap", required_argument, NULL, 'g'},
+        {"hold", no_argument, NULL, 'h'},
+        {"unsafe", no_argument, NULL, 'u'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 't' : threads = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'o' : others = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'n' : gs_times = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'g' : gs_gap_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'h' : gs_mode = BUS_STRESS_MODE_HOLD; break;
+            case 'u' : gs_mode = BUS_STRESS_MODE_UNSAFE; break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--threads=<n>] [--others=<n>] [--times=<n>] [--gap=<us>] [--hold | --unsafe]\n",
+                        argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if ((threads == 0) || (threads > BUS_STRESS_MAX_THREADS) || (others > BUS_STRESS_MAX_THREADS))
+    {
+        fprintf(stderr, "threads must be 1 - %d and others 0 - %d.\n", BUS_STRESS_MAX_THREADS, BUS_STRESS_MAX_THREADS);
+        
+        return 1;
+    }
+    
+    /* link the simulated bus */
+    (void)hdc1080_arbiter_init(&gs_arbiter, a_bus_try_lock, a_bus_mutex_lock, a_bus_mutex_unlock, a_now_us);
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, a_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, a_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, a_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, a_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, a_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, a_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, a_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, a_debug_print);
+    if (gs_mode == BUS_STRESS_MODE_SPLIT)
+    {
+        DRIVER_HDC1080_LINK_LOCK(&gs_handle, a_handle_lock);
+        DRIVER_HDC1080_LINK_UNLOCK(&gs_handle, a_handle_unlock);
+        DRIVER_HDC1080_LINK_BUS_LOCK(&gs_handle, a_bus_lock);
+        DRIVER_HDC1080_LINK_BUS_UNLOCK(&gs_handle, a_bus_unlock);
+    }
+    else if (gs_mode == BUS_STRESS_MODE_HOLD)
+    {
+        DRIVER_HDC1080_LINK_LOCK(&gs_handle, a_bus_lock);
+        DRIVER_HDC1080_LINK_UNLOCK(&gs_handle, a_bus_unlock);
+    }
+    else
+    {
+        /* nothing is locked */
+    }
+    if (hdc1080_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    (void)hdc1080_arbiter_clear_stats(&gs_arbiter);
+    
+    /* run the threads */
+    printf("mode %s, %u hdc1080 threads x %u reads, %u second devices every %uus.\n", mode_name[gs_mode],
+           threads, gs_times, others, gs_gap_us);
+    start_us = a_now_us();
+    for (i = 0; i < others; i++)
+    {
+        (void)pthread_create(&other_worker[i].thread, NULL, a_other_thread, &other_worker[i]);
+    }
+    for (i = 0; i < threads; i++)
+    {
+        (void)pthread_create(&hdc1080_worker[i].thread, NULL, a_hdc1080_thread, &hdc1080_worker[i]);
+    }
+    for (i = 0; i < threads; i++)
+    {
+        (void)pthread_join(hdc1080_worker[i].thread, NULL);
+        reads += hdc1080_worker[i].done;
+        errors += hdc1080_worker[i].errors;
+        mismatches += hdc1080_worker[i].mismatches;
+    }
+    elapsed_us = a_now_us() - start_us;
+    pthread_mutex_lock(&gs_count_mutex);
+    gs_stop = 1;
+    pthread_mutex_unlock(&gs_count_mutex);
+    for (i = 0; i < others; i++)
+    {
+        (void)pthread_join(other_worker[i].thread, NULL);
+        other_done += other_worker[i].done;
+        other_errors += other_worker[i].errors;
+        if (other_worker[i].wait_max_us > other_wait_max_us)
+        {
+            other_wait_max_us = other_worker[i].wait_max_us;
+        }
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* print the result */
+    (void)hdc1080_arbiter_get_stats(&gs_arbiter, &stats);
+    printf("hdc1080: %u reads in %ums, %u errors, %u mismatches.\n", reads, elapsed_us / 1000, errors, mismatches);
+    printf("second devices: %u transactions, %u errors, longest wait %uus.\n", other_done, other_errors, other_wait_max_us);
+    if (stats.acquisitions != 0)
+    {
+        printf("arbiter: %u acquisitions, %u contended (%0.1f%%), wait avg %uus max %uus, hold avg %uus max %uus.\n",
+               stats.acquisitions, stats.contentions, (double)stats.contentions * 100.0 / stats.acquisitions,
+               (stats.contentions != 0) ? (uint32_t)(stats.wait_total_us / stats.contentions) : 0, stats.wait_max_us,
+               (uint32_t)(stats.hold_total_us / stats.acquisitions), stats.hold_max_us);
+    }
+    printf("bus: %u collisions, %u naks.\n", gs_collisions, gs_naks);
+    
+    return ((gs_collisions != 0) || (errors != 0) || (mismatches != 0) || (other_errors != 0)) ? 1 : 0;
+}
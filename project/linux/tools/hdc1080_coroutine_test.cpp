@@ -0,0 +1,386 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_coroutine_test.cpp
+ * @brief     hdc1080 coroutine test tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_coroutine.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+/**
+ * @brief coroutine test tool definition
+ */
+#define SENSOR_NUM                 256           /**< simulated sensors */
+#define TRANSACTION_US             10            /**< bus time of one transaction */
+#define SLOW_STEP_US               400           /**< extra conversion time of the slow sensors */
+
+/**
+ * @brief coroutine test tool simulated chip structure definition
+ */
+typedef struct sim_chip_s
+{
+    uint16_t config;                 /**< config register */
+    uint16_t temperature_raw;        /**< temperature of the chip */
+    uint16_t humidity_raw;           /**< humidity of the chip */
+    uint32_t conversion_us;          /**< conversion time of the chip */
+    uint64_t ready_us;               /**< end of the conversion */
+    uint8_t converting;              /**< conversion triggered */
+    uint8_t pointer;                 /**< register pointer */
+} sim_chip_t;
+
+static uint64_t gs_now_us;                         /**< virtual time */
+static uint64_t gs_transactions;                   /**< bus transactions */
+static uint64_t gs_naks;                           /**< nacked fetches */
+static sim_chip_t gs_chip[SENSOR_NUM];             /**< simulated chips */
+static hdc1080_handle_t gs_handle[SENSOR_NUM];     /**< driver handles */
+
+/**
+ * @brief  virtual clock
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_now_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief     virtual idle
+ * @param[in] us idle time
+ * @note      it only advances the clock
+ */
+static void a_idle_us(uint64_t us)
+{
+    gs_now_us += us;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  *chip pointer to a chip
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_sim_read(sim_chip_t *chip, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    gs_transactions += 2;
+    gs_now_us += 2 * TRANSACTION_US;
+    switch (reg)
+    {
+        case 0x02 : v = chip->config; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : v = 0x0000; break;
+    }
+    if (len < 2)
+    {
+        return 1;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] *chip pointer to a chip
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      a pointer write to the temperature register triggers the conversion
+ */
+static uint8_t a_sim_write(sim_chip_t *chip, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_transactions += 1;
+    gs_now_us += TRANSACTION_US;
+    chip->pointer = reg;
+    if ((reg == 0x02) && (len == 2))
+    {
+        chip->config = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+        if ((chip->config & (1 << 15)) != 0)
+        {
+            chip->config = 0x1000;
+        }
+    }
+    if ((reg == 0x00) && (len == 0))
+    {
+        chip->converting = 1;
+        chip->ready_us = gs_now_us + chip->conversion_us;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  *chip pointer to a chip
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       naks until the conversion is finished
+ */
+static uint8_t a_sim_read_cmd(sim_chip_t *chip, uint8_t *buf, uint16_t len)
+{
+    gs_transactions += 1;
+    gs_now_us += TRANSACTION_US;
+    if ((chip->converting == 0) || (gs_now_us < chip->ready_us) || (len != 4))
+    {
+        gs_naks++;
+        
+        return 1;
+    }
+    chip->converting = 0;
+    buf[0] = (uint8_t)(chip->temperature_raw >> 8);
+    buf[1] = (uint8_t)(chip->temperature_raw >> 0);
+    buf[2] = (uint8_t)(chip->humidity_raw >> 8);
+    buf[3] = (uint8_t)(chip->humidity_raw >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      blocking, only used by the init
+ */
+static void a_sim_delay_ms(uint32_t ms)
+{
+    gs_now_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_sim_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief simulated bus of one sensor
+ * @note  the interface functions have no context, one instance per sensor gives every handle its own chip
+ */
+template <size_t I>
+struct sim_port
+{
+    static uint8_t init(void) { return 0; }                                                                                          /**< iic init */
+    static uint8_t deinit(void) { return 0; }                                                                                        /**< iic deinit */
+    static uint8_t read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { (void)addr; return a_sim_read(&gs_chip[I], reg, buf, len); }      /**< iic read */
+    static uint8_t write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { (void)addr; return a_sim_write(&gs_chip[I], reg, buf, len); }    /**< iic write */
+    static uint8_t read_cmd(uint8_t addr, uint8_t *buf, uint16_t len) { (void)addr; return a_sim_read_cmd(&gs_chip[I], buf, len); }               /**< iic read command */
+    
+    /**
+     * @brief     link the handle of the sensor
+     * @note      none
+     */
+    static void link(void)
+    {
+        hdc1080_handle_t *handle = &gs_handle[I];
+        
+        DRIVER_HDC1080_LINK_INIT(handle, hdc1080_handle_t);
+        DRIVER_HDC1080_LINK_IIC_INIT(handle, init);
+        DRIVER_HDC1080_LINK_IIC_DEINIT(handle, deinit);
+        DRIVER_HDC1080_LINK_IIC_READ(handle, read);
+        DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(handle, read);
+        DRIVER_HDC1080_LINK_IIC_WRITE(handle, write);
+        DRIVER_HDC1080_LINK_IIC_READ_CMD(handle, read_cmd);
+        DRIVER_HDC1080_LINK_DELAY_MS(handle, a_sim_delay_ms);
+        DRIVER_HDC1080_LINK_DEBUG_PRINT(handle, a_sim_debug_print);
+    }
+};
+
+/**
+ * @brief link all handles
+ * @note  none
+ */
+template <size_t... I>
+static void a_link_all(std::index_sequence<I...>)
+{
+    (sim_port<I>::link(), ...);
+}
+
+/**
+ * @brief coroutine test tool counter structure definition
+ */
+typedef struct counter_s
+{
+    uint32_t ok;               /**< good reads */
+    uint32_t failed;           /**< failed reads */
+    uint32_t mismatch;         /**< wrong values */
+    uint32_t in_flight;        /**< reads in flight */
+    uint32_t in_flight_max;    /**< max reads in flight */
+} counter_t;
+
+/**
+ * @brief     read one sensor
+ * @param[in] &s sensor
+ * @param[in] index sensor index
+ * @param[in] rounds read times
+ * @param[in] *c pointer to the counters
+ * @return    task
+ * @note      none
+ */
+static hdc1080::task<void> a_reader(hdc1080::sensor &s, uint32_t index, uint32_t rounds, counter_t *c)
+{
+    uint32_t i;
+    
+    for (i = 0; i < rounds; i++)
+    {
+        c->in_flight++;
+        if (c->in_flight > c->in_flight_max)
+        {
+            c->in_flight_max = c->in_flight;
+        }
+        hdc1080::result<hdc1080::sample> r = co_await s.read();
+        c->in_flight--;
+        if (!r)
+        {
+            c->failed++;
+            
+            continue;
+        }
+        if ((r.value.temperature_raw != gs_chip[index].temperature_raw) ||
+            (r.value.humidity_raw != gs_chip[index].humidity_raw))
+        {
+            c->mismatch++;
+            
+            continue;
+        }
+        c->ok++;
+        
+        /* the next sample of the chip */
+        gs_chip[index].temperature_raw += 16;
+        gs_chip[index].humidity_raw -= 16;
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      usage: hdc1080_coroutine_test [rounds]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t i;
+    uint32_t rounds = 10;
+    uint32_t retries = 0;
+    uint64_t start_us;
+    uint64_t elapsed_us;
+    uint64_t blocking_us;
+    uint64_t resumed;
+    uint64_t transactions;
+    counter_t c;
+    hdc1080::executor e(a_now_us, a_idle_us);
+    std::vector<std::unique_ptr<hdc1080::sensor>> sensors;
+    
+    /* parse the args */
+    if (argc > 1)
+    {
+        rounds = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+    if (rounds == 0)
+    {
+        fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+        
+        return 1;
+    }
+    
+    /* init the chips, every 8th sensor converts slower than the datasheet time */
+    a_link_all(std::make_index_sequence<SENSOR_NUM>{});
+    for (i = 0; i < SENSOR_NUM; i++)
+    {
+        gs_chip[i].config = 0x1000;
+        gs_chip[i].temperature_raw = (uint16_t)(0x6000 + i * 8);
+        gs_chip[i].humidity_raw = (uint16_t)(0x6500 - i * 8);
+        gs_chip[i].conversion_us = (i % 8 == 7) ? (12850 + (i % 3 + 1) * SLOW_STEP_US) : (11850 + (i % 4) * 250);
+        if (hdc1080_init(&gs_handle[i]) != 0)
+        {
+            fprintf(stderr, "hdc1080: init %u failed.\n", i);
+            
+            return 1;
+        }
+        sensors.push_back(std::make_unique<hdc1080::sensor>(&gs_handle[i], e));
+    }
+    
+    /* read all sensors on one thread */
+    memset(&c, 0, sizeof(c));
+    transactions = gs_transactions;
+    start_us = gs_now_us;
+    for (i = 0; i < SENSOR_NUM; i++)
+    {
+        e.spawn(a_reader(*sensors[i], i, rounds, &c));
+    }
+    resumed = e.run();
+    elapsed_us = gs_now_us - start_us;
+    transactions = gs_transactions - transactions;
+    for (i = 0; i < SENSOR_NUM; i++)
+    {
+        retries += sensors[i]->retries();
+        (void)hdc1080_deinit(&gs_handle[i]);
+    }
+    
+    /* one blocking thread sleeps the conversion of every read */
+    blocking_us = (uint64_t)SENSOR_NUM * rounds * (sensors[0]->conversion_us() + 3 * TRANSACTION_US);
+    printf("%u sensors x %u reads on one thread, conversion wait %uus, bus %uus per transaction.\n",
+           SENSOR_NUM, rounds, sensors[0]->conversion_us(), TRANSACTION_US);
+    printf("reads: %u ok, %u failed, %u mismatches, %u in flight at most.\n", c.ok, c.failed, c.mismatch, c.in_flight_max);
+    printf("bus: %llu transactions, %llu naks, %u fetch retries.\n", (unsigned long long)transactions,
+           (unsigned long long)gs_naks, retries);
+    printf("time: %0.1fms virtual, %llu resumes, a blocking loop takes %0.1fms.\n", elapsed_us / 1000.0,
+           (unsigned long long)resumed, blocking_us / 1000.0);
+    if ((c.ok != SENSOR_NUM * rounds) || (c.in_flight_max != SENSOR_NUM) || (retries == 0) ||
+        (elapsed_us * 4 > blocking_us))
+    {
+        printf("hdc1080: coroutine test failed.\n");
+        
+        return 1;
+    }
+    printf("hdc1080: coroutine test passed.\n");
+    
+    return 0;
+}
@@ -0,0 +1,482 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_cpp_bench.cpp
+ * @brief     hdc1080 c++ driver benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief cpp bench tool definition
+ * @note  build with -DCPP_BENCH_SIZE=1 for a c only and with -DCPP_BENCH_SIZE=2 for a c++ only program to compare the sizes
+ */
+#ifndef CPP_BENCH_SIZE
+    #define CPP_BENCH_SIZE 0
+#endif
+
+static uint32_t gs_transactions;        /**< bus transactions */
+static uint32_t gs_bytes;               /**< bytes on the wire with the address bytes */
+static uint32_t gs_delay_ms;            /**< requested delays */
+static volatile uint8_t gs_noise;       /**< low data byte, volatile so that the reads are not folded */
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a pointer write and a read
+ */
+static uint8_t a_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    (void)addr;
+    gs_transactions += 2;
+    gs_bytes += 3 + len;
+    switch (reg)
+    {
+        case 0x00 : v = 0x6000; break;
+        case 0x01 : v = 0x6500; break;
+        case 0x02 : v = 0x1000; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : v = 0x1234; break;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0) | gs_noise;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      none
+ */
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    gs_transactions += 1;
+    gs_bytes += 2 + len;
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    (void)addr;
+    gs_transactions += 1;
+    gs_bytes += 1 + len;
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (i % 2 == 0) ? 0x60 : gs_noise;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      it only counts
+ */
+static void a_delay_ms(uint32_t ms)
+{
+    gs_delay_ms += ms;
+}
+
+/**
+ * @brief simulated bus policy of the c++ driver
+ */
+struct bench_bus
+{
+    static uint8_t init() { return a_iic_init(); }                                                                        /**< iic init */
+    static uint8_t deinit() { return a_iic_deinit(); }                                                                    /**< iic deinit */
+    static uint8_t read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return a_iic_read(addr, reg, buf, len); }     /**< iic read */
+    static uint8_t write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return a_iic_write(addr, reg, buf, len); }   /**< iic write */
+    static uint8_t read_cmd(uint8_t addr, uint8_t *buf, uint16_t len) { return a_iic_read_cmd(addr, buf, len); }          /**< iic read command */
+    static void delay_ms(uint32_t ms) { a_delay_ms(ms); }                                                                 /**< delay */
+};
+
+/**
+ * @brief cpp bench tool sequence configuration
+ */
+using bench_config = hdc1080::config<HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+                                     HDC1080_HUMIDITY_RESOLUTION_14_BIT, HDC1080_BOOL_FALSE>;
+
+/**
+ * @brief cpp bench tool result structure definition
+ */
+struct bench_result
+{
+    uint32_t init_transactions;        /**< transactions of the init and the config */
+    uint32_t read_transactions;        /**< transactions per read */
+    uint32_t read_bytes;               /**< bytes per read */
+    uint32_t read_delay_ms;            /**< delays per read */
+    double read_ns;                    /**< host time per read */
+    float temperature;                 /**< last temperature */
+};
+
+/**
+ * @brief     compiler barrier
+ * @param[in] *p pointer to the result of one iteration
+ * @note      the result escapes and memory is clobbered, so the timed loops are neither folded nor hoisted
+ */
+static inline void a_barrier(const void *p)
+{
+    __asm__ __volatile__("" : : "r"(p) : "memory");
+}
+
+#if (CPP_BENCH_SIZE != 2)
+/**
+ * @brief      simulated read with wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a pointer write, the conversion wait and a read
+ */
+static uint8_t a_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    a_delay_ms(7);
+    
+    return a_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     link the simulated bus
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      none
+ */
+static void a_link(hdc1080_handle_t *handle)
+{
+    DRIVER_HDC1080_LINK_INIT(handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_IIC_INIT(handle, a_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(handle, a_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(handle, a_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(handle, a_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(handle, a_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(handle, a_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(handle, a_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(handle, a_debug_print);
+}
+
+/**
+ * @brief      init and configure with the c driver
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the usual init of a c application
+ */
+static uint8_t a_c_init(hdc1080_handle_t *handle)
+{
+    a_link(handle);
+    if ((hdc1080_init(handle) != 0) ||
+        (hdc1080_set_mode(handle, bench_config::mode) != 0) ||
+        (hdc1080_set_temperature_resolution(handle, bench_config::temperature_resolution) != 0) ||
+        (hdc1080_set_humidity_resolution(handle, bench_config::humidity_resolution) != 0) ||
+        (hdc1080_set_heater(handle, bench_config::heater) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+#endif
+
+#if (CPP_BENCH_SIZE == 0)
+/**
+ * @brief  reset the counters
+ * @note   none
+ */
+static void a_reset(void)
+{
+    gs_transactions = 0;
+    gs_bytes = 0;
+    gs_delay_ms = 0;
+}
+
+/**
+ * @brief      run the c driver
+ * @param[in]  times read times
+ * @param[in]  split 1 uses the start and fetch api
+ * @param[out] *r pointer to a result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_run_c(uint32_t times, uint8_t split, bench_result *r)
+{
+    hdc1080_handle_t handle;
+    uint32_t i;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature = 0.0f;
+    float humidity;
+    
+    a_reset();
+    if (a_c_init(&handle) != 0)
+    {
+        return 1;
+    }
+    r->init_transactions = gs_transactions;
+    a_reset();
+    auto start = std::chrono::steady_clock::now();
+    for (i = 0; i < times; i++)
+    {
+        if (split != 0)
+        {
+            if (hdc1080_start_temperature_humidity(&handle) != 0)
+            {
+                return 1;
+            }
+            a_delay_ms(bench_config::sequence_ms);
+            if (hdc1080_fetch_temperature_humidity(&handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            if (hdc1080_read_temperature_humidity(&handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0)
+            {
+                return 1;
+            }
+        }
+        a_barrier(&temperature);
+        a_barrier(&humidity);
+    }
+    auto end = std::chrono::steady_clock::now();
+    r->read_transactions = gs_transactions / times;
+    r->read_bytes = gs_bytes / times;
+    r->read_delay_ms = gs_delay_ms / times;
+    r->read_ns = std::chrono::duration<double, std::nano>(end - start).count() / times;
+    r->temperature = temperature;
+    (void)hdc1080_deinit(&handle);
+    
+    return 0;
+}
+
+/**
+ * @brief      run the c++ driver
+ * @param[in]  times read times
+ * @param[out] *r pointer to a result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_run_cpp(uint32_t times, bench_result *r)
+{
+    uint32_t i;
+    
+    a_reset();
+    hdc1080::device<bench_bus, bench_config> device;
+    if (!device)
+    {
+        return 1;
+    }
+    r->init_transactions = gs_transactions;
+    a_reset();
+    auto start = std::chrono::steady_clock::now();
+    for (i = 0; i < times; i++)
+    {
+        auto sample = device.read();
+        if (!sample)
+        {
+            return 1;
+        }
+        a_barrier(&sample);
+        r->temperature = sample.value.temperature;
+    }
+    auto end = std::chrono::steady_clock::now();
+    r->read_transactions = gs_transactions / times;
+    r->read_bytes = gs_bytes / times;
+    r->read_delay_ms = gs_delay_ms / times;
+    r->read_ns = std::chrono::duration<double, std::nano>(end - start).count() / times;
+    
+    return 0;
+}
+
+/**
+ * @brief     print a result
+ * @param[in] *name pointer to a name buffer
+ * @param[in] *r pointer to a result
+ * @note      none
+ */
+static void a_print(const char *name, const bench_result *r)
+{
+    printf("%-22s %16u %18u %14u %13u %11.1f %10.2f\n", name, r->init_transactions, r->read_transactions,
+           r->read_bytes, r->read_delay_ms, r->read_ns, r->temperature);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_cpp_bench [times]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t times = 1000000;
+    bench_result c_read = {};
+    bench_result c_split = {};
+    bench_result cpp_read = {};
+    
+    /* parse the args */
+    if (argc > 1)
+    {
+        times = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+    if (times == 0)
+    {
+        fprintf(stderr, "usage: %s [times]\n", argv[0]);
+        
+        return 1;
+    }
+    
+    /* run the drivers */
+    if ((a_run_c(times, 0, &c_read) != 0) || (a_run_c(times, 1, &c_split) != 0) || (a_run_cpp(times, &cpp_read) != 0))
+    {
+        fprintf(stderr, "run failed.\n");
+        
+        return 1;
+    }
+    printf("%u reads, sequence mode, 14 bit, config word 0x%04X, wait %ums.\n", times, bench_config::word,
+           hdc1080::device<bench_bus, bench_config>::conversion_ms());
+    printf("driver                 init transactions  read transactions  read bytes  read delay(ms)  host(ns)  temperature\n");
+    a_print("c read", &c_read);
+    a_print("c start and fetch", &c_split);
+    a_print("c++ read", &cpp_read);
+    
+    return 0;
+}
+#elif (CPP_BENCH_SIZE == 1)
+/**
+ * @brief  c only program
+ * @return status code
+ * @note   it inits, configures and reads once
+ */
+int main(void)
+{
+    hdc1080_handle_t handle;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    if ((a_c_init(&handle) != 0) ||
+        (hdc1080_read_temperature_humidity(&handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0))
+    {
+        return 1;
+    }
+    (void)hdc1080_deinit(&handle);
+    
+    return (int)temperature_raw;
+}
+#else
+/**
+ * @brief  c++ only program
+ * @return status code
+ * @note   it inits, configures and reads once
+ */
+int main(void)
+{
+    hdc1080::device<bench_bus, bench_config> device;
+    
+    auto sample = device.read();
+    if (!sample)
+    {
+        return 1;
+    }
+    
+    return (int)sample.value.temperature_raw;
+}
+#endif
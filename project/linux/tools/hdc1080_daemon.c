@@ -0,0 +1,1121 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_daemon.c
+ * @brief     hdc1080 multi bus polling daemon
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "driver_hdc1080.h"
+#include "hdc1080_shm.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <linux/i2c-dev.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief daemon tool definition
+ */
+#define DAEMON_MAX_BUS             16          /**< max buses */
+#define DAEMON_FETCH_RETRY         3           /**< fetch retries after the conversion time */
+#define DAEMON_RETRY_US            1000        /**< wait before a fetch retry */
+#define DAEMON_RESET_MS            100         /**< reset time of the chip */
+
+/**
+ * @brief daemon tool sensor state enumeration definition
+ */
+typedef enum
+{
+    DAEMON_STATE_TRIGGER = 0,        /**< next transaction triggers a conversion */
+    DAEMON_STATE_FETCH   = 1,        /**< next transaction fetches the conversion */
+} daemon_state_t;
+
+/**
+ * @brief daemon tool record structure definition
+ * @note  one entry of the result table per sensor
+ */
+typedef struct daemon_record_s
+{
+    uint64_t timestamp_us;           /**< time of the last good fetch */
+    uint32_t reads;                  /**< good reads */
+    uint32_t errors;                 /**< failed reads */
+    uint16_t temperature_raw;        /**< raw temperature */
+    uint16_t humidity_raw;           /**< raw humidity */
+    float temperature;               /**< converted temperature in C */
+    float humidity;                  /**< converted humidity in % */
+    uint8_t status;                  /**< status code of the last read */
+} daemon_record_t;
+
+/**
+ * @brief daemon tool sensor structure definition
+ */
+typedef struct daemon_sensor_s
+{
+    uint64_t due_us;                 /**< time of the next transaction */
+    uint64_t period_us;              /**< start of the current period */
+    uint64_t sequence;               /**< fifo order of the same due time */
+    uint32_t bus;                    /**< bus index */
+    uint8_t mux;                     /**< 7 bit mux address, 0 if none */
+    uint8_t channel;                 /**< mux channel */
+    uint8_t state;                   /**< daemon_state_t */
+    uint8_t retry;                   /**< fetch retries of the current read */
+    uint32_t conversion_us;          /**< simulated conversion time */
+    uint64_t ready_us;               /**< simulated end of the conversion */
+    uint16_t config;                 /**< simulated config register */
+    uint8_t serial_id[6];            /**< serial id, the key of the shared memory table */
+} daemon_sensor_t;
+
+/**
+ * @brief daemon tool bus structure definition
+ * @note  the queue is a min heap of the sensors ordered by the time of their next transaction
+ */
+typedef struct daemon_bus_s
+{
+    char path[64];                   /**< i2c-dev path */
+    int fd;                          /**< i2c-dev file */
+    int timer;                       /**< timerfd of the next deadline */
+    uint8_t slave;                   /**< selected 7 bit address */
+    uint8_t mux;                     /**< selected mux */
+    uint8_t channel;                 /**< selected mux channel */
+    hdc1080_handle_t handle;         /**< driver handle of the bus */
+    uint32_t *queue;                 /**< transaction queue */
+    uint32_t queue_len;              /**< queued sensors */
+    uint32_t sensors;                /**< sensors of the bus */
+    uint64_t wakeups;                /**< timer wakeups */
+    uint64_t transactions;           /**< wire transactions */
+    uint64_t naks;                   /**< nacked fetches */
+    uint64_t late_max_us;            /**< latest transaction after its deadline */
+    uint64_t late_total_us;          /**< sum of the lateness */
+    uint64_t handled;                /**< handled queue entries */
+    uint64_t missed;                 /**< periods skipped by a late read */
+} daemon_bus_t;
+
+static daemon_bus_t gs_bus[DAEMON_MAX_BUS];        /**< buses */
+static uint32_t gs_bus_num;                        /**< bus number */
+static daemon_sensor_t *gs_sensor;                 /**< sensors */
+static daemon_record_t *gs_table;                  /**< shared result table */
+static uint32_t gs_sensor_num;                     /**< sensor number */
+static daemon_sensor_t *gs_current;                /**< sensor of the current driver call */
+static uint8_t gs_sim;                             /**< 1 uses the simulated bus */
+static uint32_t gs_init_delay_ms;                  /**< longest delay requested during the init */
+static uint64_t gs_sequence;                       /**< queue sequence */
+static hdc1080_shm_t gs_shm;                       /**< shared memory table */
+static uint8_t gs_shm_enable;                      /**< 1 publishes the results to the shared memory table */
+static uint32_t gs_wait_us;                        /**< conversion wait of the sequence */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     compare two queued sensors
+ * @param[in] a first sensor index
+ * @param[in] b second sensor index
+ * @return    1 if a is due before b
+ * @note      none
+ */
+static uint8_t a_before(uint32_t a, uint32_t b)
+{
+    if (gs_sensor[a].due_us != gs_sensor[b].due_us)
+    {
+        return gs_sensor[a].due_us < gs_sensor[b].due_us;
+    }
+    
+    return gs_sensor[a].sequence < gs_sensor[b].sequence;
+}
+
+/**
+ * @brief     queue a transaction of a sensor
+ * @param[in] *bus pointer to a bus
+ * @param[in] index sensor index
+ * @param[in] due_us time of the transaction
+ * @note      none
+ */
+static void a_queue_push(daemon_bus_t *bus, uint32_t index, uint64_t due_us)
+{
+    uint32_t i;
+    uint32_t parent;
+    
+    gs_sensor[index].due_us = due_us;
+    gs_sensor[index].sequence = gs_sequence++;
+    i = bus->queue_len++;
+    bus->queue[i] = index;
+    while (i > 0)
+    {
+        parent = (i - 1) / 2;
+        if (a_before(bus->queue[parent], bus->queue[i]) != 0)
+        {
+            break;
+        }
+        bus->queue[i] = bus->queue[parent];
+        bus->queue[parent] = index;
+        i = parent;
+    }
+}
+
+/**
+ * @brief     remove the first transaction
+ * @param[in] *bus pointer to a bus
+ * @return    sensor index
+ * @note      the queue must not be empty
+ */
+static uint32_t a_queue_pop(daemon_bus_t *bus)
+{
+    uint32_t first = bus->queue[0];
+    uint32_t i = 0;
+    uint32_t child;
+    uint32_t t;
+    
+    bus->queue[0] = bus->queue[--bus->queue_len];
+    while (1)
+    {
+        child = 2 * i + 1;
+        if (child >= bus->queue_len)
+        {
+            break;
+        }
+        if ((child + 1 < bus->queue_len) && (a_before(bus->queue[child + 1], bus->queue[child]) != 0))
+        {
+            child++;
+        }
+        if (a_before(bus->queue[i], bus->queue[child]) != 0)
+        {
+            break;
+        }
+        t = bus->queue[i];
+        bus->queue[i] = bus->queue[child];
+        bus->queue[child] = t;
+        i = child;
+    }
+    
+    return first;
+}
+
+/**
+ * @brief     arm the timer of a bus
+ * @param[in] *bus pointer to a bus
+ * @note      the timer expires at the first deadline of the queue
+ */
+static void a_arm(daemon_bus_t *bus)
+{
+    struct itimerspec its;
+    uint64_t due_us;
+    
+    memset(&its, 0, sizeof(its));
+    if (bus->queue_len == 0)
+    {
+        (void)timerfd_settime(bus->timer, TFD_TIMER_ABSTIME, &its, NULL);
+        
+        return;
+    }
+    due_us = gs_sensor[bus->queue[0]].due_us;
+    its.it_value.tv_sec = (time_t)(due_us / 1000000);
+    its.it_value.tv_nsec = (long)(due_us % 1000000) * 1000;
+    if ((its.it_value.tv_sec == 0) && (its.it_value.tv_nsec == 0))
+    {
+        its.it_value.tv_nsec = 1;
+    }
+    (void)timerfd_settime(bus->timer, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+/**
+ * @brief     select a slave on the bus of the current sensor
+ * @param[in] *bus pointer to a bus
+ * @param[in] slave 7 bit address
+ * @return    status code
+ *            - 0 success
+ *            - 1 select failed
+ * @note      none
+ */
+static uint8_t a_dev_slave(daemon_bus_t *bus, uint8_t slave)
+{
+    if (bus->slave == slave)
+    {
+        return 0;
+    }
+    if (ioctl(bus->fd, I2C_SLAVE, slave) < 0)
+    {
+        return 1;
+    }
+    bus->slave = slave;
+    
+    return 0;
+}
+
+/**
+ * @brief  route the bus to the current sensor
+ * @return status code
+ *         - 0 success
+ *         - 1 route failed
+ * @note   an open channel of another mux on the same bus is closed first, all chips share one address
+ */
+static uint8_t a_dev_route(void)
+{
+    daemon_bus_t *bus = &gs_bus[gs_current->bus];
+    uint8_t data;
+    
+    if ((bus->mux == gs_current->mux) && (bus->channel == gs_current->channel))
+    {
+        return 0;
+    }
+    if ((bus->mux != 0) && (bus->mux != gs_current->mux))
+    {
+        data = 0x00;
+        if ((a_dev_slave(bus, bus->mux) != 0) || (write(bus->fd, &data, 1) != 1))
+        {
+            return 1;
+        }
+        bus->transactions++;
+    }
+    if (gs_current->mux != 0)
+    {
+        data = (uint8_t)(1 << gs_current->channel);
+        if ((a_dev_slave(bus, gs_current->mux) != 0) || (write(bus->fd, &data, 1) != 1))
+        {
+            bus->mux = 0;
+            
+            return 1;
+        }
+        bus->transactions++;
+    }
+    bus->mux = gs_current->mux;
+    bus->channel = gs_current->channel;
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated register read of the current sensor
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @note       none
+ */
+static void a_sim_read(uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    switch (reg)
+    {
+        case 0x02 : v = gs_current->config; break;
+        case 0xFB : v = 0x1080; break;
+        case 0xFC : v = (uint16_t)((gs_current - gs_sensor) >> 9); break;
+        case 0xFD : v = (uint16_t)(((gs_current - gs_sensor) & 0x1FF) << 7); break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : v = 0x0000; break;
+    }
+    if (len >= 2)
+    {
+        buf[0] = (uint8_t)(v >> 8);
+        buf[1] = (uint8_t)(v >> 0);
+    }
+}
+
+/**
+ * @brief  iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   opens the bus of the current sensor once
+ */
+static uint8_t a_iic_init(void)
+{
+    daemon_bus_t *bus = &gs_bus[gs_current->bus];
+    
+    if ((gs_sim != 0) || (bus->fd >= 0))
+    {
+        return 0;
+    }
+    bus->fd = open(bus->path, O_RDWR | O_CLOEXEC);
+    if (bus->fd < 0)
+    {
+        fprintf(stderr, "hdc1080_daemon: open %s failed, %s.\n", bus->path, strerror(errno));
+        
+        return 1;
+    }
+    bus->slave = 0;
+    bus->mux = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief  iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   the buses are closed by the daemon
+ */
+static uint8_t a_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    daemon_bus_t *bus = &gs_bus[gs_current->bus];
+    
+    bus->transactions += 2;
+    if (gs_sim != 0)
+    {
+        a_sim_read(reg, buf, len);
+        
+        return 0;
+    }
+    if ((a_dev_route() != 0) || (a_dev_slave(bus, addr >> 1) != 0) ||
+        (write(bus->fd, &reg, 1) != 1) || (read(bus->fd, buf, len) != (ssize_t)len))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read with wait
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       only used by the blocking api, the daemon never calls it
+ */
+static uint8_t a_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief     iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a pointer write to the temperature register triggers a conversion
+ */
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    daemon_bus_t *bus = &gs_bus[gs_current->bus];
+    uint8_t data[3];
+    
+    bus->transactions++;
+    if (gs_sim != 0)
+    {
+        if ((reg == 0x02) && (len == 2))
+        {
+            gs_current->config = ((buf[0] & 0x80) != 0) ? 0x1000 : (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+        }
+        if ((reg == 0x00) && (len == 0))
+        {
+            gs_current->ready_us = a_now_us() + gs_current->conversion_us;
+        }
+        
+        return 0;
+    }
+    if (len > 2)
+    {
+        return 1;
+    }
+    data[0] = reg;
+    if (len > 0)
+    {
+        memcpy(&data[1], buf, len);
+    }
+    if ((a_dev_route() != 0) || (a_dev_slave(bus, addr >> 1) != 0) ||
+        (write(bus->fd, data, len + 1) != (ssize_t)(len + 1)))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the chip naks before the conversion is finished
+ */
+static uint8_t a_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    daemon_bus_t *bus = &gs_bus[gs_current->bus];
+    uint32_t index = (uint32_t)(gs_current - gs_sensor);
+    uint16_t t;
+    uint16_t h;
+    
+    bus->transactions++;
+    if (gs_sim != 0)
+    {
+        if ((gs_current->ready_us == 0) || (a_now_us() < gs_current->ready_us) || (len != 4))
+        {
+            return 1;
+        }
+        gs_current->ready_us = 0;
+        t = (uint16_t)(0x6000 + (index % 64) * 16 + gs_table[index].reads % 32);
+        h = (uint16_t)(0x6500 - (index % 64) * 16 - gs_table[index].reads % 32);
+        buf[0] = (uint8_t)(t >> 8);
+        buf[1] = (uint8_t)(t >> 0);
+        buf[2] = (uint8_t)(h >> 8);
+        buf[3] = (uint8_t)(h >> 0);
+        
+        return 0;
+    }
+    if ((a_dev_route() != 0) || (a_dev_slave(bus, addr >> 1) != 0) || (read(bus->fd, buf, len) != (ssize_t)len))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     delay
+ * @param[in] ms delay time in ms
+ * @note      only the init delays, the reset times of all chips overlap and are slept once after the init
+ */
+static void a_delay_ms(uint32_t ms)
+{
+    if (ms > gs_init_delay_ms)
+    {
+        gs_init_delay_ms = ms;
+    }
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     run the due transactions of a bus
+ * @param[in] *bus pointer to a bus
+ * @param[in] period_us read period
+ * @note      a trigger queues the fetch after the conversion time, a fetch stores the result and queues the next trigger
+ */
+static void a_bus_run(daemon_bus_t *bus, uint64_t period_us)
+{
+    uint32_t index;
+    uint64_t now;
+    uint64_t late;
+    uint64_t next;
+    uint8_t res;
+    daemon_sensor_t *s;
+    daemon_record_t *r;
+    
+    now = a_now_us();
+    while ((bus->queue_len != 0) && (gs_sensor[bus->queue[0]].due_us <= now))
+    {
+        index = a_queue_pop(bus);
+        s = &gs_sensor[index];
+        r = &gs_table[index];
+        late = now - s->due_us;
+        bus->late_total_us += late;
+        bus->handled++;
+        if (late > bus->late_max_us)
+        {
+            bus->late_max_us = late;
+        }
+        gs_current = s;
+        if (s->state == DAEMON_STATE_TRIGGER)
+        {
+            s->period_us = s->due_us;
+            s->retry = 0;
+            res = hdc1080_start_temperature_humidity(&bus->handle);
+            if (res == 0)
+            {
+                s->state = DAEMON_STATE_FETCH;
+                a_queue_push(bus, index, now + gs_wait_us);
+                
+                continue;
+            }
+        }
+        else
+        {
+            res = hdc1080_fetch_temperature_humidity(&bus->handle, &r->temperature_raw, &r->temperature,
+                                                     &r->humidity_raw, &r->humidity);
+            if ((res == 1) && (s->retry < DAEMON_FETCH_RETRY))
+            {
+                bus->naks++;
+                s->retry++;
+                a_queue_push(bus, index, now + DAEMON_RETRY_US);
+                
+                continue;
+            }
+            if (res == 0)
+            {
+                r->timestamp_us = now;
+                r->reads++;
+            }
+        }
+        if (res != 0)
+        {
+            r->errors++;
+        }
+        r->status = res;
+        if (gs_shm_enable != 0)
+        {
+            hdc1080_shm_sample_t sample;
+            
+            sample.timestamp_ms = r->timestamp_us / 1000;
+            sample.temperature_raw = r->temperature_raw;
+            sample.humidity_raw = r->humidity_raw;
+            sample.temperature = r->temperature;
+            sample.humidity = r->humidity;
+            sample.reads = r->reads;
+            sample.errors = r->errors;
+            sample.status = res;
+            (void)hdc1080_shm_publish(&gs_shm, s->serial_id, &sample);
+        }
+        
+        /* the next period, skipped periods are counted */
+        s->state = DAEMON_STATE_TRIGGER;
+        next = s->period_us + period_us;
+        while (next <= now)
+        {
+            next += period_us;
+            bus->missed++;
+        }
+        a_queue_push(bus, index, next);
+    }
+    a_arm(bus);
+}
+
+/**
+ * @brief     add a sensor
+ * @param[in] *path pointer to an i2c-dev path
+ * @param[in] mux 7 bit mux address, 0 if none
+ * @param[in] channel mux channel
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_add(const char *path, uint8_t mux, uint8_t channel)
+{
+    uint32_t i;
+    daemon_sensor_t *sensor;
+    daemon_record_t *table;
+    
+    for (i = 0; i < gs_bus_num; i++)
+    {
+        if (strcmp(gs_bus[i].path, path) == 0)
+        {
+            break;
+        }
+    }
+    if (i == gs_bus_num)
+    {
+        if ((gs_bus_num == DAEMON_MAX_BUS) || (strlen(path) >= sizeof(gs_bus[i].path)))
+        {
+            return 1;
+        }
+        strcpy(gs_bus[i].path, path);
+        gs_bus[i].fd = -1;
+        gs_bus[i].timer = -1;
+        gs_bus_num++;
+    }
+    if (channel > 7)
+    {
+        return 1;
+    }
+    sensor = realloc(gs_sensor, (gs_sensor_num + 1) * sizeof(daemon_sensor_t));
+    if (sensor == NULL)
+    {
+        return 1;
+    }
+    gs_sensor = sensor;
+    table = realloc(gs_table, (gs_sensor_num + 1) * sizeof(daemon_record_t));
+    if (table == NULL)
+    {
+        return 1;
+    }
+    gs_table = table;
+    memset(&gs_sensor[gs_sensor_num], 0, sizeof(daemon_sensor_t));
+    memset(&gs_table[gs_sensor_num], 0, sizeof(daemon_record_t));
+    gs_sensor[gs_sensor_num].bus = i;
+    gs_sensor[gs_sensor_num].mux = mux;
+    gs_sensor[gs_sensor_num].channel = channel;
+    gs_sensor[gs_sensor_num].config = 0x1000;
+    gs_sensor[gs_sensor_num].conversion_us = 11850 + (gs_sensor_num % 4) * 250 +
+                                             ((gs_sensor_num % 16 == 15) ? 1500 : 0);
+    gs_bus[i].sensors++;
+    gs_sensor_num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     load the sensor list
+ * @param[in] *name pointer to a file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      one sensor per line: <i2c-dev path> <mux address or 0> <channel>, # starts a comment
+ */
+static uint8_t a_load(const char *name)
+{
+    FILE *fp;
+    char line[128];
+    char path[64];
+    unsigned int mux;
+    unsigned int channel;
+    uint32_t n = 0;
+    
+    fp = fopen(name, "r");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "hdc1080_daemon: open %s failed.\n", name);
+        
+        return 1;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        n++;
+        if ((line[0] == '#') || (line[0] == '\n'))
+        {
+            continue;
+        }
+        if ((sscanf(line, "%63s %i %u", path, &mux, &channel) != 3) || (mux > 0x7F) ||
+            (a_add(path, (uint8_t)mux, (uint8_t)channel) != 0))
+        {
+            fprintf(stderr, "hdc1080_daemon: %s:%u is invalid.\n", name, n);
+            fclose(fp);
+            
+            return 1;
+        }
+    }
+    fclose(fp);
+    
+    return 0;
+}
+
+/**
+ * @brief     print the statistics
+ * @param[in] elapsed_us run time
+ * @note      none
+ */
+static void a_report(uint64_t elapsed_us)
+{
+    uint32_t i;
+    uint64_t reads = 0;
+    uint64_t errors = 0;
+    uint64_t wakeups = 0;
+    uint64_t transactions = 0;
+    uint64_t naks = 0;
+    uint64_t missed = 0;
+    uint64_t late_max_us = 0;
+    uint64_t late_total_us = 0;
+    uint64_t handled = 0;
+    uint64_t cpu_us;
+    struct rusage usage;
+    
+    for (i = 0; i < gs_sensor_num; i++)
+    {
+        reads += gs_table[i].reads;
+        errors += gs_table[i].errors;
+    }
+    for (i = 0; i < gs_bus_num; i++)
+    {
+        wakeups += gs_bus[i].wakeups;
+        transactions += gs_bus[i].transactions;
+        naks += gs_bus[i].naks;
+        missed += gs_bus[i].missed;
+        late_total_us += gs_bus[i].late_total_us;
+        handled += gs_bus[i].handled;
+        if (gs_bus[i].late_max_us > late_max_us)
+        {
+            late_max_us = gs_bus[i].late_max_us;
+        }
+    }
+    (void)getrusage(RUSAGE_SELF, &usage);
+    cpu_us = (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+             (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+    printf("%0.1fs: %llu reads, %llu errors, %llu missed periods, %llu naks, %llu transactions, %llu wakeups.\n",
+           elapsed_us / 1000000.0, (unsigned long long)reads, (unsigned long long)errors, (unsigned long long)missed,
+           (unsigned long long)naks, (unsigned long long)transactions, (unsigned long long)wakeups);
+    printf("lateness avg %0.1fus max %lluus, cpu %0.1f%% of one core, %0.2fus per read.\n",
+           (handled != 0) ? (double)late_total_us / handled : 0.0,
+           (unsigned long long)late_max_us, (elapsed_us != 0) ? cpu_us * 100.0 / elapsed_us : 0.0,
+           (reads != 0) ? (double)cpu_us / reads : 0.0);
+    fflush(stdout);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_daemon (--config=<file> | --sim=<buses>x<sensors>) [--period=<ms>] [--duration=<s>]
+ *                   [--report=<s>] [--table] [--shm=<name>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int i;
+    int n;
+    int ep;
+    int sig;
+    int report = -1;
+    int stop = -1;
+    uint32_t humidity_us;
+    uint32_t j;
+    uint32_t k;
+    uint32_t buses;
+    uint32_t sensors;
+    uint32_t period_ms = 1000;
+    uint32_t duration_s = 0;
+    uint32_t report_s = 0;
+    uint8_t table = 0;
+    uint8_t running = 1;
+    uint8_t res = 0;
+    uint64_t start_us;
+    uint64_t expirations;
+    const char *config = NULL;
+    const char *shm = NULL;
+    char path[64];
+    sigset_t mask;
+    struct itimerspec its;
+    struct epoll_event ev;
+    struct epoll_event events[DAEMON_MAX_BUS + 3];
+    const struct option long_options[] =
+    {
+        {"config", required_argument, NULL, 'c'},
+        {"sim", required_argument, NULL, 's'},
+        {"period", required_argument, NULL, 'p'},
+        {"duration", required_argument, NULL, 'd'},
+        {"report", required_argument, NULL, 'r'},
+        {"table", no_argument, NULL, 't'},
+        {"shm", required_argument, NULL, 'm'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' : config = optarg; break;
+            case 's' :
+            {
+                if ((sscanf(optarg, "%ux%u", &buses, &sensors) != 2) || (buses == 0) || (buses > DAEMON_MAX_BUS) ||
+                    (sensors == 0))
+                {
+                    fprintf(stderr, "hdc1080_daemon: sim must be 1 - %d buses x sensors.\n", DAEMON_MAX_BUS);
+                    
+                    return 1;
+                }
+                gs_sim = 1;
+                for (j = 0; j < buses; j++)
+                {
+                    (void)snprintf(path, sizeof(path), "sim%u", j);
+                    for (k = 0; k < sensors; k++)
+                    {
+                        if (a_add(path, (uint8_t)(0x70 + (k / 8) % 8), (uint8_t)(k % 8)) != 0)
+                        {
+                            fprintf(stderr, "hdc1080_daemon: no memory.\n");
+                            
+                            return 1;
+                        }
+                    }
+                }
+                break;
+            }
+            case 'p' : period_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'd' : duration_s = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r' : report_s = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 't' : table = 1; break;
+            case 'm' : shm = optarg; break;
+            default :
+            {
+                fprintf(stderr, "usage: %s (--config=<file> | --sim=<buses>x<sensors>) [--period=<ms>] [--duration=<s>] "
+                        "[--report=<s>] [--table] [--shm=<name>]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if (((config == NULL) == (gs_sim == 0)) || ((config != NULL) && (a_load(config) != 0)) || (gs_sensor_num == 0) ||
+        (period_ms < 20))
+    {
+        fprintf(stderr, "hdc1080_daemon: one of --config and --sim with sensors and a period of at least 20ms is needed.\n");
+        
+        return 1;
+    }
+    
+    /* init every chip through the handle of its bus */
+    for (j = 0; j < gs_bus_num; j++)
+    {
+        DRIVER_HDC1080_LINK_INIT(&gs_bus[j].handle, hdc1080_handle_t);
+        DRIVER_HDC1080_LINK_IIC_INIT(&gs_bus[j].handle, a_iic_init);
+        DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_bus[j].handle, a_iic_deinit);
+        DRIVER_HDC1080_LINK_IIC_READ(&gs_bus[j].handle, a_iic_read);
+        DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_bus[j].handle, a_iic_read_with_wait);
+        DRIVER_HDC1080_LINK_IIC_WRITE(&gs_bus[j].handle, a_iic_write);
+        DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_bus[j].handle, a_iic_read_cmd);
+        DRIVER_HDC1080_LINK_DELAY_MS(&gs_bus[j].handle, a_delay_ms);
+        DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_bus[j].handle, a_debug_print);
+        gs_bus[j].queue = malloc(gs_bus[j].sensors * sizeof(uint32_t));
+        if (gs_bus[j].queue == NULL)
+        {
+            fprintf(stderr, "hdc1080_daemon: no memory.\n");
+            
+            return 1;
+        }
+    }
+    for (j = 0; j < gs_sensor_num; j++)
+    {
+        gs_current = &gs_sensor[j];
+        if (hdc1080_init(&gs_bus[gs_sensor[j].bus].handle) != 0)
+        {
+            fprintf(stderr, "hdc1080_daemon: init sensor %u on %s mux 0x%02X channel %u failed.\n", j,
+                    gs_bus[gs_sensor[j].bus].path, gs_sensor[j].mux, gs_sensor[j].channel);
+            
+            return 1;
+        }
+        if ((shm != NULL) && (hdc1080_get_serial_id(&gs_bus[gs_sensor[j].bus].handle, gs_sensor[j].serial_id) != 0))
+        {
+            fprintf(stderr, "hdc1080_daemon: read the serial id of sensor %u failed.\n", j);
+            
+            return 1;
+        }
+    }
+    usleep(gs_init_delay_ms * 1000);
+    
+    /* the results are published by serial id, readers map the segment with hdc1080_shm_open */
+    if (shm != NULL)
+    {
+        if (hdc1080_shm_create(&gs_shm, shm, gs_sensor_num) != 0)
+        {
+            fprintf(stderr, "hdc1080_daemon: create shared memory %s failed.\n", shm);
+            
+            return 1;
+        }
+        gs_shm_enable = 1;
+    }
+    (void)hdc1080_get_conversion_time(HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT,
+                                      &gs_wait_us, &humidity_us);
+    gs_wait_us += humidity_us;
+    
+    /* one timerfd per bus, the first triggers are spread over the period */
+    ep = epoll_create1(EPOLL_CLOEXEC);
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    sigprocmask(SIG_BLOCK, &mask, NULL);
+    sig = signalfd(-1, &mask, SFD_CLOEXEC);
+    if ((ep < 0) || (sig < 0))
+    {
+        fprintf(stderr, "hdc1080_daemon: epoll or signalfd failed.\n");
+        
+        return 1;
+    }
+    ev.events = EPOLLIN;
+    ev.data.u32 = DAEMON_MAX_BUS;
+    (void)epoll_ctl(ep, EPOLL_CTL_ADD, sig, &ev);
+    start_us = a_now_us();
+    for (j = 0; j < gs_sensor_num; j++)
+    {
+        daemon_bus_t *bus = &gs_bus[gs_sensor[j].bus];
+        
+        a_queue_push(bus, j, start_us + (uint64_t)period_ms * 1000 * bus->queue_len / bus->sensors);
+    }
+    for (j = 0; j < gs_bus_num; j++)
+    {
+        gs_bus[j].timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (gs_bus[j].timer < 0)
+        {
+            fprintf(stderr, "hdc1080_daemon: timerfd failed.\n");
+            
+            return 1;
+        }
+        ev.events = EPOLLIN;
+        ev.data.u32 = j;
+        (void)epoll_ctl(ep, EPOLL_CTL_ADD, gs_bus[j].timer, &ev);
+        a_arm(&gs_bus[j]);
+    }
+    if (report_s != 0)
+    {
+        memset(&its, 0, sizeof(its));
+        report = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        its.it_value.tv_sec = report_s;
+        its.it_interval.tv_sec = report_s;
+        (void)timerfd_settime(report, 0, &its, NULL);
+        ev.events = EPOLLIN;
+        ev.data.u32 = DAEMON_MAX_BUS + 1;
+        (void)epoll_ctl(ep, EPOLL_CTL_ADD, report, &ev);
+    }
+    if (duration_s != 0)
+    {
+        memset(&its, 0, sizeof(its));
+        stop = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        its.it_value.tv_sec = duration_s;
+        (void)timerfd_settime(stop, 0, &its, NULL);
+        ev.events = EPOLLIN;
+        ev.data.u32 = DAEMON_MAX_BUS + 2;
+        (void)epoll_ctl(ep, EPOLL_CTL_ADD, stop, &ev);
+    }
+    printf("hdc1080_daemon: %u sensors on %u buses%s, period %ums.\n", gs_sensor_num, gs_bus_num,
+           (gs_sim != 0) ? " (simulated)" : "", period_ms);
+    fflush(stdout);
+    
+    /* event loop */
+    while (running != 0)
+    {
+        n = epoll_wait(ep, events, DAEMON_MAX_BUS + 3, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            res = 1;
+            
+            break;
+        }
+        for (i = 0; i < n; i++)
+        {
+            if ((events[i].data.u32 == DAEMON_MAX_BUS) || (events[i].data.u32 == DAEMON_MAX_BUS + 2))
+            {
+                running = 0;
+            }
+            else if (events[i].data.u32 == DAEMON_MAX_BUS + 1)
+            {
+                (void)read(report, &expirations, sizeof(expirations));
+                a_report(a_now_us() - start_us);
+            }
+            else
+            {
+                daemon_bus_t *bus = &gs_bus[events[i].data.u32];
+                
+                (void)read(bus->timer, &expirations, sizeof(expirations));
+                bus->wakeups++;
+                a_bus_run(bus, (uint64_t)period_ms * 1000);
+            }
+        }
+    }
+    /* final report and table */
+    a_report(a_now_us() - start_us);
+    if (table != 0)
+    {
+        printf("sensor  bus       mux   channel  reads  errors  status  temperature  humidity\n");
+        for (j = 0; j < gs_sensor_num; j++)
+        {
+            printf("%6u  %-8s  0x%02X  %7u  %5u  %6u  %6u  %11.2f  %8.2f\n", j, gs_bus[gs_sensor[j].bus].path,
+                   gs_sensor[j].mux, gs_sensor[j].channel, gs_table[j].reads, gs_table[j].errors, gs_table[j].status,
+                   gs_table[j].temperature, gs_table[j].humidity);
+        }
+    }
+    for (j = 0; j < gs_bus_num; j++)
+    {
+        gs_current = &gs_sensor[0];
+        (void)hdc1080_deinit(&gs_bus[j].handle);
+        if (gs_bus[j].fd >= 0)
+        {
+            close(gs_bus[j].fd);
+        }
+        close(gs_bus[j].timer);
+        free(gs_bus[j].queue);
+    }
+    if (report >= 0)
+    {
+        close(report);
+    }
+    if (stop >= 0)
+    {
+        close(stop);
+    }
+    close(sig);
+    close(ep);
+    if (gs_shm_enable != 0)
+    {
+        (void)hdc1080_shm_close(&gs_shm);
+        (void)hdc1080_shm_unlink(shm);
+    }
+    free(gs_sensor);
+    free(gs_table);
+    
+    return res;
+}
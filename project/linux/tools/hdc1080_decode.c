@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_decode.c
+ * @brief     hdc1080 stream decode tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_frame.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief decode tool max frame length definition
+ */
+#define DECODE_MAX_LEN        64        /**< max encoded frame length */
+
+/**
+ * @brief decode statistics structure definition
+ */
+typedef struct decode_stat_s
+{
+    uint32_t records;        /**< decoded records */
+    uint32_t lost;           /**< records missing in the sequence */
+    uint32_t crc;            /**< frames with a crc error */
+    uint32_t invalid;        /**< invalid frames */
+} decode_stat_t;
+
+/**
+ * @brief         decode one frame and print it as a csv line
+ * @param[in]     *buf pointer to a frame buffer
+ * @param[in]     len frame length
+ * @param[in,out] *stat pointer to a decode statistics structure
+ * @param[in,out] *next_seq pointer to an expected sequence buffer, -1 before the first record
+ * @note          none
+ */
+static void a_decode_frame(const uint8_t *buf, uint16_t len, decode_stat_t *stat, int32_t *next_seq)
+{
+    uint8_t res;
+    float temperature;
+    float humidity;
+    hdc1080_frame_record_t record;
+    
+    /* decode the frame */
+    res = hdc1080_frame_decode(buf, len, &record);
+    if (res == 4)
+    {
+        stat->crc++;
+        
+        return;
+    }
+    else if (res != 0)
+    {
+        stat->invalid++;
+        
+        return;
+    }
+    
+    /* check the sequence */
+    if ((*next_seq >= 0) && (record.seq != (uint16_t)(*next_seq)))
+    {
+        stat->lost += (uint16_t)(record.seq - (uint16_t)(*next_seq));
+    }
+    *next_seq = (int32_t)((uint16_t)(record.seq + 1));
+    stat->records++;
+    
+    /* output */
+    (void)hdc1080_temperature_convert_to_data(record.temperature_raw, &temperature);
+    (void)hdc1080_humidity_convert_to_data(record.humidity_raw, &humidity);
+    printf("%u,%u,%u,%u,%0.3f,%0.3f\n", record.seq, record.timestamp_ms, 
+           record.temperature_raw, record.humidity_raw, temperature, humidity);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_decode [capture.bin], it reads stdin without a file
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    int c;
+    uint8_t buf[DECODE_MAX_LEN];
+    uint16_t len = 0;
+    uint8_t overflow = 0;
+    uint8_t synced = 0;
+    int32_t next_seq = -1;
+    decode_stat_t stat;
+    hdc1080_frame_record_t record;
+    
+    /* open the capture */
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [capture.bin]\n", argv[0]);
+        
+        return 1;
+    }
+    if (argc == 2)
+    {
+        f = fopen(argv[1], "rb");
+        if (f == NULL)
+        {
+            fprintf(stderr, "hdc1080_decode: open %s failed.\n", argv[1]);
+            
+            return 1;
+        }
+    }
+    else
+    {
+        f = stdin;
+    }
+    
+    /* split the stream at the delimiters */
+    memset(&stat, 0, sizeof(decode_stat_t));
+    printf("seq,timestamp_ms,temperature_raw,humidity_raw,temperature_c,humidity_percent\n");
+    while ((c = fgetc(f)) != EOF)
+    {
+        if (c != 0)
+        {
+            if (len < DECODE_MAX_LEN)
+            {
+                buf[len++] = (uint8_t)c;
+            }
+            else
+            {
+                overflow = 1;
+            }
+            
+            continue;
+        }
+        
+        /* the bytes before the first delimiter may be the shell text */
+        if (synced == 0)
+        {
+            synced = 1;
+            if ((overflow == 0) && (hdc1080_frame_decode(buf, len, &record) == 0))
+            {
+                a_decode_frame(buf, len, &stat, &next_seq);
+            }
+        }
+        else if (overflow != 0)
+        {
+            stat.invalid++;
+        }
+        else if (len != 0)
+        {
+            a_decode_frame(buf, len, &stat, &next_seq);
+        }
+        len = 0;
+        overflow = 0;
+    }
+    if (f != stdin)
+    {
+        (void)fclose(f);
+    }
+    
+    /* print the statistics */
+    fprintf(stderr, "hdc1080_decode: %u records, %u lost, %u crc errors, %u invalid frames.\n",
+            stat.records, stat.lost, stat.crc, stat.invalid);
+    
+    return 0;
+}
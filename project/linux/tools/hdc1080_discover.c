@@ -0,0 +1,584 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_discover.c
+ * @brief     hdc1080 parallel discovery tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "driver_hdc1080_discover.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <linux/i2c-dev.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief discover tool definition
+ */
+#define DISCOVER_MAX_BUS            16          /**< max buses */
+#define DISCOVER_MAX_ENTRY          64          /**< max sensors of one bus */
+
+/**
+ * @brief discover tool bus structure definition
+ */
+typedef struct discover_bus_s
+{
+    char path[64];                                                          /**< i2c-dev path, simN for a simulated bus */
+    int fd;                                                                 /**< i2c-dev file */
+    uint8_t slave;                                                          /**< selected 7 bit address */
+    hdc1080_handle_t handle;                                                /**< driver handle of the bus */
+    hdc1080_discover_t discover;                                            /**< discovery of the bus */
+    hdc1080_discover_entry_t entry[DISCOVER_MAX_ENTRY];                     /**< found sensors */
+    uint8_t res;                                                            /**< status of the last run */
+    uint64_t elapsed_us;                                                    /**< time of the last run */
+    uint8_t sim_mux;                                                        /**< simulated muxes present, bit n is 0x70 + n */
+    uint8_t sim_mask[8];                                                    /**< simulated mux control bytes */
+    uint8_t sim_chip[8][HDC1080_DISCOVER_CHANNELS];                         /**< simulated chips, 1 if present */
+    uint32_t transactions;                                                  /**< bus transactions */
+    uint32_t collisions;                                                    /**< reads answered by two chips */
+} discover_bus_t;
+
+static discover_bus_t gs_bus[DISCOVER_MAX_BUS];        /**< buses */
+static uint32_t gs_bus_num;                            /**< bus number */
+static uint32_t gs_transaction_us = 250;               /**< simulated wire time of one transaction */
+static uint8_t gs_sim;                                 /**< 1 uses simulated buses */
+static __thread discover_bus_t *gs_current;            /**< bus of the calling thread */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief spend the wire time of one simulated transaction
+ * @note  the thread sleeps as in a blocking i2c-dev transfer
+ */
+static void a_sim_wire(void)
+{
+    struct timespec ts;
+    
+    gs_current->transactions++;
+    ts.tv_sec = 0;
+    ts.tv_nsec = (long)gs_transaction_us * 1000;
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief      find the simulated chip that answers
+ * @param[out] *serial pointer to a serial buffer
+ * @return     1 if a chip answers
+ * @note       none
+ */
+static uint8_t a_sim_chip(uint16_t *serial)
+{
+    uint32_t m;
+    uint32_t c;
+    uint32_t n = 0;
+    
+    for (m = 0; m < 8; m++)
+    {
+        for (c = 0; c < HDC1080_DISCOVER_CHANNELS; c++)
+        {
+            if (((gs_current->sim_mask[m] & (1 << c)) != 0) && (gs_current->sim_chip[m][c] != 0))
+            {
+                n++;
+                *serial = (uint16_t)((gs_current - gs_bus) << 8 | m << 4 | c);
+            }
+        }
+    }
+    if (n > 1)
+    {
+        gs_current->collisions++;
+    }
+    
+    return (n != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     select a slave on the current bus
+ * @param[in] slave 7 bit address
+ * @return    status code
+ *            - 0 success
+ *            - 1 select failed
+ * @note      none
+ */
+static uint8_t a_dev_slave(uint8_t slave)
+{
+    if (gs_current->slave == slave)
+    {
+        return 0;
+    }
+    if (ioctl(gs_current->fd, I2C_SLAVE, slave) < 0)
+    {
+        return 1;
+    }
+    gs_current->slave = slave;
+    
+    return 0;
+}
+
+/**
+ * @brief     write the control byte of a mux
+ * @param[in] addr 7 bit mux address
+ * @param[in] mask control byte
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a missing mux naks
+ */
+static uint8_t a_mux_write(uint8_t addr, uint8_t mask)
+{
+    if (gs_sim != 0)
+    {
+        a_sim_wire();
+        if ((addr < 0x70) || (addr > 0x77) || ((gs_current->sim_mux & (1 << (addr - 0x70))) == 0))
+        {
+            return 1;
+        }
+        gs_current->sim_mask[addr - 0x70] = mask;
+        
+        return 0;
+    }
+    gs_current->transactions++;
+    if ((a_dev_slave(addr) != 0) || (write(gs_current->fd, &mask, 1) != 1))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+static uint8_t a_iic_init(void)
+{
+    if (gs_sim != 0)
+    {
+        return 0;
+    }
+    gs_current->fd = open(gs_current->path, O_RDWR | O_CLOEXEC);
+    if (gs_current->fd < 0)
+    {
+        fprintf(stderr, "hdc1080_discover: open %s failed, %s.\n", gs_current->path, strerror(errno));
+        
+        return 1;
+    }
+    gs_current->slave = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief  iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_iic_deinit(void)
+{
+    if ((gs_sim == 0) && (gs_current->fd >= 0))
+    {
+        close(gs_current->fd);
+        gs_current->fd = -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the id registers need no conversion time
+ */
+static uint8_t a_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t serial = 0;
+    uint16_t v;
+    
+    if (gs_sim != 0)
+    {
+        a_sim_wire();
+        if ((a_sim_chip(&serial) == 0) || (len != 2))
+        {
+            return 1;
+        }
+        switch (reg)
+        {
+            case 0xFB : v = 0x1080; break;
+            case 0xFC : v = serial; break;
+            case 0xFD : v = 0x5A80; break;
+            case 0xFE : v = 0x5449; break;
+            case 0xFF : v = 0x1050; break;
+            default : v = 0x0000; break;
+        }
+        buf[0] = (uint8_t)(v >> 8);
+        buf[1] = (uint8_t)(v >> 0);
+        
+        return 0;
+    }
+    gs_current->transactions += 2;
+    if ((a_dev_slave(addr >> 1) != 0) || (write(gs_current->fd, &reg, 1) != 1) ||
+        (read(gs_current->fd, buf, len) != (ssize_t)len))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read with wait
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       the probe never calls it
+ */
+static uint8_t a_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief     iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 1 write failed
+ * @note      the probe never calls it
+ */
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief      iic bus command read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       the probe never calls it
+ */
+static uint8_t a_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief     delay
+ * @param[in] ms delay time in ms
+ * @note      none
+ */
+static void a_delay_ms(uint32_t ms)
+{
+    usleep(ms * 1000);
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      a foreign device at the address of the chip is reported to stderr
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     scan one bus
+ * @param[in] *arg pointer to a bus
+ * @return    NULL
+ * @note      thread function of the parallel run
+ */
+static void *a_scan(void *arg)
+{
+    discover_bus_t *bus = arg;
+    uint64_t start = a_now_us();
+    
+    gs_current = bus;
+    bus->res = hdc1080_discover_run(&bus->discover);
+    bus->elapsed_us = a_now_us() - start;
+    
+    return NULL;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_discover (--sim=<buses> | <i2c-dev path> ...) [--mux=<addr,...>] [--transaction=<us>]
+ *                   [--sequential] [--config]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t j;
+    uint32_t m;
+    uint32_t found = 0;
+    uint32_t probes = 0;
+    uint32_t collisions = 0;
+    uint8_t sequential = 0;
+    uint8_t config = 0;
+    uint8_t res = 0;
+    uint8_t mux[HDC1080_DISCOVER_MAX_MUX] = {0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77};
+    uint32_t mux_num = 8;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t longest = 0;
+    char *p;
+    pthread_t thread[DISCOVER_MAX_BUS];
+    const struct option long_options[] =
+    {
+        {"sim", required_argument, NULL, 's'},
+        {"mux", required_argument, NULL, 'm'},
+        {"transaction", required_argument, NULL, 't'},
+        {"sequential", no_argument, NULL, 'q'},
+        {"config", no_argument, NULL, 'c'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 's' :
+            {
+                gs_sim = 1;
+                gs_bus_num = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            }
+            case 'm' :
+            {
+                mux_num = 0;
+                p = optarg;
+                while ((*p != '\0') && (mux_num < HDC1080_DISCOVER_MAX_MUX))
+                {
+                    mux[mux_num++] = (uint8_t)strtoul(p, &p, 0);
+                    if (*p == ',')
+                    {
+                        p++;
+                    }
+                }
+                break;
+            }
+            case 't' : gs_transaction_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'q' : sequential = 1; break;
+            case 'c' : config = 1; break;
+            default :
+            {
+                fprintf(stderr, "usage: %s (--sim=<buses> | <i2c-dev path> ...) [--mux=<addr,...>] [--transaction=<us>] "
+                        "[--sequential] [--config]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if (gs_sim == 0)
+    {
+        for (gs_bus_num = 0; (optind < argc) && (gs_bus_num < DISCOVER_MAX_BUS); optind++, gs_bus_num++)
+        {
+            (void)snprintf(gs_bus[gs_bus_num].path, sizeof(gs_bus[gs_bus_num].path), "%s", argv[optind]);
+        }
+    }
+    if ((gs_bus_num == 0) || (gs_bus_num > DISCOVER_MAX_BUS))
+    {
+        fprintf(stderr, "hdc1080_discover: 1 - %d buses are needed.\n", DISCOVER_MAX_BUS);
+        
+        return 1;
+    }
+    
+    /* one handle and one discovery per bus, simulated bus b has b % 4 + 1 muxes and a chip on every third channel */
+    for (i = 0; i < gs_bus_num; i++)
+    {
+        discover_bus_t *bus = &gs_bus[i];
+        
+        bus->fd = -1;
+        if (gs_sim != 0)
+        {
+            (void)snprintf(bus->path, sizeof(bus->path), "sim%u", i);
+            bus->sim_mux = (uint8_t)((1 << (i % 4 + 1)) - 1);
+            memset(bus->sim_mask, 0xFF, sizeof(bus->sim_mask));
+            for (m = 0; m < 8; m++)
+            {
+                for (j = 0; j < HDC1080_DISCOVER_CHANNELS; j++)
+                {
+                    bus->sim_chip[m][j] = (((bus->sim_mux >> m) & 1) != 0) && ((i * 7 + m * 3 + j) % 3 == 0);
+                }
+            }
+        }
+        DRIVER_HDC1080_LINK_INIT(&bus->handle, hdc1080_handle_t);
+        DRIVER_HDC1080_LINK_IIC_INIT(&bus->handle, a_iic_init);
+        DRIVER_HDC1080_LINK_IIC_DEINIT(&bus->handle, a_iic_deinit);
+        DRIVER_HDC1080_LINK_IIC_READ(&bus->handle, a_iic_read);
+        DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&bus->handle, a_iic_read_with_wait);
+        DRIVER_HDC1080_LINK_IIC_WRITE(&bus->handle, a_iic_write);
+        DRIVER_HDC1080_LINK_IIC_READ_CMD(&bus->handle, a_iic_read_cmd);
+        DRIVER_HDC1080_LINK_DELAY_MS(&bus->handle, a_delay_ms);
+        DRIVER_HDC1080_LINK_DEBUG_PRINT(&bus->handle, a_debug_print);
+        (void)hdc1080_discover_init(&bus->discover, (uint8_t)i, &bus->handle, a_mux_write, bus->entry, DISCOVER_MAX_ENTRY);
+        for (m = 0; m < mux_num; m++)
+        {
+            if (hdc1080_discover_add_mux(&bus->discover, mux[m]) != 0)
+            {
+                fprintf(stderr, "hdc1080_discover: mux 0x%02X is invalid.\n", mux[m]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* scan the buses one after another or one thread per bus */
+    start = a_now_us();
+    for (i = 0; i < gs_bus_num; i++)
+    {
+        if (sequential != 0)
+        {
+            (void)a_scan(&gs_bus[i]);
+        }
+        else if (pthread_create(&thread[i], NULL, a_scan, &gs_bus[i]) != 0)
+        {
+            fprintf(stderr, "hdc1080_discover: create thread failed.\n");
+            
+            return 1;
+        }
+    }
+    if (sequential == 0)
+    {
+        for (i = 0; i < gs_bus_num; i++)
+        {
+            (void)pthread_join(thread[i], NULL);
+        }
+    }
+    elapsed = a_now_us() - start;
+    
+    /* the table of found serial ids, --config prints the sensor lines of hdc1080_daemon instead */
+    if (config == 0)
+    {
+        printf("bus       mux   channel  serial id\n");
+    }
+    for (i = 0; i < gs_bus_num; i++)
+    {
+        discover_bus_t *bus = &gs_bus[i];
+        
+        if (bus->res != 0)
+        {
+            fprintf(stderr, "hdc1080_discover: scan %s failed, status %u.\n", bus->path, bus->res);
+            res = 1;
+        }
+        for (j = 0; j < bus->discover.entry_num; j++)
+        {
+            hdc1080_discover_entry_t *e = &bus->entry[j];
+            
+            if (config != 0)
+            {
+                printf("%s 0x%02X %u\n", bus->path, e->mux, e->channel);
+            }
+            else
+            {
+                printf("%-8s  0x%02X  %7u  %02X%02X%02X%02X%02X%02X\n", bus->path, e->mux, e->channel,
+                       e->serial_id[0], e->serial_id[1], e->serial_id[2], e->serial_id[3], e->serial_id[4],
+                       e->serial_id[5]);
+            }
+        }
+        found += bus->discover.entry_num;
+        probes += bus->discover.probes;
+        collisions += bus->collisions;
+        if (bus->elapsed_us > longest)
+        {
+            longest = bus->elapsed_us;
+        }
+    }
+    if (config == 0)
+    {
+        printf("%u sensors on %u buses, %u probes, %s %.1fms, slowest bus %.1fms, %u collisions.\n", found, gs_bus_num,
+               probes, (sequential != 0) ? "sequential" : "parallel", elapsed / 1000.0, longest / 1000.0, collisions);
+    }
+    
+    return ((res != 0) || (collisions != 0)) ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_energy.c
+ * @brief     hdc1080 energy model tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_energy.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief energy tool configuration structure definition
+ */
+typedef struct energy_config_s
+{
+    hdc1080_mode_t mode;                                          /**< chip mode */
+    hdc1080_temperature_resolution_t temperature_resolution;      /**< temperature resolution */
+    hdc1080_humidity_resolution_t humidity_resolution;            /**< humidity resolution */
+    const char *name;                                             /**< configuration name */
+} energy_config_t;
+
+/**
+ * @brief energy tool configuration table
+ */
+static const energy_config_t gsc_config[] =
+{
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, "sequence t14 rh14"},
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_11_BIT, "sequence t14 rh11"},
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_8_BIT, "sequence t14 rh8"},
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, "sequence t11 rh14"},
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_11_BIT, "sequence t11 rh11"},
+    {HDC1080_MODE_SEQUENCE, HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_8_BIT, "sequence t11 rh8"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, "or t14 rh14"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_11_BIT, "or t14 rh11"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_8_BIT, "or t14 rh8"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, "or t11 rh14"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_11_BIT, "or t11 rh11"},
+    {HDC1080_MODE_OR,       HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_8_BIT, "or t11 rh8"},
+};
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_energy [--period=<ms>] [--voltage=<v>] [--capacity=<mah>] [--mcu-active=<ua>]
+ *                   [--mcu-sleep=<ua>] [--iic=<hz>] [--busy]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t period_ms = 5000;
+    float capacity_mah = 220.0f;
+    int32_t best = -1;
+    float best_uj = 0.0f;
+    hdc1080_energy_param_t param;
+    hdc1080_energy_t energy;
+    const struct option long_options[] =
+    {
+        {"period", required_argument, NULL, 'p'},
+        {"voltage", required_argument, NULL, 'v'},
+        {"capacity", required_argument, NULL, 'c'},
+        {"mcu-active", required_argument, NULL, 'a'},
+        {"mcu-sleep", required_argument, NULL, 's'},
+        {"iic", required_argument, NULL, 'i'},
+        {"busy", no_argument, NULL, 'b'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    (void)hdc1080_energy_init_param(&param);
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'p' : period_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'v' : param.supply_v = strtof(optarg, NULL); break;
+            case 'c' : capacity_mah = strtof(optarg, NULL); break;
+            case 'a' : param.mcu_active_ua = strtof(optarg, NULL); break;
+            case 's' : param.mcu_sleep_ua = strtof(optarg, NULL); break;
+            case 'i' : param.iic_hz = strtof(optarg, NULL); break;
+            case 'b' : param.wait = HDC1080_ENERGY_WAIT_BUSY; break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--period=<ms>] [--voltage=<v>] [--capacity=<mah>] [--mcu-active=<ua>] "
+                        "[--mcu-sleep=<ua>] [--iic=<hz>] [--busy]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* estimate all configurations */
+    printf("period %ums, supply %0.2fV, mcu %s across the conversion.\n", period_ms, param.supply_v,
+           (param.wait == HDC1080_ENERGY_WAIT_BUSY) ? "busy waits" : "sleeps");
+    printf("configuration      conversion(ms)  sensor(uJ)  mcu(uJ)  total(uJ)  average(uA)  life(days)\n");
+    for (i = 0; i < sizeof(gsc_config) / sizeof(gsc_config[0]); i++)
+    {
+        if (hdc1080_energy_estimate(&param, gsc_config[i].mode, gsc_config[i].temperature_resolution,
+                                    gsc_config[i].humidity_resolution, period_ms, &energy) != 0)
+        {
+            printf("%-17s  period is too short\n", gsc_config[i].name);
+            
+            continue;
+        }
+        printf("%-17s  %14.2f  %10.3f  %7.3f  %9.3f  %11.3f  %10.0f\n", gsc_config[i].name,
+               energy.conversion_us / 1000.0f, energy.sensor_uj, energy.mcu_uj, energy.total_uj,
+               energy.average_ua, capacity_mah * 1000.0f / energy.average_ua / 24.0f);
+        if ((best < 0) || (energy.total_uj < best_uj))
+        {
+            best = (int32_t)i;
+            best_uj = energy.total_uj;
+        }
+    }
+    if (best < 0)
+    {
+        return 1;
+    }
+    printf("lowest energy: %s.\n", gsc_config[best].name);
+    
+    return 0;
+}
@@ -0,0 +1,484 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_fifo_stress.c
+ * @brief     uart tx ring stress tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "fifo.h"
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief fifo stress tool definition
+ */
+#define FIFO_STRESS_PAYLOAD_MAX    48          /**< max payload length of one line */
+#define FIFO_STRESS_LINE_MAX       64          /**< max line length */
+#define FIFO_STRESS_BLOCK_MAX      0xFFFF      /**< max length of one interrupt transfer */
+
+static fifo_t gs_fifo;                                                         /**< tx ring buffer */
+static uint8_t *gs_buffer;                                                     /**< tx ring memory */
+static uint32_t gs_baud = 115200;                                              /**< simulated uart rate */
+static uint32_t gs_lines = 1000;                                               /**< lines to send */
+static uint32_t gs_burst = 40;                                                 /**< lines per burst */
+static uint32_t gs_period_us = 200000;                                         /**< burst period */
+static uint32_t gs_timeout_ms = 1000;                                          /**< write timeout as uart_write */
+static volatile uint8_t gs_done;                                               /**< 1 when the producer finished */
+static pthread_mutex_t gs_done_mutex = PTHREAD_MUTEX_INITIALIZER;              /**< done flag mutex */
+
+/**
+ * @brief producer result structure definition
+ */
+typedef struct fifo_stress_producer_s
+{
+    uint64_t queued;               /**< bytes accepted by the ring */
+    uint32_t blocked;              /**< writes that waited for space */
+    uint32_t block_max_us;         /**< longest wait for space */
+    uint32_t timeouts;             /**< writes given up after the timeout */
+    uint32_t peak;                 /**< highest ring fill */
+} fifo_stress_producer_t;
+
+/**
+ * @brief drain result structure definition
+ */
+typedef struct fifo_stress_drain_s
+{
+    uint64_t sent;                 /**< bytes sent on the simulated wire */
+    uint32_t blocks;               /**< interrupt transfers */
+    uint32_t ok;                   /**< correct lines */
+    uint32_t missing;              /**< lines not seen */
+    uint32_t damaged;              /**< lines with wrong content */
+    uint32_t reordered;            /**< lines older than the previous one */
+    uint32_t expected;             /**< next expected sequence */
+    uint32_t len;                  /**< assembled line length */
+    char line[FIFO_STRESS_LINE_MAX + 1];        /**< assembled line */
+} fifo_stress_drain_t;
+
+static fifo_stress_producer_t gs_producer;        /**< producer result */
+static fifo_stress_drain_t gs_drain;              /**< drain result */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     sleep
+ * @param[in] us sleep time in us
+ * @note      none
+ */
+static void a_sleep_us(uint32_t us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = (long)(us % 1000000) * 1000;
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief     sleep until an absolute time
+ * @param[in] us monotonic time in us
+ * @note      none
+ */
+static void a_sleep_until_us(uint64_t us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(us / 1000000);
+    ts.tv_nsec = (long)(us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+    {
+        /* interrupted, sleep again */
+    }
+}
+
+/**
+ * @brief  check the done flag
+ * @return 1 if the producer finished
+ * @note   none
+ */
+static uint8_t a_done(void)
+{
+    uint8_t done;
+    
+    pthread_mutex_lock(&gs_done_mutex);
+    done = gs_done;
+    pthread_mutex_unlock(&gs_done_mutex);
+    
+    return done;
+}
+
+/**
+ * @brief      build one line
+ * @param[in]  seq line sequence
+ * @param[out] *line pointer to a line buffer
+ * @return     line length
+ * @note       "<seq in 8 hex digits> <payload>\n", the payload length and content depend on seq
+ */
+static uint32_t a_make_line(uint32_t seq, char *line)
+{
+    uint32_t i;
+    uint32_t len;
+    
+    (void)snprintf(line, FIFO_STRESS_LINE_MAX, "%08X ", (unsigned int)seq);
+    len = (seq * 7) % (FIFO_STRESS_PAYLOAD_MAX + 1);
+    for (i = 0; i < len; i++)
+    {
+        line[9 + i] = (char)('a' + ((seq + i) % 26));
+    }
+    line[9 + len] = '\n';
+    
+    return 10 + len;
+}
+
+/**
+ * @brief     check one received line
+ * @param[in] *drain pointer to a drain result structure
+ * @note      none
+ */
+static void a_check_line(fifo_stress_drain_t *drain)
+{
+    char *end;
+    char expect[FIFO_STRESS_LINE_MAX + 1];
+    uint32_t seq;
+    uint32_t len;
+    
+    /* parse the sequence */
+    drain->line[drain->len] = '\0';
+    seq = (uint32_t)strtoul(drain->line, &end, 16);
+    if ((end != &drain->line[8]) || (seq >= gs_lines))
+    {
+        drain->damaged++;
+        
+        return;
+    }
+    
+    /* compare with the sent line without the newline */
+    len = a_make_line(seq, expect) - 1;
+    if ((len != drain->len) || (memcmp(expect, drain->line, len) != 0))
+    {
+        drain->damaged++;
+        
+        return;
+    }
+    
+    /* check the order */
+    if (seq < drain->expected)
+    {
+        drain->reordered++;
+        
+        return;
+    }
+    drain->missing += seq - drain->expected;
+    drain->expected = seq + 1;
+    drain->ok++;
+}
+
+/**
+ * @brief     emulate uart_write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write timeout
+ * @note      waits 1ms for space until the line fits, up to the timeout, then queues it whole
+ */
+static uint8_t a_uart_write(const uint8_t *buf, uint32_t len)
+{
+    uint32_t timeout = gs_timeout_ms;
+    uint32_t need;
+    uint32_t written;
+    uint32_t used;
+    uint64_t start_us = 0;
+    uint64_t wait_us;
+    
+    while (len != 0)
+    {
+        /* wait until the line or a full ring fits */
+        need = (len < gs_fifo.size) ? len : gs_fifo.size;
+        if (fifo_get_free(&gs_fifo) < need)
+        {
+            if (timeout == gs_timeout_ms)
+            {
+                start_us = a_now_us();
+                gs_producer.blocked++;
+            }
+            if (timeout == 0)
+            {
+                gs_producer.timeouts++;
+                
+                return 1;
+            }
+            a_sleep_us(1000);
+            timeout--;
+            
+            continue;
+        }
+        
+        /* queue it */
+        written = fifo_write(&gs_fifo, buf, need);
+        buf += written;
+        len -= written;
+        gs_producer.queued += written;
+        used = fifo_get_used(&gs_fifo);
+        if (used > gs_producer.peak)
+        {
+            gs_producer.peak = used;
+        }
+    }
+    if (timeout != gs_timeout_ms)
+    {
+        wait_us = a_now_us() - start_us;
+        if (wait_us > gs_producer.block_max_us)
+        {
+            gs_producer.block_max_us = (uint32_t)wait_us;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     producer thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      sends bursts of lines, as a main loop printing a batch of results
+ */
+static void *a_producer(void *arg)
+{
+    uint32_t seq;
+    uint32_t len;
+    char line[FIFO_STRESS_LINE_MAX];
+    
+    (void)arg;
+    for (seq = 0; seq < gs_lines; seq++)
+    {
+        len = a_make_line(seq, line);
+        (void)a_uart_write((const uint8_t *)line, len);
+        if ((gs_burst != 0) && (((seq + 1) % gs_burst) == 0) && (gs_period_us != 0))
+        {
+            a_sleep_us(gs_period_us);
+        }
+    }
+    pthread_mutex_lock(&gs_done_mutex);
+    gs_done = 1;
+    pthread_mutex_unlock(&gs_done_mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief     drain thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      emulates the tx complete interrupt chain: peek a block, keep it on
+ *            the wire for 10 bits per byte at the baud rate, check it and drop it
+ */
+static void *a_drain(void *arg)
+{
+    uint8_t *block;
+    uint32_t i;
+    uint32_t len;
+    uint64_t wire_us;
+    uint64_t now_us;
+    
+    (void)arg;
+    wire_us = a_now_us();
+    while (1)
+    {
+        /* start the next transfer */
+        len = fifo_peek(&gs_fifo, &block);
+        if (len == 0)
+        {
+            if ((a_done() != 0) && (fifo_get_used(&gs_fifo) == 0))
+            {
+                break;
+            }
+            a_sleep_us(50);
+            
+            continue;
+        }
+        if (len > FIFO_STRESS_BLOCK_MAX)
+        {
+            len = FIFO_STRESS_BLOCK_MAX;
+        }
+        
+        /* the wire is busy for the whole block */
+        now_us = a_now_us();
+        if (wire_us < now_us)
+        {
+            wire_us = now_us;
+        }
+        wire_us += (uint64_t)len * 10 * 1000000 / gs_baud;
+        a_sleep_until_us(wire_us);
+        
+        /* check the sent bytes */
+        for (i = 0; i < len; i++)
+        {
+            if (block[i] == '\n')
+            {
+                a_check_line(&gs_drain);
+                gs_drain.len = 0;
+            }
+            else if (gs_drain.len < FIFO_STRESS_LINE_MAX)
+            {
+                gs_drain.line[gs_drain.len++] = (char)block[i];
+            }
+            else
+            {
+                /* overlong line, kept at the max length and counted as damaged */
+            }
+        }
+        gs_drain.sent += len;
+        gs_drain.blocks++;
+        
+        /* tx complete */
+        fifo_drop(&gs_fifo, len);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed or the ring reordered, damaged or lost data
+ * @note      usage: hdc1080_fifo_stress [--baud=<bps>] [--size=<bytes>] [--lines=<n>] [--burst=<n>] [--period=<us>] [--timeout=<ms>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t size = 2048;
+    uint64_t start_us;
+    uint32_t elapsed_ms;
+    uint8_t res;
+    pthread_t producer;
+    pthread_t drain;
+    const struct option long_options[] =
+    {
+        {"baud", required_argument, NULL, 'b'},
+        {"size", required_argument, NULL, 's'},
+        {"lines", required_argument, NULL, 'l'},
+        {"burst", required_argument, NULL, 'n'},
+        {"period", required_argument, NULL, 'p'},
+        {"timeout", required_argument, NULL, 't'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'b' : gs_baud = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's' : size = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'l' : gs_lines = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'n' : gs_burst = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'p' : gs_period_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 't' : gs_timeout_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--baud=<bps>] [--size=<bytes>] [--lines=<n>] [--burst=<n>] [--period=<us>] [--timeout=<ms>]\n",
+                        argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if (gs_baud == 0)
+    {
+        fprintf(stderr, "baud must not be 0.\n");
+        
+        return 1;
+    }
+    
+    /* init the ring */
+    gs_buffer = (uint8_t *)malloc(size);
+    if ((gs_buffer == NULL) || (fifo_init(&gs_fifo, gs_buffer, size) != 0))
+    {
+        fprintf(stderr, "size must be a power of 2.\n");
+        free(gs_buffer);
+        
+        return 1;
+    }
+    
+    /* run the threads */
+    printf("ring %u bytes, %u baud, %u lines in bursts of %u every %uus, timeout %ums.\n", size, gs_baud,
+           gs_lines, gs_burst, gs_period_us, gs_timeout_ms);
+    start_us = a_now_us();
+    (void)pthread_create(&drain, NULL, a_drain, NULL);
+    (void)pthread_create(&producer, NULL, a_producer, NULL);
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(drain, NULL);
+    elapsed_ms = (uint32_t)((a_now_us() - start_us) / 1000);
+    gs_drain.missing += gs_lines - gs_drain.expected;
+    free(gs_buffer);
+    
+    /* print the result */
+    printf("producer: %llu bytes queued, %u writes blocked, longest block %uus, %u timeouts, ring peak %u bytes.\n",
+           (unsigned long long)gs_producer.queued, gs_producer.blocked, gs_producer.block_max_us,
+           gs_producer.timeouts, gs_producer.peak);
+    printf("drain: %llu bytes in %u blocks in %ums, %u lines ok, %u missing, %u damaged, %u out of order.\n",
+           (unsigned long long)gs_drain.sent, gs_drain.blocks, elapsed_ms, gs_drain.ok, gs_drain.missing,
+           gs_drain.damaged, gs_drain.reordered);
+    
+    /* reordered or damaged lines are always a bug, lost lines only if no write timed out */
+    res = 0;
+    if ((gs_drain.sent != gs_producer.queued) || (gs_drain.reordered != 0) || (gs_drain.damaged != 0))
+    {
+        res = 1;
+    }
+    if ((gs_producer.timeouts == 0) && (gs_drain.missing != 0))
+    {
+        res = 1;
+    }
+    
+    return res;
+}
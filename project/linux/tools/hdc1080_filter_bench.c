@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_filter_bench.c
+ * @brief     hdc1080 filter benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_hdc1080_filter.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief filter bench default definition
+ */
+#define FILTER_BENCH_SAMPLES                 1000000        /**< sample number */
+#define FILTER_BENCH_TEMPERATURE_NOISE       0.05f          /**< temperature sensor noise in C */
+#define FILTER_BENCH_HUMIDITY_NOISE          0.1f           /**< humidity sensor noise in % */
+#define FILTER_BENCH_TEMPERATURE_PROCESS     0.01f          /**< kalman temperature process noise in C */
+#define FILTER_BENCH_HUMIDITY_PROCESS        0.01f          /**< kalman humidity process noise in % */
+
+/**
+ * @brief filter bench resolution structure definition
+ */
+typedef struct filter_bench_resolution_s
+{
+    hdc1080_temperature_resolution_t temperature;        /**< temperature resolution */
+    hdc1080_humidity_resolution_t humidity;              /**< humidity resolution */
+    uint32_t temperature_step;                           /**< temperature code step */
+    uint32_t humidity_step;                              /**< humidity code step */
+    const char *name;                                    /**< resolution name */
+} filter_bench_resolution_t;
+
+/**
+ * @brief filter bench resolution table
+ */
+static const filter_bench_resolution_t gsc_resolution[] =
+{
+    {HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, 4, 4, "t14 rh14"},
+    {HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_11_BIT, 32, 32, "t11 rh11"},
+    {HDC1080_TEMPERATURE_RESOLUTION_11_BIT, HDC1080_HUMIDITY_RESOLUTION_8_BIT, 32, 256, "t11 rh8"},
+};
+
+static uint16_t *gs_temperature_truth;        /**< true temperature buffer */
+static uint16_t *gs_humidity_truth;           /**< true humidity buffer */
+static uint16_t *gs_temperature_raw;          /**< raw temperature buffer */
+static uint16_t *gs_humidity_raw;             /**< raw humidity buffer */
+static uint16_t *gs_temperature_out;          /**< filtered temperature buffer */
+static uint16_t *gs_humidity_out;             /**< filtered humidity buffer */
+static uint32_t gs_seed;                      /**< random seed */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  get a pseudo gaussian value
+ * @return value with a zero mean and a one sigma of about 1
+ * @note   the sum of four uniform values
+ */
+static float a_gauss(void)
+{
+    int i;
+    float sum = 0.0f;
+    
+    for (i = 0; i < 4; i++)
+    {
+        gs_seed = gs_seed * 1664525U + 1013904223U;
+        sum += (float)(gs_seed >> 8) / 16777216.0f;
+    }
+    
+    return (sum - 2.0f) * 1.7320508f;
+}
+
+/**
+ * @brief     quantize a raw code to a resolution
+ * @param[in] code raw code
+ * @param[in] step code step of the resolution
+ * @return    quantized raw code
+ * @note      none
+ */
+static uint16_t a_quantize(float code, uint32_t step)
+{
+    float q;
+    
+    q = floorf((code + (float)step / 2.0f) / (float)step) * (float)step;
+    if (q < 0.0f)
+    {
+        return 0;
+    }
+    if (q > (float)(65536 - step))
+    {
+        return (uint16_t)(65536 - step);
+    }
+    
+    return (uint16_t)q;
+}
+
+/**
+ * @brief     get the rms error of a buffer
+ * @param[in] *out pointer to a buffer
+ * @param[in] *truth pointer to a truth buffer
+ * @param[in] samples sample number
+ * @return    rms error in raw code
+ * @note      the first 1000 samples are the start up and skipped
+ */
+static double a_rms(const uint16_t *out, const uint16_t *truth, uint32_t samples)
+{
+    uint32_t i;
+    double e;
+    double sum = 0.0;
+    
+    for (i = 1000; i < samples; i++)
+    {
+        e = (double)out[i] - (double)truth[i];
+        sum += e * e;
+    }
+    
+    return sqrt(sum / (double)(samples - 1000));
+}
+
+/**
+ * @brief     get the step latency of a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    samples until the temperature output crosses 63% of a 10000 code step
+ * @note      none
+ */
+static uint32_t a_latency(hdc1080_filter_t *filter)
+{
+    uint32_t i;
+    uint16_t t;
+    uint16_t h;
+    
+    (void)hdc1080_filter_reset(filter);
+    for (i = 0; i < 1000; i++)
+    {
+        (void)hdc1080_filter_update(filter, 20000, 20000, &t, &h);
+    }
+    for (i = 1; i < 100000; i++)
+    {
+        (void)hdc1080_filter_update(filter, 30000, 30000, &t, &h);
+        if (t >= 26321)
+        {
+            break;
+        }
+    }
+    
+    return i;
+}
+
+/**
+ * @brief     run one filter
+ * @param[in] *resolution pointer to a resolution structure
+ * @param[in] *name filter name
+ * @param[in] *filter pointer to a filter structure, NULL means no filter
+ * @param[in] samples sample number
+ * @note      none
+ */
+static void a_run(const filter_bench_resolution_t *resolution, const char *name, hdc1080_filter_t *filter, uint32_t samples)
+{
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    uint32_t latency = 0;
+    double start;
+    double ns = 0.0;
+    const uint16_t *t = gs_temperature_raw;
+    const uint16_t *h = gs_humidity_raw;
+    hdc1080_filter_t copy;
+    
+    (void)hdc1080_get_conversion_time(resolution->temperature, resolution->humidity, &temperature_us, &humidity_us);
+    if (filter != NULL)
+    {
+        copy = *filter;
+        start = a_now_ns();
+        (void)hdc1080_filter_batch(filter, gs_temperature_raw, gs_humidity_raw,
+                                   gs_temperature_out, gs_humidity_out, samples);
+        ns = (a_now_ns() - start) / (double)samples;
+        latency = a_latency(&copy);
+        t = gs_temperature_out;
+        h = gs_humidity_out;
+    }
+    printf("%-8s  %-9s  %14.2f  %8.4f  %9.4f  %16u  %9.2f\n", resolution->name, name,
+           (temperature_us + humidity_us) / 1000.0, a_rms(t, gs_temperature_truth, samples) * 165.0 / 65536.0,
+           a_rms(h, gs_humidity_truth, samples) * 100.0 / 65536.0, latency, ns);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_filter_bench [--samples=<num>] [--temperature-noise=<c>] [--humidity-noise=<%>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t r;
+    uint32_t samples = FILTER_BENCH_SAMPLES;
+    float temperature_noise = FILTER_BENCH_TEMPERATURE_NOISE;
+    float humidity_noise = FILTER_BENCH_HUMIDITY_NOISE;
+    float truth_t;
+    float truth_h;
+    float sigma_t;
+    float sigma_h;
+    hdc1080_filter_t filter;
+    const struct option long_options[] =
+    {
+        {"samples", required_argument, NULL, 1},
+        {"temperature-noise", required_argument, NULL, 2},
+        {"humidity-noise", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+    
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 1 :
+            {
+                samples = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 2 :
+            {
+                temperature_noise = strtof(optarg, NULL);
+                
+                break;
+            }
+            case 3 :
+            {
+                humidity_noise = strtof(optarg, NULL);
+                
+                break;
+            }
+            default :
+            {
+                fprintf(stderr, "usage: hdc1080_filter_bench [--samples=<num>] [--temperature-noise=<c>] [--humidity-noise=<%%>]\n");
+                
+                return 1;
+            }
+        }
+    }
+    if (samples <= 1000)
+    {
+        fprintf(stderr, "hdc1080_filter_bench: samples must be above 1000.\n");
+        
+        return 1;
+    }
+    
+    gs_temperature_truth = malloc(samples * sizeof(uint16_t));
+    gs_humidity_truth = malloc(samples * sizeof(uint16_t));
+    gs_temperature_raw = malloc(samples * sizeof(uint16_t));
+    gs_humidity_raw = malloc(samples * sizeof(uint16_t));
+    gs_temperature_out = malloc(samples * sizeof(uint16_t));
+    gs_humidity_out = malloc(samples * sizeof(uint16_t));
+    if ((gs_temperature_truth == NULL) || (gs_humidity_truth == NULL) || (gs_temperature_raw == NULL) ||
+        (gs_humidity_raw == NULL) || (gs_temperature_out == NULL) || (gs_humidity_out == NULL))
+    {
+        fprintf(stderr, "hdc1080_filter_bench: out of memory.\n");
+        
+        return 1;
+    }
+    
+    printf("%u samples, a slow sine of 2C and 5%% with %0.3fC and %0.3f%% sensor noise.\n",
+           samples, temperature_noise, humidity_noise);
+    printf("%-8s  %-9s  %14s  %8s  %9s  %16s  %9s\n", "config", "filter", "conversion(ms)", "t rms(C)",
+           "rh rms(%)", "latency(samples)", "ns/sample");
+    for (r = 0; r < sizeof(gsc_resolution) / sizeof(gsc_resolution[0]); r++)
+    {
+        /* the same signal and noise for every resolution */
+        gs_seed = 1;
+        for (i = 0; i < samples; i++)
+        {
+            truth_t = 26000.0f + 794.0f * sinf((float)i * 6.2831853f / 3600.0f);
+            truth_h = 32768.0f + 3277.0f * sinf((float)i * 6.2831853f / 7200.0f);
+            gs_temperature_truth[i] = (uint16_t)(truth_t + 0.5f);
+            gs_humidity_truth[i] = (uint16_t)(truth_h + 0.5f);
+            gs_temperature_raw[i] = a_quantize(truth_t + a_gauss() * temperature_noise * 65536.0f / 165.0f,
+                                               gsc_resolution[r].temperature_step);
+            gs_humidity_raw[i] = a_quantize(truth_h + a_gauss() * humidity_noise * 65536.0f / 100.0f,
+                                            gsc_resolution[r].humidity_step);
+        }
+        
+        /* the kalman measurement noise is the sensor noise plus the quantization noise */
+        sigma_t = sqrtf(temperature_noise * temperature_noise +
+                        powf(gsc_resolution[r].temperature_step * 165.0f / 65536.0f, 2.0f) / 12.0f);
+        sigma_h = sqrtf(humidity_noise * humidity_noise +
+                        powf(gsc_resolution[r].humidity_step * 100.0f / 65536.0f, 2.0f) / 12.0f);
+        
+        a_run(&gsc_resolution[r], "none", NULL, samples);
+        (void)hdc1080_filter_init_ema(&filter, 2, 2);
+        a_run(&gsc_resolution[r], "ema 2", &filter, samples);
+        (void)hdc1080_filter_init_ema(&filter, 4, 4);
+        a_run(&gsc_resolution[r], "ema 4", &filter, samples);
+        if (hdc1080_filter_init_kalman(&filter, FILTER_BENCH_TEMPERATURE_PROCESS, FILTER_BENCH_HUMIDITY_PROCESS,
+                                       sigma_t, sigma_h) != 0)
+        {
+            fprintf(stderr, "hdc1080_filter_bench: noise is too large for the kalman filter.\n");
+            
+            return 1;
+        }
+        a_run(&gsc_resolution[r], "kalman", &filter, samples);
+    }
+    
+    free(gs_temperature_truth);
+    free(gs_humidity_truth);
+    free(gs_temperature_raw);
+    free(gs_humidity_raw);
+    free(gs_temperature_out);
+    free(gs_humidity_out);
+    
+    return 0;
+}
@@ -0,0 +1,597 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_heater_sim.c
+ * @brief     hdc1080 heater condensation simulator
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_heater.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief heater simulator definition
+ */
+#define HEATER_SIM_AMBIENT           15.0f         /**< air temperature in C */
+#define HEATER_SIM_TAU_MS            4000.0f       /**< thermal time constant of the die */
+#define HEATER_SIM_RISE              10.0f         /**< die temperature rise of a heater that never stops */
+#define HEATER_SIM_CONVERSION_MS     7             /**< conversion time of one register */
+#define HEATER_SIM_DEPOSIT           1.0f          /**< fog droplets in ug/s */
+#define HEATER_SIM_EVAPORATION       0.1f          /**< evaporation in ug/s/hPa */
+#define HEATER_SIM_FILM_MAX          200.0f        /**< film that runs off in ug */
+#define HEATER_SIM_HEATER_MW         23.76f        /**< heater power, 7.2mA at 3.3V */
+#define HEATER_SIM_ERROR             3.0f          /**< largest error of a good reading in % */
+
+/**
+ * @brief heater simulator scheme enumeration definition
+ */
+typedef enum
+{
+    HEATER_SIM_SCHEME_NONE      = 0x00,        /**< never heat */
+    HEATER_SIM_SCHEME_MANUAL    = 0x01,        /**< 10s blocking heater, 10s blocking cool down */
+    HEATER_SIM_SCHEME_SCHEDULER = 0x02,        /**< driver_hdc1080_heater */
+} heater_sim_scheme_t;
+
+/**
+ * @brief heater simulator scheduler setting structure definition
+ */
+typedef struct heater_sim_setting_s
+{
+    uint16_t duty;            /**< duty in permille */
+    uint32_t burst_ms;        /**< longest burst of one read */
+} heater_sim_setting_t;
+
+/**
+ * @brief heater simulator result structure definition
+ */
+typedef struct heater_sim_result_s
+{
+    int32_t recovery_ms;         /**< first good reading after the fog, -1 if never */
+    uint32_t heater_ms;          /**< heater time */
+    uint32_t after_ms;           /**< heater time after the fog */
+    uint32_t block_ms;           /**< longest read call */
+    uint32_t readings;           /**< delivered readings */
+    uint32_t lost;               /**< sample periods without a reading */
+    uint32_t flagged;            /**< readings flagged as heated */
+    uint32_t bad;                /**< unflagged readings off by more than the error */
+} heater_sim_result_t;
+
+static const heater_sim_setting_t gsc_setting[] =
+{
+    {100, 200},
+    {250, 200},
+    {250, 500},
+    {500, 500},
+};
+
+static hdc1080_handle_t gs_handle;             /**< driver handle */
+static uint32_t gs_tick_ms;                    /**< simulated time in ms */
+static uint16_t gs_config;                     /**< simulated config register */
+static float gs_die;                           /**< die temperature */
+static float gs_film;                          /**< water film in ug */
+static float gs_rh;                            /**< air humidity */
+static uint8_t gs_fog;                         /**< 1 while the fog deposits droplets */
+static uint32_t gs_heater_ms;                  /**< heater time */
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     debug log
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      none
+ */
+static void a_debug_log(uint8_t id, uint16_t arg)
+{
+    fprintf(stderr, "hdc1080: debug id %d arg %d.\n", id, arg);
+}
+
+/**
+ * @brief     saturation vapour pressure
+ * @param[in] t temperature in C
+ * @return    pressure in hPa
+ * @note      none
+ */
+static float a_psat(float t)
+{
+    return 6.112f * expf(17.62f * t / (243.12f + t));
+}
+
+/**
+ * @brief     advance the simulated world
+ * @param[in] ms time
+ * @param[in] heating 1 if the heater runs
+ * @note      the die follows the air with a time constant and the film evaporates with the vapour pressure
+ *            difference between the die and the air
+ */
+static void a_sim_advance(uint32_t ms, uint8_t heating)
+{
+    uint32_t i;
+    float target;
+    float e;
+    
+    target = HEATER_SIM_AMBIENT + ((heating != 0) ? HEATER_SIM_RISE : 0.0f);
+    e = gs_rh / 100.0f * a_psat(HEATER_SIM_AMBIENT);
+    for (i = 0; i < ms; i++)
+    {
+        gs_die += (target - gs_die) / HEATER_SIM_TAU_MS;
+        gs_film -= HEATER_SIM_EVAPORATION * (a_psat(gs_die) - e) / 1000.0f;
+        if (gs_fog != 0)
+        {
+            gs_film += HEATER_SIM_DEPOSIT / 1000.0f;
+        }
+        if (gs_film < 0.0f)
+        {
+            gs_film = 0.0f;
+        }
+        if (gs_film > HEATER_SIM_FILM_MAX)
+        {
+            gs_film = HEATER_SIM_FILM_MAX;
+        }
+    }
+    gs_tick_ms += ms;
+    if (heating != 0)
+    {
+        gs_heater_ms += ms;
+    }
+}
+
+/**
+ * @brief  simulated get tick
+ * @return current time in ms
+ * @note   none
+ */
+static uint32_t a_sim_get_tick_ms(void)
+{
+    return gs_tick_ms;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      none
+ */
+static void a_sim_delay_ms(uint32_t ms)
+{
+    a_sim_advance(ms, 0);
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_sim_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_sim_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a wet die reads 100%, a dry die reads the air vapour pressure at its temperature
+ */
+static uint8_t a_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    float v;
+    uint16_t raw;
+    
+    (void)addr;
+    if (len < 2)
+    {
+        return 1;
+    }
+    switch (reg)
+    {
+        case 0x00 :
+        {
+            raw = (uint16_t)((gs_die + 40.0f) / 165.0f * 65536.0f);
+            
+            break;
+        }
+        case 0x01 :
+        {
+            v = (gs_film > 0.0f) ? 100.0f : gs_rh * a_psat(HEATER_SIM_AMBIENT) / a_psat(gs_die);
+            v = v / 100.0f * 65536.0f;
+            raw = (v > 65535.0f) ? 65535 : (uint16_t)v;
+            
+            break;
+        }
+        case 0x02 : raw = gs_config; break;
+        case 0xFE : raw = 0x5449; break;
+        case 0xFF : raw = 0x1050; break;
+        default : raw = 0x0000; break;
+    }
+    buf[0] = (uint8_t)(raw >> 8);
+    buf[1] = (uint8_t)(raw >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated read with wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       the heater only runs during the conversion
+ */
+static uint8_t a_sim_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    a_sim_advance(HEATER_SIM_CONVERSION_MS, (uint8_t)((gs_config & 0x2000) != 0));
+    
+    return a_sim_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      a config write with bit 15 set resets the chip
+ */
+static uint8_t a_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    (void)addr;
+    if ((reg == 0x02) && (len == 2))
+    {
+        v = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);
+        gs_config = ((v & 0x8000) != 0) ? 0x1000 : (v & HDC1080_CONFIG_MASK);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_sim_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_sim_iic_read(addr, 0x00, buf, len);
+}
+
+/**
+ * @brief     run one scheme through the scenario
+ * @param[in] scheme heater scheme
+ * @param[in] *setting pointer to a scheduler setting
+ * @param[in] period_ms sample period
+ * @param[in] before_ms dry air before the fog
+ * @param[in] fog_ms fog time
+ * @param[in] after_ms damp air after the fog
+ * @param[in] rh damp air humidity
+ * @param[out] *result pointer to a result structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the manual scheme heats with 10s of back to back conversions and waits 10s to cool down after
+ *            3 saturated reads and again as long as the first read after the cool down is saturated
+ */
+static uint8_t a_run(heater_sim_scheme_t scheme, const heater_sim_setting_t *setting, uint32_t period_ms,
+                     uint32_t before_ms, uint32_t fog_ms, uint32_t after_ms, float rh, heater_sim_result_t *result)
+{
+    uint32_t next;
+    uint32_t start;
+    uint32_t end;
+    uint8_t saturated = 0;
+    uint8_t heated = 0;
+    uint8_t flags;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    float truth;
+    hdc1080_heater_t heater;
+    
+    /* reset the world */
+    gs_tick_ms = 0;
+    gs_config = 0x1000;
+    gs_die = HEATER_SIM_AMBIENT;
+    gs_film = 0.0f;
+    gs_rh = rh;
+    gs_fog = 0;
+    gs_heater_ms = 0;
+    result->recovery_ms = -1;
+    result->block_ms = 0;
+    result->readings = 0;
+    result->lost = 0;
+    result->flagged = 0;
+    result->bad = 0;
+    result->after_ms = 0;
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, a_sim_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, a_sim_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, a_sim_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, a_sim_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, a_sim_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, a_sim_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, a_sim_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, a_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, a_debug_log);
+    if (hdc1080_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    if (scheme == HEATER_SIM_SCHEME_SCHEDULER)
+    {
+        if ((hdc1080_heater_init(&heater, &gs_handle, a_sim_get_tick_ms) != 0) ||
+            (hdc1080_heater_set_burst(&heater, setting->burst_ms, HDC1080_HEATER_DEFAULT_COOL_MS,
+                                      HDC1080_HEATER_DEFAULT_EPISODE_MS, HDC1080_HEATER_DEFAULT_HOLDOFF_MS) != 0) ||
+            (hdc1080_heater_set_budget(&heater, setting->duty, HDC1080_HEATER_DEFAULT_CREDIT_MS,
+                                       HEATER_SIM_HEATER_MW, 0.0f) != 0))
+        {
+            return 1;
+        }
+    }
+    gs_tick_ms = 0;
+    gs_heater_ms = 0;
+    
+    /* one read per period, a read that blocks past a period loses it */
+    end = before_ms + fog_ms + after_ms;
+    next = 0;
+    while (next < end)
+    {
+        if (gs_tick_ms < next)
+        {
+            a_sim_advance(next - gs_tick_ms, 0);
+        }
+        gs_fog = (uint8_t)((gs_tick_ms >= before_ms) && (gs_tick_ms < before_ms + fog_ms));
+        gs_rh = (gs_fog != 0) ? 100.0f : rh;
+        truth = gs_rh;
+        start = gs_tick_ms;
+        flags = 0;
+        if (scheme == HEATER_SIM_SCHEME_SCHEDULER)
+        {
+            if (hdc1080_heater_read(&heater, &temperature_raw, &temperature, &humidity_raw, &humidity, &flags) != 0)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            if (hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature,
+                                                  &humidity_raw, &humidity) != 0)
+            {
+                return 1;
+            }
+        }
+        result->readings++;
+        if (start < before_ms + fog_ms)
+        {
+            result->after_ms = gs_heater_ms;
+        }
+        if (flags != 0)
+        {
+            result->flagged++;
+        }
+        else if (fabsf(humidity - truth) > HEATER_SIM_ERROR)
+        {
+            result->bad++;
+        }
+        else if ((result->recovery_ms < 0) && (start >= before_ms + fog_ms))
+        {
+            result->recovery_ms = (int32_t)(start - before_ms - fog_ms);
+        }
+        
+        /* the manual scheme blocks for 20s */
+        if (scheme == HEATER_SIM_SCHEME_MANUAL)
+        {
+            saturated = (humidity >= HDC1080_HEATER_DEFAULT_SATURATION) ? (uint8_t)(saturated + 1) : 0;
+            if ((saturated >= HDC1080_HEATER_DEFAULT_COUNT) || ((heated != 0) && (saturated != 0)))
+            {
+                if (hdc1080_set_heater(&gs_handle, HDC1080_BOOL_TRUE) != 0)
+                {
+                    return 1;
+                }
+                while (gs_tick_ms - start < 10000)
+                {
+                    (void)hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature,
+                                                            &humidity_raw, &humidity);
+                }
+                if (hdc1080_set_heater(&gs_handle, HDC1080_BOOL_FALSE) != 0)
+                {
+                    return 1;
+                }
+                a_sim_delay_ms(10000);
+                saturated = 0;
+                heated = 1;
+            }
+            else
+            {
+                heated = 0;
+            }
+        }
+        if (gs_tick_ms - start > result->block_ms)
+        {
+            result->block_ms = gs_tick_ms - start;
+        }
+        next += period_ms;
+        while ((next <= gs_tick_ms) && (next < end))
+        {
+            result->lost++;
+            next += period_ms;
+        }
+    }
+    result->heater_ms = gs_heater_ms;
+    result->after_ms = gs_heater_ms - result->after_ms;
+    (void)hdc1080_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief     print one result
+ * @param[in] *name scheme name
+ * @param[in] *result pointer to a result structure
+ * @note      none
+ */
+static void a_print(const char *name, const heater_sim_result_t *result)
+{
+    char recovery[16];
+    
+    if (result->recovery_ms < 0)
+    {
+        (void)snprintf(recovery, sizeof(recovery), "never");
+    }
+    else
+    {
+        (void)snprintf(recovery, sizeof(recovery), "%0.1f", (float)result->recovery_ms / 1000.0f);
+    }
+    printf("%-21s  %11s  %10.1f  %15.1f  %11u  %8u  %5u  %7u  %4u\n", name, recovery,
+           HEATER_SIM_HEATER_MW * (float)result->heater_ms / 1000.0f,
+           HEATER_SIM_HEATER_MW * (float)result->after_ms / 1000.0f, result->block_ms, result->readings,
+           result->lost, result->flagged, result->bad);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_heater_sim [--period=<ms>] [--fog=<min>] [--after=<min>] [--rh=<%>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t period_ms = 1000;
+    uint32_t fog_min = 30;
+    uint32_t after_min = 90;
+    float rh = 85.0f;
+    char name[32];
+    heater_sim_result_t result;
+    const struct option long_options[] =
+    {
+        {"period", required_argument, NULL, 'p'},
+        {"fog", required_argument, NULL, 'f'},
+        {"after", required_argument, NULL, 'a'},
+        {"rh", required_argument, NULL, 'r'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'p' : period_ms = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'f' : fog_min = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'a' : after_min = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r' : rh = strtof(optarg, NULL); break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--period=<ms>] [--fog=<min>] [--after=<min>] [--rh=<%%>]\n",
+                        argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if ((period_ms == 0) || (rh >= HDC1080_HEATER_DEFAULT_DRY))
+    {
+        fprintf(stderr, "hdc1080_heater_sim: period must not be 0 and rh must stay below %0.0f%%.\n",
+                HDC1080_HEATER_DEFAULT_DRY);
+        
+        return 1;
+    }
+    
+    /* the same fog for every scheme */
+    printf("%0.0fC air, %umin fog, then %umin at %0.0f%%, one read every %ums.\n", HEATER_SIM_AMBIENT,
+           fog_min, after_min, rh, period_ms);
+    printf("scheme                 recovery(s)  heater(mJ)  after fog(mJ)  longest(ms)  readings  lost  flagged  bad\n");
+    if (a_run(HEATER_SIM_SCHEME_NONE, NULL, period_ms, 60000, fog_min * 60000,
+              after_min * 60000, rh, &result) != 0)
+    {
+        return 1;
+    }
+    a_print("none", &result);
+    if (a_run(HEATER_SIM_SCHEME_MANUAL, NULL, period_ms, 60000, fog_min * 60000,
+              after_min * 60000, rh, &result) != 0)
+    {
+        return 1;
+    }
+    a_print("manual 10s/10s", &result);
+    for (i = 0; i < sizeof(gsc_setting) / sizeof(gsc_setting[0]); i++)
+    {
+        if (a_run(HEATER_SIM_SCHEME_SCHEDULER, &gsc_setting[i], period_ms, 60000, fog_min * 60000,
+                  after_min * 60000, rh, &result) != 0)
+        {
+            fprintf(stderr, "hdc1080_heater_sim: scheduler run failed.\n");
+            
+            return 1;
+        }
+        (void)snprintf(name, sizeof(name), "scheduler %u%% %ums", gsc_setting[i].duty / 10, gsc_setting[i].burst_ms);
+        a_print(name, &result);
+    }
+    
+    return 0;
+}
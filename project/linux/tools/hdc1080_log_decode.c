@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_log_decode.c
+ * @brief     hdc1080 debug log decode tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_log.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief log decode tool max line length definition
+ */
+#define LOG_DECODE_MAX_LEN        256        /**< max console line length */
+
+/**
+ * @brief log decode statistics structure definition
+ */
+typedef struct log_decode_stat_s
+{
+    uint32_t records;        /**< decoded records */
+    uint32_t gaps;           /**< records missing in the sequence */
+    uint32_t lost;           /**< records the target reported lost */
+    uint32_t unknown;        /**< records with an unknown message id */
+    uint32_t invalid;        /**< damaged record lines */
+} log_decode_stat_t;
+
+/**
+ * @brief     convert a hex digit
+ * @param[in] c hex character
+ * @return    value or -1 if it is not a hex digit
+ * @note      none
+ */
+static int a_hex(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return c - '0';
+    }
+    if ((c >= 'A') && (c <= 'F'))
+    {
+        return c - 'A' + 10;
+    }
+    if ((c >= 'a') && (c <= 'f'))
+    {
+        return c - 'a' + 10;
+    }
+    
+    return -1;
+}
+
+/**
+ * @brief         decode one record line and print its message
+ * @param[in]     *hex pointer to the text after the prefix
+ * @param[in,out] *stat pointer to a decode statistics structure
+ * @param[in,out] *next_seq pointer to an expected sequence buffer, -1 before the first record
+ * @note          the line holds HDC1080_LOG_RECORD_SIZE packed bytes as hex digits
+ */
+static void a_decode_record(const char *hex, log_decode_stat_t *stat, int32_t *next_seq)
+{
+    uint32_t i;
+    int hi;
+    int lo;
+    char text[128];
+    uint8_t buf[HDC1080_LOG_RECORD_SIZE];
+    hdc1080_log_record_t record;
+    
+    /* parse the packed bytes */
+    for (i = 0; i < HDC1080_LOG_RECORD_SIZE; i++)
+    {
+        hi = a_hex(hex[i * 2 + 0]);
+        lo = (hi < 0) ? -1 : a_hex(hex[i * 2 + 1]);
+        if (lo < 0)
+        {
+            stat->invalid++;
+            
+            return;
+        }
+        buf[i] = (uint8_t)((hi << 4) | lo);
+    }
+    if ((hex[i * 2] != '\0') && (hex[i * 2] != '\r') && (hex[i * 2] != '\n'))
+    {
+        stat->invalid++;
+        
+        return;
+    }
+    (void)hdc1080_log_unpack(buf, &record);
+    
+    /* check the sequence, a record lost on the target also skips one */
+    if ((*next_seq >= 0) && (record.seq != (uint8_t)(*next_seq)))
+    {
+        stat->gaps += (uint8_t)(record.seq - (uint8_t)(*next_seq));
+    }
+    *next_seq = (int32_t)((uint8_t)(record.seq + 1));
+    stat->records++;
+    
+    /* output */
+    if (hdc1080_log_format(&record, text, sizeof(text)) != 0)
+    {
+        stat->unknown++;
+    }
+    fputs(text, stdout);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_log_decode [console.log], it reads stdin without a file,
+ *            the record lines are replaced by their messages and the other lines are copied
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    char line[LOG_DECODE_MAX_LEN];
+    size_t prefix;
+    size_t lost_prefix;
+    uint32_t lost;
+    int32_t next_seq = -1;
+    log_decode_stat_t stat;
+    
+    /* open the capture */
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [console.log]\n", argv[0]);
+        
+        return 1;
+    }
+    if (argc == 2)
+    {
+        f = fopen(argv[1], "r");
+        if (f == NULL)
+        {
+            fprintf(stderr, "hdc1080_log_decode: open %s failed.\n", argv[1]);
+            
+            return 1;
+        }
+    }
+    else
+    {
+        f = stdin;
+    }
+    
+    /* decode the record lines, copy the shell text */
+    memset(&stat, 0, sizeof(log_decode_stat_t));
+    prefix = strlen(HDC1080_LOG_LINE_PREFIX);
+    lost_prefix = strlen(HDC1080_LOG_LINE_LOST);
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        if (strncmp(line, HDC1080_LOG_LINE_LOST, lost_prefix) == 0)
+        {
+            lost = (uint32_t)strtoul(&line[lost_prefix], NULL, 10);
+            stat.lost += lost;
+            printf("hdc1080: %u log records lost.\n", lost);
+        }
+        else if (strncmp(line, HDC1080_LOG_LINE_PREFIX, prefix) == 0)
+        {
+            a_decode_record(&line[prefix], &stat, &next_seq);
+        }
+        else
+        {
+            fputs(line, stdout);
+        }
+    }
+    if (f != stdin)
+    {
+        (void)fclose(f);
+    }
+    
+    /* print the statistics */
+    fprintf(stderr, "hdc1080_log_decode: %u records, %u sequence gaps, %u lost on the target, "
+            "%u unknown ids, %u invalid lines.\n", stat.records, stat.gaps, stat.lost, stat.unknown, stat.invalid);
+    
+    return 0;
+}
@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_metrics_bench.c
+ * @brief     hdc1080 metrics benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_hdc1080_metrics.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief metrics bench grid definition
+ */
+#define METRICS_BENCH_STEP          64                              /**< raw code step of the grid */
+#define METRICS_BENCH_HUMIDITY_MIN  656                             /**< 1% in raw code */
+#define METRICS_BENCH_EDGE_F        0.05                            /**< skipped distance from a heat index branch in F */
+#define METRICS_BENCH_ROUNDS        8                               /**< timing rounds */
+
+/**
+ * @brief metrics bench error structure definition
+ */
+typedef struct metrics_bench_error_s
+{
+    double dew_point;                                               /**< max dew point error in C */
+    double absolute_humidity;                                       /**< max absolute humidity error in mg/m3 */
+    double absolute_humidity_ratio;                                 /**< max absolute humidity error in % above 10g/m3 */
+    double heat_index;                                              /**< max heat index error in C */
+} metrics_bench_error_t;
+
+/**
+ * @brief      reference metrics in double precision
+ * @param[in]  t temperature in C
+ * @param[in]  h relative humidity in %
+ * @param[out] *dp pointer to a dew point buffer
+ * @param[out] *ah pointer to an absolute humidity buffer
+ * @param[out] *hi pointer to a heat index buffer
+ * @return     1 if the heat index is close to a branch of the nws algorithm, else 0
+ * @note       none
+ */
+static int a_reference(double t, double h, double *dp, double *ah, double *hi)
+{
+    double x;
+    double g;
+    double tf;
+    double s;
+    double v;
+    int edge = 0;
+    
+    x = 17.62 * t / (243.12 + t);
+    g = log(h / 100.0) + x;
+    *dp = 243.12 * g / (17.62 - g);
+    *ah = 216.7 * 6.112 * exp(x) * h / 100.0 / (273.15 + t);
+    tf = t * 1.8 + 32.0;
+    s = 0.5 * (tf + 61.0 + (tf - 68.0) * 1.2 + h * 0.094);
+    v = s;
+    if (fabs((s + tf) * 0.5 - 80.0) < METRICS_BENCH_EDGE_F)
+    {
+        edge = 1;
+    }
+    if ((s + tf) * 0.5 >= 80.0)
+    {
+        v = -42.379 + 2.04901523 * tf + 10.14333127 * h - 0.22475541 * tf * h - 0.00683783 * tf * tf
+            - 0.05481717 * h * h + 0.00122874 * tf * tf * h + 0.00085282 * tf * h * h
+            - 0.00000199 * tf * tf * h * h;
+        if ((fabs(h - 13.0) < 0.01) || (fabs(h - 85.0) < 0.01) || (fabs(tf - 80.0) < METRICS_BENCH_EDGE_F) ||
+            (fabs(tf - 87.0) < METRICS_BENCH_EDGE_F) || (fabs(tf - 112.0) < METRICS_BENCH_EDGE_F))
+        {
+            edge = 1;
+        }
+        if ((h < 13.0) && (tf >= 80.0) && (tf <= 112.0))
+        {
+            v -= ((13.0 - h) / 4.0) * sqrt((17.0 - fabs(tf - 95.0)) / 17.0);
+        }
+        else if ((h > 85.0) && (tf >= 80.0) && (tf <= 87.0))
+        {
+            v += ((h - 85.0) / 10.0) * ((87.0 - tf) / 5.0);
+        }
+    }
+    *hi = (v - 32.0) / 1.8;
+    
+    return edge;
+}
+
+/**
+ * @brief      update the max error
+ * @param[in]  *e pointer to an error structure
+ * @param[in]  dp dew point
+ * @param[in]  ah absolute humidity
+ * @param[in]  hi heat index
+ * @param[in]  rdp reference dew point
+ * @param[in]  rah reference absolute humidity
+ * @param[in]  rhi reference heat index
+ * @param[in]  edge 1 skips the heat index
+ * @note       none
+ */
+static void a_update(metrics_bench_error_t *e, double dp, double ah, double hi,
+                     double rdp, double rah, double rhi, int edge)
+{
+    if (fabs(dp - rdp) > e->dew_point)
+    {
+        e->dew_point = fabs(dp - rdp);
+    }
+    if (fabs(ah - rah) * 1000.0 > e->absolute_humidity)
+    {
+        e->absolute_humidity = fabs(ah - rah) * 1000.0;
+    }
+    if ((rah >= 10.0) && (fabs(ah - rah) / rah * 100.0 > e->absolute_humidity_ratio))
+    {
+        e->absolute_humidity_ratio = fabs(ah - rah) / rah * 100.0;
+    }
+    if ((edge == 0) && (fabs(hi - rhi) > e->heat_index))
+    {
+        e->heat_index = fabs(hi - rhi);
+    }
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  main function
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   usage: hdc1080_metrics_bench
+ */
+int main(void)
+{
+    uint32_t n = 0;
+    uint32_t i;
+    uint32_t t;
+    uint32_t h;
+    uint32_t r;
+    uint32_t skipped = 0;
+    uint16_t *t_raw;
+    uint16_t *h_raw;
+    float *t_f;
+    float *h_f;
+    hdc1080_metrics_t *m;
+    hdc1080_metrics_fixed_t *mf;
+    metrics_bench_error_t e_exact = {0};
+    metrics_bench_error_t e_fast = {0};
+    metrics_bench_error_t e_fixed = {0};
+    double start;
+    double ns[3];
+    double rdp;
+    double rah;
+    double rhi;
+    volatile double sink = 0.0;
+    int edge;
+    
+    /* build the raw code grid */
+    t_raw = malloc(sizeof(uint16_t) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    h_raw = malloc(sizeof(uint16_t) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    t_f = malloc(sizeof(float) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    h_f = malloc(sizeof(float) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    m = malloc(sizeof(hdc1080_metrics_t) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    mf = malloc(sizeof(hdc1080_metrics_fixed_t) * (65536 / METRICS_BENCH_STEP) * (65536 / METRICS_BENCH_STEP));
+    if ((t_raw == NULL) || (h_raw == NULL) || (t_f == NULL) || (h_f == NULL) || (m == NULL) || (mf == NULL))
+    {
+        fprintf(stderr, "hdc1080_metrics_bench: out of memory.\n");
+        
+        return 1;
+    }
+    for (t = 0; t < 65536; t += METRICS_BENCH_STEP)
+    {
+        for (h = METRICS_BENCH_HUMIDITY_MIN; h < 65536; h += METRICS_BENCH_STEP)
+        {
+            t_raw[n] = (uint16_t)t;
+            h_raw[n] = (uint16_t)h;
+            t_f[n] = (float)t / 65536.0f * 165.0f - 40.0f;
+            h_f[n] = (float)h / 65536.0f * 100.0f;
+            n++;
+        }
+    }
+    
+    /* accuracy against the double reference */
+    for (i = 0; i < n; i++)
+    {
+        edge = a_reference((double)t_raw[i] / 65536.0 * 165.0 - 40.0, (double)h_raw[i] / 65536.0 * 100.0,
+                           &rdp, &rah, &rhi);
+        skipped += (uint32_t)edge;
+        (void)hdc1080_metrics_exact(t_f[i], h_f[i], &m[0]);
+        a_update(&e_exact, m[0].dew_point, m[0].absolute_humidity, m[0].heat_index, rdp, rah, rhi, edge);
+        (void)hdc1080_metrics_fast(t_f[i], h_f[i], &m[0]);
+        a_update(&e_fast, m[0].dew_point, m[0].absolute_humidity, m[0].heat_index, rdp, rah, rhi, edge);
+        (void)hdc1080_metrics_fixed(t_raw[i], h_raw[i], &mf[0]);
+        a_update(&e_fixed, mf[0].dew_point / 100.0, mf[0].absolute_humidity / 1000.0, mf[0].heat_index / 100.0,
+                 rdp, rah, rhi, edge);
+    }
+    
+    /* throughput of the batch api */
+    for (r = 0; r < 3; r++)
+    {
+        start = a_now_ns();
+        for (i = 0; i < METRICS_BENCH_ROUNDS; i++)
+        {
+            if (r == 0)
+            {
+                (void)hdc1080_metrics_exact_batch(t_f, h_f, m, n);
+                sink += m[i].dew_point;
+            }
+            else if (r == 1)
+            {
+                (void)hdc1080_metrics_fast_batch(t_f, h_f, m, n);
+                sink += m[i].dew_point;
+            }
+            else
+            {
+                (void)hdc1080_metrics_fixed_batch(t_raw, h_raw, mf, n);
+                sink += mf[i].dew_point;
+            }
+        }
+        ns[r] = (a_now_ns() - start) / ((double)n * METRICS_BENCH_ROUNDS);
+    }
+    
+    printf("%u samples, -40C to 125C, 1%% to 100%%, %u heat index samples next to a branch skipped.\n", n, skipped);
+    printf("max error against a double precision reference, the relative absolute humidity error is above 10g/m3.\n");
+    printf("tier    dew point(C)  abs humidity(mg/m3)  abs humidity(%%)  heat index(C)  ns/sample\n");
+    printf("exact   %12.4f  %19.4f  %15.4f  %13.4f  %9.1f\n", e_exact.dew_point, e_exact.absolute_humidity,
+           e_exact.absolute_humidity_ratio, e_exact.heat_index, ns[0]);
+    printf("fast    %12.4f  %19.4f  %15.4f  %13.4f  %9.1f\n", e_fast.dew_point, e_fast.absolute_humidity,
+           e_fast.absolute_humidity_ratio, e_fast.heat_index, ns[1]);
+    printf("fixed   %12.4f  %19.4f  %15.4f  %13.4f  %9.1f\n", e_fixed.dew_point, e_fixed.absolute_humidity,
+           e_fixed.absolute_humidity_ratio, e_fixed.heat_index, ns[2]);
+    
+    free(t_raw);
+    free(h_raw);
+    free(t_f);
+    free(h_f);
+    free(m);
+    free(mf);
+    
+    return 0;
+}
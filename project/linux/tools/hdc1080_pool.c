@@ -0,0 +1,834 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_pool.c
+ * @brief     hdc1080 work stealing acquisition pool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "hdc1080_pool.h"
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief pool sensor state definition
+ */
+#define POOL_STATE_TRIGGER        0        /**< next transaction triggers a conversion */
+#define POOL_STATE_FETCH          1        /**< next transaction fetches the conversion */
+
+/**
+ * @brief pool bus structure definition
+ * @note  only the worker holding the bus touches the queue, due_us and the queue are handed over with the bus
+ */
+typedef struct hdc1080_pool_bus_s
+{
+    uint32_t *queue;                 /**< sensors of the bus, a min heap ordered by their next transaction */
+    uint32_t queue_len;              /**< queued sensors */
+    uint64_t sequence;               /**< queue sequence */
+    uint64_t due_us;                 /**< next transaction of a waiting bus */
+    uint32_t home;                   /**< worker queue the bus returns to after a wait */
+} hdc1080_pool_bus_t;
+
+/**
+ * @brief pool worker structure definition
+ */
+typedef struct hdc1080_pool_worker_s
+{
+    hdc1080_pool_t *pool;            /**< pool */
+    pthread_t thread;                /**< thread */
+    pthread_mutex_t mutex;           /**< guards the bus queue of the worker */
+    uint32_t *deque;                 /**< ready buses, the owner takes the last, a thief the first */
+    uint32_t head;                   /**< first entry */
+    uint32_t len;                    /**< entry number */
+    uint32_t index;                  /**< worker index */
+    uint32_t ready;                  /**< queued buses, guarded by the pool mutex */
+    uint64_t transactions;           /**< triggers and fetches */
+    uint64_t runs;                   /**< bus runs */
+    uint64_t steals;                 /**< stolen bus runs */
+    uint64_t sleeps;                 /**< idle waits */
+    uint64_t busy_us;                /**< time spent running buses */
+} hdc1080_pool_worker_t;
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_pool_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     compare two sensors of a bus
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] a first sensor index
+ * @param[in] b second sensor index
+ * @return    1 if a is due before b
+ * @note      none
+ */
+static uint8_t a_pool_sensor_before(hdc1080_pool_t *pool, uint32_t a, uint32_t b)
+{
+    if (pool->sensor[a].due_us != pool->sensor[b].due_us)
+    {
+        return pool->sensor[a].due_us < pool->sensor[b].due_us;
+    }
+    
+    return pool->sensor[a].sequence < pool->sensor[b].sequence;
+}
+
+/**
+ * @brief     queue the next transaction of a sensor
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *bus pointer to the bus of the sensor
+ * @param[in] index sensor index
+ * @param[in] due_us time of the transaction
+ * @note      none
+ */
+static void a_pool_sensor_push(hdc1080_pool_t *pool, hdc1080_pool_bus_t *bus, uint32_t index, uint64_t due_us)
+{
+    uint32_t i;
+    uint32_t parent;
+    
+    pool->sensor[index].due_us = due_us;
+    pool->sensor[index].sequence = bus->sequence++;
+    i = bus->queue_len++;
+    bus->queue[i] = index;
+    while (i > 0)
+    {
+        parent = (i - 1) / 2;
+        if (a_pool_sensor_before(pool, bus->queue[parent], index) != 0)
+        {
+            break;
+        }
+        bus->queue[i] = bus->queue[parent];
+        bus->queue[parent] = index;
+        i = parent;
+    }
+}
+
+/**
+ * @brief     remove the first sensor of a bus
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *bus pointer to a bus
+ * @return    sensor index
+ * @note      the queue must not be empty
+ */
+static uint32_t a_pool_sensor_pop(hdc1080_pool_t *pool, hdc1080_pool_bus_t *bus)
+{
+    uint32_t first = bus->queue[0];
+    uint32_t i = 0;
+    uint32_t child;
+    uint32_t t;
+    
+    bus->queue[0] = bus->queue[--bus->queue_len];
+    while (1)
+    {
+        child = 2 * i + 1;
+        if (child >= bus->queue_len)
+        {
+            break;
+        }
+        if ((child + 1 < bus->queue_len) && (a_pool_sensor_before(pool, bus->queue[child + 1], bus->queue[child]) != 0))
+        {
+            child++;
+        }
+        if (a_pool_sensor_before(pool, bus->queue[i], bus->queue[child]) != 0)
+        {
+            break;
+        }
+        t = bus->queue[i];
+        bus->queue[i] = bus->queue[child];
+        bus->queue[child] = t;
+        i = child;
+    }
+    
+    return first;
+}
+
+/**
+ * @brief     add a waiting bus to the timer heap
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] b bus index
+ * @note      the pool mutex must be held
+ */
+static void a_pool_timer_push(hdc1080_pool_t *pool, uint32_t b)
+{
+    uint32_t i;
+    uint32_t parent;
+    
+    i = pool->timer_len++;
+    pool->timer[i] = b;
+    while (i > 0)
+    {
+        parent = (i - 1) / 2;
+        if (pool->bus[pool->timer[parent]].due_us <= pool->bus[b].due_us)
+        {
+            break;
+        }
+        pool->timer[i] = pool->timer[parent];
+        pool->timer[parent] = b;
+        i = parent;
+    }
+}
+
+/**
+ * @brief     remove the first waiting bus
+ * @param[in] *pool pointer to a pool structure
+ * @return    bus index
+ * @note      the pool mutex must be held and the heap must not be empty
+ */
+static uint32_t a_pool_timer_pop(hdc1080_pool_t *pool)
+{
+    uint32_t first = pool->timer[0];
+    uint32_t i = 0;
+    uint32_t child;
+    uint32_t t;
+    
+    pool->timer[0] = pool->timer[--pool->timer_len];
+    while (1)
+    {
+        child = 2 * i + 1;
+        if (child >= pool->timer_len)
+        {
+            break;
+        }
+        if ((child + 1 < pool->timer_len) &&
+            (pool->bus[pool->timer[child + 1]].due_us < pool->bus[pool->timer[child]].due_us))
+        {
+            child++;
+        }
+        if (pool->bus[pool->timer[i]].due_us <= pool->bus[pool->timer[child]].due_us)
+        {
+            break;
+        }
+        t = pool->timer[i];
+        pool->timer[i] = pool->timer[child];
+        pool->timer[child] = t;
+        i = child;
+    }
+    
+    return first;
+}
+
+/**
+ * @brief     queue a ready bus at a worker
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *w pointer to a worker
+ * @param[in] b bus index
+ * @param[in] locked 1 if the pool mutex is held
+ * @note      the counts are raised before the bus is visible, so a thief never sees a count below the queued buses
+ */
+static void a_pool_put(hdc1080_pool_t *pool, hdc1080_pool_worker_t *w, uint32_t b, uint8_t locked)
+{
+    if (locked == 0)
+    {
+        pthread_mutex_lock(&pool->mutex);
+    }
+    w->ready++;
+    pool->ready++;
+    if (pool->sleeping != 0)
+    {
+        pthread_cond_broadcast(&pool->cond);
+    }
+    if (locked == 0)
+    {
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    pthread_mutex_lock(&w->mutex);
+    w->deque[(w->head + w->len) % pool->bus_num] = b;
+    w->len++;
+    pthread_mutex_unlock(&w->mutex);
+}
+
+/**
+ * @brief      take a ready bus from a worker
+ * @param[in]  *pool pointer to a pool structure
+ * @param[in]  *w pointer to a worker
+ * @param[in]  first 1 takes the oldest bus as a thief, 0 the newest as the owner
+ * @param[out] *b pointer to a bus index buffer
+ * @return     1 if a bus was taken
+ * @note       none
+ */
+static uint8_t a_pool_take(hdc1080_pool_t *pool, hdc1080_pool_worker_t *w, uint8_t first, uint32_t *b)
+{
+    uint8_t taken = 0;
+    
+    pthread_mutex_lock(&w->mutex);
+    if (w->len != 0)
+    {
+        if (first != 0)
+        {
+            *b = w->deque[w->head];
+            w->head = (w->head + 1) % pool->bus_num;
+        }
+        else
+        {
+            *b = w->deque[(w->head + w->len - 1) % pool->bus_num];
+        }
+        w->len--;
+        taken = 1;
+    }
+    pthread_mutex_unlock(&w->mutex);
+    if (taken != 0)
+    {
+        pthread_mutex_lock(&pool->mutex);
+        w->ready--;
+        pool->ready--;
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    
+    return taken;
+}
+
+/**
+ * @brief     run one transaction of a sensor
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *w pointer to the running worker
+ * @param[in] *s pointer to a sensor
+ * @param[in] now current time
+ * @return    1 if the sensor finished its reads
+ * @note      a trigger sets the fetch after the conversion time, a nacked fetch is retried later
+ */
+static uint8_t a_pool_step(hdc1080_pool_t *pool, hdc1080_pool_worker_t *w, hdc1080_pool_sensor_t *s, uint64_t now)
+{
+    uint8_t res;
+    
+    if (pool->select != NULL)
+    {
+        pool->select(s);
+    }
+    w->transactions++;
+    if (s->state == POOL_STATE_TRIGGER)
+    {
+        s->period_us = s->due_us;
+        s->retry = 0;
+        res = hdc1080_start_temperature_humidity(s->handle);
+        if (res == 0)
+        {
+            s->state = POOL_STATE_FETCH;
+            s->due_us = now + pool->wait_us;
+            
+            return 0;
+        }
+    }
+    else
+    {
+        res = hdc1080_fetch_temperature_humidity(s->handle, &s->temperature_raw, &s->temperature,
+                                                 &s->humidity_raw, &s->humidity);
+        if ((res == 1) && (s->retry < HDC1080_POOL_FETCH_RETRY))
+        {
+            s->naks++;
+            s->retry++;
+            s->due_us = now + HDC1080_POOL_RETRY_US;
+            
+            return 0;
+        }
+    }
+    if (res == 0)
+    {
+        s->reads++;
+    }
+    else
+    {
+        s->errors++;
+    }
+    if (s->reads + s->errors >= pool->reads)
+    {
+        return 1;
+    }
+    s->state = POOL_STATE_TRIGGER;
+    s->due_us = s->period_us + pool->period_us;
+    if (s->due_us < now)
+    {
+        s->due_us = now;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the due transactions of a bus
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *w pointer to the running worker
+ * @param[in] b bus index
+ * @return    time of the next transaction, UINT64_MAX if every sensor of the bus finished
+ * @note      at most HDC1080_POOL_BATCH transactions, so a busy bus does not hold a worker
+ */
+static uint64_t a_pool_bus_run(hdc1080_pool_t *pool, hdc1080_pool_worker_t *w, uint32_t b)
+{
+    hdc1080_pool_bus_t *bus = &pool->bus[b];
+    uint32_t n = 0;
+    uint32_t index;
+    uint64_t now = a_pool_now_us();
+    
+    while ((bus->queue_len != 0) && (pool->sensor[bus->queue[0]].due_us <= now) && (n < HDC1080_POOL_BATCH))
+    {
+        index = a_pool_sensor_pop(pool, bus);
+        if (a_pool_step(pool, w, &pool->sensor[index], now) == 0)
+        {
+            a_pool_sensor_push(pool, bus, index, pool->sensor[index].due_us);
+        }
+        n++;
+        now = a_pool_now_us();
+    }
+    if (bus->queue_len == 0)
+    {
+        return UINT64_MAX;
+    }
+    
+    return pool->sensor[bus->queue[0]].due_us;
+}
+
+/**
+ * @brief     worker thread
+ * @param[in] *arg pointer to a worker
+ * @return    NULL
+ * @note      runs its own buses first, then steals, then moves the expired waiting buses, then sleeps
+ */
+static void *a_pool_worker(void *arg)
+{
+    hdc1080_pool_worker_t *w = (hdc1080_pool_worker_t *)arg;
+    hdc1080_pool_t *pool = w->pool;
+    uint32_t b = 0;
+    uint32_t k;
+    uint32_t avail;
+    uint8_t taken;
+    uint8_t expired;
+    uint64_t start;
+    uint64_t next;
+    uint64_t now;
+    struct timespec ts;
+    
+    /* wait until every worker is created */
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->go == 0)
+    {
+        (void)pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    if (pool->go != 1)
+    {
+        return NULL;
+    }
+    
+    while (1)
+    {
+        /* own buses first, then the oldest bus of another worker */
+        taken = a_pool_take(pool, w, 0, &b);
+        for (k = 1; (taken == 0) && (pool->steal != 0) && (k < pool->worker_num); k++)
+        {
+            taken = a_pool_take(pool, &pool->worker[(w->index + k) % pool->worker_num], 1, &b);
+            if (taken != 0)
+            {
+                w->steals++;
+            }
+        }
+        if (taken != 0)
+        {
+            start = a_pool_now_us();
+            next = a_pool_bus_run(pool, w, b);
+            now = a_pool_now_us();
+            w->busy_us += now - start;
+            w->runs++;
+            if (next == UINT64_MAX)
+            {
+                pthread_mutex_lock(&pool->mutex);
+                pool->remaining--;
+                if (pool->remaining == 0)
+                {
+                    pthread_cond_broadcast(&pool->cond);
+                }
+                pthread_mutex_unlock(&pool->mutex);
+            }
+            else if (next <= now)
+            {
+                /* more is due, queue it behind the other ready buses of this worker */
+                a_pool_put(pool, (pool->steal != 0) ? w : &pool->worker[pool->bus[b].home], b, 0);
+            }
+            else
+            {
+                pthread_mutex_lock(&pool->mutex);
+                pool->bus[b].due_us = next;
+                a_pool_timer_push(pool, b);
+                if ((pool->sleeping != 0) && (pool->timer[0] == b))
+                {
+                    pthread_cond_broadcast(&pool->cond);
+                }
+                pthread_mutex_unlock(&pool->mutex);
+            }
+            
+            continue;
+        }
+        
+        /* nothing ready, move the expired buses back to their home workers or sleep */
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->remaining == 0)
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            
+            break;
+        }
+        now = a_pool_now_us();
+        expired = 0;
+        while ((pool->timer_len != 0) && (pool->bus[pool->timer[0]].due_us <= now))
+        {
+            b = a_pool_timer_pop(pool);
+            a_pool_put(pool, &pool->worker[pool->bus[b].home], b, 1);
+            expired = 1;
+        }
+        avail = (pool->steal != 0) ? pool->ready : w->ready;
+        if ((expired != 0) || (avail != 0))
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            if (expired == 0)
+            {
+                /* a bus is being queued or taken, let its worker finish */
+                sched_yield();
+            }
+            
+            continue;
+        }
+        pool->sleeping++;
+        w->sleeps++;
+        if (pool->timer_len != 0)
+        {
+            next = pool->bus[pool->timer[0]].due_us;
+            ts.tv_sec = (time_t)(next / 1000000);
+            ts.tv_nsec = (long)(next % 1000000) * 1000;
+            (void)pthread_cond_timedwait(&pool->cond, &pool->mutex, &ts);
+        }
+        else
+        {
+            (void)pthread_cond_wait(&pool->cond, &pool->mutex);
+        }
+        pool->sleeping--;
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     free the memory of the pool
+ * @param[in] *pool pointer to a pool structure
+ * @note      none
+ */
+static void a_pool_free(hdc1080_pool_t *pool)
+{
+    uint32_t i;
+    
+    if (pool->bus != NULL)
+    {
+        for (i = 0; i < pool->bus_num; i++)
+        {
+            free(pool->bus[i].queue);
+        }
+    }
+    if (pool->worker != NULL)
+    {
+        for (i = 0; i < pool->worker_num; i++)
+        {
+            free(pool->worker[i].deque);
+        }
+    }
+    free(pool->bus);
+    free(pool->worker);
+    free(pool->timer);
+    pool->bus = NULL;
+    pool->worker = NULL;
+    pool->timer = NULL;
+}
+
+/**
+ * @brief     initialize the pool
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *sensor pointer to a sensor array
+ * @param[in] sensor_num sensor number
+ * @param[in] bus_num bus number
+ * @param[in] worker_num worker number
+ * @param[in] *select pointer to a select function, it may be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 no memory
+ *            - 2 pool or sensor is NULL
+ *            - 4 a number or a bus index is invalid
+ * @note      the conversion wait defaults to the 14 bit sequence, the handles must be initialized in
+ *            HDC1080_MODE_SEQUENCE, select routes the driver interface of a worker thread to the sensor
+ */
+uint8_t hdc1080_pool_init(hdc1080_pool_t *pool, hdc1080_pool_sensor_t *sensor, uint32_t sensor_num,
+                          uint32_t bus_num, uint32_t worker_num, void (*select)(hdc1080_pool_sensor_t *sensor))
+{
+    uint32_t i;
+    uint32_t humidity_us;
+    pthread_condattr_t attr;
+    
+    if ((pool == NULL) || (sensor == NULL))
+    {
+        return 2;
+    }
+    if ((sensor_num == 0) || (bus_num == 0) || (worker_num == 0))
+    {
+        return 4;
+    }
+    for (i = 0; i < sensor_num; i++)
+    {
+        if (sensor[i].bus >= bus_num)
+        {
+            return 4;
+        }
+    }
+    
+    /* allocate the buses, the workers and the timer heap */
+    memset(pool, 0, sizeof(hdc1080_pool_t));
+    pool->sensor = sensor;
+    pool->sensor_num = sensor_num;
+    pool->bus_num = bus_num;
+    pool->worker_num = worker_num;
+    pool->select = select;
+    (void)hdc1080_get_conversion_time(HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT,
+                                      &pool->wait_us, &humidity_us);
+    pool->wait_us += humidity_us;
+    pool->bus = calloc(bus_num, sizeof(hdc1080_pool_bus_t));
+    pool->worker = calloc(worker_num, sizeof(hdc1080_pool_worker_t));
+    pool->timer = calloc(bus_num, sizeof(uint32_t));
+    if ((pool->bus == NULL) || (pool->worker == NULL) || (pool->timer == NULL))
+    {
+        a_pool_free(pool);
+        
+        return 1;
+    }
+    for (i = 0; i < bus_num; i++)
+    {
+        pool->bus[i].queue = calloc(sensor_num, sizeof(uint32_t));
+        if (pool->bus[i].queue == NULL)
+        {
+            a_pool_free(pool);
+            
+            return 1;
+        }
+    }
+    for (i = 0; i < worker_num; i++)
+    {
+        pool->worker[i].deque = calloc(bus_num, sizeof(uint32_t));
+        if (pool->worker[i].deque == NULL)
+        {
+            a_pool_free(pool);
+            
+            return 1;
+        }
+        pool->worker[i].pool = pool;
+        pool->worker[i].index = i;
+    }
+    for (i = 0; i < worker_num; i++)
+    {
+        pthread_mutex_init(&pool->worker[i].mutex, NULL);
+    }
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&pool->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&pool->mutex, NULL);
+    
+    return 0;
+}
+
+/**
+ * @brief     run the pool
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] reads reads per sensor
+ * @param[in] period_us read period, 0 reads back to back
+ * @param[in] steal 1 lets the workers steal
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 pool is NULL
+ * @note      returns when every sensor finished its reads, the results stay in the sensor array
+ */
+uint8_t hdc1080_pool_run(hdc1080_pool_t *pool, uint32_t reads, uint32_t period_us, uint8_t steal)
+{
+    uint32_t i;
+    uint32_t started = 0;
+    uint64_t now;
+    hdc1080_pool_sensor_t *s;
+    
+    if (pool == NULL)
+    {
+        return 2;
+    }
+    if (reads == 0)
+    {
+        return 0;
+    }
+    
+    /* reset the sensors and the workers, every bus starts ready at its home worker */
+    pool->reads = reads;
+    pool->period_us = period_us;
+    pool->steal = steal;
+    pool->timer_len = 0;
+    pool->ready = 0;
+    pool->remaining = 0;
+    pool->sleeping = 0;
+    for (i = 0; i < pool->worker_num; i++)
+    {
+        pool->worker[i].head = 0;
+        pool->worker[i].len = 0;
+        pool->worker[i].ready = 0;
+        pool->worker[i].transactions = 0;
+        pool->worker[i].runs = 0;
+        pool->worker[i].steals = 0;
+        pool->worker[i].sleeps = 0;
+        pool->worker[i].busy_us = 0;
+    }
+    for (i = 0; i < pool->bus_num; i++)
+    {
+        pool->bus[i].queue_len = 0;
+        pool->bus[i].sequence = 0;
+        pool->bus[i].home = i % pool->worker_num;
+    }
+    now = a_pool_now_us();
+    for (i = 0; i < pool->sensor_num; i++)
+    {
+        s = &pool->sensor[i];
+        s->reads = 0;
+        s->errors = 0;
+        s->naks = 0;
+        s->state = POOL_STATE_TRIGGER;
+        s->retry = 0;
+        a_pool_sensor_push(pool, &pool->bus[s->bus], i, now);
+    }
+    for (i = 0; i < pool->bus_num; i++)
+    {
+        if (pool->bus[i].queue_len != 0)
+        {
+            pool->remaining++;
+            a_pool_put(pool, &pool->worker[pool->bus[i].home], i, 0);
+        }
+    }
+    
+    /* create the workers, they start together or not at all */
+    pool->go = 0;
+    for (i = 0; i < pool->worker_num; i++)
+    {
+        if (pthread_create(&pool->worker[i].thread, NULL, a_pool_worker, &pool->worker[i]) != 0)
+        {
+            break;
+        }
+        started++;
+    }
+    pthread_mutex_lock(&pool->mutex);
+    pool->go = (started == pool->worker_num) ? 1 : 2;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+    for (i = 0; i < started; i++)
+    {
+        (void)pthread_join(pool->worker[i].thread, NULL);
+    }
+    
+    return (pool->go == 1) ? 0 : 1;
+}
+
+/**
+ * @brief      get the statistics of the last run
+ * @param[in]  *pool pointer to a pool structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pool or stats is NULL
+ * @note       none
+ */
+uint8_t hdc1080_pool_get_stats(hdc1080_pool_t *pool, hdc1080_pool_stats_t *stats)
+{
+    uint32_t i;
+    
+    if ((pool == NULL) || (stats == NULL))
+    {
+        return 2;
+    }
+    
+    memset(stats, 0, sizeof(hdc1080_pool_stats_t));
+    stats->busy_min_us = UINT64_MAX;
+    for (i = 0; i < pool->worker_num; i++)
+    {
+        stats->transactions += pool->worker[i].transactions;
+        stats->runs += pool->worker[i].runs;
+        stats->steals += pool->worker[i].steals;
+        stats->sleeps += pool->worker[i].sleeps;
+        if (pool->worker[i].busy_us > stats->busy_max_us)
+        {
+            stats->busy_max_us = pool->worker[i].busy_us;
+        }
+        if (pool->worker[i].busy_us < stats->busy_min_us)
+        {
+            stats->busy_min_us = pool->worker[i].busy_us;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     free the pool
+ * @param[in] *pool pointer to a pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 pool is NULL
+ * @note      none
+ */
+uint8_t hdc1080_pool_deinit(hdc1080_pool_t *pool)
+{
+    uint32_t i;
+    
+    if (pool == NULL)
+    {
+        return 2;
+    }
+    
+    if (pool->worker != NULL)
+    {
+        for (i = 0; i < pool->worker_num; i++)
+        {
+            pthread_mutex_destroy(&pool->worker[i].mutex);
+        }
+        pthread_cond_destroy(&pool->cond);
+        pthread_mutex_destroy(&pool->mutex);
+    }
+    a_pool_free(pool);
+    
+    return 0;
+}
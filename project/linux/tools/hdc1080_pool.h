@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_pool.h
+ * @brief     hdc1080 work stealing acquisition pool header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef HDC1080_POOL_H
+#define HDC1080_POOL_H
+
+#include "driver_hdc1080.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief pool definition
+ */
+#define HDC1080_POOL_BATCH            8           /**< transactions of one bus run before the bus is queued again */
+#define HDC1080_POOL_FETCH_RETRY      3           /**< fetch retries after the conversion time */
+#define HDC1080_POOL_RETRY_US         1000        /**< wait before a fetch retry */
+
+/**
+ * @brief pool sensor structure definition
+ * @note  handle, bus and user are set by the caller, the rest is written by the pool
+ */
+typedef struct hdc1080_pool_sensor_s
+{
+    hdc1080_handle_t *handle;              /**< initialized driver handle, sensors of one bus may share it */
+    uint32_t bus;                          /**< bus index */
+    void *user;                            /**< user data for the select hook */
+    uint16_t temperature_raw;              /**< last raw temperature */
+    uint16_t humidity_raw;                 /**< last raw humidity */
+    float temperature;                     /**< last temperature in C */
+    float humidity;                        /**< last humidity in % */
+    uint32_t reads;                        /**< good reads */
+    uint32_t errors;                       /**< failed reads */
+    uint32_t naks;                         /**< nacked fetches */
+    uint64_t due_us;                       /**< time of the next transaction */
+    uint64_t period_us;                    /**< start of the current read */
+    uint64_t sequence;                     /**< fifo order of the same due time */
+    uint8_t state;                         /**< next transaction, trigger or fetch */
+    uint8_t retry;                         /**< fetch retries of the current read */
+} hdc1080_pool_sensor_t;
+
+/**
+ * @brief pool statistics structure definition
+ */
+typedef struct hdc1080_pool_stats_s
+{
+    uint64_t transactions;                 /**< triggers and fetches */
+    uint64_t runs;                         /**< bus runs */
+    uint64_t steals;                       /**< bus runs taken from the queue of another worker */
+    uint64_t sleeps;                       /**< waits of an idle worker */
+    uint64_t busy_max_us;                  /**< longest busy time of one worker */
+    uint64_t busy_min_us;                  /**< shortest busy time of one worker */
+} hdc1080_pool_stats_t;
+
+/**
+ * @brief pool structure definition
+ * @note  a bus is a token held by at most one worker, the holder runs the due transactions of the bus in
+ *        order, so every bus is used exclusively and keeps its order, an idle worker steals a ready bus
+ *        from the queue of another worker
+ */
+typedef struct hdc1080_pool_s
+{
+    hdc1080_pool_sensor_t *sensor;                           /**< sensors */
+    uint32_t sensor_num;                                     /**< sensor number */
+    uint32_t bus_num;                                        /**< bus number */
+    uint32_t worker_num;                                     /**< worker number */
+    void (*select)(hdc1080_pool_sensor_t *sensor);           /**< called by the worker before every transaction of a sensor */
+    uint32_t wait_us;                                        /**< conversion wait */
+    uint32_t period_us;                                      /**< read period, 0 reads back to back */
+    uint32_t reads;                                          /**< reads per sensor */
+    uint8_t steal;                                           /**< 1 lets the workers steal, 0 pins bus b to worker b % worker_num */
+    struct hdc1080_pool_bus_s *bus;                          /**< bus states */
+    struct hdc1080_pool_worker_s *worker;                    /**< workers */
+    pthread_mutex_t mutex;                                   /**< guards the timer heap and the ready counts */
+    pthread_cond_t cond;                                     /**< wakes the idle workers */
+    uint32_t *timer;                                         /**< heap of the waiting buses */
+    uint32_t timer_len;                                      /**< waiting buses */
+    uint32_t ready;                                          /**< queued buses of all workers */
+    uint32_t remaining;                                      /**< buses with unfinished sensors */
+    uint32_t sleeping;                                       /**< idle workers */
+    uint8_t go;                                              /**< 1 starts the workers, 2 stops them before the run */
+} hdc1080_pool_t;
+
+/**
+ * @brief     initialize the pool
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] *sensor pointer to a sensor array
+ * @param[in] sensor_num sensor number
+ * @param[in] bus_num bus number
+ * @param[in] worker_num worker number
+ * @param[in] *select pointer to a select function, it may be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 no memory
+ *            - 2 pool or sensor is NULL
+ *            - 4 a number or a bus index is invalid
+ * @note      the conversion wait defaults to the 14 bit sequence, the handles must be initialized in
+ *            HDC1080_MODE_SEQUENCE, select routes the driver interface of a worker thread to the sensor
+ */
+uint8_t hdc1080_pool_init(hdc1080_pool_t *pool, hdc1080_pool_sensor_t *sensor, uint32_t sensor_num,
+                          uint32_t bus_num, uint32_t worker_num, void (*select)(hdc1080_pool_sensor_t *sensor));
+
+/**
+ * @brief     run the pool
+ * @param[in] *pool pointer to a pool structure
+ * @param[in] reads reads per sensor
+ * @param[in] period_us read period, 0 reads back to back
+ * @param[in] steal 1 lets the workers steal
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 pool is NULL
+ * @note      returns when every sensor finished its reads, the results stay in the sensor array
+ */
+uint8_t hdc1080_pool_run(hdc1080_pool_t *pool, uint32_t reads, uint32_t period_us, uint8_t steal);
+
+/**
+ * @brief      get the statistics of the last run
+ * @param[in]  *pool pointer to a pool structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 pool or stats is NULL
+ * @note       none
+ */
+uint8_t hdc1080_pool_get_stats(hdc1080_pool_t *pool, hdc1080_pool_stats_t *stats);
+
+/**
+ * @brief     free the pool
+ * @param[in] *pool pointer to a pool structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 pool is NULL
+ * @note      none
+ */
+uint8_t hdc1080_pool_deinit(hdc1080_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
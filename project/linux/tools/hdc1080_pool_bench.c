@@ -0,0 +1,440 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_pool_bench.c
+ * @brief     hdc1080 work stealing pool benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "hdc1080_pool.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief pool bench tool definition
+ */
+#define POOL_BENCH_MAX_BUS          64          /**< max buses */
+
+/**
+ * @brief pool bench tool simulated chip structure definition
+ */
+typedef struct pool_bench_chip_s
+{
+    uint32_t bus;                   /**< bus index */
+    uint32_t conversion_us;         /**< conversion time of the chip */
+    uint64_t ready_us;              /**< end of the conversion, 0 if none */
+    uint16_t config;                /**< config register */
+    uint16_t sample;                /**< next sample */
+} pool_bench_chip_t;
+
+/**
+ * @brief pool bench tool simulated bus structure definition
+ */
+typedef struct pool_bench_bus_s
+{
+    hdc1080_handle_t handle;        /**< driver handle shared by the sensors of the bus */
+    uint32_t transaction_us;        /**< wire time of one transaction */
+    volatile uint32_t owner;        /**< 1 while a transaction is on the wire */
+    uint32_t collisions;            /**< overlapped transactions */
+} pool_bench_bus_t;
+
+static pool_bench_bus_t gs_bus[POOL_BENCH_MAX_BUS];        /**< simulated buses */
+static pool_bench_chip_t *gs_chip;                         /**< simulated chips */
+static __thread pool_bench_chip_t *gs_current;             /**< chip of the current transaction of the thread */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief  occupy the wire of the current bus
+ * @return status code
+ *         - 0 success
+ *         - 1 the bus was used by another thread
+ * @note   the thread sleeps as in a blocking i2c-dev transfer
+ */
+static uint8_t a_wire(void)
+{
+    pool_bench_bus_t *bus = &gs_bus[gs_current->bus];
+    struct timespec ts;
+    
+    if (__atomic_exchange_n(&bus->owner, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+        __atomic_add_fetch(&bus->collisions, 1, __ATOMIC_RELAXED);
+        
+        return 1;
+    }
+    ts.tv_sec = 0;
+    ts.tv_nsec = (long)bus->transaction_us * 1000;
+    nanosleep(&ts, NULL);
+    __atomic_store_n(&bus->owner, 0, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief  iic bus init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  iic bus deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       only the init reads registers, the wire time is not simulated
+ */
+static uint8_t a_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    (void)addr;
+    switch (reg)
+    {
+        case 0x02 : v = gs_current->config; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : v = 0x0000; break;
+    }
+    if (len < 2)
+    {
+        return 1;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ * @note      a pointer write to the temperature register triggers a conversion
+ */
+static uint8_t a_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    if ((reg == 0x02) && (len == 2))
+    {
+        gs_current->config = ((buf[0] & 0x80) != 0) ? 0x1000 : (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+        
+        return 0;
+    }
+    if (a_wire() != 0)
+    {
+        return 1;
+    }
+    if ((reg == 0x00) && (len == 0))
+    {
+        gs_current->ready_us = a_now_us() + gs_current->conversion_us;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       the chip naks before the conversion is finished
+ */
+static uint8_t a_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    if (a_wire() != 0)
+    {
+        return 1;
+    }
+    if ((gs_current->ready_us == 0) || (a_now_us() < gs_current->ready_us) || (len != 4))
+    {
+        return 1;
+    }
+    gs_current->ready_us = 0;
+    buf[0] = (uint8_t)(gs_current->sample >> 8);
+    buf[1] = (uint8_t)(gs_current->sample >> 0);
+    buf[2] = (uint8_t)(gs_current->sample >> 8);
+    buf[3] = (uint8_t)(gs_current->sample >> 0);
+    gs_current->sample++;
+    
+    return 0;
+}
+
+/**
+ * @brief     delay
+ * @param[in] ms delay time in ms
+ * @note      the simulated reset takes no time
+ */
+static void a_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     route the driver interface of the worker to a sensor
+ * @param[in] *sensor pointer to a pool sensor
+ * @note      none
+ */
+static void a_select(hdc1080_pool_sensor_t *sensor)
+{
+    gs_current = (pool_bench_chip_t *)sensor->user;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_pool_bench [--buses=<n>] [--sensors=<n>] [--reads=<n>] [--transaction=<us>]
+ *                   [--slow=<factor>] [--workers=<max>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t w;
+    uint32_t buses = 8;
+    uint32_t sensors = 32;
+    uint32_t reads = 10;
+    uint32_t transaction_us = 250;
+    uint32_t slow = 6;
+    uint32_t workers = 8;
+    uint32_t total;
+    uint32_t collisions;
+    uint8_t steal;
+    uint8_t res = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t base = 0;
+    uint64_t good;
+    uint64_t bad;
+    uint64_t naks;
+    hdc1080_pool_t pool;
+    hdc1080_pool_stats_t stats;
+    hdc1080_pool_sensor_t *sensor;
+    const struct option long_options[] =
+    {
+        {"buses", required_argument, NULL, 'b'},
+        {"sensors", required_argument, NULL, 's'},
+        {"reads", required_argument, NULL, 'r'},
+        {"transaction", required_argument, NULL, 't'},
+        {"slow", required_argument, NULL, 'l'},
+        {"workers", required_argument, NULL, 'w'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'b' : buses = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's' : sensors = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r' : reads = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 't' : transaction_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'l' : slow = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'w' : workers = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--buses=<n>] [--sensors=<n>] [--reads=<n>] [--transaction=<us>] "
+                        "[--slow=<factor>] [--workers=<max>]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if ((buses < 2) || (buses > POOL_BENCH_MAX_BUS) || (sensors == 0) || (reads == 0) || (workers == 0) ||
+        (slow == 0) || (transaction_us >= 1000000))
+    {
+        fprintf(stderr, "buses must be 2 - %d, the other numbers at least 1.\n", POOL_BENCH_MAX_BUS);
+        
+        return 1;
+    }
+    
+    /* bus 0 is slow, the middle bus is half as slow, one handle per bus */
+    total = buses * sensors;
+    gs_chip = calloc(total, sizeof(pool_bench_chip_t));
+    sensor = calloc(total, sizeof(hdc1080_pool_sensor_t));
+    if ((gs_chip == NULL) || (sensor == NULL))
+    {
+        fprintf(stderr, "no memory.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < buses; i++)
+    {
+        gs_bus[i].transaction_us = transaction_us;
+        if (i == 0)
+        {
+            gs_bus[i].transaction_us = transaction_us * slow;
+        }
+        else if ((i == buses / 2) && (slow > 1))
+        {
+            gs_bus[i].transaction_us = transaction_us * slow / 2;
+        }
+        DRIVER_HDC1080_LINK_INIT(&gs_bus[i].handle, hdc1080_handle_t);
+        DRIVER_HDC1080_LINK_IIC_INIT(&gs_bus[i].handle, a_iic_init);
+        DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_bus[i].handle, a_iic_deinit);
+        DRIVER_HDC1080_LINK_IIC_READ(&gs_bus[i].handle, a_iic_read);
+        DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_bus[i].handle, a_iic_read);
+        DRIVER_HDC1080_LINK_IIC_WRITE(&gs_bus[i].handle, a_iic_write);
+        DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_bus[i].handle, a_iic_read_cmd);
+        DRIVER_HDC1080_LINK_DELAY_MS(&gs_bus[i].handle, a_delay_ms);
+        DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_bus[i].handle, a_debug_print);
+    }
+    for (i = 0; i < total; i++)
+    {
+        gs_chip[i].bus = i / sensors;
+        gs_chip[i].config = 0x1000;
+        gs_chip[i].conversion_us = 11850 + (i % 4) * 250 + ((i % 16 == 15) ? 1500 : 0);
+        sensor[i].handle = &gs_bus[i / sensors].handle;
+        sensor[i].bus = i / sensors;
+        sensor[i].user = &gs_chip[i];
+        gs_current = &gs_chip[i];
+        if (hdc1080_init(sensor[i].handle) != 0)
+        {
+            fprintf(stderr, "init %u failed.\n", i);
+            
+            return 1;
+        }
+    }
+    
+    /* the same work with 1 to workers threads, pinned and stealing */
+    printf("%u buses x %u sensors x %u reads, %uus per transaction, bus 0 x%u and bus %u x%u.\n", buses, sensors,
+           reads, transaction_us, slow, buses / 2, (slow > 1) ? slow / 2 : 1);
+    printf("workers  mode      time(ms)  reads/s  speedup  steals  sleeps  busy min/max(ms)  naks  errors\n");
+    for (w = 1; w <= workers; w *= 2)
+    {
+        for (steal = 0; steal < 2; steal++)
+        {
+            if ((w == 1) && (steal != 0))
+            {
+                continue;
+            }
+            if (hdc1080_pool_init(&pool, sensor, total, buses, w, a_select) != 0)
+            {
+                fprintf(stderr, "pool init failed.\n");
+                
+                return 1;
+            }
+            start = a_now_us();
+            if (hdc1080_pool_run(&pool, reads, 0, steal) != 0)
+            {
+                fprintf(stderr, "pool run failed.\n");
+                
+                return 1;
+            }
+            elapsed = a_now_us() - start;
+            (void)hdc1080_pool_get_stats(&pool, &stats);
+            (void)hdc1080_pool_deinit(&pool);
+            good = 0;
+            bad = 0;
+            naks = 0;
+            for (i = 0; i < total; i++)
+            {
+                good += sensor[i].reads;
+                bad += sensor[i].errors;
+                naks += sensor[i].naks;
+            }
+            if (w == 1)
+            {
+                base = elapsed;
+            }
+            printf("%7u  %-8s  %8.1f  %7.0f  %7.2f  %6llu  %6llu  %7.1f/%-7.1f  %5llu  %6llu\n", w,
+                   (steal != 0) ? "stealing" : "pinned", elapsed / 1000.0, good * 1000000.0 / elapsed,
+                   (double)base / elapsed, (unsigned long long)stats.steals, (unsigned long long)stats.sleeps,
+                   stats.busy_min_us / 1000.0, stats.busy_max_us / 1000.0, (unsigned long long)naks,
+                   (unsigned long long)bad);
+            if ((good != (uint64_t)total * reads) || (bad != 0))
+            {
+                res = 1;
+            }
+        }
+    }
+    collisions = 0;
+    for (i = 0; i < buses; i++)
+    {
+        collisions += gs_bus[i].collisions;
+    }
+    printf("%u bus collisions.\n", collisions);
+    free(sensor);
+    free(gs_chip);
+    
+    return ((res == 0) && (collisions == 0)) ? 0 : 1;
+}
@@ -0,0 +1,473 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_query.c
+ * @brief     hdc1080 columnar store query tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "hdc1080_store.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief query tool default definition
+ */
+#define QUERY_BENCH_SAMPLES        10000000        /**< synthetic samples of the bench */
+#define QUERY_BENCH_QUERIES        1000            /**< random queries per range length */
+#define QUERY_MAX_LINE             256             /**< max csv line length */
+
+static hdc1080_store_t gs_store;        /**< store structure */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief     import a csv of hdc1080_decode or hdc1080_series_decode
+ * @param[in] *f pointer to a csv file
+ * @param[in] base_ms time of the tick 0 in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 import failed
+ * @note      the 32 bit ticks are unwrapped, a sample not newer than the last one is skipped
+ */
+static int a_import(FILE *f, uint64_t base_ms)
+{
+    char line[QUERY_MAX_LINE];
+    char *token;
+    char *save;
+    int col;
+    int ts_col = -1;
+    int t_col = -1;
+    int h_col = -1;
+    uint8_t res;
+    uint32_t tick;
+    uint32_t last_tick = 0;
+    uint64_t wrap = 0;
+    uint64_t imported = 0;
+    uint64_t skipped = 0;
+    unsigned long v[3] = {0, 0, 0};
+    
+    /* find the columns in the header */
+    if (fgets(line, sizeof(line), f) == NULL)
+    {
+        fprintf(stderr, "hdc1080_query: the csv is empty.\n");
+        
+        return 1;
+    }
+    col = 0;
+    for (token = strtok_r(line, ",\r\n", &save); token != NULL; token = strtok_r(NULL, ",\r\n", &save))
+    {
+        if (strcmp(token, "timestamp_ms") == 0)
+        {
+            ts_col = col;
+        }
+        else if (strcmp(token, "temperature_raw") == 0)
+        {
+            t_col = col;
+        }
+        else if (strcmp(token, "humidity_raw") == 0)
+        {
+            h_col = col;
+        }
+        else
+        {
+            /* other column */
+        }
+        col++;
+    }
+    if ((ts_col < 0) || (t_col < 0) || (h_col < 0))
+    {
+        fprintf(stderr, "hdc1080_query: the csv has no timestamp_ms, temperature_raw and humidity_raw.\n");
+        
+        return 1;
+    }
+    
+    /* append the samples */
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        col = 0;
+        for (token = strtok_r(line, ",\r\n", &save); token != NULL; token = strtok_r(NULL, ",\r\n", &save))
+        {
+            if (col == ts_col)
+            {
+                v[0] = strtoul(token, NULL, 10);
+            }
+            else if (col == t_col)
+            {
+                v[1] = strtoul(token, NULL, 10);
+            }
+            else if (col == h_col)
+            {
+                v[2] = strtoul(token, NULL, 10);
+            }
+            else
+            {
+                /* other column */
+            }
+            col++;
+        }
+        if ((col <= ts_col) || (col <= t_col) || (col <= h_col))
+        {
+            skipped++;
+            
+            continue;
+        }
+        
+        /* a tick far below the last one wrapped */
+        tick = (uint32_t)v[0];
+        if ((imported != 0) && (tick < last_tick) && (last_tick - tick > 0x80000000U))
+        {
+            wrap += 0x100000000ULL;
+        }
+        res = hdc1080_store_append(&gs_store, base_ms + wrap + tick, (uint16_t)v[1], (uint16_t)v[2], 0);
+        if (res == 4)
+        {
+            skipped++;
+            
+            continue;
+        }
+        else if (res != 0)
+        {
+            fprintf(stderr, "hdc1080_query: append failed.\n");
+            
+            return 1;
+        }
+        last_tick = tick;
+        imported++;
+    }
+    fprintf(stderr, "hdc1080_query: %llu samples imported, %llu skipped, %llu in the store.\n",
+            (unsigned long long)imported, (unsigned long long)skipped,
+            (unsigned long long)(gs_store.count + gs_store.pending));
+    
+    return 0;
+}
+
+/**
+ * @brief     print the summaries of a range
+ * @param[in] from_ms range start time in ms
+ * @param[in] to_ms range end time in ms, exclusive
+ * @param[in] window_ms window length in ms, 0 is one window
+ * @param[in] exclude samples with one of these flags are skipped
+ * @note      empty windows are not printed
+ */
+static void a_stats(uint64_t from_ms, uint64_t to_ms, uint64_t window_ms, uint8_t exclude)
+{
+    uint64_t start;
+    uint64_t end;
+    hdc1080_store_summary_t summary;
+    
+    if (gs_store.count == 0)
+    {
+        return;
+    }
+    
+    /* clip the range to the store */
+    if (from_ms < gs_store.timestamp_ms[0])
+    {
+        from_ms = gs_store.timestamp_ms[0];
+        if (window_ms != 0)
+        {
+            from_ms -= from_ms % window_ms;
+        }
+    }
+    if (to_ms > gs_store.timestamp_ms[gs_store.count - 1] + 1)
+    {
+        to_ms = gs_store.timestamp_ms[gs_store.count - 1] + 1;
+    }
+    
+    printf("start_ms,end_ms,count,t_min,t_max,t_mean,t_stddev,rh_min,rh_max,rh_mean,rh_stddev\n");
+    for (start = from_ms; start < to_ms; start = end)
+    {
+        end = ((window_ms == 0) || (to_ms - start <= window_ms)) ? to_ms : start + window_ms;
+        if ((hdc1080_store_summarize(&gs_store, start, end, exclude, &summary) != 0) || (summary.count == 0))
+        {
+            continue;
+        }
+        printf("%llu,%llu,%llu,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f\n",
+               (unsigned long long)summary.start_ms, (unsigned long long)summary.end_ms,
+               (unsigned long long)summary.count,
+               summary.temperature.min, summary.temperature.max, summary.temperature.mean, summary.temperature.stddev,
+               summary.humidity.min, summary.humidity.max, summary.humidity.mean, summary.humidity.stddev);
+    }
+}
+
+/**
+ * @brief     print the samples of a range
+ * @param[in] from_ms range start time in ms
+ * @param[in] to_ms range end time in ms, exclusive
+ * @note      none
+ */
+static void a_dump(uint64_t from_ms, uint64_t to_ms)
+{
+    uint64_t i;
+    uint64_t first;
+    uint64_t last;
+    float temperature;
+    float humidity;
+    
+    if (hdc1080_store_range(&gs_store, from_ms, to_ms, &first, &last) != 0)
+    {
+        return;
+    }
+    printf("timestamp_ms,temperature_raw,humidity_raw,flags,temperature_c,humidity_percent\n");
+    for (i = first; i < last; i++)
+    {
+        (void)hdc1080_temperature_convert_to_data(gs_store.temperature_raw[i], &temperature);
+        (void)hdc1080_humidity_convert_to_data(gs_store.humidity_raw[i], &humidity);
+        printf("%llu,%u,%u,%u,%0.3f,%0.3f\n", (unsigned long long)gs_store.timestamp_ms[i],
+               gs_store.temperature_raw[i], gs_store.humidity_raw[i], gs_store.flags[i], temperature, humidity);
+    }
+}
+
+/**
+ * @brief     fill an empty store with a synthetic signal and time the queries
+ * @param[in] samples sample number at a 1s period
+ * @return    status code
+ *            - 0 success
+ *            - 1 bench failed
+ * @note      a daily sine with one code of noise and the heater flag set one hour per day
+ */
+static int a_bench(uint64_t samples)
+{
+    static const uint64_t range_ms[] = {3600000ULL, 86400000ULL, 2592000000ULL};
+    static const char *const range_name[] = {"1 hour", "1 day", "30 days"};
+    uint64_t i;
+    uint64_t start;
+    uint64_t end;
+    uint64_t scanned;
+    uint32_t seed = 1;
+    uint32_t r;
+    uint32_t k;
+    double ns;
+    double day;
+    hdc1080_store_summary_t summary;
+    
+    if (gs_store.count != 0)
+    {
+        fprintf(stderr, "hdc1080_query: bench needs an empty store.\n");
+        
+        return 1;
+    }
+    
+    /* append */
+    ns = a_now_ns();
+    for (i = 0; i < samples; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        day = (double)(i % 86400) / 86400.0 * 6.283185307;
+        if (hdc1080_store_append(&gs_store, i * 1000, (uint16_t)(25000 + 800 * sin(day) + (seed >> 30) * 4),
+                                 (uint16_t)(30000 - 3000 * sin(day) + ((seed >> 28) & 3) * 4),
+                                 ((i % 86400) < 3600) ? HDC1080_STORE_FLAG_HEATER : 0) != 0)
+        {
+            fprintf(stderr, "hdc1080_query: append failed.\n");
+            
+            return 1;
+        }
+    }
+    if (hdc1080_store_flush(&gs_store) != 0)
+    {
+        return 1;
+    }
+    ns = a_now_ns() - ns;
+    printf("%llu samples over %0.1f days, %u bytes per sample.\n", (unsigned long long)samples,
+           (double)samples / 86400.0, (unsigned int)(sizeof(uint64_t) + 2 * sizeof(uint16_t) + sizeof(uint8_t)));
+    printf("append %0.1f million samples per second.\n", (double)samples / ns * 1000.0);
+    printf("query          samples/query   us/query   ns/sample\n");
+    
+    /* random ranges */
+    for (k = 0; k < sizeof(range_ms) / sizeof(range_ms[0]); k++)
+    {
+        if (range_ms[k] > samples * 1000)
+        {
+            continue;
+        }
+        scanned = 0;
+        ns = a_now_ns();
+        for (r = 0; r < QUERY_BENCH_QUERIES; r++)
+        {
+            seed = seed * 1664525U + 1013904223U;
+            start = (uint64_t)seed % (samples * 1000 - range_ms[k] + 1);
+            (void)hdc1080_store_summarize(&gs_store, start, start + range_ms[k], 0, &summary);
+            scanned += summary.count;
+        }
+        ns = a_now_ns() - ns;
+        printf("%-13s  %13.0f  %9.2f  %10.3f\n", range_name[k], (double)scanned / QUERY_BENCH_QUERIES,
+               ns / QUERY_BENCH_QUERIES / 1000.0, ns / (double)scanned);
+    }
+    
+    /* full scans */
+    for (k = 0; k < 2; k++)
+    {
+        end = samples * 1000;
+        ns = a_now_ns();
+        (void)hdc1080_store_summarize(&gs_store, 0, end, (k == 0) ? 0 : HDC1080_STORE_FLAG_HEATER, &summary);
+        ns = a_now_ns() - ns;
+        printf("%-13s  %13llu  %9.2f  %10.3f\n", (k == 0) ? "all" : "all, no heater",
+               (unsigned long long)summary.count, ns / 1000.0, ns / (double)summary.count);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_query import <dir> [--base=<ms>] [file.csv]
+ *                   hdc1080_query stats <dir> [--from=<ms>] [--to=<ms>] [--window=<ms>] [--exclude=<flags>]
+ *                   hdc1080_query dump <dir> [--from=<ms>] [--to=<ms>]
+ *                   hdc1080_query bench <dir> [--samples=<num>]
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    int c;
+    int res;
+    const char *cmd;
+    uint8_t writable;
+    uint8_t exclude = 0;
+    uint64_t base_ms = 0;
+    uint64_t from_ms = 0;
+    uint64_t to_ms = UINT64_MAX;
+    uint64_t window_ms = 0;
+    uint64_t samples = QUERY_BENCH_SAMPLES;
+    const struct option long_options[] =
+    {
+        {"base", required_argument, NULL, 'b'},
+        {"from", required_argument, NULL, 'f'},
+        {"to", required_argument, NULL, 't'},
+        {"window", required_argument, NULL, 'w'},
+        {"exclude", required_argument, NULL, 'e'},
+        {"samples", required_argument, NULL, 's'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'b' : base_ms = strtoull(optarg, NULL, 10); break;
+            case 'f' : from_ms = strtoull(optarg, NULL, 10); break;
+            case 't' : to_ms = strtoull(optarg, NULL, 10); break;
+            case 'w' : window_ms = strtoull(optarg, NULL, 10); break;
+            case 'e' : exclude = (uint8_t)strtoul(optarg, NULL, 0); break;
+            case 's' : samples = strtoull(optarg, NULL, 10); break;
+            default : optind = argc + 1; break;
+        }
+    }
+    if ((optind + 2 > argc) || (from_ms > to_ms))
+    {
+        fprintf(stderr, "usage: %s import <dir> [--base=<ms>] [file.csv]\n", argv[0]);
+        fprintf(stderr, "       %s stats <dir> [--from=<ms>] [--to=<ms>] [--window=<ms>] [--exclude=<flags>]\n", argv[0]);
+        fprintf(stderr, "       %s dump <dir> [--from=<ms>] [--to=<ms>]\n", argv[0]);
+        fprintf(stderr, "       %s bench <dir> [--samples=<num>]\n", argv[0]);
+        
+        return 1;
+    }
+    cmd = argv[optind];
+    writable = (uint8_t)((strcmp(cmd, "import") == 0) || (strcmp(cmd, "bench") == 0));
+    
+    /* open the store */
+    if (hdc1080_store_open(&gs_store, argv[optind + 1], writable) != 0)
+    {
+        fprintf(stderr, "hdc1080_query: open %s failed.\n", argv[optind + 1]);
+        
+        return 1;
+    }
+    
+    /* run the command */
+    res = 0;
+    if (strcmp(cmd, "import") == 0)
+    {
+        f = stdin;
+        if (optind + 2 < argc)
+        {
+            f = fopen(argv[optind + 2], "r");
+        }
+        if (f == NULL)
+        {
+            fprintf(stderr, "hdc1080_query: open %s failed.\n", argv[optind + 2]);
+            res = 1;
+        }
+        else
+        {
+            res = a_import(f, base_ms);
+            if (f != stdin)
+            {
+                (void)fclose(f);
+            }
+        }
+    }
+    else if (strcmp(cmd, "stats") == 0)
+    {
+        a_stats(from_ms, to_ms, window_ms, exclude);
+    }
+    else if (strcmp(cmd, "dump") == 0)
+    {
+        a_dump(from_ms, to_ms);
+    }
+    else if (strcmp(cmd, "bench") == 0)
+    {
+        res = a_bench(samples);
+    }
+    else
+    {
+        fprintf(stderr, "hdc1080_query: unknown command %s.\n", cmd);
+        res = 1;
+    }
+    if (hdc1080_store_close(&gs_store) != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
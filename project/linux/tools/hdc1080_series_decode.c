@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_series_decode.c
+ * @brief     hdc1080 series decode tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "driver_hdc1080_series.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief series decode tool definition
+ */
+#define SERIES_DECODE_MAX_SAMPLES        65535        /**< max samples of one block */
+
+/**
+ * @brief series decode statistics structure definition
+ */
+typedef struct series_decode_stat_s
+{
+    uint32_t blocks;         /**< decoded blocks */
+    uint32_t samples;        /**< decoded samples */
+    uint32_t bytes;          /**< bytes of the decoded blocks */
+    uint32_t crc;            /**< blocks with a crc error */
+    uint32_t skipped;        /**< bytes outside of a block */
+} series_decode_stat_t;
+
+static hdc1080_series_sample_t gs_samples[SERIES_DECODE_MAX_SAMPLES];        /**< sample buffer */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief         decode all blocks of a capture
+ * @param[in]     *buf pointer to a capture buffer
+ * @param[in]     len capture length
+ * @param[in,out] *stat pointer to a statistics structure
+ * @param[in]     print 1 prints the csv lines
+ * @note          the bytes before a valid block header are skipped, a damaged block is skipped byte by byte
+ */
+static void a_series_decode_all(const uint8_t *buf, uint32_t len, series_decode_stat_t *stat, uint8_t print)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t pos;
+    float temperature;
+    float humidity;
+    hdc1080_series_header_t header;
+    
+    memset(stat, 0, sizeof(series_decode_stat_t));
+    pos = 0;
+    while (pos < len)
+    {
+        /* find a block */
+        if ((buf[pos] != (HDC1080_SERIES_MAGIC & 0xFF)) ||
+            (hdc1080_series_read_header(&buf[pos], len - pos, &header) != 0))
+        {
+            stat->skipped++;
+            pos++;
+            
+            continue;
+        }
+        
+        /* decode the block */
+        res = hdc1080_series_decode(&buf[pos], len - pos, &header, gs_samples, SERIES_DECODE_MAX_SAMPLES);
+        if (res != 0)
+        {
+            if (res == 4)
+            {
+                stat->crc++;
+            }
+            stat->skipped++;
+            pos++;
+            
+            continue;
+        }
+        stat->blocks++;
+        stat->samples += header.count;
+        stat->bytes += header.len;
+        pos += header.len;
+        
+        /* output */
+        if (print != 0)
+        {
+            for (i = 0; i < header.count; i++)
+            {
+                (void)hdc1080_temperature_convert_to_data(gs_samples[i].temperature_raw, &temperature);
+                (void)hdc1080_humidity_convert_to_data(gs_samples[i].humidity_raw, &humidity);
+                printf("%02X%02X%02X%02X%02X%02X,%u,%u,%u,%0.3f,%0.3f\n",
+                       header.id[0], header.id[1], header.id[2], header.id[3], header.id[4], header.id[5],
+                       gs_samples[i].timestamp_ms, gs_samples[i].temperature_raw, gs_samples[i].humidity_raw,
+                       temperature, humidity);
+            }
+        }
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed or the bench found no sample
+ * @note      usage: hdc1080_series_decode [--bench=<rounds>] [capture.bin], it reads stdin without a file
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    int c;
+    uint8_t *buf;
+    uint8_t *p;
+    uint32_t i;
+    uint32_t len;
+    uint32_t size;
+    uint32_t rounds = 0;
+    double ns;
+    series_decode_stat_t stat;
+    const struct option long_options[] =
+    {
+        {"bench", required_argument, NULL, 'b'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'b' : rounds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--bench=<rounds>] [capture.bin]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* open the capture */
+    if (optind < argc)
+    {
+        f = fopen(argv[optind], "rb");
+        if (f == NULL)
+        {
+            fprintf(stderr, "hdc1080_series_decode: open %s failed.\n", argv[optind]);
+            
+            return 1;
+        }
+    }
+    else
+    {
+        f = stdin;
+    }
+    
+    /* read the whole capture */
+    len = 0;
+    size = 4096;
+    buf = (uint8_t *)malloc(size);
+    while (buf != NULL)
+    {
+        len += (uint32_t)fread(&buf[len], 1, size - len, f);
+        if (len < size)
+        {
+            break;
+        }
+        size *= 2;
+        p = (uint8_t *)realloc(buf, size);
+        if (p == NULL)
+        {
+            free(buf);
+        }
+        buf = p;
+    }
+    if (f != stdin)
+    {
+        (void)fclose(f);
+    }
+    if (buf == NULL)
+    {
+        fprintf(stderr, "hdc1080_series_decode: out of memory.\n");
+        
+        return 1;
+    }
+    
+    /* decode */
+    if (rounds == 0)
+    {
+        printf("id,timestamp_ms,temperature_raw,humidity_raw,temperature_c,humidity_percent\n");
+        a_series_decode_all(buf, len, &stat, 1);
+        fprintf(stderr, "hdc1080_series_decode: %u blocks, %u samples, %0.2f bytes per sample, "
+                "%u crc errors, %u bytes skipped.\n", stat.blocks, stat.samples,
+                (stat.samples != 0) ? (double)stat.bytes / (double)stat.samples : 0.0, stat.crc, stat.skipped);
+    }
+    else
+    {
+        ns = a_now_ns();
+        for (i = 0; i < rounds; i++)
+        {
+            a_series_decode_all(buf, len, &stat, 0);
+        }
+        ns = a_now_ns() - ns;
+        if (stat.samples == 0)
+        {
+            fprintf(stderr, "hdc1080_series_decode: no sample found, nothing to measure.\n");
+            free(buf);
+            
+            return 1;
+        }
+        printf("%u blocks, %u samples, %0.2f bytes per sample.\n", stat.blocks, stat.samples,
+               (double)stat.bytes / (double)stat.samples);
+        printf("%0.2f ns per sample, %0.1f million samples per second.\n",
+               ns / ((double)rounds * stat.samples), (double)rounds * stat.samples / ns * 1000.0);
+    }
+    free(buf);
+    
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_shell_fuzz.c
+ * @brief     shell line assembly and parser fuzz harness
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "line.h"
+#include "shell.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief shell fuzz harness definition
+ */
+#define SHELL_FUZZ_IDLE            5           /**< idle gap in ticks */
+#define SHELL_FUZZ_POLL            0xFF        /**< input byte that lets the main loop poll */
+#define SHELL_FUZZ_WAIT            0xFE        /**< input byte that lets the idle gap pass */
+#define SHELL_FUZZ_INPUT_MAX       65536       /**< max input length of the standalone driver */
+
+static uint32_t gs_runs;        /**< commands that reached a registered function */
+
+/**
+ * @brief fail the run
+ * @note  abort is caught by libFuzzer and AFL as a crash
+ */
+#define SHELL_FUZZ_CHECK(x)                                                              \
+do                                                                                       \
+{                                                                                        \
+    if (!(x))                                                                            \
+    {                                                                                    \
+        fprintf(stderr, "hdc1080_shell_fuzz: %s failed at line %d.\n", #x, __LINE__);    \
+        abort();                                                                         \
+    }                                                                                    \
+} while (0)
+
+/**
+ * @brief     registered command
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ * @note      checks the split arguments as a shell command sees them
+ */
+static uint8_t a_command(uint8_t argc, char **argv)
+{
+    uint8_t i;
+    
+    SHELL_FUZZ_CHECK((argc != 0) && (argc < SHELL_MAX_SIZE));
+    for (i = 0; i < argc; i++)
+    {
+        SHELL_FUZZ_CHECK(argv[i] != NULL);
+        SHELL_FUZZ_CHECK(argv[i][0] != '\0');
+        SHELL_FUZZ_CHECK(strchr(argv[i], ' ') == NULL);
+        SHELL_FUZZ_CHECK(strlen(argv[i]) < SHELL_MAX_BUF_SIZE);
+    }
+    gs_runs++;
+    
+    return 0;
+}
+
+/**
+ * @brief     read the ready line and run it as the main loop does
+ * @param[in] *line pointer to a line structure
+ * @note      none
+ */
+static void a_consume(line_t *line)
+{
+    uint8_t res;
+    uint16_t i;
+    uint16_t len = 0xFFFF;
+    uint8_t buf[256];
+    
+    res = line_get(line, buf, 256, &len);
+    SHELL_FUZZ_CHECK(res != 1);
+    SHELL_FUZZ_CHECK(line->ready == 0);
+    if (res == 2)
+    {
+        SHELL_FUZZ_CHECK(len == 0);
+        
+        return;
+    }
+    SHELL_FUZZ_CHECK((len != 0) && (len <= 256));
+    for (i = 0; i < len; i++)
+    {
+        SHELL_FUZZ_CHECK((buf[i] != '\r') && (buf[i] != '\n'));
+    }
+    res = shell_parse((char *)buf, len);
+    SHELL_FUZZ_CHECK(res <= 4);
+    SHELL_FUZZ_CHECK((res != 3) || (len >= SHELL_MAX_BUF_SIZE));
+}
+
+/**
+ * @brief     check the hand over of one step
+ * @param[in] *line pointer to a line structure
+ * @param[in] *before pointer to the line structure before the step
+ * @note      a finished line is either handed over or counted as dropped, never both
+ */
+static void a_check_step(line_t *line, line_t *before)
+{
+    uint8_t finished;
+    uint8_t handed;
+    
+    finished = (((before->len != 0) || (before->overflow != 0)) && (line->len == 0) && (line->overflow == 0)) ? 1 : 0;
+    handed = ((before->ready == 0) && (line->ready != 0)) ? 1 : 0;
+    SHELL_FUZZ_CHECK(line->len <= LINE_MAX_LEN);
+    SHELL_FUZZ_CHECK(finished == handed + (line->dropped - before->dropped));
+    SHELL_FUZZ_CHECK((handed == 0) || (line->active != before->active));
+    SHELL_FUZZ_CHECK((line->ready != 1) || (line->ready_len <= LINE_MAX_LEN));
+}
+
+/**
+ * @brief     fuzz entry
+ * @param[in] *data pointer to an input buffer
+ * @param[in] size input length
+ * @return    0
+ * @note      every byte is received by the rx interrupt one tick after the previous one,
+ *            SHELL_FUZZ_POLL runs one pass of the main loop and SHELL_FUZZ_WAIT lets the
+ *            idle gap pass, so lines finished while the previous one is unread are dropped
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    size_t i;
+    uint32_t tick = 0;
+    line_t line;
+    line_t before;
+    
+    /* init as the target does */
+    line_init(&line, SHELL_FUZZ_IDLE);
+    (void)shell_init();
+    (void)shell_register("hdc1080", a_command);
+    (void)shell_register("help", a_command);
+    
+    for (i = 0; i < size; i++)
+    {
+        before = line;
+        if (data[i] == SHELL_FUZZ_POLL)
+        {
+            /* one pass of the main loop */
+            if (line_poll(&line, tick) != 0)
+            {
+                a_check_step(&line, &before);
+                a_consume(&line);
+            }
+            else
+            {
+                a_check_step(&line, &before);
+            }
+        }
+        else if (data[i] == SHELL_FUZZ_WAIT)
+        {
+            tick += SHELL_FUZZ_IDLE;
+        }
+        else
+        {
+            /* rx interrupt */
+            line_put(&line, data[i], tick);
+            tick++;
+            a_check_step(&line, &before);
+        }
+    }
+    
+    return 0;
+}
+
+#ifdef SHELL_FUZZ_MAIN
+/**
+ * @brief     run one input
+ * @param[in] *fp pointer to an input file
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static int a_run_file(FILE *fp)
+{
+    size_t len;
+    static uint8_t buf[SHELL_FUZZ_INPUT_MAX];
+    
+    len = fread(buf, 1, SHELL_FUZZ_INPUT_MAX, fp);
+    if (ferror(fp) != 0)
+    {
+        return 1;
+    }
+    (void)LLVMFuzzerTestOneInput(buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 an input could not be read
+ * @note      usage: hdc1080_shell_fuzz [file ...], stdin without a file, as afl-fuzz runs it
+ */
+int main(int argc, char **argv)
+{
+    int i;
+    FILE *fp;
+    
+    if (argc < 2)
+    {
+        return a_run_file(stdin);
+    }
+    for (i = 1; i < argc; i++)
+    {
+        fp = fopen(argv[i], "rb");
+        if ((fp == NULL) || (a_run_file(fp) != 0))
+        {
+            fprintf(stderr, "hdc1080_shell_fuzz: can't read %s.\n", argv[i]);
+            if (fp != NULL)
+            {
+                (void)fclose(fp);
+            }
+            
+            return 1;
+        }
+        (void)fclose(fp);
+    }
+    printf("hdc1080_shell_fuzz: %d inputs, %u commands run.\n", argc - 1, gs_runs);
+    
+    return 0;
+}
+#endif
@@ -0,0 +1,485 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_shm.c
+ * @brief     hdc1080 shared memory latest reading table source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "hdc1080_shm.h"
+#include <fcntl.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief shm sample word number
+ */
+#define SHM_SAMPLE_WORDS        (sizeof(hdc1080_shm_sample_t) / sizeof(uint32_t))
+
+/**
+ * @brief     get the segment length
+ * @param[in] capacity max entries
+ * @param[in] index_len hash index slots
+ * @return    length in bytes
+ * @note      the entries start on a cache line
+ */
+static size_t a_shm_len(uint32_t capacity, uint32_t index_len)
+{
+    size_t index_bytes = ((size_t)index_len * sizeof(uint32_t) + 63) & ~(size_t)63;
+    
+    return sizeof(hdc1080_shm_header_t) + index_bytes + (size_t)capacity * sizeof(hdc1080_shm_entry_t);
+}
+
+/**
+ * @brief     set the pointers of a mapping
+ * @param[in] *shm pointer to an shm handle
+ * @note      none
+ */
+static void a_shm_layout(hdc1080_shm_t *shm)
+{
+    size_t index_bytes = ((size_t)shm->header->index_len * sizeof(uint32_t) + 63) & ~(size_t)63;
+    
+    shm->index = (uint32_t *)((uint8_t *)shm->map + sizeof(hdc1080_shm_header_t));
+    shm->entry = (hdc1080_shm_entry_t *)((uint8_t *)shm->index + index_bytes);
+}
+
+/**
+ * @brief     hash a serial id
+ * @param[in] *serial_id pointer to a 6 byte serial id
+ * @return    hash
+ * @note      fnv-1a
+ */
+static uint32_t a_shm_hash(const uint8_t serial_id[6])
+{
+    uint32_t h = 2166136261U;
+    uint8_t i;
+    
+    for (i = 0; i < 6; i++)
+    {
+        h ^= serial_id[i];
+        h *= 16777619U;
+    }
+    
+    return h;
+}
+
+/**
+ * @brief      look up a serial id
+ * @param[in]  *shm pointer to an shm handle
+ * @param[in]  *serial_id pointer to a 6 byte serial id
+ * @param[out] *pos pointer to the index slot of the id or the empty slot ending the probe
+ * @return     entry index + 1, 0 if not found
+ * @note       the slots are published with release, so the serial id of an indexed entry is complete
+ */
+static uint32_t a_shm_lookup(hdc1080_shm_t *shm, const uint8_t serial_id[6], uint32_t *pos)
+{
+    uint32_t mask = shm->header->index_len - 1;
+    uint32_t i = a_shm_hash(serial_id) & mask;
+    uint32_t v;
+    
+    while (1)
+    {
+        v = __atomic_load_n(&shm->index[i], __ATOMIC_ACQUIRE);
+        if ((v == 0) || (memcmp(shm->entry[v - 1].serial_id, serial_id, 6) == 0))
+        {
+            *pos = i;
+            
+            return v;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+/**
+ * @brief     create the table as the writer
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *name pointer to a posix shared memory name, such as "/hdc1080"
+ * @param[in] capacity max sensors
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ *            - 2 shm or name is NULL
+ *            - 4 capacity is invalid
+ * @note      an existing segment of the name is replaced, there is one writer per table
+ */
+uint8_t hdc1080_shm_create(hdc1080_shm_t *shm, const char *name, uint32_t capacity)
+{
+    int fd;
+    uint32_t index_len = 1;
+    
+    if ((shm == NULL) || (name == NULL))
+    {
+        return 2;
+    }
+    if ((capacity == 0) || (capacity > (1U << 24)))
+    {
+        return 4;
+    }
+    
+    /* the index is kept at most half full */
+    while (index_len < capacity * 2)
+    {
+        index_len <<= 1;
+    }
+    memset(shm, 0, sizeof(hdc1080_shm_t));
+    (void)shm_unlink(name);
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    shm->len = a_shm_len(capacity, index_len);
+    if (ftruncate(fd, (off_t)shm->len) != 0)
+    {
+        close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    shm->map = mmap(NULL, shm->len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm->map == MAP_FAILED)
+    {
+        shm->map = NULL;
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    
+    /* the zero filled segment is an empty table, the magic is written last */
+    shm->header = (hdc1080_shm_header_t *)shm->map;
+    shm->header->version = HDC1080_SHM_VERSION;
+    shm->header->capacity = capacity;
+    shm->header->index_len = index_len;
+    shm->header->writer_pid = (uint32_t)getpid();
+    a_shm_layout(shm);
+    shm->writable = 1;
+    __atomic_store_n(&shm->header->magic, HDC1080_SHM_MAGIC, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     publish the latest sample of a sensor
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *serial_id pointer to a 6 byte serial id
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 table is full
+ *            - 2 shm, serial_id or sample is NULL
+ *            - 3 shm is not writable
+ * @note      never waits for a reader, a new serial id is added to the table
+ */
+uint8_t hdc1080_shm_publish(hdc1080_shm_t *shm, const uint8_t serial_id[6], const hdc1080_shm_sample_t *sample)
+{
+    uint32_t pos;
+    uint32_t v;
+    uint32_t seq;
+    uint32_t i;
+    uint32_t word[SHM_SAMPLE_WORDS];
+    uint32_t *dst;
+    uint8_t added;
+    hdc1080_shm_entry_t *e;
+    
+    if ((shm == NULL) || (serial_id == NULL) || (sample == NULL))
+    {
+        return 2;
+    }
+    if (shm->writable == 0)
+    {
+        return 3;
+    }
+    
+    /* a new sensor gets the next entry, it is counted and indexed after its first sample */
+    v = a_shm_lookup(shm, serial_id, &pos);
+    added = 0;
+    if (v == 0)
+    {
+        if (shm->header->count == shm->header->capacity)
+        {
+            return 1;
+        }
+        v = shm->header->count + 1;
+        memcpy(shm->entry[v - 1].serial_id, serial_id, 6);
+        added = 1;
+    }
+    e = &shm->entry[v - 1];
+    
+    /* seqlock write, the sample words are relaxed atomics between the odd and the even sequence */
+    memcpy(word, sample, sizeof(word));
+    dst = (uint32_t *)&e->sample;
+    seq = __atomic_load_n(&e->sequence, __ATOMIC_RELAXED);
+    __atomic_store_n(&e->sequence, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 0; i < SHM_SAMPLE_WORDS; i++)
+    {
+        __atomic_store_n(&dst[i], word[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&e->sequence, seq + 2, __ATOMIC_RELEASE);
+    if (added != 0)
+    {
+        __atomic_store_n(&shm->header->count, v, __ATOMIC_RELEASE);
+        __atomic_store_n(&shm->index[pos], v, __ATOMIC_RELEASE);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     open the table as a reader
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 shm or name is NULL
+ *            - 4 layout is invalid
+ * @note      the mapping is read only, a reader cannot disturb the writer or another reader
+ */
+uint8_t hdc1080_shm_open(hdc1080_shm_t *shm, const char *name)
+{
+    int fd;
+    struct stat st;
+    hdc1080_shm_header_t header;
+    
+    if ((shm == NULL) || (name == NULL))
+    {
+        return 2;
+    }
+    
+    memset(shm, 0, sizeof(hdc1080_shm_t));
+    fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(hdc1080_shm_header_t)))
+    {
+        close(fd);
+        
+        return 4;
+    }
+    shm->len = (size_t)st.st_size;
+    shm->map = mmap(NULL, shm->len, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm->map == MAP_FAILED)
+    {
+        shm->map = NULL;
+        
+        return 1;
+    }
+    shm->header = (hdc1080_shm_header_t *)shm->map;
+    header.magic = __atomic_load_n(&shm->header->magic, __ATOMIC_ACQUIRE);
+    header.version = shm->header->version;
+    header.capacity = shm->header->capacity;
+    header.index_len = shm->header->index_len;
+    if ((header.magic != HDC1080_SHM_MAGIC) || (header.version != HDC1080_SHM_VERSION) || (header.index_len == 0) ||
+        ((header.index_len & (header.index_len - 1)) != 0) || (header.index_len < header.capacity) ||
+        (a_shm_len(header.capacity, header.index_len) > shm->len))
+    {
+        (void)hdc1080_shm_close(shm);
+        
+        return 4;
+    }
+    a_shm_layout(shm);
+    
+    return 0;
+}
+
+/**
+ * @brief      find the entry of a sensor
+ * @param[in]  *shm pointer to an shm handle
+ * @param[in]  *serial_id pointer to a 6 byte serial id
+ * @param[out] *slot pointer to an entry index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not found
+ *             - 2 shm, serial_id or slot is NULL
+ * @note       the entry index of a sensor never changes, a reader may keep it
+ */
+uint8_t hdc1080_shm_find(hdc1080_shm_t *shm, const uint8_t serial_id[6], uint32_t *slot)
+{
+    uint32_t pos;
+    uint32_t v;
+    
+    if ((shm == NULL) || (serial_id == NULL) || (slot == NULL))
+    {
+        return 2;
+    }
+    
+    v = a_shm_lookup(shm, serial_id, &pos);
+    if (v == 0)
+    {
+        return 1;
+    }
+    *slot = v - 1;
+    
+    return 0;
+}
+
+/**
+ * @brief      read the latest sample of an entry
+ * @param[in]  *shm pointer to an shm handle
+ * @param[in]  slot entry index
+ * @param[out] *serial_id pointer to a 6 byte serial id buffer, it may be NULL
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *retries pointer to a retry count buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 the writer updated the entry HDC1080_SHM_READ_RETRY times during the read
+ *             - 2 shm or sample is NULL
+ *             - 4 slot is not published
+ * @note       lock free, the copy is retried while the writer updates the entry
+ */
+uint8_t hdc1080_shm_read(hdc1080_shm_t *shm, uint32_t slot, uint8_t serial_id[6], hdc1080_shm_sample_t *sample,
+                         uint32_t *retries)
+{
+    uint32_t s1;
+    uint32_t s2;
+    uint32_t n;
+    uint32_t i;
+    uint32_t word[SHM_SAMPLE_WORDS];
+    const uint32_t *src;
+    hdc1080_shm_entry_t *e;
+    
+    if ((shm == NULL) || (sample == NULL))
+    {
+        return 2;
+    }
+    if (slot >= __atomic_load_n(&shm->header->count, __ATOMIC_ACQUIRE))
+    {
+        return 4;
+    }
+    
+    e = &shm->entry[slot];
+    src = (const uint32_t *)&e->sample;
+    for (n = 0; n < HDC1080_SHM_READ_RETRY; n++)
+    {
+        s1 = __atomic_load_n(&e->sequence, __ATOMIC_ACQUIRE);
+        if ((s1 & 1) != 0)
+        {
+            /* the writer was preempted inside its update, give it the cpu */
+            sched_yield();
+            
+            continue;
+        }
+        for (i = 0; i < SHM_SAMPLE_WORDS; i++)
+        {
+            word[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s2 = __atomic_load_n(&e->sequence, __ATOMIC_RELAXED);
+        if (s1 == s2)
+        {
+            memcpy(sample, word, sizeof(word));
+            if (serial_id != NULL)
+            {
+                memcpy(serial_id, e->serial_id, 6);
+            }
+            if (retries != NULL)
+            {
+                *retries = n;
+            }
+            
+            return 0;
+        }
+    }
+    if (retries != NULL)
+    {
+        *retries = n;
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     get the published entry number
+ * @param[in] *shm pointer to an shm handle
+ * @return    entry number
+ * @note      entries 0 to the number - 1 can be read
+ */
+uint32_t hdc1080_shm_count(hdc1080_shm_t *shm)
+{
+    if ((shm == NULL) || (shm->header == NULL))
+    {
+        return 0;
+    }
+    
+    return __atomic_load_n(&shm->header->count, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief     close the table
+ * @param[in] *shm pointer to an shm handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 shm is NULL
+ * @note      the segment stays until hdc1080_shm_unlink
+ */
+uint8_t hdc1080_shm_close(hdc1080_shm_t *shm)
+{
+    if (shm == NULL)
+    {
+        return 2;
+    }
+    
+    if (shm->map != NULL)
+    {
+        (void)munmap(shm->map, shm->len);
+    }
+    memset(shm, 0, sizeof(hdc1080_shm_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     remove the segment
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlink failed
+ *            - 2 name is NULL
+ * @note      mapped readers keep their mapping
+ */
+uint8_t hdc1080_shm_unlink(const char *name)
+{
+    if (name == NULL)
+    {
+        return 2;
+    }
+    
+    return (shm_unlink(name) == 0) ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_shm.h
+ * @brief     hdc1080 shared memory latest reading table header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef HDC1080_SHM_H
+#define HDC1080_SHM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief shm definition
+ */
+#define HDC1080_SHM_MAGIC             0x31434448        /**< "HDC1" */
+#define HDC1080_SHM_VERSION           1                 /**< layout version */
+#define HDC1080_SHM_READ_RETRY        1000              /**< seqlock retries of one read before it gives up */
+
+/**
+ * @brief shm sample structure definition
+ * @note  copied word by word under the seqlock, so its size is a multiple of 4
+ */
+typedef struct hdc1080_shm_sample_s
+{
+    uint64_t timestamp_ms;             /**< time of the reading in ms */
+    uint16_t temperature_raw;          /**< raw temperature */
+    uint16_t humidity_raw;             /**< raw humidity */
+    float temperature;                 /**< temperature in C */
+    float humidity;                    /**< humidity in % */
+    uint32_t reads;                    /**< good reads of the sensor */
+    uint32_t errors;                   /**< failed reads of the sensor */
+    uint32_t status;                   /**< status code of the last read */
+} hdc1080_shm_sample_t;
+
+/**
+ * @brief shm entry structure definition
+ * @note  one cache line per sensor, sequence is odd while the writer updates the sample
+ */
+typedef struct hdc1080_shm_entry_s
+{
+    uint32_t sequence;                 /**< seqlock sequence */
+    uint8_t serial_id[6];              /**< serial id, written once before the entry is indexed */
+    uint8_t reserved[6];               /**< reserved */
+    hdc1080_shm_sample_t sample;       /**< latest sample */
+    uint8_t pad[64 - 16 - sizeof(hdc1080_shm_sample_t)];        /**< pad to a cache line */
+} hdc1080_shm_entry_t;
+
+/**
+ * @brief shm header structure definition
+ */
+typedef struct hdc1080_shm_header_s
+{
+    uint32_t magic;                    /**< HDC1080_SHM_MAGIC */
+    uint32_t version;                  /**< HDC1080_SHM_VERSION */
+    uint32_t capacity;                 /**< max entries */
+    uint32_t index_len;                /**< hash index slots, a power of 2 */
+    uint32_t count;                    /**< published entries */
+    uint32_t writer_pid;               /**< pid of the writer */
+    uint8_t reserved[40];              /**< pad to a cache line */
+} hdc1080_shm_header_t;
+
+/**
+ * @brief shm handle structure definition
+ */
+typedef struct hdc1080_shm_s
+{
+    void *map;                         /**< mapping */
+    size_t len;                        /**< mapping length */
+    hdc1080_shm_header_t *header;      /**< header */
+    uint32_t *index;                   /**< hash index, entry index + 1, 0 is empty */
+    hdc1080_shm_entry_t *entry;        /**< entries */
+    uint8_t writable;                  /**< 1 for the writer */
+} hdc1080_shm_t;
+
+/**
+ * @brief     create the table as the writer
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *name pointer to a posix shared memory name, such as "/hdc1080"
+ * @param[in] capacity max sensors
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ *            - 2 shm or name is NULL
+ *            - 4 capacity is invalid
+ * @note      an existing segment of the name is replaced, there is one writer per table
+ */
+uint8_t hdc1080_shm_create(hdc1080_shm_t *shm, const char *name, uint32_t capacity);
+
+/**
+ * @brief     publish the latest sample of a sensor
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *serial_id pointer to a 6 byte serial id
+ * @param[in] *sample pointer to a sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 table is full
+ *            - 2 shm, serial_id or sample is NULL
+ *            - 3 shm is not writable
+ * @note      never waits for a reader, a new serial id is added to the table
+ */
+uint8_t hdc1080_shm_publish(hdc1080_shm_t *shm, const uint8_t serial_id[6], const hdc1080_shm_sample_t *sample);
+
+/**
+ * @brief     open the table as a reader
+ * @param[in] *shm pointer to an shm handle
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 shm or name is NULL
+ *            - 4 layout is invalid
+ * @note      the mapping is read only, a reader cannot disturb the writer or another reader
+ */
+uint8_t hdc1080_shm_open(hdc1080_shm_t *shm, const char *name);
+
+/**
+ * @brief      find the entry of a sensor
+ * @param[in]  *shm pointer to an shm handle
+ * @param[in]  *serial_id pointer to a 6 byte serial id
+ * @param[out] *slot pointer to an entry index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 not found
+ *             - 2 shm, serial_id or slot is NULL
+ * @note       the entry index of a sensor never changes, a reader may keep it
+ */
+uint8_t hdc1080_shm_find(hdc1080_shm_t *shm, const uint8_t serial_id[6], uint32_t *slot);
+
+/**
+ * @brief      read the latest sample of an entry
+ * @param[in]  *shm pointer to an shm handle
+ * @param[in]  slot entry index
+ * @param[out] *serial_id pointer to a 6 byte serial id buffer, it may be NULL
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *retries pointer to a retry count buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 the writer updated the entry HDC1080_SHM_READ_RETRY times during the read
+ *             - 2 shm or sample is NULL
+ *             - 4 slot is not published
+ * @note       lock free, the copy is retried while the writer updates the entry and the reader yields the cpu
+ *             when it finds the writer inside an update
+ */
+uint8_t hdc1080_shm_read(hdc1080_shm_t *shm, uint32_t slot, uint8_t serial_id[6], hdc1080_shm_sample_t *sample,
+                         uint32_t *retries);
+
+/**
+ * @brief     get the published entry number
+ * @param[in] *shm pointer to an shm handle
+ * @return    entry number
+ * @note      entries 0 to the number - 1 can be read
+ */
+uint32_t hdc1080_shm_count(hdc1080_shm_t *shm);
+
+/**
+ * @brief     close the table
+ * @param[in] *shm pointer to an shm handle
+ * @return    status code
+ *            - 0 success
+ *            - 2 shm is NULL
+ * @note      the segment stays until hdc1080_shm_unlink
+ */
+uint8_t hdc1080_shm_close(hdc1080_shm_t *shm);
+
+/**
+ * @brief     remove the segment
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlink failed
+ *            - 2 name is NULL
+ * @note      mapped readers keep their mapping
+ */
+uint8_t hdc1080_shm_unlink(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
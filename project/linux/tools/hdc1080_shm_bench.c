@@ -0,0 +1,432 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_shm_bench.c
+ * @brief     hdc1080 shared memory table benchmark tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "hdc1080_shm.h"
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief shm bench tool definition
+ */
+#define SHM_BENCH_MAX_READERS       16        /**< max reader processes */
+
+/**
+ * @brief shm bench tool reader result structure definition
+ */
+typedef struct shm_bench_result_s
+{
+    uint64_t reads;              /**< good reads */
+    uint64_t retries;            /**< seqlock retries */
+    uint64_t torn;               /**< inconsistent samples */
+    uint64_t failed;             /**< reads given up */
+} shm_bench_result_t;
+
+static hdc1080_shm_t gs_writer;                  /**< writer table */
+static uint32_t gs_sensors = 1024;               /**< sensors */
+static uint32_t gs_rate;                         /**< updates per second, 0 is flat out */
+static volatile uint8_t gs_stop;                 /**< stops the writer */
+static uint64_t gs_updates;                      /**< writer updates */
+static uint64_t gs_publish_max_ns;               /**< longest publish */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief      make the serial id of a sensor
+ * @param[in]  i sensor index
+ * @param[out] *id pointer to a 6 byte buffer
+ * @note       none
+ */
+static void a_serial(uint32_t i, uint8_t id[6])
+{
+    id[0] = 0x10;
+    id[1] = 0x80;
+    id[2] = (uint8_t)(i >> 24);
+    id[3] = (uint8_t)(i >> 16);
+    id[4] = (uint8_t)(i >> 8);
+    id[5] = (uint8_t)(i >> 0);
+}
+
+/**
+ * @brief      make a consistent sample
+ * @param[in]  n update number
+ * @param[out] *sample pointer to a sample buffer
+ * @note       every field is derived from n, so a torn copy is detected
+ */
+static void a_sample(uint32_t n, hdc1080_shm_sample_t *sample)
+{
+    sample->timestamp_ms = (uint64_t)n * 2;
+    sample->temperature_raw = (uint16_t)n;
+    sample->humidity_raw = (uint16_t)~n;
+    sample->temperature = (float)(uint16_t)n / 65536.0f * 165.0f - 40.0f;
+    sample->humidity = (float)(uint16_t)~n / 65536.0f * 100.0f;
+    sample->reads = n;
+    sample->errors = n ^ 0xA5A5A5A5U;
+    sample->status = n & 0xFF;
+}
+
+/**
+ * @brief     check a sample
+ * @param[in] *sample pointer to a sample
+ * @return    1 if the sample is consistent
+ * @note      none
+ */
+static uint8_t a_check(const hdc1080_shm_sample_t *sample)
+{
+    uint32_t n = sample->reads;
+    
+    return (sample->timestamp_ms == (uint64_t)n * 2) && (sample->temperature_raw == (uint16_t)n) &&
+           (sample->humidity_raw == (uint16_t)~n) && (sample->errors == (n ^ 0xA5A5A5A5U)) &&
+           (sample->status == (n & 0xFF));
+}
+
+/**
+ * @brief     writer thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      updates the sensors round robin
+ */
+static void *a_writer(void *arg)
+{
+    uint32_t n = 0;
+    uint8_t id[6];
+    uint64_t t;
+    uint64_t next = a_now_ns();
+    hdc1080_shm_sample_t sample;
+    struct timespec ts;
+    
+    (void)arg;
+    gs_updates = 0;
+    gs_publish_max_ns = 0;
+    while (gs_stop == 0)
+    {
+        a_serial(n % gs_sensors, id);
+        a_sample(n, &sample);
+        t = a_now_ns();
+        (void)hdc1080_shm_publish(&gs_writer, id, &sample);
+        t = a_now_ns() - t;
+        if (t > gs_publish_max_ns)
+        {
+            gs_publish_max_ns = t;
+        }
+        n++;
+        gs_updates++;
+        if (gs_rate != 0)
+        {
+            next += 1000000000ULL / gs_rate;
+            ts.tv_sec = (time_t)(next / 1000000000ULL);
+            ts.tv_nsec = (long)(next % 1000000000ULL);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     reader process
+ * @param[in] *name pointer to a segment name
+ * @param[in] seconds run time
+ * @param[in] fd result pipe
+ * @return    exit code
+ * @note      opens the table read only, finds every sensor once and reads random entries
+ */
+static int a_reader(const char *name, uint32_t seconds, int fd)
+{
+    hdc1080_shm_t shm;
+    hdc1080_shm_sample_t sample;
+    shm_bench_result_t r;
+    uint32_t *slot;
+    uint32_t i;
+    uint32_t retries;
+    uint32_t x = (uint32_t)getpid();
+    uint8_t id[6];
+    uint64_t end;
+    
+    memset(&r, 0, sizeof(r));
+    slot = malloc(gs_sensors * sizeof(uint32_t));
+    if ((slot == NULL) || (hdc1080_shm_open(&shm, name) != 0))
+    {
+        return 1;
+    }
+    for (i = 0; i < gs_sensors; i++)
+    {
+        a_serial(i, id);
+        if (hdc1080_shm_find(&shm, id, &slot[i]) != 0)
+        {
+            return 1;
+        }
+    }
+    end = a_now_ns() + (uint64_t)seconds * 1000000000ULL;
+    while (1)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            x = x * 1664525U + 1013904223U;
+            if (hdc1080_shm_read(&shm, slot[(x >> 8) % gs_sensors], NULL, &sample, &retries) != 0)
+            {
+                r.failed++;
+                
+                continue;
+            }
+            r.retries += retries;
+            if (a_check(&sample) == 0)
+            {
+                r.torn++;
+            }
+            r.reads++;
+        }
+        if (a_now_ns() >= end)
+        {
+            break;
+        }
+    }
+    (void)hdc1080_shm_close(&shm);
+    free(slot);
+    
+    return (write(fd, &r, sizeof(r)) == (ssize_t)sizeof(r)) ? 0 : 1;
+}
+
+/**
+ * @brief     print the table of another writer
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+static uint8_t a_dump(const char *name)
+{
+    hdc1080_shm_t shm;
+    hdc1080_shm_sample_t sample;
+    uint32_t i;
+    uint32_t count;
+    uint8_t id[6];
+    
+    if (hdc1080_shm_open(&shm, name) != 0)
+    {
+        fprintf(stderr, "open %s failed.\n", name);
+        
+        return 1;
+    }
+    count = hdc1080_shm_count(&shm);
+    printf("slot  serial id     timestamp(ms)  reads  errors  status  temperature  humidity\n");
+    for (i = 0; i < count; i++)
+    {
+        if (hdc1080_shm_read(&shm, i, id, &sample, NULL) != 0)
+        {
+            continue;
+        }
+        printf("%4u  %02X%02X%02X%02X%02X%02X  %13llu  %5u  %6u  %6u  %11.2f  %8.2f\n", i, id[0], id[1], id[2], id[3],
+               id[4], id[5], (unsigned long long)sample.timestamp_ms, sample.reads, sample.errors, sample.status,
+               sample.temperature, sample.humidity);
+    }
+    (void)hdc1080_shm_close(&shm);
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: hdc1080_shm_bench [--sensors=<n>] [--readers=<max>] [--seconds=<s>] [--rate=<updates/s>]
+ *                   [--dump=<name>]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int status;
+    int fd[2];
+    uint32_t i;
+    uint32_t readers = 4;
+    uint32_t seconds = 1;
+    uint32_t n;
+    uint8_t id[6];
+    uint8_t res = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    char name[64];
+    pid_t pid[SHM_BENCH_MAX_READERS];
+    pthread_t writer;
+    hdc1080_shm_sample_t sample;
+    shm_bench_result_t r;
+    shm_bench_result_t total;
+    const struct option long_options[] =
+    {
+        {"sensors", required_argument, NULL, 's'},
+        {"readers", required_argument, NULL, 'r'},
+        {"seconds", required_argument, NULL, 't'},
+        {"rate", required_argument, NULL, 'u'},
+        {"dump", required_argument, NULL, 'd'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 's' : gs_sensors = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r' : readers = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 't' : seconds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'u' : gs_rate = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'd' : return a_dump(optarg);
+            default :
+            {
+                fprintf(stderr, "usage: %s [--sensors=<n>] [--readers=<max>] [--seconds=<s>] [--rate=<updates/s>] "
+                        "[--dump=<name>]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if ((gs_sensors == 0) || (readers > SHM_BENCH_MAX_READERS) || (seconds == 0))
+    {
+        fprintf(stderr, "sensors and seconds must be at least 1, readers 0 - %d.\n", SHM_BENCH_MAX_READERS);
+        
+        return 1;
+    }
+    
+    /* publish every sensor once */
+    (void)snprintf(name, sizeof(name), "/hdc1080_shm_bench_%d", (int)getpid());
+    if (hdc1080_shm_create(&gs_writer, name, gs_sensors) != 0)
+    {
+        fprintf(stderr, "create %s failed.\n", name);
+        
+        return 1;
+    }
+    for (i = 0; i < gs_sensors; i++)
+    {
+        a_serial(i, id);
+        a_sample(i, &sample);
+        (void)hdc1080_shm_publish(&gs_writer, id, &sample);
+    }
+    
+    /* 0 to readers reader processes against one writer thread */
+    printf("%u sensors, %u bytes per entry, writer %s, %us per run.\n", gs_sensors, (unsigned)sizeof(hdc1080_shm_entry_t),
+           (gs_rate != 0) ? "rate limited" : "flat out", seconds);
+    printf("readers  updates/s  publish max(ns)  reads/s  retries  torn  failed\n");
+    for (n = 0; n <= readers; n = (n == 0) ? 1 : n * 2)
+    {
+        memset(&total, 0, sizeof(total));
+        if (pipe(fd) != 0)
+        {
+            res = 1;
+            
+            break;
+        }
+        fflush(stdout);
+        for (i = 0; i < n; i++)
+        {
+            pid[i] = fork();
+            if (pid[i] == 0)
+            {
+                close(fd[0]);
+                _exit(a_reader(name, seconds, fd[1]));
+            }
+        }
+        close(fd[1]);
+        gs_stop = 0;
+        start = a_now_ns();
+        (void)pthread_create(&writer, NULL, a_writer, NULL);
+        if (n == 0)
+        {
+            sleep(seconds);
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (read(fd[0], &r, sizeof(r)) == (ssize_t)sizeof(r))
+            {
+                total.reads += r.reads;
+                total.retries += r.retries;
+                total.torn += r.torn;
+                total.failed += r.failed;
+            }
+            else
+            {
+                res = 1;
+            }
+        }
+        gs_stop = 1;
+        (void)pthread_join(writer, NULL);
+        elapsed = a_now_ns() - start;
+        for (i = 0; i < n; i++)
+        {
+            if ((waitpid(pid[i], &status, 0) != pid[i]) || (WIFEXITED(status) == 0) || (WEXITSTATUS(status) != 0))
+            {
+                res = 1;
+            }
+        }
+        close(fd[0]);
+        printf("%7u  %9.0f  %15llu  %7.0f  %7llu  %4llu  %6llu\n", n, gs_updates * 1e9 / elapsed,
+               (unsigned long long)gs_publish_max_ns, total.reads / (double)seconds,
+               (unsigned long long)total.retries, (unsigned long long)total.torn, (unsigned long long)total.failed);
+        if ((total.torn != 0) || (total.failed != 0))
+        {
+            res = 1;
+        }
+        if (n == readers)
+        {
+            break;
+        }
+    }
+    (void)hdc1080_shm_close(&gs_writer);
+    (void)hdc1080_shm_unlink(name);
+    
+    return res;
+}
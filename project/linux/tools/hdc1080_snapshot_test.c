@@ -0,0 +1,492 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_snapshot_test.c
+ * @brief     hdc1080 snapshot file storage test
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "driver_hdc1080_snapshot.h"
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @brief snapshot test tool definition
+ */
+#define SNAPSHOT_TEST_CONFIG        0x1600        /**< sequence mode, 11 bit temperature and 8 bit humidity */
+#define SNAPSHOT_TEST_READS         8             /**< filtered reads per boot */
+
+static hdc1080_handle_t gs_handle;                 /**< driver handle */
+static const char *gs_path = "hdc1080_snapshot.bin";        /**< snapshot file */
+static uint16_t gs_config = 0x1000;                /**< simulated config register */
+static uint16_t gs_serial = 0x0001;                /**< simulated serial id */
+static uint32_t gs_transactions;                   /**< bus transactions of the boot */
+static uint32_t gs_delay_ms;                       /**< delays of the boot */
+static uint32_t gs_sample;                         /**< simulated sample counter */
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     debug log
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      none
+ */
+static void a_debug_log(uint8_t id, uint16_t arg)
+{
+    fprintf(stderr, "hdc1080: debug id %d arg %d.\n", id, arg);
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_sim_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_sim_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       the temperature code moves by one step per sample
+ */
+static uint8_t a_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    (void)addr;
+    gs_transactions++;
+    if (len < 2)
+    {
+        return 1;
+    }
+    switch (reg)
+    {
+        case 0x00 : v = (uint16_t)(0x6000 + (gs_sample++ % 16) * 0x20); break;
+        case 0x01 : v = 0x6500; break;
+        case 0x02 : v = gs_config; break;
+        case 0xFB : v = 0x1080; break;
+        case 0xFC : v = gs_serial; break;
+        case 0xFD : v = 0x4200; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : v = 0x0000; break;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0);
+    if (len == 4)
+    {
+        buf[2] = 0x65;
+        buf[3] = 0x00;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_sim_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_sim_iic_read(addr, 0x00, buf, len);
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      a config write with bit 15 set resets the chip
+ */
+static uint8_t a_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    
+    (void)addr;
+    gs_transactions++;
+    if ((reg == 0x02) && (len == 2))
+    {
+        v = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);
+        gs_config = ((v & 0x8000) != 0) ? 0x1000 : (v & HDC1080_CONFIG_MASK);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      only counted
+ */
+static void a_sim_delay_ms(uint32_t ms)
+{
+    gs_delay_ms += ms;
+}
+
+/**
+ * @brief      file storage load
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a missing or short file fails
+ */
+static uint8_t a_file_load(uint8_t *buf, uint16_t len)
+{
+    FILE *fp;
+    size_t n;
+    
+    fp = fopen(gs_path, "rb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    n = fread(buf, 1, len, fp);
+    (void)fclose(fp);
+    
+    return (n == len) ? 0 : 1;
+}
+
+/**
+ * @brief     file storage save
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      it writes a temporary file and renames it, so a crash never leaves half a snapshot
+ */
+static uint8_t a_file_save(const uint8_t *buf, uint16_t len)
+{
+    char tmp[512];
+    FILE *fp;
+    
+    (void)snprintf(tmp, sizeof(tmp), "%s.tmp", gs_path);
+    fp = fopen(tmp, "wb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    if ((fwrite(buf, 1, len, fp) != len) || (fflush(fp) != 0) || (fsync(fileno(fp)) != 0))
+    {
+        (void)fclose(fp);
+        (void)remove(tmp);
+        
+        return 1;
+    }
+    (void)fclose(fp);
+    if (rename(tmp, gs_path) != 0)
+    {
+        (void)remove(tmp);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     damage the snapshot file
+ * @param[in] offset byte offset
+ * @param[in] len new file length, 0 keeps the length
+ * @return    status code
+ * @note      a byte at offset is flipped
+ */
+static uint8_t a_file_damage(long offset, long len)
+{
+    uint8_t buf[HDC1080_SNAPSHOT_SIZE];
+    FILE *fp;
+    
+    if (a_file_load(buf, HDC1080_SNAPSHOT_SIZE) != 0)
+    {
+        return 1;
+    }
+    buf[offset] ^= 0x01;
+    fp = fopen(gs_path, "wb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    (void)fwrite(buf, 1, (len != 0) ? (size_t)len : sizeof(buf), fp);
+    (void)fclose(fp);
+    
+    return 0;
+}
+
+/**
+ * @brief  link the driver handle as after an mcu reset
+ * @note   none
+ */
+static void a_link(void)
+{
+    DRIVER_HDC1080_LINK_INIT(&gs_handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_IIC_INIT(&gs_handle, a_sim_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(&gs_handle, a_sim_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, a_sim_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, a_sim_iic_read);
+    DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, a_sim_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, a_sim_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, a_sim_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, a_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, a_debug_log);
+    gs_transactions = 0;
+    gs_delay_ms = 0;
+}
+
+/**
+ * @brief      full init, configuration and calibration
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @param[out] *filter pointer to a filter structure
+ * @return     status code
+ * @note       the calibration stands for a table load at boot
+ */
+static uint8_t a_cold_boot(hdc1080_snapshot_t *snapshot, hdc1080_filter_t *filter)
+{
+    if ((hdc1080_init(&gs_handle) != 0) ||
+        (hdc1080_set_heater(&gs_handle, HDC1080_BOOL_FALSE) != 0) ||
+        (hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE) != 0) ||
+        (hdc1080_set_temperature_resolution(&gs_handle, HDC1080_TEMPERATURE_RESOLUTION_11_BIT) != 0) ||
+        (hdc1080_set_humidity_resolution(&gs_handle, HDC1080_HUMIDITY_RESOLUTION_8_BIT) != 0) ||
+        (hdc1080_get_serial_id(&gs_handle, snapshot->serial_id) != 0) ||
+        (hdc1080_filter_init_ema(filter, 3, 3) != 0))
+    {
+        return 1;
+    }
+    snapshot->temperature_offset = -12;
+    snapshot->humidity_offset = 40;
+    
+    return 0;
+}
+
+/**
+ * @brief      one boot of the device
+ * @param[in]  boot boot number
+ * @param[in]  expect expected load status
+ * @param[out] *estimate pointer to the last filtered temperature code
+ * @return     status code
+ * @note       it loads the snapshot, restores or falls back to the full init, reads and saves the snapshot
+ */
+static uint8_t a_boot(uint32_t boot, uint8_t expect, uint16_t *estimate)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t transactions;
+    uint32_t delay_ms;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    uint16_t humidity;
+    float temperature_s;
+    float humidity_s;
+    const char *path;
+    hdc1080_bool_t reset;
+    hdc1080_filter_t filter;
+    hdc1080_snapshot_t snapshot;
+    const hdc1080_snapshot_storage_t storage = {a_file_load, a_file_save};
+    
+    a_link();
+    memset(&snapshot, 0, sizeof(snapshot));
+    memset(&filter, 0, sizeof(filter));
+    res = hdc1080_snapshot_load(&storage, &snapshot);
+    if (res != expect)
+    {
+        printf("boot %u: load returned %u, expected %u.\n", boot, res, expect);
+        
+        return 1;
+    }
+    if (res == 0)
+    {
+        if (hdc1080_snapshot_restore(&gs_handle, &snapshot, &filter, &reset) != 0)
+        {
+            printf("boot %u: restore failed.\n", boot);
+            
+            return 1;
+        }
+        path = (reset == HDC1080_BOOL_TRUE) ? "restore, chip reset" : "restore";
+    }
+    else
+    {
+        if (a_cold_boot(&snapshot, &filter) != 0)
+        {
+            printf("boot %u: full init failed.\n", boot);
+            
+            return 1;
+        }
+        path = "full init";
+    }
+    transactions = gs_transactions;
+    delay_ms = gs_delay_ms;
+    if (gs_config != SNAPSHOT_TEST_CONFIG)
+    {
+        printf("boot %u: config 0x%04X is wrong.\n", boot, gs_config);
+        
+        return 1;
+    }
+    
+    /* run and save the state for the next boot */
+    for (i = 0; i < SNAPSHOT_TEST_READS; i++)
+    {
+        if ((hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature_s,
+                                               &humidity_raw, &humidity_s) != 0) ||
+            (hdc1080_snapshot_calibrate(&snapshot, &temperature_raw, &humidity_raw) != 0) ||
+            (hdc1080_filter_update(&filter, temperature_raw, humidity_raw, estimate, &humidity) != 0))
+        {
+            printf("boot %u: read failed.\n", boot);
+            
+            return 1;
+        }
+    }
+    if ((hdc1080_snapshot_capture(&gs_handle, &filter, &snapshot) != 0) ||
+        (hdc1080_snapshot_save(&storage, &snapshot) != 0))
+    {
+        printf("boot %u: save failed.\n", boot);
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    printf("%4u  %-20s  %12u  %8u  0x%04X\n", boot, path, transactions, delay_ms, *estimate);
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      usage: hdc1080_snapshot_test [--file=<path>] [--boots=<num>] [--keep]
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    uint32_t i;
+    uint32_t boots = 8;
+    uint8_t keep = 0;
+    uint16_t estimate;
+    const struct option long_options[] =
+    {
+        {"file", required_argument, NULL, 'f'},
+        {"boots", required_argument, NULL, 'b'},
+        {"keep", no_argument, NULL, 'k'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'f' : gs_path = optarg; break;
+            case 'b' : boots = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'k' : keep = 1; break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--file=<path>] [--boots=<num>] [--keep]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    if (boots < 2)
+    {
+        boots = 2;
+    }
+    (void)remove(gs_path);
+    
+    /* every fourth boot follows a power cycle, the others an mcu reset */
+    printf("boot  path                  transactions  delay ms  filter\n");
+    for (i = 0; i < boots; i++)
+    {
+        if ((i % 4) == 3)
+        {
+            gs_config = 0x1000;
+        }
+        if (a_boot(i, (i == 0) ? 1 : 0, &estimate) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* damaged files fall back to the full init */
+    if ((a_file_damage(20, 0) != 0) || (a_boot(i++, 4, &estimate) != 0))
+    {
+        return 1;
+    }
+    if ((a_file_damage(0, HDC1080_SNAPSHOT_SIZE / 2) != 0) || (a_boot(i++, 1, &estimate) != 0))
+    {
+        return 1;
+    }
+    if (keep == 0)
+    {
+        (void)remove(gs_path);
+    }
+    printf("hdc1080: snapshot test passed.\n");
+    
+    return 0;
+}
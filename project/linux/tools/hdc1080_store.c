@@ -0,0 +1,721 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_store.c
+ * @brief     hdc1080 columnar sample store
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "hdc1080_store.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief store column definition
+ */
+#define STORE_COLUMN_TIMESTAMP          0        /**< timestamp column */
+#define STORE_COLUMN_TEMPERATURE        1        /**< raw temperature column */
+#define STORE_COLUMN_HUMIDITY           2        /**< raw humidity column */
+#define STORE_COLUMN_FLAGS              3        /**< flags column */
+#define STORE_COLUMN_INDEX              4        /**< sparse index column */
+
+/**
+ * @brief store column file name table
+ */
+static const char *const gsc_name[HDC1080_STORE_COLUMNS] =
+{
+    "timestamp.col", "temperature.col", "humidity.col", "flags.col", "index.col",
+};
+
+/**
+ * @brief store column element size table
+ */
+static const size_t gsc_size[HDC1080_STORE_COLUMNS] =
+{
+    sizeof(uint64_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(uint8_t), sizeof(uint64_t),
+};
+
+/**
+ * @brief     write a buffer at an offset
+ * @param[in] fd file descriptor
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] offset file offset
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_store_write(int fd, const void *buf, size_t len, uint64_t offset)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+    ssize_t n;
+    
+    while (len != 0)
+    {
+        n = pwrite(fd, p, len, (off_t)offset);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            
+            return 1;
+        }
+        p += n;
+        len -= (size_t)n;
+        offset += (uint64_t)n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap all columns
+ * @param[in] *store pointer to a store structure
+ * @note      none
+ */
+static void a_store_unmap(hdc1080_store_t *store)
+{
+    uint8_t c;
+    
+    for (c = 0; c < HDC1080_STORE_COLUMNS; c++)
+    {
+        if (store->map[c] != NULL)
+        {
+            (void)munmap(store->map[c], store->map_len[c]);
+            store->map[c] = NULL;
+            store->map_len[c] = 0;
+        }
+    }
+    store->timestamp_ms = NULL;
+    store->temperature_raw = NULL;
+    store->humidity_raw = NULL;
+    store->flags = NULL;
+    store->index = NULL;
+}
+
+/**
+ * @brief     map all columns
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      an empty column is not mapped
+ */
+static uint8_t a_store_map(hdc1080_store_t *store)
+{
+    uint8_t c;
+    uint64_t n;
+    
+    a_store_unmap(store);
+    for (c = 0; c < HDC1080_STORE_COLUMNS; c++)
+    {
+        n = (c == STORE_COLUMN_INDEX) ? store->index_count : store->count;
+        if (n == 0)
+        {
+            continue;
+        }
+        store->map_len[c] = (size_t)(n * gsc_size[c]);
+        store->map[c] = mmap(NULL, store->map_len[c], PROT_READ, MAP_SHARED, store->fd[c], 0);
+        if (store->map[c] == MAP_FAILED)
+        {
+            store->map[c] = NULL;
+            store->map_len[c] = 0;
+            a_store_unmap(store);
+            
+            return 1;
+        }
+    }
+    
+    /* the scans read the columns front to back */
+    for (c = 0; c < STORE_COLUMN_INDEX; c++)
+    {
+        if (store->map[c] != NULL)
+        {
+            (void)posix_madvise(store->map[c], store->map_len[c], POSIX_MADV_SEQUENTIAL);
+        }
+    }
+    store->timestamp_ms = (const uint64_t *)store->map[STORE_COLUMN_TIMESTAMP];
+    store->temperature_raw = (const uint16_t *)store->map[STORE_COLUMN_TEMPERATURE];
+    store->humidity_raw = (const uint16_t *)store->map[STORE_COLUMN_HUMIDITY];
+    store->flags = (const uint8_t *)store->map[STORE_COLUMN_FLAGS];
+    store->index = (const uint64_t *)store->map[STORE_COLUMN_INDEX];
+    
+    return 0;
+}
+
+/**
+ * @brief     rebuild the sparse index from the timestamp column
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 rebuild failed
+ * @note      none
+ */
+static uint8_t a_store_rebuild_index(hdc1080_store_t *store)
+{
+    uint64_t i;
+    uint64_t n;
+    
+    n = (store->count + HDC1080_STORE_INDEX_STRIDE - 1) / HDC1080_STORE_INDEX_STRIDE;
+    if (ftruncate(store->fd[STORE_COLUMN_INDEX], 0) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (a_store_write(store->fd[STORE_COLUMN_INDEX], &store->timestamp_ms[i * HDC1080_STORE_INDEX_STRIDE],
+                          sizeof(uint64_t), i * sizeof(uint64_t)) != 0)
+        {
+            return 1;
+        }
+    }
+    store->index_count = n;
+    
+    return 0;
+}
+
+/**
+ * @brief     find the first sample not older than a timestamp
+ * @param[in] *store pointer to a store structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @return    sample position
+ * @note      none
+ */
+static uint64_t a_store_lower_bound(const hdc1080_store_t *store, uint64_t timestamp_ms)
+{
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t mid;
+    
+    /* the index narrows the search to one stride */
+    lo = 0;
+    hi = store->count;
+    if (store->index_count == (store->count + HDC1080_STORE_INDEX_STRIDE - 1) / HDC1080_STORE_INDEX_STRIDE)
+    {
+        lo = 0;
+        hi = store->index_count;
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+            if (store->index[mid] < timestamp_ms)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        if (lo == 0)
+        {
+            return 0;
+        }
+        hi = lo * HDC1080_STORE_INDEX_STRIDE;
+        if (hi > store->count)
+        {
+            hi = store->count;
+        }
+        lo = (lo - 1) * HDC1080_STORE_INDEX_STRIDE;
+    }
+    
+    /* search the timestamps */
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (store->timestamp_ms[mid] < timestamp_ms)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    
+    return lo;
+}
+
+/**
+ * @brief store raw channel sums structure definition
+ */
+typedef struct store_sums_s
+{
+    uint32_t min;        /**< min raw code */
+    uint32_t max;        /**< max raw code */
+    uint64_t sum;        /**< sum of the raw codes */
+    uint64_t sum2;       /**< sum of the squared raw codes */
+} store_sums_t;
+
+/**
+ * @brief         scan one raw column
+ * @param[in]     *raw pointer to a raw column
+ * @param[in]     len sample number
+ * @param[in,out] *sums pointer to a sums structure
+ * @note          one column at a time in chunks with 32 bit sums, so the compiler vectorizes the loop
+ */
+static void a_store_scan(const uint16_t *raw, uint64_t len, store_sums_t *sums)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t v;
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint64_t sum2;
+    
+    while (len != 0)
+    {
+        /* 65536 codes of 16 bit fit a 32 bit sum */
+        n = (len > 65536) ? 65536 : (uint32_t)len;
+        min = sums->min;
+        max = sums->max;
+        sum = 0;
+        sum2 = 0;
+        for (i = 0; i < n; i++)
+        {
+            v = raw[i];
+            min = (v < min) ? v : min;
+            max = (v > max) ? v : max;
+            sum += v;
+            sum2 += v * v;
+        }
+        sums->min = min;
+        sums->max = max;
+        sums->sum += sum;
+        sums->sum2 += sum2;
+        raw += n;
+        len -= n;
+    }
+}
+
+/**
+ * @brief      convert the raw sums of a channel
+ * @param[in]  *sums pointer to a sums structure
+ * @param[in]  count sample number
+ * @param[in]  *convert pointer to the driver conversion function of the channel
+ * @param[in]  span span of the channel
+ * @param[out] *channel pointer to a channel summary structure
+ * @note       min and max are converted by the driver, mean and stddev are not raw codes and use its constants
+ */
+static void a_store_channel(const store_sums_t *sums, uint64_t count, uint8_t (*convert)(uint16_t raw, float *s),
+                            float span, hdc1080_aggregate_channel_t *channel)
+{
+    double mean;
+    double var;
+    float offset;
+    
+    mean = (double)sums->sum / (double)count;
+    var = 0.0;
+    if (count > 1)
+    {
+        var = ((double)sums->sum2 - mean * (double)sums->sum) / (double)(count - 1);
+        if (var < 0.0)
+        {
+            var = 0.0;
+        }
+    }
+    (void)convert(0, &offset);
+    (void)convert((uint16_t)sums->min, &channel->min);
+    (void)convert((uint16_t)sums->max, &channel->max);
+    channel->mean = (float)(mean / HDC1080_RAW_SPAN * span + offset);
+    channel->stddev = (float)(sqrt(var) / HDC1080_RAW_SPAN * span);
+}
+
+/**
+ * @brief     open a store
+ * @param[in] *store pointer to a store structure
+ * @param[in] *dir pointer to a store directory
+ * @param[in] writable 1 creates the directory and allows appends
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 store or dir is NULL
+ * @note      the columns are cut to the shortest one and the index is rebuilt if a writer stopped in the middle
+ */
+uint8_t hdc1080_store_open(hdc1080_store_t *store, const char *dir, uint8_t writable)
+{
+    uint8_t c;
+    uint8_t rebuild;
+    uint64_t n;
+    char path[HDC1080_STORE_MAX_PATH + 32];
+    struct stat st;
+    
+    if ((store == NULL) || (dir == NULL))
+    {
+        return 2;
+    }
+    
+    /* open the columns */
+    memset(store, 0, sizeof(hdc1080_store_t));
+    for (c = 0; c < HDC1080_STORE_COLUMNS; c++)
+    {
+        store->fd[c] = -1;
+    }
+    if (strlen(dir) >= HDC1080_STORE_MAX_PATH)
+    {
+        return 1;
+    }
+    strcpy(store->dir, dir);
+    store->writable = writable;
+    if ((writable != 0) && (mkdir(dir, 0755) != 0) && (errno != EEXIST))
+    {
+        return 1;
+    }
+    store->count = UINT64_MAX;
+    for (c = 0; c < HDC1080_STORE_COLUMNS; c++)
+    {
+        (void)snprintf(path, sizeof(path), "%s/%s", dir, gsc_name[c]);
+        store->fd[c] = open(path, (writable != 0) ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+        if ((store->fd[c] < 0) && (c == STORE_COLUMN_INDEX) && (errno == ENOENT))
+        {
+            /* a reader works without the index */
+            continue;
+        }
+        if ((store->fd[c] < 0) || (fstat(store->fd[c], &st) != 0))
+        {
+            (void)hdc1080_store_close(store);
+            
+            return 1;
+        }
+        n = (uint64_t)st.st_size / gsc_size[c];
+        if (c == STORE_COLUMN_INDEX)
+        {
+            store->index_count = n;
+        }
+        else if (n < store->count)
+        {
+            store->count = n;
+        }
+        else
+        {
+            /* the column is not shorter */
+        }
+    }
+    
+    /* cut the columns of an interrupted append */
+    if (writable != 0)
+    {
+        for (c = 0; c < STORE_COLUMN_INDEX; c++)
+        {
+            if (ftruncate(store->fd[c], (off_t)(store->count * gsc_size[c])) != 0)
+            {
+                (void)hdc1080_store_close(store);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* a writer rebuilds a stale index, a reader without a valid index falls back to a full binary search */
+    n = (store->count + HDC1080_STORE_INDEX_STRIDE - 1) / HDC1080_STORE_INDEX_STRIDE;
+    rebuild = (uint8_t)((writable != 0) && (store->index_count != n));
+    if (store->index_count > n)
+    {
+        store->index_count = n;
+    }
+    if (a_store_map(store) != 0)
+    {
+        (void)hdc1080_store_close(store);
+        
+        return 1;
+    }
+    if (rebuild != 0)
+    {
+        if ((a_store_rebuild_index(store) != 0) || (a_store_map(store) != 0))
+        {
+            (void)hdc1080_store_close(store);
+            
+            return 1;
+        }
+    }
+    if (store->count != 0)
+    {
+        store->last_ms = store->timestamp_ms[store->count - 1];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close a store
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 store is NULL
+ * @note      the buffered samples are written first
+ */
+uint8_t hdc1080_store_close(hdc1080_store_t *store)
+{
+    uint8_t c;
+    uint8_t res = 0;
+    
+    if (store == NULL)
+    {
+        return 2;
+    }
+    
+    if ((store->writable != 0) && (store->pending != 0))
+    {
+        res = hdc1080_store_flush(store);
+    }
+    a_store_unmap(store);
+    for (c = 0; c < HDC1080_STORE_COLUMNS; c++)
+    {
+        if (store->fd[c] >= 0)
+        {
+            (void)close(store->fd[c]);
+            store->fd[c] = -1;
+        }
+    }
+    store->count = 0;
+    store->index_count = 0;
+    
+    return res;
+}
+
+/**
+ * @brief     append a sample
+ * @param[in] *store pointer to a store structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] temperature_raw raw temperature
+ * @param[in] humidity_raw raw humidity
+ * @param[in] flags sample flags
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 store is NULL
+ *            - 3 store is read only
+ *            - 4 timestamp is not newer than the last sample
+ * @note      the samples are buffered and become visible to the queries after hdc1080_store_flush
+ */
+uint8_t hdc1080_store_append(hdc1080_store_t *store, uint64_t timestamp_ms, uint16_t temperature_raw,
+                             uint16_t humidity_raw, uint8_t flags)
+{
+    if (store == NULL)
+    {
+        return 2;
+    }
+    if (store->writable == 0)
+    {
+        return 3;
+    }
+    if (((store->count != 0) || (store->pending != 0)) && (timestamp_ms <= store->last_ms))
+    {
+        return 4;
+    }
+    
+    /* buffer the sample */
+    store->pending_timestamp_ms[store->pending] = timestamp_ms;
+    store->pending_temperature_raw[store->pending] = temperature_raw;
+    store->pending_humidity_raw[store->pending] = humidity_raw;
+    store->pending_flags[store->pending] = flags;
+    store->pending++;
+    store->last_ms = timestamp_ms;
+    if (store->pending == HDC1080_STORE_BUFFER_LEN)
+    {
+        return hdc1080_store_flush(store);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     write the buffered samples and map them
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 store is NULL
+ * @note      none
+ */
+uint8_t hdc1080_store_flush(hdc1080_store_t *store)
+{
+    uint32_t i;
+    uint64_t n;
+    
+    if (store == NULL)
+    {
+        return 2;
+    }
+    if (store->pending == 0)
+    {
+        return 0;
+    }
+    
+    /* the data columns first, the index last */
+    n = store->pending;
+    if ((a_store_write(store->fd[STORE_COLUMN_TIMESTAMP], store->pending_timestamp_ms, n * sizeof(uint64_t),
+                       store->count * sizeof(uint64_t)) != 0) ||
+        (a_store_write(store->fd[STORE_COLUMN_TEMPERATURE], store->pending_temperature_raw, n * sizeof(uint16_t),
+                       store->count * sizeof(uint16_t)) != 0) ||
+        (a_store_write(store->fd[STORE_COLUMN_HUMIDITY], store->pending_humidity_raw, n * sizeof(uint16_t),
+                       store->count * sizeof(uint16_t)) != 0) ||
+        (a_store_write(store->fd[STORE_COLUMN_FLAGS], store->pending_flags, n * sizeof(uint8_t),
+                       store->count * sizeof(uint8_t)) != 0))
+    {
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if (((store->count + i) % HDC1080_STORE_INDEX_STRIDE) == 0)
+        {
+            if (a_store_write(store->fd[STORE_COLUMN_INDEX], &store->pending_timestamp_ms[i], sizeof(uint64_t),
+                              store->index_count * sizeof(uint64_t)) != 0)
+            {
+                return 1;
+            }
+            store->index_count++;
+        }
+    }
+    store->count += n;
+    store->pending = 0;
+    
+    return a_store_map(store);
+}
+
+/**
+ * @brief      find the samples of a time range
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms range start time in ms
+ * @param[in]  end_ms range end time in ms, exclusive
+ * @param[out] *first pointer to a first sample buffer
+ * @param[out] *last pointer to a last sample buffer, exclusive
+ * @return     status code
+ *             - 0 success
+ *             - 2 store, first or last is NULL
+ *             - 4 range is invalid
+ * @note       a binary search of the sparse index and of one index stride, it touches a few pages only
+ */
+uint8_t hdc1080_store_range(const hdc1080_store_t *store, uint64_t start_ms, uint64_t end_ms,
+                            uint64_t *first, uint64_t *last)
+{
+    if ((store == NULL) || (first == NULL) || (last == NULL))
+    {
+        return 2;
+    }
+    if (start_ms > end_ms)
+    {
+        return 4;
+    }
+    
+    *first = a_store_lower_bound(store, start_ms);
+    *last = a_store_lower_bound(store, end_ms);
+    
+    return 0;
+}
+
+/**
+ * @brief      summarize a time range
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms range start time in ms
+ * @param[in]  end_ms range end time in ms, exclusive
+ * @param[in]  exclude samples with one of these flags are skipped
+ * @param[out] *summary pointer to a summary structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or summary is NULL
+ *             - 4 range is invalid
+ * @note       min, max, sum and sum of squares run on the raw codes with integers,
+ *             only the result is converted with the driver formulas, an empty range has a count of 0
+ */
+uint8_t hdc1080_store_summarize(const hdc1080_store_t *store, uint64_t start_ms, uint64_t end_ms, uint8_t exclude,
+                                hdc1080_store_summary_t *summary)
+{
+    uint8_t res;
+    uint64_t i;
+    uint64_t first;
+    uint64_t last;
+    uint64_t count;
+    store_sums_t t = {0xFFFF, 0, 0, 0};
+    store_sums_t h = {0xFFFF, 0, 0, 0};
+    
+    if (summary == NULL)
+    {
+        return 2;
+    }
+    res = hdc1080_store_range(store, start_ms, end_ms, &first, &last);
+    if (res != 0)
+    {
+        return res;
+    }
+    
+    /* integer scan of the raw columns, the runs between the excluded samples are scanned in one go */
+    count = 0;
+    while (first < last)
+    {
+        i = first;
+        if (exclude != 0)
+        {
+            while ((i < last) && ((store->flags[i] & exclude) == 0))
+            {
+                i++;
+            }
+        }
+        else
+        {
+            i = last;
+        }
+        a_store_scan(&store->temperature_raw[first], i - first, &t);
+        a_store_scan(&store->humidity_raw[first], i - first, &h);
+        count += i - first;
+        
+        /* skip the excluded samples */
+        while ((i < last) && ((store->flags[i] & exclude) != 0))
+        {
+            i++;
+        }
+        first = i;
+    }
+    
+    /* convert the result */
+    memset(summary, 0, sizeof(hdc1080_store_summary_t));
+    summary->start_ms = start_ms;
+    summary->end_ms = end_ms;
+    summary->count = count;
+    if (count != 0)
+    {
+        a_store_channel(&t, count, hdc1080_temperature_convert_to_data, HDC1080_TEMPERATURE_SPAN, &summary->temperature);
+        a_store_channel(&h, count, hdc1080_humidity_convert_to_data, HDC1080_HUMIDITY_SPAN, &summary->humidity);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_store.h
+ * @brief     hdc1080 columnar sample store header
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef HDC1080_STORE_H
+#define HDC1080_STORE_H
+
+#include "driver_hdc1080_aggregate.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @brief store definition
+ */
+#define HDC1080_STORE_COLUMNS            5              /**< column file number */
+#define HDC1080_STORE_INDEX_STRIDE       4096           /**< samples per sparse index entry */
+#define HDC1080_STORE_BUFFER_LEN         4096           /**< appended samples buffered before a write */
+#define HDC1080_STORE_MAX_PATH           256            /**< max directory path length */
+
+/**
+ * @brief store sample flag definition
+ */
+#define HDC1080_STORE_FLAG_HEATER        (1 << 0)       /**< heater was on, the temperature is biased */
+#define HDC1080_STORE_FLAG_INVALID       (1 << 1)       /**< sample is known to be invalid */
+
+/**
+ * @brief store structure definition
+ */
+typedef struct hdc1080_store_s
+{
+    char dir[HDC1080_STORE_MAX_PATH];                              /**< store directory */
+    int fd[HDC1080_STORE_COLUMNS];                                 /**< column files */
+    void *map[HDC1080_STORE_COLUMNS];                              /**< column mappings */
+    size_t map_len[HDC1080_STORE_COLUMNS];                         /**< column mapping lengths */
+    const uint64_t *timestamp_ms;                                  /**< timestamp column in ms */
+    const uint16_t *temperature_raw;                               /**< raw temperature column */
+    const uint16_t *humidity_raw;                                  /**< raw humidity column */
+    const uint8_t *flags;                                          /**< flags column */
+    const uint64_t *index;                                         /**< timestamp of every HDC1080_STORE_INDEX_STRIDE sample */
+    uint64_t count;                                                /**< mapped sample number */
+    uint64_t index_count;                                          /**< mapped index entry number */
+    uint64_t last_ms;                                              /**< last appended timestamp in ms */
+    uint32_t pending;                                              /**< buffered sample number */
+    uint8_t writable;                                              /**< writable flag */
+    uint64_t pending_timestamp_ms[HDC1080_STORE_BUFFER_LEN];       /**< buffered timestamps */
+    uint16_t pending_temperature_raw[HDC1080_STORE_BUFFER_LEN];    /**< buffered raw temperatures */
+    uint16_t pending_humidity_raw[HDC1080_STORE_BUFFER_LEN];       /**< buffered raw humidities */
+    uint8_t pending_flags[HDC1080_STORE_BUFFER_LEN];               /**< buffered flags */
+} hdc1080_store_t;
+
+/**
+ * @brief store summary structure definition
+ */
+typedef struct hdc1080_store_summary_s
+{
+    uint64_t start_ms;                              /**< range start time in ms */
+    uint64_t end_ms;                                /**< range end time in ms, exclusive */
+    uint64_t count;                                 /**< sample number */
+    hdc1080_aggregate_channel_t temperature;        /**< temperature summary in C */
+    hdc1080_aggregate_channel_t humidity;           /**< humidity summary in % */
+} hdc1080_store_summary_t;
+
+/**
+ * @brief     open a store
+ * @param[in] *store pointer to a store structure
+ * @param[in] *dir pointer to a store directory
+ * @param[in] writable 1 creates the directory and allows appends
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ *            - 2 store or dir is NULL
+ * @note      the columns are cut to the shortest one and the index is rebuilt if a writer stopped in the middle
+ */
+uint8_t hdc1080_store_open(hdc1080_store_t *store, const char *dir, uint8_t writable);
+
+/**
+ * @brief     close a store
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 store is NULL
+ * @note      the buffered samples are written first
+ */
+uint8_t hdc1080_store_close(hdc1080_store_t *store);
+
+/**
+ * @brief     append a sample
+ * @param[in] *store pointer to a store structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] temperature_raw raw temperature
+ * @param[in] humidity_raw raw humidity
+ * @param[in] flags sample flags
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 store is NULL
+ *            - 3 store is read only
+ *            - 4 timestamp is not newer than the last sample
+ * @note      the samples are buffered and become visible to the queries after hdc1080_store_flush
+ */
+uint8_t hdc1080_store_append(hdc1080_store_t *store, uint64_t timestamp_ms, uint16_t temperature_raw,
+                             uint16_t humidity_raw, uint8_t flags);
+
+/**
+ * @brief     write the buffered samples and map them
+ * @param[in] *store pointer to a store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ *            - 2 store is NULL
+ * @note      none
+ */
+uint8_t hdc1080_store_flush(hdc1080_store_t *store);
+
+/**
+ * @brief      find the samples of a time range
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms range start time in ms
+ * @param[in]  end_ms range end time in ms, exclusive
+ * @param[out] *first pointer to a first sample buffer
+ * @param[out] *last pointer to a last sample buffer, exclusive
+ * @return     status code
+ *             - 0 success
+ *             - 2 store, first or last is NULL
+ *             - 4 range is invalid
+ * @note       a binary search of the sparse index and of one index stride, it touches a few pages only
+ */
+uint8_t hdc1080_store_range(const hdc1080_store_t *store, uint64_t start_ms, uint64_t end_ms,
+                            uint64_t *first, uint64_t *last);
+
+/**
+ * @brief      summarize a time range
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms range start time in ms
+ * @param[in]  end_ms range end time in ms, exclusive
+ * @param[in]  exclude samples with one of these flags are skipped
+ * @param[out] *summary pointer to a summary structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or summary is NULL
+ *             - 4 range is invalid
+ * @note       min, max, sum and sum of squares run on the raw codes with integers,
+ *             only the result is converted with the driver formulas, an empty range has a count of 0
+ */
+uint8_t hdc1080_store_summarize(const hdc1080_store_t *store, uint64_t start_ms, uint64_t end_ms, uint8_t exclude,
+                                hdc1080_store_summary_t *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,521 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      hdc1080_trace_replay.c
+ * @brief     hdc1080 bus trace replay tool
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "driver_hdc1080_record.h"
+#include <ctype.h>
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief trace replay tool definition
+ */
+#define TRACE_REPLAY_PREFIX        "hdc1080: trace "        /**< prefix of a hex line in a shell log */
+
+static const char *const gsc_type[] =
+{
+    "iic_init", "iic_deinit", "iic_read", "iic_write", "iic_read_cmd", "iic_read_with_wait", "delay_ms",
+};                                                   /**< event type names */
+static hdc1080_handle_t gs_bus;                      /**< handle holding the replayed bus */
+static hdc1080_trace_handle_t gs_trace;              /**< trace handle */
+static uint32_t gs_tick_ms = 0;                      /**< virtual tick */
+static uint8_t gs_quiet = 0;                         /**< 1 hides the driver prints */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static double a_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ * @note   the interface of the record example runs on the replayed trace
+ */
+uint8_t hdc1080_interface_iic_init(void)
+{
+    return gs_bus.iic_init();
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ * @note   none
+ */
+uint8_t hdc1080_interface_iic_deinit(void)
+{
+    return gs_bus.iic_deinit();
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       none
+ */
+uint8_t hdc1080_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return gs_bus.iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read with wait
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       none
+ */
+uint8_t hdc1080_interface_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return gs_bus.iic_read_with_wait(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       none
+ */
+uint8_t hdc1080_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return gs_bus.iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ * @note      none
+ */
+uint8_t hdc1080_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return gs_bus.iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the replay only counts the delay and advances the virtual tick
+ */
+void hdc1080_interface_delay_ms(uint32_t ms)
+{
+    gs_tick_ms += ms;
+    gs_bus.delay_ms(ms);
+}
+
+/**
+ * @brief  interface get the tick
+ * @return virtual tick in ms
+ * @note   none
+ */
+uint32_t hdc1080_interface_get_tick_ms(void)
+{
+    return gs_tick_ms;
+}
+
+/**
+ * @brief     interface sleep until a tick
+ * @param[in] tick wake up tick in ms
+ * @note      none
+ */
+void hdc1080_interface_sleep_until_ms(uint32_t tick)
+{
+    if ((int32_t)(tick - gs_tick_ms) > 0)
+    {
+        hdc1080_interface_delay_ms(tick - gs_tick_ms);
+    }
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void hdc1080_interface_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    if (gs_quiet != 0)
+    {
+        return;
+    }
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     interface log a binary debug record
+ * @param[in] id debug id
+ * @param[in] arg debug argument
+ * @note      none
+ */
+void hdc1080_interface_debug_log(uint8_t id, uint16_t arg)
+{
+    if (gs_quiet == 0)
+    {
+        fprintf(stderr, "hdc1080: debug id %u, arg %u.\n", id, arg);
+    }
+}
+
+/**
+ * @brief         extract the hex lines of a shell log
+ * @param[in,out] *buf pointer to a log buffer, the trace overwrites it
+ * @param[in]     len log length
+ * @return        trace length
+ * @note          a line is kept when it has the prefix followed by hex digits only
+ */
+static uint32_t a_trace_replay_from_log(uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t out = 0;
+    uint32_t plen = (uint32_t)strlen(TRACE_REPLAY_PREFIX);
+    char hex[3] = {0, 0, 0};
+    
+    i = 0;
+    while (i < len)
+    {
+        /* find the prefix */
+        if ((len - i < plen) || (memcmp(&buf[i], TRACE_REPLAY_PREFIX, plen) != 0))
+        {
+            i++;
+            
+            continue;
+        }
+        i += plen;
+        
+        /* check the hex digits */
+        j = i;
+        while ((j < len) && (isxdigit(buf[j]) != 0))
+        {
+            j++;
+        }
+        if ((j == i) || (((j - i) % 2) != 0) || ((j < len) && (buf[j] != '\r') && (buf[j] != '\n')))
+        {
+            continue;
+        }
+        
+        /* convert in place, the output never passes the input */
+        for (; i < j; i += 2)
+        {
+            hex[0] = (char)buf[i];
+            hex[1] = (char)buf[i + 1];
+            buf[out++] = (uint8_t)strtoul(hex, NULL, 16);
+        }
+    }
+    
+    return out;
+}
+
+/**
+ * @brief     list the events of a trace
+ * @param[in] *buf pointer to a trace
+ * @param[in] len trace length
+ * @return    status code
+ *            - 0 success
+ *            - 1 trace is invalid
+ * @note      none
+ */
+static uint8_t a_trace_replay_dump(const uint8_t *buf, uint32_t len)
+{
+    uint8_t res;
+    uint16_t i;
+    uint32_t pos;
+    uint32_t last;
+    hdc1080_trace_event_t event;
+    
+    printf("offset,dt_ms,type,status,addr,reg,len,data,delay_ms\n");
+    pos = 0;
+    last = 0;
+    while ((res = hdc1080_trace_parse(buf, len, &pos, &event)) == 0)
+    {
+        printf("%u,%u,%s,%u,", (last == 0) ? HDC1080_TRACE_HEADER_SIZE : last, event.dt_ms,
+               gsc_type[event.type], event.status);
+        if (event.type == HDC1080_TRACE_EVENT_DELAY)
+        {
+            printf(",,,,%u\n", event.delay_ms);
+        }
+        else if ((event.type == HDC1080_TRACE_EVENT_IIC_INIT) || (event.type == HDC1080_TRACE_EVENT_IIC_DEINIT))
+        {
+            printf(",,,,\n");
+        }
+        else
+        {
+            printf("0x%02X,0x%02X,%u,", event.addr, event.reg, event.len);
+            for (i = 0; i < event.len; i++)
+            {
+                printf("%02X", event.data[i]);
+            }
+            printf(",\n");
+        }
+        last = pos;
+    }
+    if (res != 1)
+    {
+        fprintf(stderr, "hdc1080_trace_replay: trace is invalid at offset %u.\n", pos);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     get the type of the next bus event
+ * @param[in] *buf pointer to a trace
+ * @param[in] len trace length
+ * @param[in] pos trace offset
+ * @return    event type, 0xFF at the end
+ * @note      the delays are skipped
+ */
+static uint8_t a_trace_replay_next(const uint8_t *buf, uint32_t len, uint32_t pos)
+{
+    hdc1080_trace_event_t event;
+    
+    while (hdc1080_trace_parse(buf, len, &pos, &event) == 0)
+    {
+        if (event.type != HDC1080_TRACE_EVENT_DELAY)
+        {
+            return (uint8_t)event.type;
+        }
+    }
+    
+    return 0xFF;
+}
+
+/**
+ * @brief     replay a trace through the record example
+ * @param[in] *buf pointer to a trace
+ * @param[in] len trace length
+ * @param[in] print 1 prints the csv lines
+ * @return    read samples
+ * @note      init, read while the next bus event is a read and deinit, as hdc1080 -e read --trace records it
+ */
+static uint32_t a_trace_replay_run(const uint8_t *buf, uint32_t len, uint8_t print)
+{
+    uint32_t n = 0;
+    float temperature;
+    float humidity;
+    
+    memset(&gs_bus, 0, sizeof(hdc1080_handle_t));
+    gs_tick_ms = 0;
+    if (hdc1080_trace_replay(&gs_trace, &gs_bus, buf, len) != 0)
+    {
+        return 0;
+    }
+    if (hdc1080_record_init(NULL, NULL, 0) == 0)
+    {
+        while (a_trace_replay_next(buf, len, gs_trace.len) == HDC1080_TRACE_EVENT_IIC_READ_WITH_WAIT)
+        {
+            if (hdc1080_record_read(&temperature, &humidity) != 0)
+            {
+                break;
+            }
+            n++;
+            if (print != 0)
+            {
+                printf("%u,%0.2f,%0.2f\n", n, temperature, humidity);
+            }
+        }
+        (void)hdc1080_record_deinit();
+    }
+    (void)hdc1080_trace_detach(&gs_trace, &gs_bus);
+    
+    return n;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed or the replay differs from the trace
+ * @note      usage: hdc1080_trace_replay [--dump] [--bench=<rounds>] [trace], it reads stdin without a file,
+ *            the trace is binary or the shell log of hdc1080 -e read --trace
+ */
+int main(int argc, char **argv)
+{
+    FILE *f;
+    int c;
+    uint8_t dump = 0;
+    uint8_t *buf;
+    uint8_t *p;
+    uint32_t i;
+    uint32_t n;
+    uint32_t len;
+    uint32_t size;
+    uint32_t rounds = 0;
+    double ns;
+    const struct option long_options[] =
+    {
+        {"dump", no_argument, NULL, 'd'},
+        {"bench", required_argument, NULL, 'b'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+            case 'd' : dump = 1; break;
+            case 'b' : rounds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default :
+            {
+                fprintf(stderr, "usage: %s [--dump] [--bench=<rounds>] [trace]\n", argv[0]);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* open the trace */
+    if (optind < argc)
+    {
+        f = fopen(argv[optind], "rb");
+        if (f == NULL)
+        {
+            fprintf(stderr, "hdc1080_trace_replay: open %s failed.\n", argv[optind]);
+            
+            return 1;
+        }
+    }
+    else
+    {
+        f = stdin;
+    }
+    
+    /* read the whole trace */
+    len = 0;
+    size = 4096;
+    buf = (uint8_t *)malloc(size);
+    while (buf != NULL)
+    {
+        len += (uint32_t)fread(&buf[len], 1, size - len, f);
+        if (len < size)
+        {
+            break;
+        }
+        size *= 2;
+        p = (uint8_t *)realloc(buf, size);
+        if (p == NULL)
+        {
+            free(buf);
+        }
+        buf = p;
+    }
+    if (f != stdin)
+    {
+        (void)fclose(f);
+    }
+    if (buf == NULL)
+    {
+        fprintf(stderr, "hdc1080_trace_replay: out of memory.\n");
+        
+        return 1;
+    }
+    
+    /* a shell log carries the trace as hex lines */
+    if ((len < 2) || (buf[0] != (uint8_t)(HDC1080_TRACE_MAGIC >> 0)) || (buf[1] != (uint8_t)(HDC1080_TRACE_MAGIC >> 8)))
+    {
+        len = a_trace_replay_from_log(buf, len);
+    }
+    if (dump != 0)
+    {
+        c = a_trace_replay_dump(buf, len);
+        free(buf);
+        
+        return c;
+    }
+    
+    /* replay */
+    if (rounds == 0)
+    {
+        printf("sample,temperature_c,humidity_percent\n");
+        n = a_trace_replay_run(buf, len, 1);
+    }
+    else
+    {
+        gs_quiet = 1;
+        n = 0;
+        ns = a_now_ns();
+        for (i = 0; i < rounds; i++)
+        {
+            n = a_trace_replay_run(buf, len, 0);
+        }
+        ns = a_now_ns() - ns;
+        printf("%u bytes, %u events, %u samples.\n", len, gs_trace.events, n);
+        printf("%0.2f us per replay, %0.1f ns per event.\n", ns / rounds / 1000.0,
+               (gs_trace.events != 0) ? ns / ((double)rounds * gs_trace.events) : 0.0);
+    }
+    fprintf(stderr, "hdc1080_trace_replay: %u bytes, %u events, %u samples, %u mismatches",
+            len, gs_trace.events, n, gs_trace.mismatch);
+    if (gs_trace.mismatch != 0)
+    {
+        fprintf(stderr, ", the first at offset %u", gs_trace.mismatch_pos);
+    }
+    fprintf(stderr, ".\n");
+    fprintf(stderr, "hdc1080_trace_replay: recorded %ums, recorded delays %ums, replayed delays %ums.\n",
+            gs_trace.elapsed_ms, gs_trace.trace_delay_ms, gs_trace.replay_delay_ms);
+    c = ((gs_trace.mismatch != 0) || (gs_trace.len < len)) ? 1 : 0;
+    free(buf);
+    
+    return c;
+}
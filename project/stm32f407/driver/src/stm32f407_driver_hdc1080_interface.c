@@ -35,11 +35,53 @@
  */
 
 #include "driver_hdc1080_interface.h"
+#include "driver_hdc1080_log.h"
 #include "delay.h"
 #include "iic.h"
 #include "uart.h"
 #include <stdarg.h>
 
+static hdc1080_log_handle_t gs_log;        /**< deferred debug log */
+
+/**
+ * @brief interface send the deferred debug records
+ * @note  the records are sent as packed hex lines, project/linux/tools/hdc1080_log_decode formats them on the host,
+ *        so no message string is linked, call it from the main loop and never from the driver hooks
+ */
+void hdc1080_interface_debug_flush(void)
+{
+    char str[32];
+    uint8_t buf[HDC1080_LOG_RECORD_SIZE];
+    uint16_t len;
+    uint32_t lost;
+    uint32_t i;
+    hdc1080_log_record_t record;
+    static const char hex[] = "0123456789ABCDEF";
+    
+    /* send all pending records */
+    while (hdc1080_log_read(&gs_log, &record) == 0)
+    {
+        (void)hdc1080_log_pack(&record, buf);
+        len = (uint16_t)(sizeof(HDC1080_LOG_LINE_PREFIX) - 1);
+        memcpy(str, HDC1080_LOG_LINE_PREFIX, len);
+        for (i = 0; i < HDC1080_LOG_RECORD_SIZE; i++)
+        {
+            str[len++] = hex[buf[i] >> 4];
+            str[len++] = hex[buf[i] & 0x0F];
+        }
+        str[len++] = '\n';
+        (void)uart_write((uint8_t *)str, len);
+    }
+    
+    /* report the dropped records */
+    (void)hdc1080_log_reset_lost(&gs_log, &lost);
+    if (lost != 0)
+    {
+        (void)snprintf(str, 32, HDC1080_LOG_LINE_LOST "%lu\n", (unsigned long)lost);
+        (void)uart_write((uint8_t *)str, (uint16_t)strlen(str));
+    }
+}
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -96,6 +138,21 @@ uint8_t hdc1080_interface_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t
     return iic_read_with_wait(addr, reg, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads without sending a register address
+ */
+uint8_t hdc1080_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(addr, buf, len);
+}
+
 /**
  * @brief     interface iic bus write
  * @param[in] addr iic device write address
@@ -122,6 +179,31 @@ void hdc1080_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface get the tick
+ * @return current tick in ms
+ * @note   it wraps around after 2^32 ms
+ */
+uint32_t hdc1080_interface_get_tick_ms(void)
+{
+    return HAL_GetTick();
+}
+
+/**
+ * @brief     interface sleep until the tick
+ * @param[in] tick wake up tick in ms
+ * @note      it returns at once when the tick has passed,
+ *            a low power port stops the core until the next interrupt instead of spinning
+ */
+void hdc1080_interface_sleep_until_ms(uint32_t tick)
+{
+    /* the systick interrupt wakes the core every ms */
+    while ((int32_t)(HAL_GetTick() - tick) < 0)
+    {
+        __WFI();
+    }
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -133,6 +215,9 @@ void hdc1080_interface_debug_print(const char *const fmt, ...)
     uint16_t len;
     va_list args;
     
+    /* keep the output order */
+    hdc1080_interface_debug_flush();
+    
     memset((char *)str, 0, sizeof(char) * 256); 
     va_start(args, fmt);
     vsnprintf((char *)str, 255, (char const *)fmt, args);
@@ -141,3 +226,15 @@ void hdc1080_interface_debug_print(const char *const fmt, ...)
     len = strlen((char *)str);
     (void)uart_write((uint8_t *)str, len);
 }
+
+/**
+ * @brief     interface log debug message record
+ * @param[in] id debug message id
+ * @param[in] arg debug message argument
+ * @note      it must not block, only used when HDC1080_DEBUG_LEVEL is HDC1080_DEBUG_LEVEL_BINARY
+ */
+void hdc1080_interface_debug_log(uint8_t id, uint16_t arg)
+{
+    /* store the record, the main loop sends it */
+    (void)hdc1080_log_write(&gs_log, id, arg);
+}
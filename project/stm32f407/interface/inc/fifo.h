@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      fifo.h
+ * @brief     fifo header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef FIFO_H
+#define FIFO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup fifo fifo function
+ * @brief    fifo function modules
+ * @{
+ */
+
+/**
+ * @brief fifo structure definition
+ */
+typedef struct fifo_s
+{
+    uint8_t *buf;                  /**< data buffer */
+    uint32_t size;                 /**< buffer size, power of 2 */
+    volatile uint32_t head;        /**< write counter, only released by the producer */
+    volatile uint32_t tail;        /**< read counter, only released by the consumer */
+} fifo_t;
+
+/**
+ * @brief     fifo init
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 1 size is not a power of 2
+ * @note      none
+ */
+uint8_t fifo_init(fifo_t *fifo, uint8_t *buf, uint32_t size);
+
+/**
+ * @brief     fifo get the used length
+ * @param[in] *fifo pointer to a fifo structure
+ * @return    used length
+ * @note      none
+ */
+uint32_t fifo_get_used(fifo_t *fifo);
+
+/**
+ * @brief     fifo get the free length
+ * @param[in] *fifo pointer to a fifo structure
+ * @return    free length
+ * @note      none
+ */
+uint32_t fifo_get_free(fifo_t *fifo);
+
+/**
+ * @brief     fifo write data
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    length of the written data
+ * @note      producer side, it writes as many bytes as fit and never blocks
+ */
+uint32_t fifo_write(fifo_t *fifo, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      fifo read data
+ * @param[in]  *fifo pointer to a fifo structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     length of the read data
+ * @note       consumer side
+ */
+uint32_t fifo_read(fifo_t *fifo, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      fifo get the continuous data block
+ * @param[in]  *fifo pointer to a fifo structure
+ * @param[out] **buf pointer to a data block address buffer
+ * @return     length of the data block
+ * @note       consumer side, the block stays valid until fifo_drop is called,
+ *             so it can be handed to a dma or interrupt transfer without a copy
+ */
+uint32_t fifo_peek(fifo_t *fifo, uint8_t **buf);
+
+/**
+ * @brief     fifo drop data
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] len data length
+ * @note      consumer side, releases the data returned by fifo_peek
+ */
+void fifo_drop(fifo_t *fifo, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
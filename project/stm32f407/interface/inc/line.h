@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      line.h
+ * @brief     line header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LINE_H
+#define LINE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup line line function
+ * @brief    line assembly function modules
+ * @{
+ */
+
+/**
+ * @brief line max buffer length definition
+ */
+#define LINE_MAX_LEN        256        /**< line max len */
+
+/**
+ * @brief line structure definition
+ */
+typedef struct line_s
+{
+    char buf[2][LINE_MAX_LEN];         /**< assembling and ready buffers */
+    volatile uint16_t len;             /**< assembling length, only changed by the producer */
+    volatile uint8_t active;           /**< assembling buffer index */
+    volatile uint8_t overflow;         /**< assembling line overflow flag */
+    volatile uint8_t ready;            /**< ready flag, 0 none, 1 line, 2 line is too long */
+    volatile uint16_t ready_len;       /**< ready length */
+    volatile uint32_t last_tick;       /**< tick of the last received byte */
+    volatile uint32_t dropped;         /**< dropped line counter */
+    uint32_t idle;                     /**< idle gap in ticks that ends a line, 0 disables it */
+} line_t;
+
+/**
+ * @brief     line init
+ * @param[in] *line pointer to a line structure
+ * @param[in] idle idle gap in ticks that ends a line without a terminator
+ * @note      idle 0 disables the idle gap and only '\r' or '\n' ends a line
+ */
+void line_init(line_t *line, uint32_t idle);
+
+/**
+ * @brief     line put one byte
+ * @param[in] *line pointer to a line structure
+ * @param[in] c received byte
+ * @param[in] tick current tick
+ * @note      producer side, it is called from the rx interrupt,
+ *            a line finished while the previous one is still ready is dropped
+ */
+void line_put(line_t *line, uint8_t c, uint32_t tick);
+
+/**
+ * @brief     line poll the idle gap
+ * @param[in] *line pointer to a line structure
+ * @param[in] tick current tick
+ * @return    status code
+ *            - 0 no line is ready
+ *            - 1 a line is ready
+ * @note      it finishes a line that has been quiet for the idle gap,
+ *            the producer must not run during this call
+ */
+uint8_t line_poll(line_t *line, uint32_t tick);
+
+/**
+ * @brief      line get the ready line
+ * @param[in]  *line pointer to a line structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *out_len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no line is ready
+ *             - 2 line is too long
+ * @note       consumer side, the line is released after the call,
+ *             the terminator is not copied
+ */
+uint8_t line_get(line_t *line, uint8_t *buf, uint16_t len, uint16_t *out_len);
+
+/**
+ * @brief     line get the dropped line counter
+ * @param[in] *line pointer to a line structure
+ * @return    dropped line counter
+ * @note      none
+ */
+uint32_t line_get_dropped(line_t *line);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -55,6 +55,18 @@ extern "C"{
 #define UART_MAX_LEN        256        /**< uart max len */
 #define UART2_MAX_LEN       512        /**< uart2 max len */
 
+/**
+ * @brief uart tx ring buffer length definition
+ * @note  must be a power of 2
+ */
+#define UART_TX_MAX_LEN     2048       /**< uart tx max len */
+
+/**
+ * @brief uart rx line idle gap definition
+ * @note  a command without '\r' or '\n' ends after this quiet time
+ */
+#define UART_LINE_IDLE_MS   5          /**< uart line idle ms */
+
 /**
  * @brief     uart init with 8 data bits, 1 stop bit and no parity
  * @param[in] baud baud rate
@@ -81,7 +93,8 @@ uint8_t uart_deinit(void);
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the data is queued and sent in the background,
+ *            it only blocks when the tx ring buffer is full
  */
 uint8_t uart_write(uint8_t *buf, uint16_t len);
 
@@ -102,6 +115,29 @@ uint16_t uart_read(uint8_t *buf, uint16_t len);
  */
 uint16_t uart_flush(void);
 
+/**
+ * @brief  uart check the pending line
+ * @return status code
+ *         - 0 no line is pending
+ *         - 1 a line is pending
+ * @note   it also ends a line that has been quiet for UART_LINE_IDLE_MS,
+ *         it can be called with the interrupts disabled before __WFI
+ */
+uint8_t uart_line_pending(void);
+
+/**
+ * @brief      uart read one line
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *out_len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no line is pending
+ *             - 2 line is too long
+ * @note       the line is assembled in the rx interrupt and ends with '\r', '\n' or an idle gap
+ */
+uint8_t uart_line_read(uint8_t *buf, uint16_t len, uint16_t *out_len);
+
 /**
  * @brief     uart print format data
  * @param[in] fmt format data
@@ -119,7 +155,7 @@ UART_HandleTypeDef* uart_get_handle(void);
 
 /**
  * @brief uart set tx done
- * @note  none
+ * @note  call it in the tx complete callback, it chains the next queued block
  */
 void uart_set_tx_done(void);
 
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      fifo.c
+ * @brief     fifo source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "fifo.h"
+#include <string.h>
+#if !defined(__GNUC__)
+#include "stm32f4xx.h"
+#endif
+
+/**
+ * @brief     fifo load a counter of the other side
+ * @param[in] *counter pointer to a counter
+ * @return    counter value
+ * @note      acquire, the data published before the counter is seen after it
+ */
+static uint32_t a_fifo_load_acquire(volatile uint32_t *counter)
+{
+#if defined(__GNUC__)
+    return __atomic_load_n(counter, __ATOMIC_ACQUIRE);
+#else
+    uint32_t value;
+    
+    /* the barrier keeps the following copy after the load */
+    value = *counter;
+    __DMB();
+    
+    return value;
+#endif
+}
+
+/**
+ * @brief     fifo publish a counter to the other side
+ * @param[in] *counter pointer to a counter
+ * @param[in] value counter value
+ * @note      release, the copy before it is finished when the other side sees the counter
+ */
+static void a_fifo_store_release(volatile uint32_t *counter, uint32_t value)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(counter, value, __ATOMIC_RELEASE);
+#else
+    /* the barrier keeps the copy before the store */
+    __DMB();
+    *counter = value;
+#endif
+}
+
+/**
+ * @brief     fifo init
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 1 size is not a power of 2
+ * @note      none
+ */
+uint8_t fifo_init(fifo_t *fifo, uint8_t *buf, uint32_t size)
+{
+    /* check the size */
+    if ((size == 0) || ((size & (size - 1)) != 0))
+    {
+        return 1;
+    }
+    
+    /* init the fifo */
+    fifo->buf = buf;
+    fifo->size = size;
+    fifo->head = 0;
+    fifo->tail = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     fifo get the used length
+ * @param[in] *fifo pointer to a fifo structure
+ * @return    used length
+ * @note      none
+ */
+uint32_t fifo_get_used(fifo_t *fifo)
+{
+    return a_fifo_load_acquire(&fifo->head) - a_fifo_load_acquire(&fifo->tail);
+}
+
+/**
+ * @brief     fifo get the free length
+ * @param[in] *fifo pointer to a fifo structure
+ * @return    free length
+ * @note      none
+ */
+uint32_t fifo_get_free(fifo_t *fifo)
+{
+    return fifo->size - (a_fifo_load_acquire(&fifo->head) - a_fifo_load_acquire(&fifo->tail));
+}
+
+/**
+ * @brief     fifo write data
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    length of the written data
+ * @note      producer side, it writes as many bytes as fit and never blocks
+ */
+uint32_t fifo_write(fifo_t *fifo, const uint8_t *buf, uint32_t len)
+{
+    uint32_t head;
+    uint32_t offset;
+    uint32_t first;
+    uint32_t free_len;
+    
+    /* limit to the free space */
+    head = fifo->head;
+    free_len = fifo->size - (head - a_fifo_load_acquire(&fifo->tail));
+    if (len > free_len)
+    {
+        len = free_len;
+    }
+    
+    /* copy in two parts around the wrap */
+    offset = head & (fifo->size - 1);
+    first = fifo->size - offset;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&fifo->buf[offset], buf, first);
+    memcpy(&fifo->buf[0], &buf[first], len - first);
+    
+    /* publish the data */
+    a_fifo_store_release(&fifo->head, head + len);
+    
+    return len;
+}
+
+/**
+ * @brief      fifo read data
+ * @param[in]  *fifo pointer to a fifo structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     length of the read data
+ * @note       consumer side
+ */
+uint32_t fifo_read(fifo_t *fifo, uint8_t *buf, uint32_t len)
+{
+    uint32_t tail;
+    uint32_t offset;
+    uint32_t first;
+    uint32_t used_len;
+    
+    /* limit to the used space */
+    tail = fifo->tail;
+    used_len = a_fifo_load_acquire(&fifo->head) - tail;
+    if (len > used_len)
+    {
+        len = used_len;
+    }
+    
+    /* copy in two parts around the wrap */
+    offset = tail & (fifo->size - 1);
+    first = fifo->size - offset;
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(buf, &fifo->buf[offset], first);
+    memcpy(&buf[first], &fifo->buf[0], len - first);
+    
+    /* release the space */
+    a_fifo_store_release(&fifo->tail, tail + len);
+    
+    return len;
+}
+
+/**
+ * @brief      fifo get the continuous data block
+ * @param[in]  *fifo pointer to a fifo structure
+ * @param[out] **buf pointer to a data block address buffer
+ * @return     length of the data block
+ * @note       consumer side, the block stays valid until fifo_drop is called,
+ *             so it can be handed to a dma or interrupt transfer without a copy
+ */
+uint32_t fifo_peek(fifo_t *fifo, uint8_t **buf)
+{
+    uint32_t tail;
+    uint32_t offset;
+    uint32_t len;
+    
+    /* get the used length */
+    tail = fifo->tail;
+    len = a_fifo_load_acquire(&fifo->head) - tail;
+    
+    /* stop at the end of the buffer */
+    offset = tail & (fifo->size - 1);
+    if (len > (fifo->size - offset))
+    {
+        len = fifo->size - offset;
+    }
+    *buf = &fifo->buf[offset];
+    
+    return len;
+}
+
+/**
+ * @brief     fifo drop data
+ * @param[in] *fifo pointer to a fifo structure
+ * @param[in] len data length
+ * @note      consumer side, releases the data returned by fifo_peek
+ */
+void fifo_drop(fifo_t *fifo, uint32_t len)
+{
+    a_fifo_store_release(&fifo->tail, fifo->tail + len);
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      line.c
+ * @brief     line source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "line.h"
+#include <string.h>
+
+/**
+ * @brief     line finish the assembling line
+ * @param[in] *line pointer to a line structure
+ * @note      none
+ */
+static void a_line_finish(line_t *line)
+{
+    /* ignore the empty line */
+    if ((line->len == 0) && (line->overflow == 0))
+    {
+        return;
+    }
+    
+    /* drop it if the consumer is late */
+    if (line->ready != 0)
+    {
+        line->dropped++;
+    }
+    else
+    {
+        /* hand over the buffer */
+        line->ready_len = line->len;
+        line->ready = (line->overflow != 0) ? 2 : 1;
+        line->active ^= 1;
+    }
+    
+    /* restart the line */
+    line->len = 0;
+    line->overflow = 0;
+}
+
+/**
+ * @brief     line init
+ * @param[in] *line pointer to a line structure
+ * @param[in] idle idle gap in ticks that ends a line without a terminator
+ * @note      idle 0 disables the idle gap and only '\r' or '\n' ends a line
+ */
+void line_init(line_t *line, uint32_t idle)
+{
+    memset(line, 0, sizeof(line_t));
+    line->idle = idle;
+}
+
+/**
+ * @brief     line put one byte
+ * @param[in] *line pointer to a line structure
+ * @param[in] c received byte
+ * @param[in] tick current tick
+ * @note      producer side, it is called from the rx interrupt,
+ *            a line finished while the previous one is still ready is dropped
+ */
+void line_put(line_t *line, uint8_t c, uint32_t tick)
+{
+    line->last_tick = tick;
+    
+    /* terminator */
+    if ((c == '\r') || (c == '\n'))
+    {
+        a_line_finish(line);
+        
+        return;
+    }
+    
+    /* save the byte */
+    if (line->len < LINE_MAX_LEN)
+    {
+        line->buf[line->active][line->len] = (char)c;
+        line->len++;
+    }
+    else
+    {
+        line->overflow = 1;
+    }
+}
+
+/**
+ * @brief     line poll the idle gap
+ * @param[in] *line pointer to a line structure
+ * @param[in] tick current tick
+ * @return    status code
+ *            - 0 no line is ready
+ *            - 1 a line is ready
+ * @note      it finishes a line that has been quiet for the idle gap,
+ *            the producer must not run during this call
+ */
+uint8_t line_poll(line_t *line, uint32_t tick)
+{
+    /* check the idle gap */
+    if ((line->idle != 0) && (line->ready == 0) &&
+        ((line->len != 0) || (line->overflow != 0)) &&
+        ((uint32_t)(tick - line->last_tick) >= line->idle))
+    {
+        a_line_finish(line);
+    }
+    
+    return (line->ready != 0) ? 1 : 0;
+}
+
+/**
+ * @brief      line get the ready line
+ * @param[in]  *line pointer to a line structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *out_len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no line is ready
+ *             - 2 line is too long
+ * @note       consumer side, the line is released after the call,
+ *             the terminator is not copied
+ */
+uint8_t line_get(line_t *line, uint8_t *buf, uint16_t len, uint16_t *out_len)
+{
+    uint8_t res;
+    
+    /* check the ready line */
+    res = line->ready;
+    if (res == 0)
+    {
+        return 1;
+    }
+    
+    /* copy the ready buffer, the producer never touches it while it is ready */
+    *out_len = 0;
+    if ((res == 1) && (line->ready_len <= len))
+    {
+        memcpy(buf, line->buf[line->active ^ 1], line->ready_len);
+        *out_len = line->ready_len;
+    }
+    else
+    {
+        res = 2;
+    }
+    
+    /* release the buffer */
+    line->ready = 0;
+    
+    return (res == 2) ? 2 : 0;
+}
+
+/**
+ * @brief     line get the dropped line counter
+ * @param[in] *line pointer to a line structure
+ * @return    dropped line counter
+ * @note      none
+ */
+uint32_t line_get_dropped(line_t *line)
+{
+    return line->dropped;
+}
@@ -35,6 +35,8 @@
  */
 
 #include "uart.h"
+#include "fifo.h"
+#include "line.h"
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -47,6 +49,10 @@ uint8_t g_uart_rx_buffer[UART_MAX_LEN];        /**< uart rx buffer */
 uint8_t g_uart_buffer;                         /**< uart one buffer */
 volatile uint16_t g_uart_point;                /**< uart rx point */
 volatile uint8_t g_uart_tx_done;               /**< uart tx done flag */
+uint8_t g_uart_tx_buffer[UART_TX_MAX_LEN];     /**< uart tx ring buffer */
+fifo_t g_uart_tx_fifo;                         /**< uart tx fifo */
+volatile uint16_t g_uart_tx_len;               /**< uart tx length in flight */
+line_t g_uart_line;                            /**< uart rx line */
 
 /**
  * @brief uart2 var definition
@@ -57,6 +63,45 @@ uint8_t g_uart2_buffer;                          /**< uart2 one buffer */
 volatile uint16_t g_uart2_point;                 /**< uart2 rx point */
 volatile uint8_t g_uart2_tx_done;                /**< uart2 tx done flag */
 
+/**
+ * @brief uart start the next queued transfer
+ * @note  it can be called from the main loop and the tx complete interrupt
+ */
+static void a_uart_tx_start(void)
+{
+    uint8_t *buf;
+    uint32_t len;
+    uint32_t primask;
+    
+    /* enter critical section */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    
+    /* start when idle and data is queued */
+    if (g_uart_tx_done != 0)
+    {
+        len = fifo_peek(&g_uart_tx_fifo, &buf);
+        if (len > 0xFFFFU)
+        {
+            len = 0xFFFFU;
+        }
+        if (len != 0)
+        {
+            g_uart_tx_len = (uint16_t)len;
+            g_uart_tx_done = 0;
+            if (HAL_UART_Transmit_IT(&g_uart_handle, buf, (uint16_t)len) != HAL_OK)
+            {
+                /* keep the block, the next write retries */
+                g_uart_tx_len = 0;
+                g_uart_tx_done = 1;
+            }
+        }
+    }
+    
+    /* exit critical section */
+    __set_PRIMASK(primask);
+}
+
 /**
  * @brief     uart init with 8 data bits, 1 stop bit and no parity
  * @param[in] baud baud rate
@@ -76,6 +121,14 @@ uint8_t uart_init(uint32_t baud)
     g_uart_handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;
     g_uart_handle.Init.OverSampling = UART_OVERSAMPLING_16;
     
+    /* tx fifo init */
+    (void)fifo_init(&g_uart_tx_fifo, g_uart_tx_buffer, UART_TX_MAX_LEN);
+    g_uart_tx_len = 0;
+    g_uart_tx_done = 1;
+    
+    /* rx line init */
+    line_init(&g_uart_line, UART_LINE_IDLE_MS);
+    
     /* uart init */
     if (HAL_UART_Init(&g_uart_handle) != HAL_OK)
     {
@@ -100,6 +153,15 @@ uint8_t uart_init(uint32_t baud)
  */
 uint8_t uart_deinit(void)
 {
+    uint16_t timeout = 1000;
+    
+    /* wait for the queued data */
+    while ((fifo_get_used(&g_uart_tx_fifo) != 0) && (timeout != 0))
+    {
+        HAL_Delay(1);
+        timeout--;
+    }
+    
     /* uart deinit */
     if (HAL_UART_DeInit(&g_uart_handle) != HAL_OK)
     {
@@ -116,37 +178,45 @@ uint8_t uart_deinit(void)
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the data is queued and sent in the background, it only blocks when the tx ring buffer is full,
+ *            data up to the ring size is queued whole or not at all, so a timeout never cuts a line
  */
 uint8_t uart_write(uint8_t *buf, uint16_t len)
 {
     uint16_t timeout = 1000;
+    uint32_t need;
+    uint32_t written;
     
-    /* set tx done 0 */
-    g_uart_tx_done = 0;
-    
-    /* transmit */
-    if (HAL_UART_Transmit_IT(&g_uart_handle, (uint8_t *)buf, len) != HAL_OK)
+    while (len != 0)
     {
-        return 1;
-    }
-    
-    /* wait for events */
-    while ((g_uart_tx_done == 0) && (timeout != 0))
-    {
-        HAL_Delay(1);
-        timeout--;
+        /* wait until the data or a full ring fits */
+        need = (len < g_uart_tx_fifo.size) ? len : g_uart_tx_fifo.size;
+        if (fifo_get_free(&g_uart_tx_fifo) < need)
+        {
+            /* start the transfer if idle */
+            a_uart_tx_start();
+            
+            /* wait for space */
+            if (timeout == 0)
+            {
+                return 1;
+            }
+            HAL_Delay(1);
+            timeout--;
+            
+            continue;
+        }
+        
+        /* queue it */
+        written = fifo_write(&g_uart_tx_fifo, buf, need);
+        buf += written;
+        len -= (uint16_t)written;
+        
+        /* start the transfer if idle */
+        a_uart_tx_start();
     }
     
-    /* check the timeout */
-    if (timeout != 0)
-    {
-        return 0;
-    }
-    else
-    {
-        return 1;
-    }
+    return 0;
 }
 
 /**
@@ -194,6 +264,51 @@ uint16_t uart_flush(void)
     return 0;
 }
 
+/**
+ * @brief  uart check the pending line
+ * @return status code
+ *         - 0 no line is pending
+ *         - 1 a line is pending
+ * @note   it also ends a line that has been quiet for UART_LINE_IDLE_MS,
+ *         it can be called with the interrupts disabled before __WFI
+ */
+uint8_t uart_line_pending(void)
+{
+    uint8_t res;
+    uint32_t primask;
+    
+    /* enter critical section */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    
+    /* check the line */
+    res = line_poll(&g_uart_line, HAL_GetTick());
+    
+    /* exit critical section */
+    __set_PRIMASK(primask);
+    
+    return res;
+}
+
+/**
+ * @brief      uart read one line
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *out_len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no line is pending
+ *             - 2 line is too long
+ * @note       the line is assembled in the rx interrupt and ends with '\r', '\n' or an idle gap
+ */
+uint8_t uart_line_read(uint8_t *buf, uint16_t len, uint16_t *out_len)
+{
+    /* check the idle gap */
+    (void)uart_line_pending();
+    
+    return line_get(&g_uart_line, buf, len, out_len);
+}
+
 /**
  * @brief     uart print format data
  * @param[in] fmt format data
@@ -383,11 +498,17 @@ UART_HandleTypeDef* uart2_get_handle(void)
 
 /**
  * @brief uart set tx done
- * @note  none
+ * @note  call it in the tx complete callback, it chains the next queued block
  */
 void uart_set_tx_done(void)
 {
+    /* release the sent block */
+    fifo_drop(&g_uart_tx_fifo, g_uart_tx_len);
+    g_uart_tx_len = 0;
     g_uart_tx_done = 1;
+    
+    /* chain the next block */
+    a_uart_tx_start();
 }
 
 /**
@@ -413,6 +534,9 @@ void uart_irq_handler(void)
         g_uart_point = 0;
     }
     
+    /* assemble the line */
+    line_put(&g_uart_line, g_uart_buffer, HAL_GetTick());
+    
     /* receive one byte */
     (void)HAL_UART_Receive_IT(&g_uart_handle, (uint8_t *)&g_uart_buffer, 1);
 }
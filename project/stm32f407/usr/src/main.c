@@ -35,8 +35,29 @@
  */
 
 #include "driver_hdc1080_basic.h"
+#include "driver_hdc1080_stream.h"
+#include "driver_hdc1080_duty.h"
+#include "driver_hdc1080_report.h"
+#include "driver_hdc1080_record.h"
+#include "driver_hdc1080_shared.h"
+#include "driver_hdc1080_warm.h"
+#include "driver_hdc1080_aggregate.h"
 #include "driver_hdc1080_register_test.h"
 #include "driver_hdc1080_read_test.h"
+#include "driver_hdc1080_metrics_test.h"
+#include "driver_hdc1080_aggregate_test.h"
+#include "driver_hdc1080_cov_test.h"
+#include "driver_hdc1080_filter_test.h"
+#include "driver_hdc1080_adaptive_test.h"
+#include "driver_hdc1080_series_test.h"
+#include "driver_hdc1080_trace_test.h"
+#include "driver_hdc1080_cache_test.h"
+#include "driver_hdc1080_arbiter_test.h"
+#include "driver_hdc1080_discover_test.h"
+#include "driver_hdc1080_health_test.h"
+#include "driver_hdc1080_snapshot_test.h"
+#include "driver_hdc1080_heater_test.h"
+#include "driver_hdc1080_log_test.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -73,10 +94,24 @@ uint8_t hdc1080(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"rate", required_argument, NULL, 2},
+        {"format", required_argument, NULL, 3},
+        {"period", required_argument, NULL, 4},
+        {"window", required_argument, NULL, 5},
+        {"hop", required_argument, NULL, 6},
+        {"filter", required_argument, NULL, 7},
+        {"trace", no_argument, NULL, 8},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
+    char format[33] = "text";
+    char filter[33] = "kalman";
     uint32_t times = 3;
+    uint32_t rate = 0;
+    uint32_t period_ms = HDC1080_DUTY_DEFAULT_PERIOD_MS;
+    uint32_t window_ms = 60000;
+    uint32_t hop_ms = 0;
+    uint8_t trace = 0;
     
     /* if no params */
     if (argc == 1)
@@ -156,6 +191,71 @@ uint8_t hdc1080(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* stream rate */
+            case 2 :
+            {
+                /* set the rate */
+                rate = atol(optarg);
+                
+                break;
+            }
+            
+            /* stream format */
+            case 3 :
+            {
+                /* set the format */
+                memset(format, 0, sizeof(char) * 33);
+                snprintf(format, 32, "%s", optarg);
+                
+                break;
+            }
+            
+            /* duty period */
+            case 4 :
+            {
+                /* set the period */
+                period_ms = atol(optarg);
+                
+                break;
+            }
+            
+            /* aggregate window */
+            case 5 :
+            {
+                /* set the window */
+                window_ms = atol(optarg);
+                
+                break;
+            }
+            
+            /* aggregate hop */
+            case 6 :
+            {
+                /* set the hop */
+                hop_ms = atol(optarg);
+                
+                break;
+            }
+            
+            /* filter type */
+            case 7 :
+            {
+                /* set the filter */
+                memset(filter, 0, sizeof(char) * 33);
+                snprintf(filter, 32, "%s", optarg);
+                
+                break;
+            }
+            
+            /* bus trace */
+            case 8 :
+            {
+                /* enable the trace */
+                trace = 1;
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -195,20 +295,723 @@ uint8_t hdc1080(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_metrics", type) == 0)
+    {
+        /* run metrics test */
+        if (hdc1080_metrics_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_aggregate", type) == 0)
+    {
+        /* run aggregate test */
+        if (hdc1080_aggregate_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_cov", type) == 0)
+    {
+        /* run cov test */
+        if (hdc1080_cov_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_filter", type) == 0)
+    {
+        /* run filter test */
+        if (hdc1080_filter_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_adaptive", type) == 0)
+    {
+        /* run adaptive test */
+        if (hdc1080_adaptive_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_series", type) == 0)
+    {
+        /* run series test */
+        if (hdc1080_series_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_trace", type) == 0)
+    {
+        /* run trace test */
+        if (hdc1080_trace_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_cache", type) == 0)
+    {
+        /* run cache test */
+        if (hdc1080_cache_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_arbiter", type) == 0)
+    {
+        /* run arbiter test */
+        if (hdc1080_arbiter_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_discover", type) == 0)
+    {
+        /* run discover test */
+        if (hdc1080_discover_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_health", type) == 0)
+    {
+        /* run health test */
+        if (hdc1080_health_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_snapshot", type) == 0)
+    {
+        /* run snapshot test */
+        if (hdc1080_snapshot_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_heater", type) == 0)
+    {
+        /* run heater test */
+        if (hdc1080_heater_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_log", type) == 0)
+    {
+        /* run log test */
+        if (hdc1080_log_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
         uint32_t i;
+        uint32_t j;
+        float temperature;
+        float humidity;
+        static hdc1080_trace_handle_t trace_handle;
+        static uint8_t trace_buf[2048];
+        
+        /* init, the record example records the bus */
+        if (trace != 0)
+        {
+            res = hdc1080_record_init(&trace_handle, trace_buf, sizeof(trace_buf));
+        }
+        else
+        {
+            res = hdc1080_basic_init();
+        }
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 2000ms */
+            hdc1080_interface_delay_ms(2000);
+            
+            /* read data */
+            if (trace != 0)
+            {
+                res = hdc1080_record_read((float *)&temperature, (float *)&humidity);
+            }
+            else
+            {
+                res = hdc1080_basic_read((float *)&temperature, (float *)&humidity);
+            }
+            if (res != 0)
+            {
+                if (trace != 0)
+                {
+                    (void)hdc1080_record_deinit();
+                }
+                else
+                {
+                    (void)hdc1080_basic_deinit();
+                }
+                
+                return 1;
+            }
+            
+            /* output */
+            hdc1080_interface_debug_print("hdc1080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC.\n", temperature);
+            hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity); 
+        }
+        
+        /* deinit */
+        if (trace != 0)
+        {
+            (void)hdc1080_record_deinit();
+        }
+        else
+        {
+            (void)hdc1080_basic_deinit();
+        }
+        
+        /* dump the trace as hex lines */
+        if (trace != 0)
+        {
+            for (i = 0; i < trace_handle.len; i += 32)
+            {
+                char line[65];
+                
+                for (j = 0; (j < 32) && (i + j < trace_handle.len); j++)
+                {
+                    snprintf(&line[j * 2], 3, "%02X", trace_buf[i + j]);
+                }
+                line[j * 2] = 0;
+                hdc1080_interface_debug_print("hdc1080: trace %s\n", line);
+            }
+            hdc1080_interface_debug_print("hdc1080: trace %d bytes, %d events, %d lost.\n",
+                                          trace_handle.len, trace_handle.events, trace_handle.lost);
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_cov", type) == 0)
+    {
+        uint8_t res;
+        uint8_t report;
+        uint32_t i;
+        uint32_t samples;
+        float temperature;
+        float humidity;
+        
+        /* report init */
+        res = hdc1080_report_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        i = 0;
+        samples = 0;
+        while (i < times)
+        {
+            /* delay the poll period */
+            hdc1080_interface_delay_ms(period_ms);
+            
+            /* read data */
+            res = hdc1080_report_read((float *)&temperature, (float *)&humidity, (uint8_t *)&report);
+            if (res != 0)
+            {
+                (void)hdc1080_report_deinit();
+                
+                return 1;
+            }
+            samples++;
+            
+            /* only a reported sample is handed over */
+            if (report != 0)
+            {
+                i++;
+                hdc1080_interface_debug_print("hdc1080: %d/%d, sample %d, reason 0x%02X.\n", (uint32_t)i, (uint32_t)times, samples, report);
+                hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC.\n", temperature);
+                hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity);
+            }
+        }
+        
+        /* deinit */
+        (void)hdc1080_report_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint8_t bin;
+        uint32_t i;
+        uint32_t period;
+        uint32_t next;
+        uint16_t len;
+        uint8_t id[6];
+        uint8_t frame[HDC1080_FRAME_MAX_SIZE];
+        uint8_t block[HDC1080_STREAM_DEFAULT_SERIES_BLOCK_SIZE];
+        float temperature;
+        float humidity;
+        hdc1080_frame_record_t record;
+        hdc1080_series_encoder_t encoder;
+        
+        /* check the format */
+        if (strcmp("bin", format) == 0)
+        {
+            bin = 1;
+        }
+        else if (strcmp("series", format) == 0)
+        {
+            bin = 2;
+        }
+        else if (strcmp("text", format) == 0)
+        {
+            bin = 0;
+        }
+        else
+        {
+            return 5;
+        }
+        
+        /* stream init */
+        res = hdc1080_stream_init((uint32_t *)&period);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* the conversion time limits the rate */
+        if ((rate != 0) && ((1000 / rate) > period))
+        {
+            period = 1000 / rate;
+        }
+        
+        /* the series blocks are tagged with the serial id */
+        if (bin == 2)
+        {
+            if ((hdc1080_stream_get_serial_id(id) != 0) ||
+                (hdc1080_series_encoder_init(&encoder, block, HDC1080_STREAM_DEFAULT_SERIES_BLOCK_SIZE, id,
+                                             HDC1080_STREAM_DEFAULT_TEMPERATURE_RESOLUTION,
+                                             HDC1080_STREAM_DEFAULT_HUMIDITY_RESOLUTION) != 0))
+            {
+                (void)hdc1080_stream_deinit();
+                
+                return 1;
+            }
+        }
+        
+        /* a leading delimiter separates the frames from the shell text */
+        if (bin != 0)
+        {
+            frame[0] = 0x00;
+            (void)uart_write(frame, 1);
+        }
+        
+        /* loop */
+        next = HAL_GetTick();
+        for (i = 0; i < times; i++)
+        {
+            /* read one record */
+            res = hdc1080_stream_read(HAL_GetTick(), &record);
+            if (res == 0)
+            {
+                if (bin == 2)
+                {
+                    /* queue the block when it is full */
+                    (void)hdc1080_series_encoder_add(&encoder, record.timestamp_ms, record.temperature_raw,
+                                                     record.humidity_raw, (uint16_t *)&len);
+                    if (len != 0)
+                    {
+                        (void)uart_write(block, len);
+                    }
+                }
+                else if (bin != 0)
+                {
+                    /* queue the frame, it is sent in the background */
+                    (void)hdc1080_frame_encode(&record, frame, HDC1080_FRAME_MAX_SIZE, (uint16_t *)&len);
+                    (void)uart_write(frame, len);
+                }
+                else
+                {
+                    /* output */
+                    (void)hdc1080_temperature_convert_to_data(record.temperature_raw, (float *)&temperature);
+                    (void)hdc1080_humidity_convert_to_data(record.humidity_raw, (float *)&humidity);
+                    hdc1080_interface_debug_print("hdc1080: %d temperature is %0.2fC humidity is %0.2f%%.\n", record.seq, 
+                                                  temperature, humidity);
+                }
+            }
+            
+            /* a new command stops the stream */
+            if (uart_line_pending() != 0)
+            {
+                break;
+            }
+            
+            /* sleep until the next period */
+            next += period;
+            while ((int32_t)(HAL_GetTick() - next) < 0)
+            {
+                __WFI();
+            }
+        }
+        
+        /* send the open block */
+        if (bin == 2)
+        {
+            (void)hdc1080_series_encoder_flush(&encoder, (uint16_t *)&len);
+            if (len != 0)
+            {
+                (void)uart_write(block, len);
+            }
+        }
+        
+        /* deinit */
+        (void)hdc1080_stream_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_duty", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float temperature;
+        float humidity;
+        hdc1080_energy_t energy;
+        
+        /* duty init */
+        res = hdc1080_duty_init(HDC1080_DUTY_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_DUTY_DEFAULT_HUMIDITY_RESOLUTION, period_ms);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* sleep and read data */
+            res = hdc1080_duty_read((float *)&temperature, (float *)&humidity);
+            if (res != 0)
+            {
+                (void)hdc1080_duty_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            hdc1080_interface_debug_print("hdc1080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC.\n", temperature);
+            hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity);
+        }
+        
+        /* output the estimated energy */
+        (void)hdc1080_duty_get_energy(&energy);
+        hdc1080_interface_debug_print("hdc1080: energy is %0.2fuJ per sample.\n", energy.total_uj);
+        hdc1080_interface_debug_print("hdc1080: average current is %0.2fuA.\n", energy.average_ua);
+        
+        /* deinit */
+        (void)hdc1080_duty_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_filter", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float temperature;
+        float humidity;
+        hdc1080_filter_t smooth;
+        
+        /* check the filter */
+        if (strcmp("ema", filter) == 0)
+        {
+            (void)hdc1080_filter_init_ema(&smooth, HDC1080_DUTY_DEFAULT_FILTER_EMA_SHIFT, HDC1080_DUTY_DEFAULT_FILTER_EMA_SHIFT);
+        }
+        else if (strcmp("kalman", filter) == 0)
+        {
+            (void)hdc1080_filter_init_kalman(&smooth, HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_PROCESS, HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_PROCESS,
+                                             HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_NOISE, HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_NOISE);
+        }
+        else
+        {
+            return 5;
+        }
+        
+        /* duty init with the fast resolutions */
+        res = hdc1080_duty_init(HDC1080_DUTY_DEFAULT_FILTER_TEMPERATURE_RESOLUTION, HDC1080_DUTY_DEFAULT_FILTER_HUMIDITY_RESOLUTION, period_ms);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* sleep, read and smooth data */
+            res = hdc1080_duty_read_filter(&smooth, (float *)&temperature, (float *)&humidity);
+            if (res != 0)
+            {
+                (void)hdc1080_duty_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            hdc1080_interface_debug_print("hdc1080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC.\n", temperature);
+            hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity);
+        }
+        
+        /* deinit */
+        (void)hdc1080_duty_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_adaptive", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t start;
+        uint32_t elapsed;
+        float temperature;
+        float humidity;
+        hdc1080_adaptive_t adaptive;
+        hdc1080_adaptive_decision_t decision;
+        
+        /* adaptive init */
+        (void)hdc1080_adaptive_init(&adaptive, HDC1080_DUTY_DEFAULT_ADAPTIVE_MIN_PERIOD_MS, HDC1080_DUTY_DEFAULT_ADAPTIVE_MAX_PERIOD_MS,
+                                    HDC1080_DUTY_DEFAULT_ADAPTIVE_TEMPERATURE_BUDGET, HDC1080_DUTY_DEFAULT_ADAPTIVE_HUMIDITY_BUDGET,
+                                    HDC1080_DUTY_DEFAULT_ADAPTIVE_RESOLUTION);
+        
+        /* duty init with the min period */
+        res = hdc1080_duty_init(HDC1080_DUTY_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_DUTY_DEFAULT_HUMIDITY_RESOLUTION, 
+                                HDC1080_DUTY_DEFAULT_ADAPTIVE_MIN_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        start = hdc1080_interface_get_tick_ms();
+        for (i = 0; i < times; i++)
+        {
+            /* sleep, read data and decide the next sample */
+            res = hdc1080_duty_read_adaptive(&adaptive, (float *)&temperature, (float *)&humidity, &decision);
+            if (res != 0)
+            {
+                (void)hdc1080_duty_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            hdc1080_interface_debug_print("hdc1080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC.\n", temperature);
+            hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity);
+            hdc1080_interface_debug_print("hdc1080: next sample in %dms, temperature %s bit, humidity %s bit.\n", decision.period_ms,
+                                          (decision.temperature_resolution == HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ? "11" : "14",
+                                          (decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_8_BIT) ? "8" :
+                                          ((decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_11_BIT) ? "11" : "14"));
+        }
+        
+        /* output the savings against the min period */
+        elapsed = hdc1080_interface_get_tick_ms() - start;
+        hdc1080_interface_debug_print("hdc1080: %d samples in %dms, a fixed %dms period takes %d.\n", times, elapsed,
+                                      HDC1080_DUTY_DEFAULT_ADAPTIVE_MIN_PERIOD_MS, elapsed / HDC1080_DUTY_DEFAULT_ADAPTIVE_MIN_PERIOD_MS + 1);
+        
+        /* deinit */
+        (void)hdc1080_duty_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_aggregate", type) == 0)
+    {
+        uint8_t res;
+        uint8_t ready;
+        uint32_t i;
+        float temperature;
+        float humidity;
+        static hdc1080_aggregate_t aggregate;
+        hdc1080_aggregate_summary_t summary;
+        
+        /* the default hop is one window */
+        if (hop_ms == 0)
+        {
+            hop_ms = window_ms;
+        }
+        
+        /* aggregate init */
+        res = hdc1080_aggregate_init(&aggregate, window_ms, hop_ms);
+        if (res != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: window must be 1 to %d hops.\n", HDC1080_AGGREGATE_MAX_PANES);
+            
+            return 1;
+        }
+        
+        /* duty init */
+        res = hdc1080_duty_init(HDC1080_DUTY_DEFAULT_TEMPERATURE_RESOLUTION, HDC1080_DUTY_DEFAULT_HUMIDITY_RESOLUTION, period_ms);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        i = 0;
+        while (i < times)
+        {
+            /* sleep and read data */
+            res = hdc1080_duty_read((float *)&temperature, (float *)&humidity);
+            if (res != 0)
+            {
+                (void)hdc1080_duty_deinit();
+                
+                return 1;
+            }
+            
+            /* only a finished window is sent */
+            (void)hdc1080_aggregate_add(&aggregate, hdc1080_interface_get_tick_ms(), temperature, humidity, &summary, &ready);
+            if (ready != 0)
+            {
+                hdc1080_interface_debug_print("hdc1080: window %d, %d samples.\n", summary.seq, summary.count);
+                hdc1080_interface_debug_print("hdc1080: temperature min %0.2fC, max %0.2fC, mean %0.2fC, stddev %0.3fC.\n",
+                                              summary.temperature.min, summary.temperature.max,
+                                              summary.temperature.mean, summary.temperature.stddev);
+                hdc1080_interface_debug_print("hdc1080: humidity min %0.2f%%, max %0.2f%%, mean %0.2f%%, stddev %0.3f%%.\n",
+                                              summary.humidity.min, summary.humidity.max,
+                                              summary.humidity.mean, summary.humidity.stddev);
+                i++;
+            }
+        }
+        
+        /* deinit */
+        (void)hdc1080_duty_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_cache", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t j;
+        uint32_t age_ms;
         float temperature;
         float humidity;
+        const uint32_t max_age_ms[3] = {0, 1000, 5000};
         
-        /* basic init */
-        res = hdc1080_basic_init();
+        /* shared init, one context needs no cache lock */
+        res = hdc1080_shared_init(NULL, NULL);
         if (res != 0)
         {
             return 1;
         }
         
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay the poll period */
+            hdc1080_interface_delay_ms(period_ms);
+            
+            /* three consumers with their own max age */
+            hdc1080_interface_debug_print("hdc1080: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < 3; j++)
+            {
+                res = hdc1080_shared_read(max_age_ms[j], (float *)&temperature, (float *)&humidity, (uint32_t *)&age_ms);
+                if (res != 0)
+                {
+                    (void)hdc1080_shared_deinit();
+                    
+                    return 1;
+                }
+                hdc1080_interface_debug_print("hdc1080: max age %dms, sample age %dms, temperature is %0.2fC, humidity is %0.2f%%.\n",
+                                              max_age_ms[j], age_ms, temperature, humidity);
+            }
+        }
+        
+        /* deinit */
+        (void)hdc1080_shared_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_warm", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        float temperature;
+        float humidity;
+        hdc1080_bool_t reset;
+        
+        /* warm init, the chip is not reset again after an mcu reset */
+        res = hdc1080_warm_init(&reset);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        hdc1080_interface_debug_print("hdc1080: %s.\n", (reset == HDC1080_BOOL_TRUE) ? "chip was reset and programmed" : "chip kept its config");
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
@@ -216,10 +1019,10 @@ uint8_t hdc1080(uint8_t argc, char **argv)
             hdc1080_interface_delay_ms(2000);
             
             /* read data */
-            res = hdc1080_basic_read((float *)&temperature, (float *)&humidity);
+            res = hdc1080_warm_read((float *)&temperature, (float *)&humidity);
             if (res != 0)
             {
-                (void)hdc1080_basic_deinit();
+                (void)hdc1080_warm_deinit();
                 
                 return 1;
             }
@@ -231,7 +1034,7 @@ uint8_t hdc1080(uint8_t argc, char **argv)
         }
         
         /* deinit */
-        (void)hdc1080_basic_deinit();
+        (void)hdc1080_warm_deinit();
         
         return 0;
     }
@@ -244,16 +1047,47 @@ uint8_t hdc1080(uint8_t argc, char **argv)
         hdc1080_interface_debug_print("  hdc1080 (-p | --port)\n");
         hdc1080_interface_debug_print("  hdc1080 (-t reg | --test=reg)\n");
         hdc1080_interface_debug_print("  hdc1080 (-t read | --test=read) [--times=<num>]\n");
-        hdc1080_interface_debug_print("  hdc1080 (-e read | --example=read) [--times=<num>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t metrics | --test=metrics)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t aggregate | --test=aggregate)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t cov | --test=cov)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t filter | --test=filter)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t adaptive | --test=adaptive)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t series | --test=series)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t trace | --test=trace)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t cache | --test=cache)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t arbiter | --test=arbiter)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t discover | --test=discover)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t health | --test=health)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t snapshot | --test=snapshot)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t heater | --test=heater)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-t log | --test=log)\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e read | --example=read) [--times=<num>] [--trace]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e cov | --example=cov) [--times=<num>] [--period=<ms>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e stream | --example=stream) [--times=<num>] [--rate=<hz>] [--format=<bin | series | text>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e duty | --example=duty) [--times=<num>] [--period=<ms>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e filter | --example=filter) [--times=<num>] [--period=<ms>] [--filter=<ema | kalman>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e adaptive | --example=adaptive) [--times=<num>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e aggregate | --example=aggregate) [--times=<num>] [--period=<ms>] [--window=<ms>] [--hop=<ms>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e cache | --example=cache) [--times=<num>] [--period=<ms>]\n");
+        hdc1080_interface_debug_print("  hdc1080 (-e warm | --example=warm) [--times=<num>]\n");
         hdc1080_interface_debug_print("\n");
         hdc1080_interface_debug_print("Options:\n");
-        hdc1080_interface_debug_print("  -e <read>, --example=<read>    Run the driver example.\n");
+        hdc1080_interface_debug_print("  -e <read | cov | stream | duty | filter | adaptive | aggregate | cache | warm>, --example=<read | cov | stream | duty | filter | adaptive | aggregate | cache | warm>\n");
+        hdc1080_interface_debug_print("                                 Run the driver example.\n");
+        hdc1080_interface_debug_print("      --filter=<ema | kalman>    Set the smoothing filter.([default: kalman])\n");
+        hdc1080_interface_debug_print("      --format=<bin | series | text>\n");
+        hdc1080_interface_debug_print("                                 Set the stream format, bin is cobs framed with crc16, series is compressed blocks.([default: text])\n");
         hdc1080_interface_debug_print("  -h, --help                     Show the help.\n");
+        hdc1080_interface_debug_print("      --hop=<ms>                 Set the aggregate window hop, less than the window slides.([default: window])\n");
         hdc1080_interface_debug_print("  -i, --information              Show the chip information.\n");
         hdc1080_interface_debug_print("  -p, --port                     Display the pin connections of the current board.\n");
-        hdc1080_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        hdc1080_interface_debug_print("      --period=<ms>              Set the duty cycled sample period or the cov and cache poll period.([default: 5000])\n");
+        hdc1080_interface_debug_print("      --rate=<hz>                Set the stream rate, 0 is the fastest rate.([default: 0])\n");
+        hdc1080_interface_debug_print("  -t <reg | read | metrics | aggregate | cov | filter | adaptive | series | trace | cache | arbiter | discover | health | snapshot | heater | log>, --test=<reg | read | metrics | aggregate | cov | filter | adaptive | series | trace | cache | arbiter | discover | health | snapshot | heater | log>\n");
         hdc1080_interface_debug_print("                                 Run the driver test.\n");
         hdc1080_interface_debug_print("      --times=<num>              Set the running times.([default: 3])\n");
+        hdc1080_interface_debug_print("      --trace                    Record the bus of the read example and dump it as hex lines.\n");
+        hdc1080_interface_debug_print("      --window=<ms>              Set the aggregate window length.([default: 60000])\n");
         
         return 0;
     }
@@ -313,9 +1147,30 @@ int main(void)
     
     while (1)
     {
-        /* read uart */
-        g_len = uart_read(g_buf, 256);
-        if (g_len != 0)
+        /* send the deferred debug records outside of the driver timing */
+        hdc1080_interface_debug_flush();
+        
+        /* sleep until a command is pending, the pending interrupt still wakes the core */
+        __disable_irq();
+        if (uart_line_pending() == 0)
+        {
+            __WFI();
+        }
+        __enable_irq();
+        
+        /* read one line */
+        res = uart_line_read(g_buf, 256, (uint16_t *)&g_len);
+        if (res == 1)
+        {
+            continue;
+        }
+        else if (res == 2)
+        {
+            uart_print("hdc1080: length is too long.\n");
+            
+            continue;
+        }
+        else
         {
             /* run shell */
             res = shell_parse((char *)g_buf, g_len);
@@ -347,8 +1202,6 @@ int main(void)
             {
                 uart_print("hdc1080: unknown status code.\n");
             }
-            uart_flush();
         }
-        delay_ms(100);
     }
 }
@@ -80,7 +80,7 @@ static uint8_t a_shell_pretreatment(char *buf, uint16_t in_len, char *buf_out, u
         {
             if (flag == 0)
             {
-                buf_out[(*out_len)] = NULL;
+                buf_out[(*out_len)] = '\0';
                 (*out_len)++;
                 flag = 1;
             }
@@ -196,7 +196,7 @@ uint8_t shell_parse(char *buf, uint16_t len)
     uint8_t argc;
     uint16_t out_len;
     
-    if (len > SHELL_MAX_BUF_SIZE)
+    if (len >= SHELL_MAX_BUF_SIZE)
     {
         return 3;
     }
@@ -206,6 +206,10 @@ uint8_t shell_parse(char *buf, uint16_t len)
     {
         return 4;
     }
+    if (argc == 0)
+    {
+        return 4;
+    }
     if (a_shell_find(&gs_shell, (char *)gs_shell.argv[0]) != 0)
     {
         return 2;
@@ -49,21 +49,130 @@
 #define DRIVER_VERSION            1000                               /**< driver version */
 
 /**
- * @brief chip address definition
+ * @brief conversion poll definition
+ * @note  only used with a linked bus_lock when the fetch after the conversion time naks
  */
-#define HDC1080_ADDRESS             0x80        /**< iic device address */
+#define HDC1080_POLL_MS                1           /**< conversion poll period in ms */
+#define HDC1080_POLL_TIMES             5           /**< conversion poll times */
 
 /**
- * @brief chip register definition
+ * @brief     debug output definition
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] NAME debug message name
+ * @param[in] ARG debug message argument
+ * @note      the message text is only linked when HDC1080_DEBUG_LEVEL is HDC1080_DEBUG_LEVEL_TEXT
  */
-#define HDC1080_REG_TEMPERATURE        0x00        /**< temperature register */
-#define HDC1080_REG_HUMIDITY           0x01        /**< humidity register */
-#define HDC1080_REG_CONFIG             0x02        /**< configuration register */
-#define HDC1080_REG_SERIAL_ID_0        0xFB        /**< serial id 0 register */
-#define HDC1080_REG_SERIAL_ID_1        0xFC        /**< serial id 1 register */
-#define HDC1080_REG_SERIAL_ID_2        0xFD        /**< serial id 2 register */
-#define HDC1080_REG_MANUFACTURER_ID    0xFE        /**< manufacturer id register */
-#define HDC1080_REG_DEVICE_ID          0xFF        /**< device id register */
+#if (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_TEXT)
+    #define HDC1080_DEBUG(HANDLE, NAME, ARG)    (HANDLE)->debug_print(HDC1080_DEBUG_TEXT_##NAME, (unsigned int)(ARG))
+#elif (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_BINARY)
+    #define HDC1080_DEBUG(HANDLE, NAME, ARG)    (HANDLE)->debug_log((uint8_t)HDC1080_DEBUG_ID_##NAME, (uint16_t)(ARG))
+#else
+    #define HDC1080_DEBUG(HANDLE, NAME, ARG)
+#endif
+
+/**
+ * @brief     lock the handle
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      it does nothing without a linked lock
+ */
+static uint8_t a_hdc1080_lock(hdc1080_handle_t *handle)
+{
+    if (handle->lock == NULL)                         /* check lock */
+    {
+        return 0;                                     /* no lock linked */
+    }
+    if (handle->lock() != 0)                          /* lock the handle */
+    {
+        HDC1080_DEBUG(handle, LOCK_FAILED, 0);        /* lock failed */
+        
+        return 1;                                     /* return error */
+    }
+    
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief     unlock the handle
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      it does nothing without a linked unlock
+ */
+static void a_hdc1080_unlock(hdc1080_handle_t *handle)
+{
+    if (handle->unlock != NULL)        /* check unlock */
+    {
+        handle->unlock();              /* unlock the handle */
+    }
+}
+
+/**
+ * @brief     lock the shared bus
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      it does nothing without a linked bus_lock
+ */
+static uint8_t a_hdc1080_bus_lock(hdc1080_handle_t *handle)
+{
+    if (handle->bus_lock == NULL)                         /* check bus_lock */
+    {
+        return 0;                                         /* no bus arbitration */
+    }
+    if (handle->bus_lock() != 0)                          /* lock the bus */
+    {
+        HDC1080_DEBUG(handle, BUS_LOCK_FAILED, 0);        /* bus lock failed */
+        
+        return 1;                                         /* return error */
+    }
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     unlock the shared bus
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      it does nothing without a linked bus_unlock
+ */
+static void a_hdc1080_bus_unlock(hdc1080_handle_t *handle)
+{
+    if (handle->bus_unlock != NULL)        /* check bus_unlock */
+    {
+        handle->bus_unlock();              /* unlock the bus */
+    }
+}
+
+/**
+ * @brief     get the conversion time of a trigger
+ * @param[in] config config register
+ * @param[in] reg triggered register
+ * @return    conversion time in ms, 0 if the resolution is invalid
+ * @note      the sequence mode converts both channels on every trigger
+ */
+static uint32_t a_hdc1080_conversion_ms(uint16_t config, uint8_t reg)
+{
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    
+    if (hdc1080_get_conversion_time((hdc1080_temperature_resolution_t)((config >> 10) & 0x1),
+                                    (hdc1080_humidity_resolution_t)((config >> 8) & 0x3),
+                                    &temperature_us, &humidity_us) != 0)        /* get the conversion time */
+    {
+        return 0;                                                               /* poll the unknown time */
+    }
+    if (((config >> 12) & 0x1) != 0)                                            /* sequence mode */
+    {
+        return (temperature_us + humidity_us) / 1000 + 1;                       /* both channels rounded up */
+    }
+    if (reg == HDC1080_REG_TEMPERATURE)                                         /* temperature */
+    {
+        return temperature_us / 1000 + 1;                                       /* temperature rounded up */
+    }
+    
+    return humidity_us / 1000 + 1;                                              /* humidity rounded up */
+}
 
 /**
  * @brief      read data with wait
@@ -73,21 +182,71 @@
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       with a linked bus_lock the trigger and the fetch are split,
+ *             the bus is released for the conversion time of the config shadow,
+ *             then fetched once with a short poll as fallback, iic_read_cmd is needed
  */
 static uint8_t a_hdc1080_iic_read_with_wait(hdc1080_handle_t *handle, uint8_t reg, uint16_t *data)
 {
+    uint8_t res;
+    uint8_t i;
     uint8_t buf[2];
+    uint32_t wait_ms;
     
-    if (handle->iic_read_with_wait(HDC1080_ADDRESS, reg, buf, 2) != 0)        /* read the register */
+    if (handle->bus_lock == NULL)                                              /* check bus arbitration */
+    {
+        res = handle->iic_read_with_wait(HDC1080_ADDRESS, reg, buf, 2);        /* read the register */
+    }
+    else
+    {
+        if (handle->iic_read_cmd == NULL)                                      /* check iic_read_cmd */
+        {
+            HDC1080_DEBUG(handle, IIC_READ_CMD_NULL, 0);                       /* iic_read_cmd is null */
+            
+            return 1;                                                          /* return error */
+        }
+        if (a_hdc1080_bus_lock(handle) != 0)                                   /* lock the bus */
+        {
+            return 1;                                                          /* return error */
+        }
+        res = handle->iic_write(HDC1080_ADDRESS, reg, NULL, 0);                /* write the pointer to trigger */
+        a_hdc1080_bus_unlock(handle);                                          /* release the bus */
+        if (res != 0)                                                          /* check result */
+        {
+            return 1;                                                          /* return error */
+        }
+        wait_ms = a_hdc1080_conversion_ms(handle->config, reg);                /* get the conversion time */
+        for (i = 0; i <= HDC1080_POLL_TIMES; i++)                              /* fetch once, poll a late conversion */
+        {
+            if (i == 0)                                                        /* first fetch */
+            {
+                handle->delay_ms(wait_ms);                                     /* wait the conversion with the bus released */
+            }
+            else
+            {
+                handle->delay_ms(HDC1080_POLL_MS);                             /* poll a late conversion */
+            }
+            if (a_hdc1080_bus_lock(handle) != 0)                               /* lock the bus */
+            {
+                return 1;                                                      /* return error */
+            }
+            res = handle->iic_read_cmd(HDC1080_ADDRESS, buf, 2);               /* nak until the conversion is finished */
+            a_hdc1080_bus_unlock(handle);                                      /* release the bus */
+            if (res == 0)                                                      /* check result */
+            {
+                break;                                                         /* conversion finished */
+            }
+        }
+    }
+    if (res != 0)                                                              /* check result */
     {
-        return 1;                                                             /* return error */
+        return 1;                                                              /* return error */
     }
     else
     {
-        *data = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                   /* get data */
+        *data = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                    /* get data */
         
-        return 0;                                                             /* success return 0 */
+        return 0;                                                              /* success return 0 */
     }
 }
 
@@ -103,9 +262,16 @@ static uint8_t a_hdc1080_iic_read_with_wait(hdc1080_handle_t *handle, uint8_t re
  */
 static uint8_t a_hdc1080_iic_read(hdc1080_handle_t *handle, uint8_t reg, uint16_t *data)
 {
+    uint8_t res;
     uint8_t buf[2];
     
-    if (handle->iic_read(HDC1080_ADDRESS, reg, buf, 2) != 0)        /* read the register */
+    if (a_hdc1080_bus_lock(handle) != 0)                            /* lock the bus */
+    {
+        return 1;                                                   /* return error */
+    }
+    res = handle->iic_read(HDC1080_ADDRESS, reg, buf, 2);           /* read the register */
+    a_hdc1080_bus_unlock(handle);                                   /* release the bus */
+    if (res != 0)                                                   /* check result */
     {
         return 1;                                                   /* return error */
     }
@@ -129,11 +295,18 @@ static uint8_t a_hdc1080_iic_read(hdc1080_handle_t *handle, uint8_t reg, uint16_
  */
 static uint8_t a_hdc1080_iic_write(hdc1080_handle_t *handle, uint8_t reg, uint16_t data)
 {
+    uint8_t res;
     uint8_t buf[2];
     
     buf[0] = (data >> 8) & 0xFF;                                     /* msb */
     buf[1] = (data >> 0) & 0xFF;                                     /* lsb */
-    if (handle->iic_write(HDC1080_ADDRESS, reg, buf, 2) != 0)        /* write the register */
+    if (a_hdc1080_bus_lock(handle) != 0)                             /* lock the bus */
+    {
+        return 1;                                                    /* return error */
+    }
+    res = handle->iic_write(HDC1080_ADDRESS, reg, buf, 2);           /* write the register */
+    a_hdc1080_bus_unlock(handle);                                    /* release the bus */
+    if (res != 0)                                                    /* check result */
     {
         return 1;                                                    /* return error */
     }
@@ -166,64 +339,83 @@ uint8_t hdc1080_init(hdc1080_handle_t *handle)
     {
         return 2;                                                              /* return error */
     }
+#if (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_TEXT)
     if (handle->debug_print == NULL)                                           /* check debug_print */
     {
         return 3;                                                              /* return error */
     }
+#elif (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_BINARY)
+    if (handle->debug_log == NULL)                                             /* check debug_log */
+    {
+        return 3;                                                              /* return error */
+    }
+#endif
     if (handle->iic_init == NULL)                                              /* check iic_init */
     {
-        handle->debug_print("hdc1080: iic_init is null.\n");                   /* iic_init is null */
+        HDC1080_DEBUG(handle, IIC_INIT_NULL, 0);                               /* iic_init is null */
         
         return 3;                                                              /* return error */
     }
     if (handle->iic_deinit == NULL)                                            /* check iic_deinit */
     {
-        handle->debug_print("hdc1080: iic_deinit is null.\n");                 /* iic_deinit is null */
+        HDC1080_DEBUG(handle, IIC_DEINIT_NULL, 0);                             /* iic_deinit is null */
         
         return 3;                                                              /* return error */
     }
     if (handle->iic_read == NULL)                                              /* check iic_read */
     {
-        handle->debug_print("hdc1080: iic_read is null.\n");                   /* iic_read is null */
+        HDC1080_DEBUG(handle, IIC_READ_NULL, 0);                               /* iic_read is null */
         
         return 3;                                                              /* return error */
     }
     if (handle->iic_read_with_wait == NULL)                                    /* check iic_read_with_wait */
     {
-        handle->debug_print("hdc1080: iic_read_with_wait is null.\n");         /* iic_read_with_wait is null */
+        HDC1080_DEBUG(handle, IIC_READ_WITH_WAIT_NULL, 0);                     /* iic_read_with_wait is null */
         
         return 3;                                                              /* return error */
     }
     if (handle->iic_write == NULL)                                             /* check iic_write */
     {
-        handle->debug_print("hdc1080: iic_write is null.\n");                  /* iic_write is null */
+        HDC1080_DEBUG(handle, IIC_WRITE_NULL, 0);                              /* iic_write is null */
         
         return 3;                                                              /* return error */
     }
     if (handle->delay_ms == NULL)                                              /* check delay_ms */
     {
-        handle->debug_print("hdc1080: delay_ms is null.\n");                   /* delay_ms is null */
+        HDC1080_DEBUG(handle, DELAY_MS_NULL, 0);                               /* delay_ms is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if ((handle->lock == NULL) != (handle->unlock == NULL))                    /* check lock and unlock */
+    {
+        HDC1080_DEBUG(handle, LOCK_NOT_PAIRED, 0);                             /* lock hooks are not paired */
+        
+        return 3;                                                              /* return error */
+    }
+    if ((handle->bus_lock == NULL) != (handle->bus_unlock == NULL))            /* check bus_lock and bus_unlock */
+    {
+        HDC1080_DEBUG(handle, BUS_LOCK_NOT_PAIRED, 0);                         /* bus lock hooks are not paired */
         
         return 3;                                                              /* return error */
     }
     
     if (handle->iic_init() != 0)                                               /* iic init */
     {
-        handle->debug_print("hdc1080: iic init failed.\n");                    /* iic init failed */
+        HDC1080_DEBUG(handle, IIC_INIT_FAILED, 0);                             /* iic init failed */
         
         return 1;                                                              /* return error */
     }
     res = a_hdc1080_iic_read(handle, HDC1080_REG_MANUFACTURER_ID, &id);        /* read manufacturer id */
     if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("hdc1080: read manufacturer id failed.\n");        /* read manufacturer id failed */
+        HDC1080_DEBUG(handle, READ_MANUFACTURER_ID_FAILED, 0);                 /* read manufacturer id failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 4;                                                              /* return error */
     }
-    if (id != 0x5449)                                                          /* check id */
+    if (id != HDC1080_MANUFACTURER_ID)                                         /* check id */
     {
-        handle->debug_print("hdc1080: manufacturer id is invalid.\n");         /* read manufacturer id failed */
+        HDC1080_DEBUG(handle, MANUFACTURER_ID_INVALID, id);                    /* read manufacturer id failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 5;                                                              /* return error */
@@ -231,14 +423,14 @@ uint8_t hdc1080_init(hdc1080_handle_t *handle)
     res = a_hdc1080_iic_read(handle, HDC1080_REG_DEVICE_ID, &id);              /* read device id */
     if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("hdc1080: read device id failed.\n");              /* read device id failed */
+        HDC1080_DEBUG(handle, READ_DEVICE_ID_FAILED, 0);                       /* read device id failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 4;                                                              /* return error */
     }
-    if (id != 0x1050)                                                          /* check id */
+    if (id != HDC1080_DEVICE_ID)                                               /* check id */
     {
-        handle->debug_print("hdc1080: device id is invalid.\n");               /* read device id failed */
+        HDC1080_DEBUG(handle, DEVICE_ID_INVALID, id);                          /* read device id failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 5;                                                              /* return error */
@@ -247,7 +439,7 @@ uint8_t hdc1080_init(hdc1080_handle_t *handle)
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);               /* read config */
     if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("hdc1080: read config failed.\n");                 /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                          /* read config failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 6;                                                              /* return error */
@@ -257,12 +449,199 @@ uint8_t hdc1080_init(hdc1080_handle_t *handle)
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);               /* write config */
     if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("hdc1080: write config failed.\n");                /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                         /* write config failed */
         (void)handle->iic_deinit();                                            /* iic deinit */
         
         return 6;                                                              /* return error */
     }
     handle->delay_ms(100);                                                     /* delay 100ms */
+    handle->config = HDC1080_CONFIG_DEFAULT;                                   /* reset config */
+    handle->inited = 1;                                                        /* flag finish initialization */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      initialize the chip without a reset when it is already configured
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[in]  mode chip mode
+ * @param[in]  heater bool value
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *reset pointer to a bool value buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic init failed
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 read id failed
+ *             - 5 id is invalid
+ *             - 6 reset failed
+ *             - 7 config is invalid
+ * @note       the ids and the config register are read, a chip that still runs the wanted
+ *             configuration after an mcu reset is used as it is, otherwise it is reset and programmed,
+ *             reset is set to HDC1080_BOOL_TRUE when the chip was reset
+ */
+uint8_t hdc1080_init_fast(hdc1080_handle_t *handle, hdc1080_mode_t mode, hdc1080_bool_t heater,
+                          hdc1080_temperature_resolution_t temperature_resolution,
+                          hdc1080_humidity_resolution_t humidity_resolution, hdc1080_bool_t *reset)
+{
+    uint8_t res;
+    uint16_t data;
+    uint16_t config;
+    uint16_t id;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+#if (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_TEXT)
+    if (handle->debug_print == NULL)                                           /* check debug_print */
+    {
+        return 3;                                                              /* return error */
+    }
+#elif (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_BINARY)
+    if (handle->debug_log == NULL)                                             /* check debug_log */
+    {
+        return 3;                                                              /* return error */
+    }
+#endif
+    if (handle->iic_init == NULL)                                              /* check iic_init */
+    {
+        HDC1080_DEBUG(handle, IIC_INIT_NULL, 0);                               /* iic_init is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if (handle->iic_deinit == NULL)                                            /* check iic_deinit */
+    {
+        HDC1080_DEBUG(handle, IIC_DEINIT_NULL, 0);                             /* iic_deinit is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if (handle->iic_read == NULL)                                              /* check iic_read */
+    {
+        HDC1080_DEBUG(handle, IIC_READ_NULL, 0);                               /* iic_read is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if (handle->iic_read_with_wait == NULL)                                    /* check iic_read_with_wait */
+    {
+        HDC1080_DEBUG(handle, IIC_READ_WITH_WAIT_NULL, 0);                     /* iic_read_with_wait is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if (handle->iic_write == NULL)                                             /* check iic_write */
+    {
+        HDC1080_DEBUG(handle, IIC_WRITE_NULL, 0);                              /* iic_write is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if (handle->delay_ms == NULL)                                              /* check delay_ms */
+    {
+        HDC1080_DEBUG(handle, DELAY_MS_NULL, 0);                               /* delay_ms is null */
+        
+        return 3;                                                              /* return error */
+    }
+    if ((handle->lock == NULL) != (handle->unlock == NULL))                    /* check lock and unlock */
+    {
+        HDC1080_DEBUG(handle, LOCK_NOT_PAIRED, 0);                             /* lock hooks are not paired */
+        
+        return 3;                                                              /* return error */
+    }
+    if ((handle->bus_lock == NULL) != (handle->bus_unlock == NULL))            /* check bus_lock and bus_unlock */
+    {
+        HDC1080_DEBUG(handle, BUS_LOCK_NOT_PAIRED, 0);                         /* bus lock hooks are not paired */
+        
+        return 3;                                                              /* return error */
+    }
+    
+    if ((mode > HDC1080_MODE_SEQUENCE) || (heater > HDC1080_BOOL_TRUE) ||
+        (temperature_resolution > HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (humidity_resolution > HDC1080_HUMIDITY_RESOLUTION_8_BIT))             /* check the config */
+    {
+        HDC1080_DEBUG(handle, CONFIG_INVALID, 0);                              /* config is invalid */
+        
+        return 7;                                                              /* return error */
+    }
+    
+    if (reset != NULL)                                                         /* check reset buffer */
+    {
+        *reset = HDC1080_BOOL_FALSE;                                           /* not reset */
+    }
+    config = (uint16_t)((uint16_t)heater << 13);                               /* set heater */
+    config |= (uint16_t)((uint16_t)mode << 12);                                /* set mode */
+    config |= (uint16_t)((uint16_t)temperature_resolution << 10);              /* set temperature resolution */
+    config |= (uint16_t)((uint16_t)humidity_resolution << 8);                  /* set humidity resolution */
+    if (handle->iic_init() != 0)                                               /* iic init */
+    {
+        HDC1080_DEBUG(handle, IIC_INIT_FAILED, 0);                             /* iic init failed */
+        
+        return 1;                                                              /* return error */
+    }
+    res = a_hdc1080_iic_read(handle, HDC1080_REG_MANUFACTURER_ID, &id);        /* read manufacturer id */
+    if (res != 0)                                                              /* check result */
+    {
+        HDC1080_DEBUG(handle, READ_MANUFACTURER_ID_FAILED, 0);                 /* read manufacturer id failed */
+        (void)handle->iic_deinit();                                            /* iic deinit */
+        
+        return 4;                                                              /* return error */
+    }
+    if (id != HDC1080_MANUFACTURER_ID)                                         /* check id */
+    {
+        HDC1080_DEBUG(handle, MANUFACTURER_ID_INVALID, id);                    /* another device answers */
+        (void)handle->iic_deinit();                                            /* iic deinit */
+        
+        return 5;                                                              /* return error */
+    }
+    res = a_hdc1080_iic_read(handle, HDC1080_REG_DEVICE_ID, &data);            /* read device id */
+    if (res != 0)                                                              /* check result */
+    {
+        HDC1080_DEBUG(handle, READ_DEVICE_ID_FAILED, 0);                       /* read device id failed */
+        (void)handle->iic_deinit();                                            /* iic deinit */
+        
+        return 4;                                                              /* return error */
+    }
+    if (data != HDC1080_DEVICE_ID)                                             /* check id */
+    {
+        HDC1080_DEBUG(handle, DEVICE_ID_INVALID, data);                        /* another device answers */
+        (void)handle->iic_deinit();                                            /* iic deinit */
+        
+        return 5;                                                              /* return error */
+    }
+    res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);               /* read config */
+    if (res != 0)                                                              /* check result */
+    {
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                          /* read config failed */
+        (void)handle->iic_deinit();                                            /* iic deinit */
+        
+        return 6;                                                              /* return error */
+    }
+    
+    if ((data & HDC1080_CONFIG_MASK) != config)                                /* check the running config */
+    {
+        res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, 1 << 15);        /* software reset */
+        if (res != 0)                                                          /* check result */
+        {
+            HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                     /* write config failed */
+            (void)handle->iic_deinit();                                        /* iic deinit */
+            
+            return 6;                                                          /* return error */
+        }
+        handle->delay_ms(100);                                                 /* delay 100ms */
+        res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, config);         /* write the wanted config */
+        if (res != 0)                                                          /* check result */
+        {
+            HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                     /* write config failed */
+            (void)handle->iic_deinit();                                        /* iic deinit */
+            
+            return 6;                                                          /* return error */
+        }
+        if (reset != NULL)                                                     /* check reset buffer */
+        {
+            *reset = HDC1080_BOOL_TRUE;                                        /* chip was reset */
+        }
+    }
+    handle->config = config;                                                   /* running config */
     handle->inited = 1;                                                        /* flag finish initialization */
     
     return 0;                                                                  /* success return 0 */
@@ -288,25 +667,139 @@ uint8_t hdc1080_deinit(hdc1080_handle_t *handle)
     {
         return 3;                                                  /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                               /* lock the handle */
+    {
+        return 1;                                                  /* return error */
+    }
     
     if (handle->iic_deinit() != 0)                                 /* iic deinit */
     {
-        handle->debug_print("hdc1080: iic deinit failed.\n");      /* iic deinit failed */
+        HDC1080_DEBUG(handle, IIC_DEINIT_FAILED, 0);               /* iic deinit failed */
+        a_hdc1080_unlock(handle);                                  /* unlock the handle */
         
         return 1;                                                  /* return error */
     }
     handle->inited = 0;                                            /* set closed flag */
+    a_hdc1080_unlock(handle);                                      /* unlock the handle */
     
     return 0;                                                      /* success return 0 */
 }
 
+/**
+ * @brief      probe the chip without initializing it
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[out] *id pointer to a serial id buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 no chip answers
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 read serial id failed
+ *             - 5 id is invalid
+ * @note       only the manufacturer id, the device id and the serial id are read, there is no reset,
+ *             iic_init is not called so the bus must be ready, the handle stays uninitialized,
+ *             a missing chip only costs one nacked read and prints no debug message
+ */
+uint8_t hdc1080_probe(hdc1080_handle_t *handle, uint8_t id[6])
+{
+    uint8_t i;
+    uint8_t reg;
+    uint16_t data;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+#if (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_TEXT)
+    if (handle->debug_print == NULL)                                                /* check debug_print */
+    {
+        return 3;                                                                   /* return error */
+    }
+#elif (HDC1080_DEBUG_LEVEL == HDC1080_DEBUG_LEVEL_BINARY)
+    if (handle->debug_log == NULL)                                                  /* check debug_log */
+    {
+        return 3;                                                                   /* return error */
+    }
+#endif
+    if (handle->iic_read == NULL)                                                   /* check iic_read */
+    {
+        HDC1080_DEBUG(handle, IIC_READ_NULL, 0);                                    /* iic_read is null */
+        
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->lock == NULL) != (handle->unlock == NULL))                         /* check lock and unlock */
+    {
+        HDC1080_DEBUG(handle, LOCK_NOT_PAIRED, 0);                                  /* lock hooks are not paired */
+        
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->bus_lock == NULL) != (handle->bus_unlock == NULL))                 /* check bus_lock and bus_unlock */
+    {
+        HDC1080_DEBUG(handle, BUS_LOCK_NOT_PAIRED, 0);                              /* bus lock hooks are not paired */
+        
+        return 3;                                                                   /* return error */
+    }
+    if (a_hdc1080_lock(handle) != 0)                                                /* lock the handle */
+    {
+        return 1;                                                                   /* return error */
+    }
+    
+    if (a_hdc1080_iic_read(handle, HDC1080_REG_MANUFACTURER_ID, &data) != 0)        /* read manufacturer id */
+    {
+        a_hdc1080_unlock(handle);                                                   /* unlock the handle */
+        
+        return 1;                                                                   /* no chip */
+    }
+    if (data != HDC1080_MANUFACTURER_ID)                                            /* check id */
+    {
+        HDC1080_DEBUG(handle, MANUFACTURER_ID_INVALID, data);                       /* another device answers */
+        a_hdc1080_unlock(handle);                                                   /* unlock the handle */
+        
+        return 5;                                                                   /* return error */
+    }
+    if (a_hdc1080_iic_read(handle, HDC1080_REG_DEVICE_ID, &data) != 0)              /* read device id */
+    {
+        HDC1080_DEBUG(handle, READ_DEVICE_ID_FAILED, 0);                            /* read device id failed */
+        a_hdc1080_unlock(handle);                                                   /* unlock the handle */
+        
+        return 1;                                                                   /* return error */
+    }
+    if (data != HDC1080_DEVICE_ID)                                                  /* check id */
+    {
+        HDC1080_DEBUG(handle, DEVICE_ID_INVALID, data);                             /* another device answers */
+        a_hdc1080_unlock(handle);                                                   /* unlock the handle */
+        
+        return 5;                                                                   /* return error */
+    }
+    if (id != NULL)                                                                 /* check id buffer */
+    {
+        reg = HDC1080_REG_SERIAL_ID_0;                                              /* first serial id register */
+        for (i = 0; i < 6; i += 2)                                                  /* 3 serial id registers */
+        {
+            if (a_hdc1080_iic_read(handle, reg, &data) != 0)                        /* read serial id */
+            {
+                HDC1080_DEBUG(handle, READ_SERIAL_ID_FAILED, i / 2);                /* read serial id failed */
+                a_hdc1080_unlock(handle);                                           /* unlock the handle */
+                
+                return 4;                                                           /* return error */
+            }
+            id[i + 0] = (data >> 8) & 0xFF;                                         /* msb */
+            id[i + 1] = (data >> 0) & 0xFF;                                         /* lsb */
+            reg++;                                                                  /* next register */
+        }
+    }
+    a_hdc1080_unlock(handle);                                                       /* unlock the handle */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
 /**
  * @brief      read the temperature and humidity data
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
  * @param[out] *humidity_raw pointer to a raw humidity buffer
- * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read temperature humidity failed
@@ -319,41 +812,54 @@ uint8_t hdc1080_read_temperature_humidity(hdc1080_handle_t *handle, uint16_t *te
 {
     uint8_t res;
     
-    if (handle == NULL)                                                                /* check handle */
+    if (handle == NULL)                                                                    /* check handle */
     {
-        return 2;                                                                      /* return error */
+        return 2;                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                           /* check handle initialization */
+    if (handle->inited != 1)                                                               /* check handle initialization */
     {
-        return 3;                                                                      /* return error */
+        return 3;                                                                          /* return error */
+    }
+    if (a_hdc1080_lock(handle) != 0)                                                       /* lock the handle */
+    {
+        return 1;                                                                          /* return error */
     }
     
     res = a_hdc1080_iic_read_with_wait(handle, HDC1080_REG_TEMPERATURE, 
-                                       temperature_raw);                               /* read temperature */
-    if (res != 0)                                                                      /* check result */
+                                       temperature_raw);                                   /* read temperature */
+    if (res != 0)                                                                          /* check result */
     {
-        handle->debug_print("hdc1080: read temperature failed.\n");                    /* read temperature failed */
+        HDC1080_DEBUG(handle, READ_TEMPERATURE_FAILED, 0);                                 /* read temperature failed */
+        a_hdc1080_unlock(handle);                                                          /* unlock the handle */
         
-        return 1;                                                                      /* return error */
+        return 1;                                                                          /* return error */
     }
-    *temperature_s = (float)(*temperature_raw) / 65536.0f * 165.0f - 40.0f;            /* convert temperature */
-    res = a_hdc1080_iic_read_with_wait(handle, HDC1080_REG_HUMIDITY, humidity_raw);    /* read humidity */
-    if (res != 0)                                                                      /* check result */
+    if (temperature_s != NULL)                                                             /* check temperature_s */
     {
-        handle->debug_print("hdc1080: read humidity failed.\n");                       /* read humidity failed */
+        (void)hdc1080_temperature_convert_to_data(*temperature_raw, temperature_s);        /* convert temperature */
+    }
+    res = a_hdc1080_iic_read_with_wait(handle, HDC1080_REG_HUMIDITY, humidity_raw);        /* read humidity */
+    if (res != 0)                                                                          /* check result */
+    {
+        HDC1080_DEBUG(handle, READ_HUMIDITY_FAILED, 0);                                    /* read humidity failed */
+        a_hdc1080_unlock(handle);                                                          /* unlock the handle */
         
-        return 1;                                                                      /* return error */
+        return 1;                                                                          /* return error */
     }
-    *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                          /* get humidity */
+    if (humidity_s != NULL)                                                                /* check humidity_s */
+    {
+        (void)hdc1080_humidity_convert_to_data(*humidity_raw, humidity_s);                 /* convert humidity */
+    }
+    a_hdc1080_unlock(handle);                                                              /* unlock the handle */
     
-    return 0;                                                                          /* success return 0 */
+    return 0;                                                                              /* success return 0 */
 }
 
 /**
  * @brief      read the temperature
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read temperature failed
@@ -373,15 +879,24 @@ uint8_t hdc1080_read_temperature(hdc1080_handle_t *handle, uint16_t *temperature
     {
         return 3;                                                                                /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                                             /* lock the handle */
+    {
+        return 1;                                                                                /* return error */
+    }
     
     res = a_hdc1080_iic_read_with_wait(handle, HDC1080_REG_TEMPERATURE, temperature_raw);        /* read temperature */
     if (res != 0)                                                                                /* check result */
     {
-        handle->debug_print("hdc1080: read temperature failed.\n");                              /* read temperature failed */
+        HDC1080_DEBUG(handle, READ_TEMPERATURE_FAILED, 0);                                       /* read temperature failed */
+        a_hdc1080_unlock(handle);                                                                /* unlock the handle */
         
         return 1;                                                                                /* return error */
     }
-    *temperature_s = (float)(*temperature_raw) / 65536.0f * 165.0f - 40.0f;                      /* convert temperature */
+    if (temperature_s != NULL)                                                                   /* check temperature_s */
+    {
+        (void)hdc1080_temperature_convert_to_data(*temperature_raw, temperature_s);              /* convert temperature */
+    }
+    a_hdc1080_unlock(handle);                                                                    /* unlock the handle */
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -390,7 +905,7 @@ uint8_t hdc1080_read_temperature(hdc1080_handle_t *handle, uint16_t *temperature
  * @brief      read the humidity data
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *humidity_raw pointer to a raw humidity buffer
- * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read humidity failed
@@ -410,19 +925,244 @@ uint8_t hdc1080_read_humidity(hdc1080_handle_t *handle, uint16_t *humidity_raw,
     {
         return 3;                                                                          /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                                       /* lock the handle */
+    {
+        return 1;                                                                          /* return error */
+    }
     
     res = a_hdc1080_iic_read_with_wait(handle, HDC1080_REG_HUMIDITY, humidity_raw);        /* read humidity */
     if (res != 0)                                                                          /* check result */
     {
-        handle->debug_print("hdc1080: read humidity failed.\n");                           /* read humidity failed */
+        HDC1080_DEBUG(handle, READ_HUMIDITY_FAILED, 0);                                    /* read humidity failed */
+        a_hdc1080_unlock(handle);                                                          /* unlock the handle */
         
         return 1;                                                                          /* return error */
     }
-    *humidity_s = (float)(*humidity_raw) / 65536.0f * 100.0f;                              /* get humidity */
+    if (humidity_s != NULL)                                                                /* check humidity_s */
+    {
+        (void)hdc1080_humidity_convert_to_data(*humidity_raw, humidity_s);                 /* convert humidity */
+    }
+    a_hdc1080_unlock(handle);                                                              /* unlock the handle */
     
     return 0;                                                                              /* success return 0 */
 }
 
+/**
+ * @brief     start a temperature and humidity measurement
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measurement failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_cmd is null
+ *            - 5 mode is not sequence
+ * @note      the chip must be in HDC1080_MODE_SEQUENCE,
+ *            call hdc1080_fetch_temperature_humidity after the conversion time
+ */
+uint8_t hdc1080_start_temperature_humidity(hdc1080_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (handle->iic_read_cmd == NULL)                                                  /* check iic_read_cmd */
+    {
+        HDC1080_DEBUG(handle, IIC_READ_CMD_NULL, 0);                                   /* iic_read_cmd is null */
+        
+        return 4;                                                                      /* return error */
+    }
+    if (((handle->config >> 12) & 0x1) != HDC1080_MODE_SEQUENCE)                       /* check the mode shadow */
+    {
+        HDC1080_DEBUG(handle, MODE_INVALID, 0);                                        /* mode is not sequence */
+        
+        return 5;                                                                      /* return error */
+    }
+    if (a_hdc1080_lock(handle) != 0)                                                   /* lock the handle */
+    {
+        return 1;                                                                      /* return error */
+    }
+    
+    if (a_hdc1080_bus_lock(handle) != 0)                                               /* lock the bus */
+    {
+        a_hdc1080_unlock(handle);                                                      /* unlock the handle */
+        
+        return 1;                                                                      /* return error */
+    }
+    res = handle->iic_write(HDC1080_ADDRESS, HDC1080_REG_TEMPERATURE, NULL, 0);        /* write the pointer to trigger */
+    a_hdc1080_bus_unlock(handle);                                                      /* release the bus */
+    if (res != 0)                                                                      /* check result */
+    {
+        HDC1080_DEBUG(handle, START_MEASUREMENT_FAILED, 0);                            /* start measurement failed */
+        a_hdc1080_unlock(handle);                                                      /* unlock the handle */
+        
+        return 1;                                                                      /* return error */
+    }
+    a_hdc1080_unlock(handle);                                                          /* unlock the handle */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      fetch the temperature and humidity measurement
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch measurement failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 iic_read_cmd is null
+ *             - 5 mode is not sequence
+ * @note       the chip does not acknowledge the read before the conversion is finished
+ */
+uint8_t hdc1080_fetch_temperature_humidity(hdc1080_handle_t *handle, uint16_t *temperature_raw, float *temperature_s,
+                                           uint16_t *humidity_raw, float *humidity_s)
+{
+    uint8_t res;
+    uint8_t buf[4];
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (handle->iic_read_cmd == NULL)                                                      /* check iic_read_cmd */
+    {
+        HDC1080_DEBUG(handle, IIC_READ_CMD_NULL, 0);                                       /* iic_read_cmd is null */
+        
+        return 4;                                                                          /* return error */
+    }
+    if (((handle->config >> 12) & 0x1) != HDC1080_MODE_SEQUENCE)                           /* check the mode shadow */
+    {
+        HDC1080_DEBUG(handle, MODE_INVALID, 0);                                            /* mode is not sequence */
+        
+        return 5;                                                                          /* return error */
+    }
+    if (a_hdc1080_lock(handle) != 0)                                                       /* lock the handle */
+    {
+        return 1;                                                                          /* return error */
+    }
+    
+    if (a_hdc1080_bus_lock(handle) != 0)                                                   /* lock the bus */
+    {
+        a_hdc1080_unlock(handle);                                                          /* unlock the handle */
+        
+        return 1;                                                                          /* return error */
+    }
+    res = handle->iic_read_cmd(HDC1080_ADDRESS, buf, 4);                                   /* read temperature and humidity */
+    a_hdc1080_bus_unlock(handle);                                                          /* release the bus */
+    if (res != 0)                                                                          /* check result */
+    {
+        HDC1080_DEBUG(handle, FETCH_MEASUREMENT_FAILED, 0);                                /* fetch measurement failed */
+        a_hdc1080_unlock(handle);                                                          /* unlock the handle */
+        
+        return 1;                                                                          /* return error */
+    }
+    *temperature_raw = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                         /* get raw temperature */
+    *humidity_raw = (uint16_t)((uint16_t)buf[2] << 8 | buf[3]);                            /* get raw humidity */
+    if (temperature_s != NULL)                                                             /* check temperature_s */
+    {
+        (void)hdc1080_temperature_convert_to_data(*temperature_raw, temperature_s);        /* convert temperature */
+    }
+    if (humidity_s != NULL)                                                                /* check humidity_s */
+    {
+        (void)hdc1080_humidity_convert_to_data(*humidity_raw, humidity_s);                 /* convert humidity */
+    }
+    a_hdc1080_unlock(handle);                                                              /* unlock the handle */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the conversion time
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *temperature_us pointer to a temperature conversion time buffer
+ * @param[out] *humidity_us pointer to a humidity conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 resolution is invalid
+ * @note       typical datasheet values, a sequence measurement takes the sum of both
+ */
+uint8_t hdc1080_get_conversion_time(hdc1080_temperature_resolution_t temperature_resolution,
+                                    hdc1080_humidity_resolution_t humidity_resolution,
+                                    uint32_t *temperature_us, uint32_t *humidity_us)
+{
+    if (temperature_resolution == HDC1080_TEMPERATURE_RESOLUTION_14_BIT)             /* 14 bit */
+    {
+        *temperature_us = HDC1080_TEMPERATURE_14_BIT_US;                             /* 6.35ms */
+    }
+    else if (temperature_resolution == HDC1080_TEMPERATURE_RESOLUTION_11_BIT)        /* 11 bit */
+    {
+        *temperature_us = HDC1080_TEMPERATURE_11_BIT_US;                             /* 3.65ms */
+    }
+    else
+    {
+        return 1;                                                                    /* return error */
+    }
+    if (humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_14_BIT)                   /* 14 bit */
+    {
+        *humidity_us = HDC1080_HUMIDITY_14_BIT_US;                                   /* 6.50ms */
+    }
+    else if (humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_11_BIT)              /* 11 bit */
+    {
+        *humidity_us = HDC1080_HUMIDITY_11_BIT_US;                                   /* 3.85ms */
+    }
+    else if (humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_8_BIT)               /* 8 bit */
+    {
+        *humidity_us = HDC1080_HUMIDITY_8_BIT_US;                                    /* 2.50ms */
+    }
+    else
+    {
+        return 1;                                                                    /* return error */
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      convert the raw temperature to the real temperature
+ * @param[in]  raw raw temperature
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ * @note       temperature = raw / 2^16 * 165C - 40C
+ */
+uint8_t hdc1080_temperature_convert_to_data(uint16_t raw, float *temperature_s)
+{
+    *temperature_s = (float)(raw) / HDC1080_RAW_SPAN * HDC1080_TEMPERATURE_SPAN + HDC1080_TEMPERATURE_MIN;        /* convert temperature */
+    
+    return 0;                                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert the raw humidity to the real humidity
+ * @param[in]  raw raw humidity
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ * @note       humidity = raw / 2^16 * 100%
+ */
+uint8_t hdc1080_humidity_convert_to_data(uint16_t raw, float *humidity_s)
+{
+    *humidity_s = (float)(raw) / HDC1080_RAW_SPAN * HDC1080_HUMIDITY_SPAN;        /* convert humidity */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
 /**
  * @brief     software reset
  * @param[in] *handle pointer to an hdc1080 handle structure
@@ -446,11 +1186,16 @@ uint8_t hdc1080_software_reset(hdc1080_handle_t *handle)
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
@@ -459,11 +1204,14 @@ uint8_t hdc1080_software_reset(hdc1080_handle_t *handle)
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);        /* write config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: write config failed.\n");         /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                  /* write config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
     handle->delay_ms(100);                                              /* delay 100ms */
+    handle->config = HDC1080_CONFIG_DEFAULT;                            /* reset config */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -492,11 +1240,16 @@ uint8_t hdc1080_set_heater(hdc1080_handle_t *handle, hdc1080_bool_t enable)
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
@@ -505,10 +1258,13 @@ uint8_t hdc1080_set_heater(hdc1080_handle_t *handle, hdc1080_bool_t enable)
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);        /* write config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: write config failed.\n");         /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                  /* write config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
+    handle->config = (uint16_t)(data & HDC1080_CONFIG_MASK);            /* update the config shadow */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -537,15 +1293,21 @@ uint8_t hdc1080_get_heater(hdc1080_handle_t *handle, hdc1080_bool_t *enable)
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
     *enable = (hdc1080_bool_t)((data >> 13) & 0x1);                     /* get the bool */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -574,11 +1336,16 @@ uint8_t hdc1080_set_mode(hdc1080_handle_t *handle, hdc1080_mode_t mode)
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
@@ -587,10 +1354,13 @@ uint8_t hdc1080_set_mode(hdc1080_handle_t *handle, hdc1080_mode_t mode)
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);        /* write config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: write config failed.\n");         /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                  /* write config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
+    handle->config = (uint16_t)(data & HDC1080_CONFIG_MASK);            /* update the config shadow */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -619,15 +1389,21 @@ uint8_t hdc1080_get_mode(hdc1080_handle_t *handle, hdc1080_mode_t *mode)
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
     *mode = (hdc1080_mode_t)((data >> 12) & 0x1);                       /* get the mode */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -656,15 +1432,21 @@ uint8_t hdc1080_get_battery_status(hdc1080_handle_t *handle, hdc1080_battery_sta
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
     *status = (hdc1080_battery_status_t)((data >> 11) & 0x1);           /* get the status */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -693,11 +1475,16 @@ uint8_t hdc1080_set_temperature_resolution(hdc1080_handle_t *handle, hdc1080_tem
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
@@ -706,10 +1493,13 @@ uint8_t hdc1080_set_temperature_resolution(hdc1080_handle_t *handle, hdc1080_tem
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);        /* write config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: write config failed.\n");         /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                  /* write config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
+    handle->config = (uint16_t)(data & HDC1080_CONFIG_MASK);            /* update the config shadow */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -738,15 +1528,21 @@ uint8_t hdc1080_get_temperature_resolution(hdc1080_handle_t *handle, hdc1080_tem
     {
         return 3;                                                                /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                             /* lock the handle */
+    {
+        return 1;                                                                /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);                 /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");                   /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                            /* read config failed */
+        a_hdc1080_unlock(handle);                                                /* unlock the handle */
         
         return 1;                                                                /* return error */
     }
     *resolution = (hdc1080_temperature_resolution_t)((data >> 10) & 0x1);        /* get the resolution */
+    a_hdc1080_unlock(handle);                                                    /* unlock the handle */
     
     return 0;                                                                    /* success return 0 */
 }
@@ -775,11 +1571,16 @@ uint8_t hdc1080_set_humidity_resolution(hdc1080_handle_t *handle, hdc1080_humidi
     {
         return 3;                                                       /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                    /* lock the handle */
+    {
+        return 1;                                                       /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");          /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                   /* read config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
@@ -788,10 +1589,13 @@ uint8_t hdc1080_set_humidity_resolution(hdc1080_handle_t *handle, hdc1080_humidi
     res = a_hdc1080_iic_write(handle, HDC1080_REG_CONFIG, data);        /* write config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: write config failed.\n");         /* write config failed */
+        HDC1080_DEBUG(handle, WRITE_CONFIG_FAILED, 0);                  /* write config failed */
+        a_hdc1080_unlock(handle);                                       /* unlock the handle */
         
         return 1;                                                       /* return error */
     }
+    handle->config = (uint16_t)(data & HDC1080_CONFIG_MASK);            /* update the config shadow */
+    a_hdc1080_unlock(handle);                                           /* unlock the handle */
     
     return 0;                                                           /* success return 0 */
 }
@@ -820,15 +1624,21 @@ uint8_t hdc1080_get_humidity_resolution(hdc1080_handle_t *handle, hdc1080_humidi
     {
         return 3;                                                            /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                         /* lock the handle */
+    {
+        return 1;                                                            /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_CONFIG, &data);             /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read config failed.\n");               /* read config failed */
+        HDC1080_DEBUG(handle, READ_CONFIG_FAILED, 0);                        /* read config failed */
+        a_hdc1080_unlock(handle);                                            /* unlock the handle */
         
         return 1;                                                            /* return error */
     }
     *resolution = (hdc1080_humidity_resolution_t)((data >> 8) & 0x3);        /* get the resolution */
+    a_hdc1080_unlock(handle);                                                /* unlock the handle */
     
     return 0;                                                                /* success return 0 */
 }
@@ -857,11 +1667,16 @@ uint8_t hdc1080_get_serial_id(hdc1080_handle_t *handle, uint8_t id[6])
     {
         return 3;                                                            /* return error */
     }
+    if (a_hdc1080_lock(handle) != 0)                                         /* lock the handle */
+    {
+        return 1;                                                            /* return error */
+    }
     
     res = a_hdc1080_iic_read(handle, HDC1080_REG_SERIAL_ID_0, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read serial id 0  failed.\n");         /* read serial id 0 failed */
+        HDC1080_DEBUG(handle, READ_SERIAL_ID_FAILED, 0);                     /* read serial id 0 failed */
+        a_hdc1080_unlock(handle);                                            /* unlock the handle */
         
         return 1;                                                            /* return error */
     }
@@ -870,7 +1685,8 @@ uint8_t hdc1080_get_serial_id(hdc1080_handle_t *handle, uint8_t id[6])
     res = a_hdc1080_iic_read(handle, HDC1080_REG_SERIAL_ID_1, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read serial id 1  failed.\n");         /* read serial id 1 failed */
+        HDC1080_DEBUG(handle, READ_SERIAL_ID_FAILED, 1);                     /* read serial id 1 failed */
+        a_hdc1080_unlock(handle);                                            /* unlock the handle */
         
         return 1;                                                            /* return error */
     }
@@ -879,12 +1695,14 @@ uint8_t hdc1080_get_serial_id(hdc1080_handle_t *handle, uint8_t id[6])
     res = a_hdc1080_iic_read(handle, HDC1080_REG_SERIAL_ID_2, &data);        /* read config */
     if (res != 0)
     {
-        handle->debug_print("hdc1080: read serial id 2  failed.\n");         /* read serial id 2 failed */
+        HDC1080_DEBUG(handle, READ_SERIAL_ID_FAILED, 2);                     /* read serial id 2 failed */
+        a_hdc1080_unlock(handle);                                            /* unlock the handle */
         
         return 1;                                                            /* return error */
     }
     id[4] = (data >> 8) & 0xFF;                                              /* id4 */
     id[5] = (data >> 0) & 0xFF;                                              /* id5 */
+    a_hdc1080_unlock(handle);                                                /* unlock the handle */
     
     return 0;                                                                /* success return 0 */
 }
@@ -899,26 +1717,45 @@ uint8_t hdc1080_get_serial_id(hdc1080_handle_t *handle, uint8_t id[6])
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      a write to the config register updates the config shadow
  */
 uint8_t hdc1080_set_reg(hdc1080_handle_t *handle, uint8_t reg, uint16_t data)
 {
-    if (handle == NULL)                                  /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                        /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                        /* return error */
+        return 3;                                                               /* return error */
     } 
+    if (a_hdc1080_lock(handle) != 0)                                            /* lock the handle */
+    {
+        return 1;                                                               /* return error */
+    }
     
-    if (a_hdc1080_iic_write(handle, reg, data) != 0)     /* write data */
+    if (a_hdc1080_iic_write(handle, reg, data) != 0)                            /* write data */
     {
-        return 1;                                        /* return error */
+        a_hdc1080_unlock(handle);                                               /* unlock the handle */
+        
+        return 1;                                                               /* return error */
     }
     else
     {
-        return 0;                                        /* success return 0 */
+        if (reg == HDC1080_REG_CONFIG)                                          /* config register */
+        {
+            if (((data >> 15) & 0x1) != 0)                                      /* software reset */
+            {
+                handle->config = HDC1080_CONFIG_DEFAULT;                        /* reset config */
+            }
+            else
+            {
+                handle->config = (uint16_t)(data & HDC1080_CONFIG_MASK);        /* update the config shadow */
+            }
+        }
+        a_hdc1080_unlock(handle);                                               /* unlock the handle */
+        
+        return 0;                                                               /* success return 0 */
     }
 }
 
@@ -944,13 +1781,21 @@ uint8_t hdc1080_get_reg(hdc1080_handle_t *handle, uint8_t reg, uint16_t *data)
     {
         return 3;                                       /* return error */
     } 
+    if (a_hdc1080_lock(handle) != 0)                    /* lock the handle */
+    {
+        return 1;                                       /* return error */
+    }
     
     if (a_hdc1080_iic_read(handle, reg, data) != 0)     /* read data */
     {
+        a_hdc1080_unlock(handle);                       /* unlock the handle */
+        
         return 1;                                       /* return error */
     }
     else
     {
+        a_hdc1080_unlock(handle);                       /* unlock the handle */
+        
         return 0;                                       /* success return 0 */
     }
 }
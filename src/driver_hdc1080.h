@@ -56,6 +56,125 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief hdc1080 debug level definition
+ */
+#define HDC1080_DEBUG_LEVEL_NONE          0        /**< no debug output, all messages are removed */
+#define HDC1080_DEBUG_LEVEL_BINARY        1        /**< message id records through debug_log, no strings are linked */
+#define HDC1080_DEBUG_LEVEL_TEXT          2        /**< formatted text through debug_print */
+
+/**
+ * @brief hdc1080 debug level
+ * @note  override it in the compiler options to remove the message strings from flash
+ */
+#ifndef HDC1080_DEBUG_LEVEL
+    #define HDC1080_DEBUG_LEVEL HDC1080_DEBUG_LEVEL_TEXT
+#endif
+
+/**
+ * @brief hdc1080 debug message id enumeration definition
+ */
+typedef enum
+{
+    HDC1080_DEBUG_ID_IIC_INIT_NULL                = 0x01,        /**< iic_init is null */
+    HDC1080_DEBUG_ID_IIC_DEINIT_NULL              = 0x02,        /**< iic_deinit is null */
+    HDC1080_DEBUG_ID_IIC_READ_NULL                = 0x03,        /**< iic_read is null */
+    HDC1080_DEBUG_ID_IIC_READ_WITH_WAIT_NULL      = 0x04,        /**< iic_read_with_wait is null */
+    HDC1080_DEBUG_ID_IIC_WRITE_NULL               = 0x05,        /**< iic_write is null */
+    HDC1080_DEBUG_ID_DELAY_MS_NULL                = 0x06,        /**< delay_ms is null */
+    HDC1080_DEBUG_ID_IIC_INIT_FAILED              = 0x07,        /**< iic init failed */
+    HDC1080_DEBUG_ID_IIC_DEINIT_FAILED            = 0x08,        /**< iic deinit failed */
+    HDC1080_DEBUG_ID_READ_MANUFACTURER_ID_FAILED  = 0x09,        /**< read manufacturer id failed */
+    HDC1080_DEBUG_ID_MANUFACTURER_ID_INVALID      = 0x0A,        /**< manufacturer id is invalid, arg is the read id */
+    HDC1080_DEBUG_ID_READ_DEVICE_ID_FAILED        = 0x0B,        /**< read device id failed */
+    HDC1080_DEBUG_ID_DEVICE_ID_INVALID            = 0x0C,        /**< device id is invalid, arg is the read id */
+    HDC1080_DEBUG_ID_READ_CONFIG_FAILED           = 0x0D,        /**< read config failed */
+    HDC1080_DEBUG_ID_WRITE_CONFIG_FAILED          = 0x0E,        /**< write config failed */
+    HDC1080_DEBUG_ID_READ_TEMPERATURE_FAILED      = 0x0F,        /**< read temperature failed */
+    HDC1080_DEBUG_ID_READ_HUMIDITY_FAILED         = 0x10,        /**< read humidity failed */
+    HDC1080_DEBUG_ID_READ_SERIAL_ID_FAILED        = 0x11,        /**< read serial id failed, arg is the serial id register index */
+    HDC1080_DEBUG_ID_IIC_READ_CMD_NULL            = 0x12,        /**< iic_read_cmd is null */
+    HDC1080_DEBUG_ID_START_MEASUREMENT_FAILED     = 0x13,        /**< start measurement failed */
+    HDC1080_DEBUG_ID_FETCH_MEASUREMENT_FAILED     = 0x14,        /**< fetch measurement failed */
+    HDC1080_DEBUG_ID_LOCK_NOT_PAIRED              = 0x15,        /**< lock and unlock are not linked together */
+    HDC1080_DEBUG_ID_BUS_LOCK_NOT_PAIRED          = 0x16,        /**< bus_lock and bus_unlock are not linked together */
+    HDC1080_DEBUG_ID_LOCK_FAILED                  = 0x17,        /**< lock failed */
+    HDC1080_DEBUG_ID_BUS_LOCK_FAILED              = 0x18,        /**< bus lock failed */
+    HDC1080_DEBUG_ID_CONFIG_INVALID               = 0x19,        /**< mode, heater or a resolution is invalid */
+    HDC1080_DEBUG_ID_MODE_INVALID                 = 0x1A,        /**< chip is not in sequence mode */
+} hdc1080_debug_id_t;
+
+/**
+ * @brief hdc1080 debug message text definition
+ */
+#define HDC1080_DEBUG_TEXT_IIC_INIT_NULL                  "hdc1080: iic_init is null.\n"                     /**< iic_init is null text */
+#define HDC1080_DEBUG_TEXT_IIC_DEINIT_NULL                "hdc1080: iic_deinit is null.\n"                   /**< iic_deinit is null text */
+#define HDC1080_DEBUG_TEXT_IIC_READ_NULL                  "hdc1080: iic_read is null.\n"                     /**< iic_read is null text */
+#define HDC1080_DEBUG_TEXT_IIC_READ_WITH_WAIT_NULL        "hdc1080: iic_read_with_wait is null.\n"           /**< iic_read_with_wait is null text */
+#define HDC1080_DEBUG_TEXT_IIC_WRITE_NULL                 "hdc1080: iic_write is null.\n"                    /**< iic_write is null text */
+#define HDC1080_DEBUG_TEXT_DELAY_MS_NULL                  "hdc1080: delay_ms is null.\n"                     /**< delay_ms is null text */
+#define HDC1080_DEBUG_TEXT_IIC_INIT_FAILED                "hdc1080: iic init failed.\n"                      /**< iic init failed text */
+#define HDC1080_DEBUG_TEXT_IIC_DEINIT_FAILED              "hdc1080: iic deinit failed.\n"                    /**< iic deinit failed text */
+#define HDC1080_DEBUG_TEXT_READ_MANUFACTURER_ID_FAILED    "hdc1080: read manufacturer id failed.\n"          /**< read manufacturer id failed text */
+#define HDC1080_DEBUG_TEXT_MANUFACTURER_ID_INVALID        "hdc1080: manufacturer id 0x%04X is invalid.\n"    /**< manufacturer id is invalid text */
+#define HDC1080_DEBUG_TEXT_READ_DEVICE_ID_FAILED          "hdc1080: read device id failed.\n"                /**< read device id failed text */
+#define HDC1080_DEBUG_TEXT_DEVICE_ID_INVALID              "hdc1080: device id 0x%04X is invalid.\n"          /**< device id is invalid text */
+#define HDC1080_DEBUG_TEXT_READ_CONFIG_FAILED             "hdc1080: read config failed.\n"                   /**< read config failed text */
+#define HDC1080_DEBUG_TEXT_WRITE_CONFIG_FAILED            "hdc1080: write config failed.\n"                  /**< write config failed text */
+#define HDC1080_DEBUG_TEXT_READ_TEMPERATURE_FAILED        "hdc1080: read temperature failed.\n"              /**< read temperature failed text */
+#define HDC1080_DEBUG_TEXT_READ_HUMIDITY_FAILED           "hdc1080: read humidity failed.\n"                 /**< read humidity failed text */
+#define HDC1080_DEBUG_TEXT_READ_SERIAL_ID_FAILED          "hdc1080: read serial id %u failed.\n"             /**< read serial id failed text */
+#define HDC1080_DEBUG_TEXT_IIC_READ_CMD_NULL              "hdc1080: iic_read_cmd is null.\n"                 /**< iic_read_cmd is null text */
+#define HDC1080_DEBUG_TEXT_START_MEASUREMENT_FAILED       "hdc1080: start measurement failed.\n"            /**< start measurement failed text */
+#define HDC1080_DEBUG_TEXT_FETCH_MEASUREMENT_FAILED       "hdc1080: fetch measurement failed.\n"            /**< fetch measurement failed text */
+#define HDC1080_DEBUG_TEXT_LOCK_NOT_PAIRED                "hdc1080: lock hooks are not paired.\n"            /**< lock not paired text */
+#define HDC1080_DEBUG_TEXT_BUS_LOCK_NOT_PAIRED            "hdc1080: bus lock hooks are not paired.\n"        /**< bus lock not paired text */
+#define HDC1080_DEBUG_TEXT_LOCK_FAILED                    "hdc1080: lock failed.\n"                          /**< lock failed text */
+#define HDC1080_DEBUG_TEXT_BUS_LOCK_FAILED                "hdc1080: bus lock failed.\n"                      /**< bus lock failed text */
+#define HDC1080_DEBUG_TEXT_CONFIG_INVALID                 "hdc1080: config is invalid.\n"                   /**< config is invalid text */
+#define HDC1080_DEBUG_TEXT_MODE_INVALID                   "hdc1080: mode is not sequence.\n"                /**< mode is invalid text */
+
+/**
+ * @brief hdc1080 conversion definition
+ * @note  temperature = raw / 2^16 * 165C - 40C, humidity = raw / 2^16 * 100%
+ */
+#define HDC1080_RAW_SPAN                  65536.0f         /**< raw code span */
+#define HDC1080_TEMPERATURE_SPAN          165.0f           /**< temperature span in C */
+#define HDC1080_TEMPERATURE_MIN           (-40.0f)         /**< temperature of raw code 0 in C */
+#define HDC1080_HUMIDITY_SPAN             100.0f           /**< humidity span in % */
+
+/**
+ * @brief hdc1080 config register definition
+ */
+#define HDC1080_CONFIG_MASK               0x3700           /**< heater, mode and resolution bits */
+#define HDC1080_CONFIG_DEFAULT            0x1000           /**< config after a reset, sequence mode at 14 bit */
+
+/**
+ * @brief hdc1080 chip definition
+ * @note  shared by the c driver and the header only c++ driver
+ */
+#define HDC1080_ADDRESS                   0x80             /**< iic device address */
+#define HDC1080_REG_TEMPERATURE           0x00             /**< temperature register */
+#define HDC1080_REG_HUMIDITY              0x01             /**< humidity register */
+#define HDC1080_REG_CONFIG                0x02             /**< configuration register */
+#define HDC1080_REG_SERIAL_ID_0           0xFB             /**< serial id 0 register */
+#define HDC1080_REG_SERIAL_ID_1           0xFC             /**< serial id 1 register */
+#define HDC1080_REG_SERIAL_ID_2           0xFD             /**< serial id 2 register */
+#define HDC1080_REG_MANUFACTURER_ID       0xFE             /**< manufacturer id register */
+#define HDC1080_REG_DEVICE_ID             0xFF             /**< device id register */
+#define HDC1080_MANUFACTURER_ID           0x5449           /**< manufacturer id */
+#define HDC1080_DEVICE_ID                 0x1050           /**< device id */
+
+/**
+ * @brief hdc1080 conversion time definition
+ * @note  typical datasheet values, a sequence measurement takes the sum of both
+ */
+#define HDC1080_TEMPERATURE_14_BIT_US     6350             /**< 14 bit temperature conversion time in us */
+#define HDC1080_TEMPERATURE_11_BIT_US     3650             /**< 11 bit temperature conversion time in us */
+#define HDC1080_HUMIDITY_14_BIT_US        6500             /**< 14 bit humidity conversion time in us */
+#define HDC1080_HUMIDITY_11_BIT_US        3850             /**< 11 bit humidity conversion time in us */
+#define HDC1080_HUMIDITY_8_BIT_US         2500             /**< 8 bit humidity conversion time in us */
+
 /**
  * @brief hdc1080 bool enumeration definition
  */
@@ -111,10 +230,17 @@ typedef struct hdc1080_handle_s
     uint8_t (*iic_deinit)(void);                                                       /**< point to an iic_deinit function address */
     uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_read function address */
     uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< point to an iic_write function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                 /**< point to an iic_read_cmd function address */
     uint8_t (*iic_read_with_wait)(uint8_t addr, uint8_t reg,
                                   uint8_t *buf, uint16_t len);                         /**< point to an iic_read_with_wait function address */
     void (*delay_ms)(uint32_t ms);                                                     /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                   /**< point to a debug_print function address */
+    void (*debug_log)(uint8_t id, uint16_t arg);                                       /**< point to a debug_log function address */
+    uint8_t (*lock)(void);                                                             /**< point to an optional lock function address */
+    void (*unlock)(void);                                                              /**< point to an optional unlock function address */
+    uint8_t (*bus_lock)(void);                                                         /**< point to an optional bus_lock function address */
+    void (*bus_unlock)(void);                                                          /**< point to an optional bus_unlock function address */
+    uint16_t config;                                                                   /**< config register shadow */
     uint8_t inited;                                                                    /**< inited flag */
 } hdc1080_handle_t;
 
@@ -193,6 +319,15 @@ typedef struct hdc1080_info_s
  */
 #define DRIVER_HDC1080_LINK_IIC_WRITE(HANDLE, FUC)             (HANDLE)->iic_write = FUC
 
+/**
+ * @brief     link iic_read_cmd function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd function address
+ * @note      optional, it is needed by hdc1080_start_temperature_humidity,
+ *            hdc1080_fetch_temperature_humidity and a linked bus_lock
+ */
+#define DRIVER_HDC1080_LINK_IIC_READ_CMD(HANDLE, FUC)          (HANDLE)->iic_read_cmd = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to an hdc1080 handle structure
@@ -209,6 +344,46 @@ typedef struct hdc1080_info_s
  */
 #define DRIVER_HDC1080_LINK_DEBUG_PRINT(HANDLE, FUC)           (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link debug_log function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to a debug_log function address
+ * @note      only used when HDC1080_DEBUG_LEVEL is HDC1080_DEBUG_LEVEL_BINARY
+ */
+#define DRIVER_HDC1080_LINK_DEBUG_LOG(HANDLE, FUC)             (HANDLE)->debug_log = FUC
+
+/**
+ * @brief     link lock function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to a lock function address
+ * @note      optional, it is held across one whole api call so that several threads can share the handle
+ */
+#define DRIVER_HDC1080_LINK_LOCK(HANDLE, FUC)                  (HANDLE)->lock = FUC
+
+/**
+ * @brief     link unlock function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to an unlock function address
+ * @note      optional, it must be linked together with lock
+ */
+#define DRIVER_HDC1080_LINK_UNLOCK(HANDLE, FUC)                (HANDLE)->unlock = FUC
+
+/**
+ * @brief     link bus_lock function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to a bus_lock function address
+ * @note      optional, it is held across one bus transaction and released during the conversion wait
+ */
+#define DRIVER_HDC1080_LINK_BUS_LOCK(HANDLE, FUC)              (HANDLE)->bus_lock = FUC
+
+/**
+ * @brief     link bus_unlock function
+ * @param[in] HANDLE pointer to an hdc1080 handle structure
+ * @param[in] FUC pointer to a bus_unlock function address
+ * @note      optional, it must be linked together with bus_lock
+ */
+#define DRIVER_HDC1080_LINK_BUS_UNLOCK(HANDLE, FUC)            (HANDLE)->bus_unlock = FUC
+
 /**
  * @}
  */
@@ -245,6 +420,31 @@ uint8_t hdc1080_info(hdc1080_info_t *info);
  */
 uint8_t hdc1080_init(hdc1080_handle_t *handle);
 
+/**
+ * @brief      initialize the chip without a reset when it is already configured
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[in]  mode chip mode
+ * @param[in]  heater bool value
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *reset pointer to a bool value buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic init failed
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 read id failed
+ *             - 5 id is invalid
+ *             - 6 reset failed
+ *             - 7 config is invalid
+ * @note       the ids and the config register are read, a chip that still runs the wanted
+ *             configuration after an mcu reset is used as it is, otherwise it is reset and programmed,
+ *             reset is set to HDC1080_BOOL_TRUE when the chip was reset
+ */
+uint8_t hdc1080_init_fast(hdc1080_handle_t *handle, hdc1080_mode_t mode, hdc1080_bool_t heater,
+                          hdc1080_temperature_resolution_t temperature_resolution,
+                          hdc1080_humidity_resolution_t humidity_resolution, hdc1080_bool_t *reset);
+
 /**
  * @brief     close the chip
  * @param[in] *handle pointer to an hdc1080 handle structure
@@ -257,13 +457,30 @@ uint8_t hdc1080_init(hdc1080_handle_t *handle);
  */
 uint8_t hdc1080_deinit(hdc1080_handle_t *handle);
 
+/**
+ * @brief      probe the chip without initializing it
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[out] *id pointer to a serial id buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 no chip answers
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ *             - 4 read serial id failed
+ *             - 5 id is invalid
+ * @note       only the manufacturer id, the device id and the serial id are read, there is no reset,
+ *             iic_init is not called so the bus must be ready, the handle stays uninitialized,
+ *             a missing chip only costs one nacked read and prints no debug message
+ */
+uint8_t hdc1080_probe(hdc1080_handle_t *handle, uint8_t id[6]);
+
 /**
  * @brief      read the temperature and humidity data
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
  * @param[out] *humidity_raw pointer to a raw humidity buffer
- * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read temperature humidity failed
@@ -278,7 +495,7 @@ uint8_t hdc1080_read_temperature_humidity(hdc1080_handle_t *handle, uint16_t *te
  * @brief      read the temperature
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *temperature_raw pointer to a raw temperature buffer
- * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read temperature failed
@@ -292,7 +509,7 @@ uint8_t hdc1080_read_temperature(hdc1080_handle_t *handle, uint16_t *temperature
  * @brief      read the humidity data
  * @param[in]  *handle pointer to an hdc1080 handle structure
  * @param[out] *humidity_raw pointer to a raw humidity buffer
- * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
  * @return     status code
  *             - 0 success
  *             - 1 read humidity failed
@@ -302,6 +519,75 @@ uint8_t hdc1080_read_temperature(hdc1080_handle_t *handle, uint16_t *temperature
  */
 uint8_t hdc1080_read_humidity(hdc1080_handle_t *handle, uint16_t *humidity_raw, float *humidity_s);
 
+/**
+ * @brief     start a temperature and humidity measurement
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measurement failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_cmd is null
+ *            - 5 mode is not sequence
+ * @note      the chip must be in HDC1080_MODE_SEQUENCE,
+ *            call hdc1080_fetch_temperature_humidity after the conversion time
+ */
+uint8_t hdc1080_start_temperature_humidity(hdc1080_handle_t *handle);
+
+/**
+ * @brief      fetch the temperature and humidity measurement
+ * @param[in]  *handle pointer to an hdc1080 handle structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer, it may be NULL
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch measurement failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 iic_read_cmd is null
+ *             - 5 mode is not sequence
+ * @note       the chip does not acknowledge the read before the conversion is finished
+ */
+uint8_t hdc1080_fetch_temperature_humidity(hdc1080_handle_t *handle, uint16_t *temperature_raw, float *temperature_s,
+                                           uint16_t *humidity_raw, float *humidity_s);
+
+/**
+ * @brief      get the conversion time
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *temperature_us pointer to a temperature conversion time buffer
+ * @param[out] *humidity_us pointer to a humidity conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 resolution is invalid
+ * @note       typical datasheet values, a sequence measurement takes the sum of both
+ */
+uint8_t hdc1080_get_conversion_time(hdc1080_temperature_resolution_t temperature_resolution,
+                                    hdc1080_humidity_resolution_t humidity_resolution,
+                                    uint32_t *temperature_us, uint32_t *humidity_us);
+
+/**
+ * @brief      convert the raw temperature to the real temperature
+ * @param[in]  raw raw temperature
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ * @note       temperature = raw / 2^16 * 165C - 40C
+ */
+uint8_t hdc1080_temperature_convert_to_data(uint16_t raw, float *temperature_s);
+
+/**
+ * @brief      convert the raw humidity to the real humidity
+ * @param[in]  raw raw humidity
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ * @note       humidity = raw / 2^16 * 100%
+ */
+uint8_t hdc1080_humidity_convert_to_data(uint16_t raw, float *humidity_s);
+
 /**
  * @brief     software reset
  * @param[in] *handle pointer to an hdc1080 handle structure
@@ -465,7 +751,7 @@ uint8_t hdc1080_get_serial_id(hdc1080_handle_t *handle, uint8_t id[6]);
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      a write to the config register updates the config shadow
  */
 uint8_t hdc1080_set_reg(hdc1080_handle_t *handle, uint8_t reg, uint16_t data);
 
@@ -0,0 +1,564 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080.hpp
+ * @brief     driver hdc1080 c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_HPP
+#define DRIVER_HDC1080_HPP
+
+#include "driver_hdc1080.h"
+#include <array>
+
+/**
+ * @defgroup hdc1080_cpp_driver hdc1080 c++ driver function
+ * @brief    hdc1080 header only c++17 driver modules
+ * @ingroup  hdc1080_driver
+ * @note     it reimplements the bus protocol of driver_hdc1080.c instead of wrapping it, so the compile time
+ *           config and the BUS policy inline without a handle, the chip constants come from driver_hdc1080.h
+ *           and a protocol change must be made in both drivers
+ * @{
+ */
+
+namespace hdc1080
+{
+
+/**
+ * @brief hdc1080 c++ fetch definition
+ * @note  the chip address, registers, ids and conversion times come from driver_hdc1080.h
+ */
+constexpr uint8_t FETCH_RETRY = 3;        /**< fetch retry times after the conversion time */
+
+/**
+ * @brief hdc1080 c++ compile time configuration definition
+ * @note  the config word and the conversion time are constants, nothing of it is stored in the device
+ */
+template <hdc1080_mode_t MODE = HDC1080_MODE_SEQUENCE,
+          hdc1080_temperature_resolution_t TEMPERATURE_RESOLUTION = HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+          hdc1080_humidity_resolution_t HUMIDITY_RESOLUTION = HDC1080_HUMIDITY_RESOLUTION_14_BIT,
+          hdc1080_bool_t HEATER = HDC1080_BOOL_FALSE>
+struct config
+{
+    static_assert((MODE == HDC1080_MODE_OR) || (MODE == HDC1080_MODE_SEQUENCE), "mode is invalid");
+    static_assert((TEMPERATURE_RESOLUTION == HDC1080_TEMPERATURE_RESOLUTION_14_BIT) ||
+                  (TEMPERATURE_RESOLUTION == HDC1080_TEMPERATURE_RESOLUTION_11_BIT), "temperature resolution is invalid");
+    static_assert((HUMIDITY_RESOLUTION == HDC1080_HUMIDITY_RESOLUTION_14_BIT) ||
+                  (HUMIDITY_RESOLUTION == HDC1080_HUMIDITY_RESOLUTION_11_BIT) ||
+                  (HUMIDITY_RESOLUTION == HDC1080_HUMIDITY_RESOLUTION_8_BIT), "humidity resolution is invalid");
+    
+    static constexpr hdc1080_mode_t mode = MODE;                                                          /**< chip mode */
+    static constexpr hdc1080_temperature_resolution_t temperature_resolution = TEMPERATURE_RESOLUTION;    /**< temperature resolution */
+    static constexpr hdc1080_humidity_resolution_t humidity_resolution = HUMIDITY_RESOLUTION;             /**< humidity resolution */
+    static constexpr hdc1080_bool_t heater = HEATER;                                                      /**< heater */
+    static constexpr uint16_t word = (uint16_t)((HEATER << 13) | (MODE << 12) |
+                                                (TEMPERATURE_RESOLUTION << 10) | (HUMIDITY_RESOLUTION << 8));    /**< config register */
+    static constexpr uint32_t temperature_us =
+        (TEMPERATURE_RESOLUTION == HDC1080_TEMPERATURE_RESOLUTION_14_BIT) ?
+        HDC1080_TEMPERATURE_14_BIT_US : HDC1080_TEMPERATURE_11_BIT_US;                                    /**< temperature conversion time */
+    static constexpr uint32_t humidity_us =
+        (HUMIDITY_RESOLUTION == HDC1080_HUMIDITY_RESOLUTION_14_BIT) ? HDC1080_HUMIDITY_14_BIT_US :
+        ((HUMIDITY_RESOLUTION == HDC1080_HUMIDITY_RESOLUTION_11_BIT) ?
+         HDC1080_HUMIDITY_11_BIT_US : HDC1080_HUMIDITY_8_BIT_US);                                         /**< humidity conversion time */
+    static constexpr uint32_t temperature_ms = (temperature_us + 999) / 1000;                             /**< rounded temperature wait */
+    static constexpr uint32_t humidity_ms = (humidity_us + 999) / 1000;                                   /**< rounded humidity wait */
+    static constexpr uint32_t sequence_ms = (temperature_us + humidity_us + 999) / 1000;                  /**< rounded sequence wait */
+    static constexpr uint32_t read_ms = (MODE == HDC1080_MODE_SEQUENCE) ? sequence_ms :
+                                        (temperature_ms + humidity_ms);                                   /**< wait of one read */
+    
+    static_assert((word & ~HDC1080_CONFIG_MASK) == 0, "config word sets a read only bit");
+};
+
+/**
+ * @brief hdc1080 c++ result definition
+ * @note  status uses the codes of the c driver, value is only valid with status 0
+ */
+template <typename T>
+struct result
+{
+    uint8_t status;        /**< status code */
+    T value;               /**< result value */
+    
+    /**
+     * @brief  check the status
+     * @return true on success
+     * @note   none
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        return status == 0;        /* check the status */
+    }
+};
+
+/**
+ * @brief hdc1080 c++ sample definition
+ */
+struct sample
+{
+    uint16_t temperature_raw;        /**< raw temperature */
+    uint16_t humidity_raw;           /**< raw humidity */
+    float temperature;               /**< converted temperature in C */
+    float humidity;                  /**< converted humidity in % */
+};
+
+/**
+ * @brief     convert a raw temperature
+ * @param[in] raw raw temperature
+ * @return    temperature in C
+ * @note      same as the c driver
+ */
+constexpr float convert_temperature(uint16_t raw) noexcept
+{
+    return (float)raw / HDC1080_RAW_SPAN * HDC1080_TEMPERATURE_SPAN + HDC1080_TEMPERATURE_MIN;        /* convert temperature */
+}
+
+/**
+ * @brief     convert a raw humidity
+ * @param[in] raw raw humidity
+ * @return    humidity in %
+ * @note      same as the c driver
+ */
+constexpr float convert_humidity(uint16_t raw) noexcept
+{
+    return (float)raw / HDC1080_RAW_SPAN * HDC1080_HUMIDITY_SPAN;        /* convert humidity */
+}
+
+/**
+ * @brief hdc1080 c++ device definition
+ * @note  BUS is a policy with the static functions init, deinit, read, write, read_cmd and delay_ms of the
+ *        hdc1080_interface signatures, they are called directly and inline into the device,
+ *        the constructor initializes the chip with the CONFIG word and the destructor closes the bus
+ */
+template <typename BUS, typename CONFIG = config<>>
+class device
+{
+    public:
+        /**
+         * @brief construct and initialize the chip
+         * @note  check status() or the bool operator before use
+         */
+        device() noexcept : m_status(a_init())
+        {
+        }
+        
+        /**
+         * @brief close the bus
+         * @note  none
+         */
+        ~device()
+        {
+            if (m_status == 0)              /* check the init status */
+            {
+                (void)BUS::deinit();        /* iic deinit */
+            }
+        }
+        
+        device(const device &) = delete;
+        device &operator=(const device &) = delete;
+        
+        /**
+         * @brief  get the init status
+         * @return status code
+         *         - 0 success
+         *         - 1 iic init failed
+         *         - 4 read id failed
+         *         - 5 id is invalid
+         *         - 6 reset or config failed
+         * @note   none
+         */
+        uint8_t status() const noexcept
+        {
+            return m_status;        /* return the init status */
+        }
+        
+        /**
+         * @brief  check the init status
+         * @return true if the chip is ready
+         * @note   none
+         */
+        explicit operator bool() const noexcept
+        {
+            return m_status == 0;        /* check the init status */
+        }
+        
+        /**
+         * @brief  get the chip mode
+         * @return chip mode
+         * @note   known at compile time, no bus access
+         */
+        static constexpr hdc1080_mode_t mode() noexcept
+        {
+            return CONFIG::mode;        /* constant */
+        }
+        
+        /**
+         * @brief  get the temperature resolution
+         * @return temperature resolution
+         * @note   known at compile time, no bus access
+         */
+        static constexpr hdc1080_temperature_resolution_t temperature_resolution() noexcept
+        {
+            return CONFIG::temperature_resolution;        /* constant */
+        }
+        
+        /**
+         * @brief  get the humidity resolution
+         * @return humidity resolution
+         * @note   known at compile time, no bus access
+         */
+        static constexpr hdc1080_humidity_resolution_t humidity_resolution() noexcept
+        {
+            return CONFIG::humidity_resolution;        /* constant */
+        }
+        
+        /**
+         * @brief  get the heater
+         * @return heater status
+         * @note   known at compile time, no bus access
+         */
+        static constexpr hdc1080_bool_t heater() noexcept
+        {
+            return CONFIG::heater;        /* constant */
+        }
+        
+        /**
+         * @brief  get the wait of one read
+         * @return wait in ms
+         * @note   known at compile time, no bus access
+         */
+        static constexpr uint32_t conversion_ms() noexcept
+        {
+            return CONFIG::read_ms;        /* constant */
+        }
+        
+        /**
+         * @brief  read the temperature and humidity
+         * @return sample with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 3 handle is not initialized
+         * @note   the sequence mode takes one trigger and one fetch, the or mode converts both channels one by one
+         */
+        result<sample> read() noexcept
+        {
+            result<sample> r = {3, {}};
+            uint8_t buf[4];
+            
+            if (m_status != 0)                                                                            /* check the init status */
+            {
+                return r;                                                                                 /* return error */
+            }
+            
+            if constexpr (CONFIG::mode == HDC1080_MODE_SEQUENCE)                                          /* resolved at compile time */
+            {
+                r.status = a_convert(HDC1080_REG_TEMPERATURE, CONFIG::sequence_ms, buf, 4);               /* convert both in one sequence */
+            }
+            else
+            {
+                r.status = a_convert(HDC1080_REG_TEMPERATURE, CONFIG::temperature_ms, &buf[0], 2);        /* convert temperature */
+                if (r.status == 0)                                                                        /* check result */
+                {
+                    r.status = a_convert(HDC1080_REG_HUMIDITY, CONFIG::humidity_ms, &buf[2], 2);          /* convert humidity */
+                }
+            }
+            if (r.status != 0)                                                                            /* check result */
+            {
+                return r;                                                                                 /* return error */
+            }
+            r.value.temperature_raw = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);                         /* get raw temperature */
+            r.value.humidity_raw = (uint16_t)((uint16_t)buf[2] << 8 | buf[3]);                            /* get raw humidity */
+            r.value.temperature = convert_temperature(r.value.temperature_raw);                           /* convert temperature */
+            r.value.humidity = convert_humidity(r.value.humidity_raw);                                    /* convert humidity */
+            
+            return r;                                                                                     /* return the sample */
+        }
+        
+        /**
+         * @brief  read the temperature
+         * @return temperature in C with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 3 handle is not initialized
+         * @note   only in HDC1080_MODE_OR
+         */
+        result<float> read_temperature() noexcept
+        {
+            static_assert(CONFIG::mode == HDC1080_MODE_OR, "a single channel needs HDC1080_MODE_OR");           /* check the mode */
+            
+            return a_read_channel(HDC1080_REG_TEMPERATURE, CONFIG::temperature_ms, convert_temperature);        /* read temperature */
+        }
+        
+        /**
+         * @brief  read the humidity
+         * @return humidity in % with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 3 handle is not initialized
+         * @note   only in HDC1080_MODE_OR
+         */
+        result<float> read_humidity() noexcept
+        {
+            static_assert(CONFIG::mode == HDC1080_MODE_OR, "a single channel needs HDC1080_MODE_OR");        /* check the mode */
+            
+            return a_read_channel(HDC1080_REG_HUMIDITY, CONFIG::humidity_ms, convert_humidity);              /* read humidity */
+        }
+        
+        /**
+         * @brief  get the battery status
+         * @return battery status with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 3 handle is not initialized
+         * @note   the only config bit set by the chip, so it is the only one read back
+         */
+        result<hdc1080_battery_status_t> battery_status() noexcept
+        {
+            result<hdc1080_battery_status_t> r = {3, HDC1080_BATTERY_STATUS_OVER_2P8_V};
+            uint16_t data;
+            
+            if (m_status != 0)                                               /* check the init status */
+            {
+                return r;                                                    /* return error */
+            }
+            
+            r.status = a_read(HDC1080_REG_CONFIG, &data);                    /* read config */
+            r.value = (hdc1080_battery_status_t)((data >> 11) & 0x1);        /* get the status */
+            
+            return r;                                                        /* return the status */
+        }
+        
+        /**
+         * @brief  get the serial id
+         * @return serial id with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 3 handle is not initialized
+         * @note   none
+         */
+        result<std::array<uint8_t, 6>> serial_id() noexcept
+        {
+            result<std::array<uint8_t, 6>> r = {3, {}};
+            uint16_t data;
+            uint8_t i;
+            
+            if (m_status != 0)                                                           /* check the init status */
+            {
+                return r;                                                                /* return error */
+            }
+            
+            for (i = 0; i < 3; i++)                                                      /* three registers */
+            {
+                r.status = a_read((uint8_t)(HDC1080_REG_SERIAL_ID_0 + i), &data);        /* read serial id */
+                if (r.status != 0)                                                       /* check result */
+                {
+                    return r;                                                            /* return error */
+                }
+                r.value[i * 2 + 0] = (uint8_t)((data >> 8) & 0xFF);                      /* msb */
+                r.value[i * 2 + 1] = (uint8_t)((data >> 0) & 0xFF);                      /* lsb */
+            }
+            
+            return r;                                                                    /* return the serial id */
+        }
+        
+    private:
+        /**
+         * @brief      read a register
+         * @param[in]  reg register address
+         * @param[out] *data pointer to a data buffer
+         * @return     status code
+         *             - 0 success
+         *             - 1 read failed
+         * @note       none
+         */
+        static uint8_t a_read(uint8_t reg, uint16_t *data) noexcept
+        {
+            uint8_t buf[2];
+            
+            if (BUS::read(HDC1080_ADDRESS, reg, buf, 2) != 0)        /* read the register */
+            {
+                *data = 0;
+                
+                return 1;                                            /* return error */
+            }
+            *data = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);
+            
+            return 0;                                                /* success return 0 */
+        }
+        
+        /**
+         * @brief     write a register
+         * @param[in] reg register address
+         * @param[in] data written data
+         * @return    status code
+         *            - 0 success
+         *            - 1 write failed
+         * @note      none
+         */
+        static uint8_t a_write(uint8_t reg, uint16_t data) noexcept
+        {
+            uint8_t buf[2];
+            
+            buf[0] = (uint8_t)((data >> 8) & 0xFF);                                /* msb */
+            buf[1] = (uint8_t)((data >> 0) & 0xFF);                                /* lsb */
+            
+            return (BUS::write(HDC1080_ADDRESS, reg, buf, 2) != 0) ? 1 : 0;        /* write the register */
+        }
+        
+        /**
+         * @brief      trigger a conversion and fetch it
+         * @param[in]  reg triggered register
+         * @param[in]  wait_ms conversion time in ms
+         * @param[out] *buf pointer to a data buffer
+         * @param[in]  len fetched length
+         * @return     status code
+         *             - 0 success
+         *             - 1 read failed
+         * @note       the chip naks a fetch before the conversion is finished, it is retried every ms
+         */
+        static uint8_t a_convert(uint8_t reg, uint32_t wait_ms, uint8_t *buf, uint16_t len) noexcept
+        {
+            uint8_t i;
+            
+            if (BUS::write(HDC1080_ADDRESS, reg, nullptr, 0) != 0)        /* write the pointer to trigger */
+            {
+                return 1;                                                 /* return error */
+            }
+            BUS::delay_ms(wait_ms);                                       /* wait the conversion time */
+            for (i = 0; i < FETCH_RETRY; i++)                             /* retry the fetch */
+            {
+                if (BUS::read_cmd(HDC1080_ADDRESS, buf, len) == 0)        /* fetch the result */
+                {
+                    return 0;                                             /* fetched */
+                }
+                BUS::delay_ms(1);                                         /* delay 1ms */
+            }
+            
+            return 1;                                                     /* return error */
+        }
+        
+        /**
+         * @brief     read one channel
+         * @param[in] reg triggered register
+         * @param[in] wait_ms conversion time in ms
+         * @param[in] *convert pointer to a conversion function
+         * @return    converted value with status
+         * @note      none
+         */
+        result<float> a_read_channel(uint8_t reg, uint32_t wait_ms, float (*convert)(uint16_t) noexcept) noexcept
+        {
+            result<float> r = {3, 0.0f};
+            uint8_t buf[2];
+            
+            if (m_status != 0)                                                        /* check the init status */
+            {
+                return r;                                                             /* return error */
+            }
+            
+            r.status = a_convert(reg, wait_ms, buf, 2);                               /* convert the channel */
+            if (r.status == 0)                                                        /* check result */
+            {
+                r.value = convert((uint16_t)((uint16_t)buf[0] << 8 | buf[1]));        /* convert the value */
+            }
+            
+            return r;                                                                 /* return the value */
+        }
+        
+        /**
+         * @brief  initialize the chip
+         * @return status code
+         *         - 0 success
+         *         - 1 iic init failed
+         *         - 4 read id failed
+         *         - 5 id is invalid
+         *         - 6 reset or config failed
+         * @note   the reset and the config are written without reading the config first,
+         *         every bit of it is known at compile time
+         */
+        static uint8_t a_init() noexcept
+        {
+            uint16_t id;
+            
+            if (BUS::init() != 0)                                      /* iic init */
+            {
+                return 1;                                              /* return error */
+            }
+            if (a_read(HDC1080_REG_MANUFACTURER_ID, &id) != 0)         /* read manufacturer id */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 4;                                              /* return error */
+            }
+            if (id != HDC1080_MANUFACTURER_ID)                         /* check id */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 5;                                              /* return error */
+            }
+            if (a_read(HDC1080_REG_DEVICE_ID, &id) != 0)               /* read device id */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 4;                                              /* return error */
+            }
+            if (id != HDC1080_DEVICE_ID)                               /* check id */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 5;                                              /* return error */
+            }
+            if (a_write(HDC1080_REG_CONFIG, 1 << 15) != 0)             /* software reset */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 6;                                              /* return error */
+            }
+            BUS::delay_ms(100);                                        /* delay 100ms */
+            if (a_write(HDC1080_REG_CONFIG, CONFIG::word) != 0)        /* write the compile time config */
+            {
+                (void)BUS::deinit();                                   /* iic deinit */
+                
+                return 6;                                              /* return error */
+            }
+            
+            return 0;                                                  /* success return 0 */
+        }
+        
+        uint8_t m_status;        /**< init status */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_adaptive.c
+ * @brief     driver hdc1080 adaptive source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_adaptive.h"
+
+/**
+ * @brief adaptive decay of the rate of change, 1/4 per sample
+ */
+#define HDC1080_ADAPTIVE_DECAY        0.25f
+
+/**
+ * @brief adaptive share of the budget for the change between two samples, the rest is for the quantization
+ */
+#define HDC1080_ADAPTIVE_TRACKING     0.75f
+
+/**
+ * @brief     update the rate of one channel
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] raw raw code
+ * @param[in] dt_ms time since the last sample in ms
+ * @note      a quantization flip after a long period is a small rate, so it barely shortens the period
+ */
+static void a_hdc1080_adaptive_rate(hdc1080_adaptive_channel_t *channel, uint16_t raw, uint32_t dt_ms)
+{
+    float diff;
+    float rate;
+    
+    diff = (float)raw - (float)channel->last;                                    /* change since the last sample */
+    if (diff < 0.0f)                                                             /* check the sign */
+    {
+        diff = -diff;                                                            /* absolute value */
+    }
+    rate = diff / (float)dt_ms;                                                  /* rate in raw code per ms */
+    if (rate > channel->rate)                                                    /* rising */
+    {
+        channel->rate = rate;                                                    /* follow at once */
+    }
+    else
+    {
+        channel->rate += (rate - channel->rate) * HDC1080_ADAPTIVE_DECAY;        /* decay slowly */
+    }
+    channel->last = raw;                                                         /* save the raw code */
+}
+
+/**
+ * @brief     get the period one channel allows
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] max_period_ms max period in ms
+ * @return    period in ms
+ * @note      none
+ */
+static float a_hdc1080_adaptive_period(const hdc1080_adaptive_channel_t *channel, uint32_t max_period_ms)
+{
+    float budget;
+    
+    budget = channel->budget * HDC1080_ADAPTIVE_TRACKING;        /* tracking share */
+    if (channel->rate * (float)max_period_ms <= budget)          /* slow enough for the max period */
+    {
+        return (float)max_period_ms;                             /* max period */
+    }
+    
+    return budget / channel->rate;                               /* budget over rate */
+}
+
+/**
+ * @brief     set the coarsest step that fits the budget left over
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] period_ms next period in ms
+ * @param[in] humidity 1 for the humidity channel, 0 for the temperature channel
+ * @note      the step is 4 for 14 bit, 32 for 11 bit and 256 for 8 bit, the temperature has no 8 bit resolution
+ */
+static void a_hdc1080_adaptive_step(hdc1080_adaptive_channel_t *channel, uint32_t period_ms, uint8_t humidity)
+{
+    float left;
+    
+    left = channel->budget - channel->rate * (float)period_ms;        /* budget left over by the change */
+    if ((humidity != 0) && (left >= 256.0f))                          /* 8 bit fits */
+    {
+        channel->step = 256;                                          /* 8 bit */
+        
+        return;                                                       /* done */
+    }
+    if (left >= 32.0f)                                                /* 11 bit fits */
+    {
+        channel->step = 32;                                           /* 11 bit */
+        
+        return;                                                       /* done */
+    }
+    
+    channel->step = 4;                                                /* 14 bit */
+}
+
+/**
+ * @brief     initialize the adaptive controller
+ * @param[in] *adaptive pointer to an adaptive structure
+ * @param[in] min_period_ms min sample period in ms
+ * @param[in] max_period_ms max sample period in ms
+ * @param[in] temperature_budget temperature error budget in C
+ * @param[in] humidity_budget humidity error budget in %
+ * @param[in] resolution HDC1080_BOOL_TRUE to adapt the resolution too
+ * @return    status code
+ *            - 0 success
+ *            - 2 adaptive is NULL
+ *            - 4 param is invalid
+ * @note      the budget is the largest change between two samples that may go unseen, plus the quantization error
+ */
+uint8_t hdc1080_adaptive_init(hdc1080_adaptive_t *adaptive, uint32_t min_period_ms, uint32_t max_period_ms,
+                              float temperature_budget, float humidity_budget, hdc1080_bool_t resolution)
+{
+    if (adaptive == NULL)                                                                                   /* check adaptive */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if ((min_period_ms == 0) || (max_period_ms < min_period_ms) ||
+        (temperature_budget <= 0.0f) || (humidity_budget <= 0.0f))                                          /* check the params */
+    {
+        return 4;                                                                                           /* return error */
+    }
+    
+    memset(adaptive, 0, sizeof(hdc1080_adaptive_t));                                                        /* clear all */
+    adaptive->temperature.budget = temperature_budget * HDC1080_RAW_SPAN / HDC1080_TEMPERATURE_SPAN;        /* temperature budget in raw code */
+    adaptive->humidity.budget = humidity_budget * HDC1080_RAW_SPAN / HDC1080_HUMIDITY_SPAN;                 /* humidity budget in raw code */
+    adaptive->temperature.step = 4;                                                                         /* start with 14 bit */
+    adaptive->humidity.step = 4;                                                                            /* start with 14 bit */
+    adaptive->min_period_ms = min_period_ms;                                                                /* set the min period */
+    adaptive->max_period_ms = max_period_ms;                                                                /* set the max period */
+    adaptive->period_ms = min_period_ms;                                                                    /* start with the min period */
+    adaptive->resolution = (resolution == HDC1080_BOOL_TRUE) ? 1 : 0;                                       /* set the resolution flag */
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      update the controller with a sample
+ * @param[in]  *adaptive pointer to an adaptive structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *decision pointer to a decision buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 adaptive or decision is NULL
+ * @note       the rate of change rises at once and decays slowly, the period is the budget divided by the rate,
+ *             clamped to the min and max period and at most doubled per sample, with the resolution enabled the
+ *             coarsest resolution whose step fits in the budget left over by the expected change is chosen,
+ *             else both resolutions are 14 bit
+ */
+uint8_t hdc1080_adaptive_update(hdc1080_adaptive_t *adaptive, uint32_t timestamp_ms, uint16_t temperature_raw,
+                                uint16_t humidity_raw, hdc1080_adaptive_decision_t *decision)
+{
+    uint32_t dt_ms;
+    uint32_t limit;
+    float period;
+    float period_h;
+    
+    if ((adaptive == NULL) || (decision == NULL))                                                   /* check adaptive */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    if (adaptive->started == 0)                                                                     /* first sample */
+    {
+        adaptive->temperature.last = temperature_raw;                                               /* set temperature */
+        adaptive->humidity.last = humidity_raw;                                                     /* set humidity */
+        adaptive->started = 1;                                                                      /* set started */
+    }
+    else
+    {
+        dt_ms = timestamp_ms - adaptive->last_ms;                                                   /* time since the last sample */
+        if (dt_ms == 0)                                                                             /* same tick */
+        {
+            dt_ms = 1;                                                                              /* at least 1ms */
+        }
+        a_hdc1080_adaptive_rate(&adaptive->temperature, temperature_raw, dt_ms);                    /* temperature rate */
+        a_hdc1080_adaptive_rate(&adaptive->humidity, humidity_raw, dt_ms);                          /* humidity rate */
+        
+        period = a_hdc1080_adaptive_period(&adaptive->temperature, adaptive->max_period_ms);        /* temperature period */
+        period_h = a_hdc1080_adaptive_period(&adaptive->humidity, adaptive->max_period_ms);         /* humidity period */
+        if (period_h < period)                                                                      /* the faster channel wins */
+        {
+            period = period_h;                                                                      /* humidity period */
+        }
+        limit = adaptive->max_period_ms;                                                            /* max period */
+        if (adaptive->period_ms < limit / 2)                                                        /* check the growth */
+        {
+            limit = adaptive->period_ms * 2;                                                        /* at most double */
+        }
+        if (period >= (float)limit)                                                                 /* check the upper limit */
+        {
+            adaptive->period_ms = limit;                                                            /* clamp */
+        }
+        else if (period <= (float)adaptive->min_period_ms)                                          /* check the lower limit */
+        {
+            adaptive->period_ms = adaptive->min_period_ms;                                          /* clamp */
+        }
+        else
+        {
+            adaptive->period_ms = (uint32_t)period;                                                 /* set the period */
+        }
+        
+        if (adaptive->resolution != 0)                                                              /* adapt the resolution */
+        {
+            a_hdc1080_adaptive_step(&adaptive->temperature, adaptive->period_ms, 0);                /* temperature step */
+            a_hdc1080_adaptive_step(&adaptive->humidity, adaptive->period_ms, 1);                   /* humidity step */
+        }
+    }
+    adaptive->last_ms = timestamp_ms;                                                               /* save the time */
+    adaptive->samples++;                                                                            /* samples + 1 */
+    
+    decision->period_ms = adaptive->period_ms;                                                      /* set the period */
+    if (adaptive->temperature.step == 32)                                                           /* 11 bit */
+    {
+        decision->temperature_resolution = HDC1080_TEMPERATURE_RESOLUTION_11_BIT;                   /* set 11 bit */
+    }
+    else
+    {
+        decision->temperature_resolution = HDC1080_TEMPERATURE_RESOLUTION_14_BIT;                   /* set 14 bit */
+    }
+    if (adaptive->humidity.step == 256)                                                             /* 8 bit */
+    {
+        decision->humidity_resolution = HDC1080_HUMIDITY_RESOLUTION_8_BIT;                          /* set 8 bit */
+    }
+    else if (adaptive->humidity.step == 32)                                                         /* 11 bit */
+    {
+        decision->humidity_resolution = HDC1080_HUMIDITY_RESOLUTION_11_BIT;                         /* set 11 bit */
+    }
+    else
+    {
+        decision->humidity_resolution = HDC1080_HUMIDITY_RESOLUTION_14_BIT;                         /* set 14 bit */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
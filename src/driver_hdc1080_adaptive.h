@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_adaptive.h
+ * @brief     driver hdc1080 adaptive header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_ADAPTIVE_H
+#define DRIVER_HDC1080_ADAPTIVE_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_adaptive_driver hdc1080 adaptive driver function
+ * @brief    hdc1080 adaptive sampling driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 adaptive channel structure definition
+ */
+typedef struct hdc1080_adaptive_channel_s
+{
+    float budget;         /**< error budget in raw code */
+    float rate;           /**< smoothed rate of change in raw code per ms */
+    uint16_t last;        /**< last raw code */
+    uint16_t step;        /**< code step of the chosen resolution */
+} hdc1080_adaptive_channel_t;
+
+/**
+ * @brief hdc1080 adaptive structure definition
+ */
+typedef struct hdc1080_adaptive_s
+{
+    hdc1080_adaptive_channel_t temperature;        /**< temperature channel */
+    hdc1080_adaptive_channel_t humidity;           /**< humidity channel */
+    uint32_t min_period_ms;                        /**< min sample period in ms */
+    uint32_t max_period_ms;                        /**< max sample period in ms */
+    uint32_t period_ms;                            /**< current sample period in ms */
+    uint32_t last_ms;                              /**< last sample time in ms */
+    uint32_t samples;                              /**< sample number */
+    uint8_t resolution;                            /**< adapt the resolution flag */
+    uint8_t started;                               /**< started flag */
+} hdc1080_adaptive_t;
+
+/**
+ * @brief hdc1080 adaptive decision structure definition
+ */
+typedef struct hdc1080_adaptive_decision_s
+{
+    uint32_t period_ms;                                          /**< time to the next sample in ms */
+    hdc1080_temperature_resolution_t temperature_resolution;     /**< temperature resolution of the next sample */
+    hdc1080_humidity_resolution_t humidity_resolution;           /**< humidity resolution of the next sample */
+} hdc1080_adaptive_decision_t;
+
+/**
+ * @brief     initialize the adaptive controller
+ * @param[in] *adaptive pointer to an adaptive structure
+ * @param[in] min_period_ms min sample period in ms
+ * @param[in] max_period_ms max sample period in ms
+ * @param[in] temperature_budget temperature error budget in C
+ * @param[in] humidity_budget humidity error budget in %
+ * @param[in] resolution HDC1080_BOOL_TRUE to adapt the resolution too
+ * @return    status code
+ *            - 0 success
+ *            - 2 adaptive is NULL
+ *            - 4 param is invalid
+ * @note      the budget is the largest change between two samples that may go unseen, plus the quantization error
+ */
+uint8_t hdc1080_adaptive_init(hdc1080_adaptive_t *adaptive, uint32_t min_period_ms, uint32_t max_period_ms,
+                              float temperature_budget, float humidity_budget, hdc1080_bool_t resolution);
+
+/**
+ * @brief      update the controller with a sample
+ * @param[in]  *adaptive pointer to an adaptive structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *decision pointer to a decision buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 adaptive or decision is NULL
+ * @note       the rate of change rises at once and decays slowly, the period is the budget divided by the rate,
+ *             clamped to the min and max period and at most doubled per sample, with the resolution enabled the
+ *             coarsest resolution whose step fits in the budget left over by the expected change is chosen,
+ *             else both resolutions are 14 bit
+ */
+uint8_t hdc1080_adaptive_update(hdc1080_adaptive_t *adaptive, uint32_t timestamp_ms, uint16_t temperature_raw,
+                                uint16_t humidity_raw, hdc1080_adaptive_decision_t *decision);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
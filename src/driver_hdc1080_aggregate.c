@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_aggregate.c
+ * @brief     driver hdc1080 aggregate source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_aggregate.h"
+#include <math.h>
+
+/**
+ * @brief     clear a pane
+ * @param[in] *pane pointer to a pane structure
+ * @note      none
+ */
+static void a_hdc1080_aggregate_clear(hdc1080_aggregate_pane_t *pane)
+{
+    memset(pane, 0, sizeof(hdc1080_aggregate_pane_t));        /* clear all */
+}
+
+/**
+ * @brief     add a value to a running statistic
+ * @param[in] *stat pointer to a statistic structure
+ * @param[in] count sample number after the value is added
+ * @param[in] value new value
+ * @note      welford update
+ */
+static void a_hdc1080_aggregate_update(hdc1080_aggregate_stat_t *stat, uint32_t count, float value)
+{
+    float delta;
+    
+    if (count == 1)                                  /* first value */
+    {
+        stat->mean = value;                          /* set the mean */
+        stat->m2 = 0.0f;                             /* no spread */
+        stat->min = value;                           /* set the min */
+        stat->max = value;                           /* set the max */
+        
+        return;                                      /* return */
+    }
+    delta = value - stat->mean;                      /* difference to the old mean */
+    stat->mean += delta / (float)count;              /* update the mean */
+    stat->m2 += delta * (value - stat->mean);        /* update the squared differences */
+    if (value < stat->min)                           /* check the min */
+    {
+        stat->min = value;                           /* set the min */
+    }
+    if (value > stat->max)                           /* check the max */
+    {
+        stat->max = value;                           /* set the max */
+    }
+}
+
+/**
+ * @brief     merge two running statistics
+ * @param[in] *dst pointer to the destination statistic structure
+ * @param[in] dst_count destination sample number
+ * @param[in] *src pointer to the source statistic structure
+ * @param[in] src_count source sample number
+ * @note      chan parallel combination, both counts must not be 0
+ */
+static void a_hdc1080_aggregate_merge(hdc1080_aggregate_stat_t *dst, uint32_t dst_count,
+                                      const hdc1080_aggregate_stat_t *src, uint32_t src_count)
+{
+    float n;
+    float delta;
+    
+    n = (float)dst_count + (float)src_count;                                             /* total number */
+    delta = src->mean - dst->mean;                                                       /* difference of the means */
+    dst->mean += delta * (float)src_count / n;                                           /* combined mean */
+    dst->m2 += src->m2 + delta * delta * (float)dst_count * (float)src_count / n;        /* combined squared differences */
+    if (src->min < dst->min)                                                             /* check the min */
+    {
+        dst->min = src->min;                                                             /* set the min */
+    }
+    if (src->max > dst->max)                                                             /* check the max */
+    {
+        dst->max = src->max;                                                             /* set the max */
+    }
+}
+
+/**
+ * @brief     convert a running statistic to a channel summary
+ * @param[in] *stat pointer to a statistic structure
+ * @param[in] count sample number
+ * @param[in] *channel pointer to a channel summary structure
+ * @note      none
+ */
+static void a_hdc1080_aggregate_channel(const hdc1080_aggregate_stat_t *stat, uint32_t count,
+                                        hdc1080_aggregate_channel_t *channel)
+{
+    channel->min = stat->min;                                                           /* set the min */
+    channel->max = stat->max;                                                           /* set the max */
+    channel->mean = stat->mean;                                                         /* set the mean */
+    channel->stddev = (count > 1) ? sqrtf(stat->m2 / (float)(count - 1)) : 0.0f;        /* sample standard deviation */
+}
+
+/**
+ * @brief      merge the panes of the ring to a summary
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[in]  start_ms window start time in ms
+ * @param[in]  end_ms window end time in ms
+ * @param[out] *summary pointer to a summary structure
+ * @return     1 if the window has samples, else 0
+ * @note       none
+ */
+static uint8_t a_hdc1080_aggregate_emit(hdc1080_aggregate_t *aggregate, uint32_t start_ms, uint32_t end_ms,
+                                        hdc1080_aggregate_summary_t *summary)
+{
+    uint8_t i;
+    hdc1080_aggregate_pane_t window;
+    const hdc1080_aggregate_pane_t *pane;
+    
+    a_hdc1080_aggregate_clear(&window);                                                                           /* clear the window */
+    for (i = 0; i < aggregate->panes; i++)                                                                        /* run all panes */
+    {
+        pane = &aggregate->pane[i];                                                                               /* get the pane */
+        if (pane->count == 0)                                                                                     /* empty pane */
+        {
+            continue;                                                                                             /* skip */
+        }
+        if (window.count == 0)                                                                                    /* first pane */
+        {
+            window = *pane;                                                                                       /* copy */
+        }
+        else
+        {
+            a_hdc1080_aggregate_merge(&window.temperature, window.count, &pane->temperature, pane->count);        /* merge temperature */
+            a_hdc1080_aggregate_merge(&window.humidity, window.count, &pane->humidity, pane->count);              /* merge humidity */
+            window.count += pane->count;                                                                          /* add the number */
+        }
+    }
+    if (window.count == 0)                                                                                        /* no samples */
+    {
+        return 0;                                                                                                 /* return false */
+    }
+    
+    summary->seq = aggregate->seq++;                                                                              /* set the sequence */
+    summary->start_ms = start_ms;                                                                                 /* set the start time */
+    summary->end_ms = end_ms;                                                                                     /* set the end time */
+    summary->count = window.count;                                                                                /* set the number */
+    a_hdc1080_aggregate_channel(&window.temperature, window.count, &summary->temperature);                        /* temperature summary */
+    a_hdc1080_aggregate_channel(&window.humidity, window.count, &summary->humidity);                              /* humidity summary */
+    
+    return 1;                                                                                                     /* return true */
+}
+
+/**
+ * @brief     initialize the aggregate structure
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] window_ms window length in ms
+ * @param[in] hop_ms window hop in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ *            - 4 window or hop is invalid
+ * @note      hop_ms == window_ms gives tumbling windows, a smaller hop gives sliding windows,
+ *            window_ms must be a multiple of hop_ms with at most HDC1080_AGGREGATE_MAX_PANES hops
+ */
+uint8_t hdc1080_aggregate_init(hdc1080_aggregate_t *aggregate, uint32_t window_ms, uint32_t hop_ms)
+{
+    if (aggregate == NULL)                                           /* check aggregate */
+    {
+        return 2;                                                    /* return error */
+    }
+    if ((hop_ms == 0) || (window_ms < hop_ms) || ((window_ms % hop_ms) != 0) ||
+        ((window_ms / hop_ms) > HDC1080_AGGREGATE_MAX_PANES))        /* check window and hop */
+    {
+        return 4;                                                    /* return error */
+    }
+    
+    memset(aggregate, 0, sizeof(hdc1080_aggregate_t));               /* clear all */
+    aggregate->hop_ms = hop_ms;                                      /* set the hop */
+    aggregate->panes = (uint8_t)(window_ms / hop_ms);                /* set the pane number */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief      add a sample to the aggregate
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity humidity in %
+ * @param[out] *summary pointer to a summary structure
+ * @param[out] *ready pointer to a ready buffer, 1 means a summary is written
+ * @return     status code
+ *             - 0 success
+ *             - 2 aggregate or buffer is NULL
+ * @note       the pane grid starts at the first sample, a sample after the end of the current pane closes it and emits
+ *             the window ending there, only full windows are emitted, a window that ends inside a gap of more than one
+ *             hop without samples is not emitted, the timestamps must not go backwards
+ */
+uint8_t hdc1080_aggregate_add(hdc1080_aggregate_t *aggregate, uint32_t timestamp_ms, float temperature, float humidity,
+                              hdc1080_aggregate_summary_t *summary, uint8_t *ready)
+{
+    uint8_t i;
+    uint32_t steps;
+    uint32_t end_ms;
+    hdc1080_aggregate_pane_t *pane;
+    
+    if ((aggregate == NULL) || (summary == NULL) || (ready == NULL))                          /* check aggregate */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    *ready = 0;                                                                               /* no summary */
+    if (aggregate->started == 0)                                                              /* first sample */
+    {
+        aggregate->pane_start_ms = timestamp_ms;                                              /* start the grid */
+        aggregate->started = 1;                                                               /* set started */
+    }
+    steps = (timestamp_ms - aggregate->pane_start_ms) / aggregate->hop_ms;                    /* closed panes */
+    if (steps != 0)                                                                           /* the current pane is closed */
+    {
+        end_ms = aggregate->pane_start_ms + aggregate->hop_ms;                                /* pane end */
+        if (aggregate->filled < aggregate->panes)                                             /* not full */
+        {
+            aggregate->filled++;                                                              /* one more pane */
+        }
+        if (aggregate->filled == aggregate->panes)                                            /* full window */
+        {
+            *ready = a_hdc1080_aggregate_emit(aggregate, end_ms - aggregate->hop_ms * aggregate->panes,
+                                              end_ms, summary);                               /* emit the window */
+        }
+        if (steps >= aggregate->panes)                                                        /* the gap covers the window */
+        {
+            for (i = 0; i < aggregate->panes; i++)                                            /* run all panes */
+            {
+                a_hdc1080_aggregate_clear(&aggregate->pane[i]);                               /* clear */
+            }
+        }
+        else
+        {
+            for (i = 0; i < steps; i++)                                                       /* run the closed panes */
+            {
+                aggregate->head = (uint8_t)((aggregate->head + 1) % aggregate->panes);        /* next pane */
+                a_hdc1080_aggregate_clear(&aggregate->pane[aggregate->head]);                 /* clear the oldest */
+            }
+        }
+        aggregate->pane_start_ms += steps * aggregate->hop_ms;                                /* move the grid */
+    }
+    
+    pane = &aggregate->pane[aggregate->head];                                                 /* get the current pane */
+    pane->count++;                                                                            /* one more sample */
+    a_hdc1080_aggregate_update(&pane->temperature, pane->count, temperature);                 /* update temperature */
+    a_hdc1080_aggregate_update(&pane->humidity, pane->count, humidity);                       /* update humidity */
+    aggregate->last_ms = timestamp_ms;                                                        /* save the time */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      flush the aggregate
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[out] *summary pointer to a summary structure
+ * @param[out] *ready pointer to a ready buffer, 1 means a summary is written
+ * @return     status code
+ *             - 0 success
+ *             - 2 aggregate or buffer is NULL
+ * @note       it emits the samples of the open window as a short window ending after the last sample and restarts
+ *             the pane grid at the next sample
+ */
+uint8_t hdc1080_aggregate_flush(hdc1080_aggregate_t *aggregate, hdc1080_aggregate_summary_t *summary, uint8_t *ready)
+{
+    uint8_t i;
+    uint8_t panes;
+    
+    if ((aggregate == NULL) || (summary == NULL) || (ready == NULL))                                                 /* check aggregate */
+    {
+        return 2;                                                                                                    /* return error */
+    }
+    
+    *ready = 0;                                                                                                      /* no summary */
+    if (aggregate->started != 0)                                                                                     /* started */
+    {
+        panes = (aggregate->filled < aggregate->panes) ? aggregate->filled : (uint8_t)(aggregate->panes - 1);        /* older panes in the window */
+        *ready = a_hdc1080_aggregate_emit(aggregate, aggregate->pane_start_ms - panes * aggregate->hop_ms,
+                                          aggregate->last_ms + 1, summary);                                          /* emit the open window */
+    }
+    for (i = 0; i < aggregate->panes; i++)                                                                           /* run all panes */
+    {
+        a_hdc1080_aggregate_clear(&aggregate->pane[i]);                                                              /* clear */
+    }
+    aggregate->head = 0;                                                                                             /* reset the head */
+    aggregate->filled = 0;                                                                                           /* reset the filled panes */
+    aggregate->started = 0;                                                                                          /* restart the grid */
+    
+    return 0;                                                                                                        /* success return 0 */
+}
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_aggregate.h
+ * @brief     driver hdc1080 aggregate header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_AGGREGATE_H
+#define DRIVER_HDC1080_AGGREGATE_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_aggregate_driver hdc1080 aggregate driver function
+ * @brief    hdc1080 aggregate driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 aggregate max pane number
+ * @note  a window is split into panes of one hop, the memory is fixed by this value
+ */
+#ifndef HDC1080_AGGREGATE_MAX_PANES
+    #define HDC1080_AGGREGATE_MAX_PANES 12
+#endif
+
+/**
+ * @brief hdc1080 aggregate running statistic structure definition
+ */
+typedef struct hdc1080_aggregate_stat_s
+{
+    float mean;                 /**< running mean */
+    float m2;                   /**< sum of the squared differences from the mean */
+    float min;                  /**< min value */
+    float max;                  /**< max value */
+} hdc1080_aggregate_stat_t;
+
+/**
+ * @brief hdc1080 aggregate pane structure definition
+ */
+typedef struct hdc1080_aggregate_pane_s
+{
+    uint32_t count;                               /**< sample number */
+    hdc1080_aggregate_stat_t temperature;         /**< temperature statistic */
+    hdc1080_aggregate_stat_t humidity;            /**< humidity statistic */
+} hdc1080_aggregate_pane_t;
+
+/**
+ * @brief hdc1080 aggregate channel summary structure definition
+ */
+typedef struct hdc1080_aggregate_channel_s
+{
+    float min;             /**< min value */
+    float max;             /**< max value */
+    float mean;            /**< mean value */
+    float stddev;          /**< sample standard deviation */
+} hdc1080_aggregate_channel_t;
+
+/**
+ * @brief hdc1080 aggregate summary structure definition
+ */
+typedef struct hdc1080_aggregate_summary_s
+{
+    uint32_t seq;                                   /**< window sequence number */
+    uint32_t start_ms;                              /**< window start time in ms */
+    uint32_t end_ms;                                /**< window end time in ms, exclusive */
+    uint32_t count;                                 /**< sample number */
+    hdc1080_aggregate_channel_t temperature;        /**< temperature summary in C */
+    hdc1080_aggregate_channel_t humidity;           /**< humidity summary in % */
+} hdc1080_aggregate_summary_t;
+
+/**
+ * @brief hdc1080 aggregate structure definition
+ */
+typedef struct hdc1080_aggregate_s
+{
+    hdc1080_aggregate_pane_t pane[HDC1080_AGGREGATE_MAX_PANES];        /**< pane ring */
+    uint32_t hop_ms;                                                   /**< pane length in ms */
+    uint32_t pane_start_ms;                                            /**< current pane start time in ms */
+    uint32_t last_ms;                                                  /**< last sample time in ms */
+    uint32_t seq;                                                      /**< next window sequence number */
+    uint8_t panes;                                                     /**< panes per window */
+    uint8_t head;                                                      /**< current pane */
+    uint8_t filled;                                                    /**< closed panes up to panes */
+    uint8_t started;                                                   /**< started flag */
+} hdc1080_aggregate_t;
+
+/**
+ * @brief     initialize the aggregate structure
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] window_ms window length in ms
+ * @param[in] hop_ms window hop in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ *            - 4 window or hop is invalid
+ * @note      hop_ms == window_ms gives tumbling windows, a smaller hop gives sliding windows,
+ *            window_ms must be a multiple of hop_ms with at most HDC1080_AGGREGATE_MAX_PANES hops
+ */
+uint8_t hdc1080_aggregate_init(hdc1080_aggregate_t *aggregate, uint32_t window_ms, uint32_t hop_ms);
+
+/**
+ * @brief      add a sample to the aggregate
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity humidity in %
+ * @param[out] *summary pointer to a summary structure
+ * @param[out] *ready pointer to a ready buffer, 1 means a summary is written
+ * @return     status code
+ *             - 0 success
+ *             - 2 aggregate or buffer is NULL
+ * @note       the pane grid starts at the first sample, a sample after the end of the current pane closes it and emits
+ *             the window ending there, only full windows are emitted, a window that ends inside a gap of more than one
+ *             hop without samples is not emitted, the timestamps must not go backwards
+ */
+uint8_t hdc1080_aggregate_add(hdc1080_aggregate_t *aggregate, uint32_t timestamp_ms, float temperature, float humidity,
+                              hdc1080_aggregate_summary_t *summary, uint8_t *ready);
+
+/**
+ * @brief      flush the aggregate
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[out] *summary pointer to a summary structure
+ * @param[out] *ready pointer to a ready buffer, 1 means a summary is written
+ * @return     status code
+ *             - 0 success
+ *             - 2 aggregate or buffer is NULL
+ * @note       it emits the samples of the open window as a short window ending after the last sample and restarts
+ *             the pane grid at the next sample
+ */
+uint8_t hdc1080_aggregate_flush(hdc1080_aggregate_t *aggregate, hdc1080_aggregate_summary_t *summary, uint8_t *ready);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_arbiter.c
+ * @brief     driver hdc1080 arbiter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_arbiter.h"
+
+/**
+ * @brief     initialize the arbiter
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @param[in] *mutex_try_lock pointer to a non blocking mutex lock function
+ * @param[in] *mutex_lock pointer to a blocking mutex lock function
+ * @param[in] *mutex_unlock pointer to a mutex unlock function
+ * @param[in] *get_tick_us pointer to a get_tick_us function
+ * @return    status code
+ *            - 0 success
+ *            - 2 arbiter or function is NULL
+ * @note      one arbiter guards one bus, the mutex must not be recursive
+ */
+uint8_t hdc1080_arbiter_init(hdc1080_arbiter_t *arbiter, uint8_t (*mutex_try_lock)(void), uint8_t (*mutex_lock)(void),
+                             void (*mutex_unlock)(void), uint32_t (*get_tick_us)(void))
+{
+    if ((arbiter == NULL) || (mutex_try_lock == NULL) || (mutex_lock == NULL) ||
+        (mutex_unlock == NULL) || (get_tick_us == NULL))        /* check the args */
+    {
+        return 2;                                               /* return error */
+    }
+    
+    memset(arbiter, 0, sizeof(hdc1080_arbiter_t));              /* clear all */
+    arbiter->mutex_try_lock = mutex_try_lock;                   /* set mutex_try_lock */
+    arbiter->mutex_lock = mutex_lock;                           /* set mutex_lock */
+    arbiter->mutex_unlock = mutex_unlock;                       /* set mutex_unlock */
+    arbiter->get_tick_us = get_tick_us;                         /* set get_tick_us */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     take the bus
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 arbiter is NULL
+ * @note      link a wrapper of it as bus_lock of every driver handle on the bus
+ */
+uint8_t hdc1080_arbiter_lock(hdc1080_arbiter_t *arbiter)
+{
+    uint8_t contended;
+    uint32_t start_us;
+    uint32_t wait_us;
+    
+    if (arbiter == NULL)                                 /* check arbiter */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    contended = 0;                                       /* not contended yet */
+    start_us = arbiter->get_tick_us();                   /* save the request time */
+    if (arbiter->mutex_try_lock() != 0)                  /* bus is busy */
+    {
+        contended = 1;                                   /* mark contended */
+        if (arbiter->mutex_lock() != 0)                  /* wait for the bus */
+        {
+            return 1;                                    /* return error */
+        }
+    }
+    arbiter->grant_us = arbiter->get_tick_us();          /* save the grant time */
+    arbiter->locked = 1;                                 /* set locked */
+    arbiter->stats.acquisitions++;                       /* count the acquisition */
+    if (contended != 0)                                  /* check contended */
+    {
+        wait_us = arbiter->grant_us - start_us;          /* get the wait time */
+        arbiter->stats.contentions++;                    /* count the contention */
+        arbiter->stats.wait_total_us += wait_us;         /* sum the wait time */
+        if (wait_us > arbiter->stats.wait_max_us)        /* check the longest wait */
+        {
+            arbiter->stats.wait_max_us = wait_us;        /* save the longest wait */
+        }
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     release the bus
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 arbiter is NULL
+ *            - 4 bus is not locked
+ * @note      only the owner may call it, link a wrapper of it as bus_unlock of every driver handle on the bus
+ */
+uint8_t hdc1080_arbiter_unlock(hdc1080_arbiter_t *arbiter)
+{
+    uint32_t hold_us;
+    
+    if (arbiter == NULL)                                         /* check arbiter */
+    {
+        return 2;                                                /* return error */
+    }
+    if (arbiter->locked == 0)                                    /* check locked */
+    {
+        return 4;                                                /* return error */
+    }
+    
+    hold_us = arbiter->get_tick_us() - arbiter->grant_us;        /* get the hold time */
+    arbiter->stats.hold_total_us += hold_us;                     /* sum the hold time */
+    if (hold_us > arbiter->stats.hold_max_us)                    /* check the longest hold */
+    {
+        arbiter->stats.hold_max_us = hold_us;                    /* save the longest hold */
+    }
+    arbiter->locked = 0;                                         /* clear locked */
+    arbiter->mutex_unlock();                                     /* release the mutex */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *arbiter pointer to an arbiter structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 lock failed
+ *             - 2 arbiter or stats is NULL
+ * @note       the copy is taken under the mutex and is not counted as an acquisition
+ */
+uint8_t hdc1080_arbiter_get_stats(hdc1080_arbiter_t *arbiter, hdc1080_arbiter_stats_t *stats)
+{
+    if ((arbiter == NULL) || (stats == NULL))        /* check the args */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    if (arbiter->mutex_lock() != 0)                  /* lock the mutex */
+    {
+        return 1;                                    /* return error */
+    }
+    *stats = arbiter->stats;                         /* copy the statistics */
+    arbiter->mutex_unlock();                         /* release the mutex */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 arbiter is NULL
+ * @note      none
+ */
+uint8_t hdc1080_arbiter_clear_stats(hdc1080_arbiter_t *arbiter)
+{
+    if (arbiter == NULL)                                                /* check arbiter */
+    {
+        return 2;                                                       /* return error */
+    }
+    
+    if (arbiter->mutex_lock() != 0)                                     /* lock the mutex */
+    {
+        return 1;                                                       /* return error */
+    }
+    memset(&arbiter->stats, 0, sizeof(hdc1080_arbiter_stats_t));        /* clear the statistics */
+    arbiter->mutex_unlock();                                            /* release the mutex */
+    
+    return 0;                                                           /* success return 0 */
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_arbiter.h
+ * @brief     driver hdc1080 arbiter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_ARBITER_H
+#define DRIVER_HDC1080_ARBITER_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_arbiter_driver hdc1080 arbiter driver function
+ * @brief    hdc1080 shared bus arbiter driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 arbiter statistics structure definition
+ */
+typedef struct hdc1080_arbiter_stats_s
+{
+    uint32_t acquisitions;         /**< granted locks */
+    uint32_t contentions;          /**< locks that found the bus busy */
+    uint32_t wait_max_us;          /**< longest wait for a busy bus in us */
+    uint32_t hold_max_us;          /**< longest bus hold in us */
+    uint64_t wait_total_us;        /**< total wait for a busy bus in us */
+    uint64_t hold_total_us;        /**< total bus hold in us */
+} hdc1080_arbiter_stats_t;
+
+/**
+ * @brief hdc1080 arbiter structure definition
+ */
+typedef struct hdc1080_arbiter_s
+{
+    uint8_t (*mutex_try_lock)(void);         /**< point to a non blocking mutex lock function address, 0 means locked */
+    uint8_t (*mutex_lock)(void);             /**< point to a blocking mutex lock function address, 0 means locked */
+    void (*mutex_unlock)(void);              /**< point to a mutex unlock function address */
+    uint32_t (*get_tick_us)(void);           /**< point to a get_tick_us function address */
+    hdc1080_arbiter_stats_t stats;           /**< statistics, only changed by the owner */
+    uint32_t grant_us;                       /**< grant time of the current owner */
+    uint8_t locked;                          /**< locked flag */
+} hdc1080_arbiter_t;
+
+/**
+ * @brief     initialize the arbiter
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @param[in] *mutex_try_lock pointer to a non blocking mutex lock function
+ * @param[in] *mutex_lock pointer to a blocking mutex lock function
+ * @param[in] *mutex_unlock pointer to a mutex unlock function
+ * @param[in] *get_tick_us pointer to a get_tick_us function
+ * @return    status code
+ *            - 0 success
+ *            - 2 arbiter or function is NULL
+ * @note      one arbiter guards one bus, the mutex must not be recursive
+ */
+uint8_t hdc1080_arbiter_init(hdc1080_arbiter_t *arbiter, uint8_t (*mutex_try_lock)(void), uint8_t (*mutex_lock)(void),
+                             void (*mutex_unlock)(void), uint32_t (*get_tick_us)(void));
+
+/**
+ * @brief     take the bus
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 arbiter is NULL
+ * @note      link a wrapper of it as bus_lock of every driver handle on the bus
+ */
+uint8_t hdc1080_arbiter_lock(hdc1080_arbiter_t *arbiter);
+
+/**
+ * @brief     release the bus
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 arbiter is NULL
+ *            - 4 bus is not locked
+ * @note      only the owner may call it, link a wrapper of it as bus_unlock of every driver handle on the bus
+ */
+uint8_t hdc1080_arbiter_unlock(hdc1080_arbiter_t *arbiter);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *arbiter pointer to an arbiter structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 lock failed
+ *             - 2 arbiter or stats is NULL
+ * @note       the copy is taken under the mutex and is not counted as an acquisition
+ */
+uint8_t hdc1080_arbiter_get_stats(hdc1080_arbiter_t *arbiter, hdc1080_arbiter_stats_t *stats);
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *arbiter pointer to an arbiter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 arbiter is NULL
+ * @note      none
+ */
+uint8_t hdc1080_arbiter_clear_stats(hdc1080_arbiter_t *arbiter);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
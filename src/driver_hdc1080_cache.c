@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cache.c
+ * @brief     driver hdc1080 cache source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_cache.h"
+
+/**
+ * @brief     lock the cache
+ * @param[in] *cache pointer to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ * @note      it does nothing without a linked lock
+ */
+static uint8_t a_hdc1080_cache_lock(hdc1080_cache_t *cache)
+{
+    if (cache->lock == NULL)        /* check lock */
+    {
+        return 0;                   /* no lock linked */
+    }
+    if (cache->lock() != 0)         /* lock the cache */
+    {
+        return 1;                   /* return error */
+    }
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief     unlock the cache
+ * @param[in] *cache pointer to a cache structure
+ * @note      it does nothing without a linked unlock
+ */
+static void a_hdc1080_cache_unlock(hdc1080_cache_t *cache)
+{
+    if (cache->unlock != NULL)        /* check unlock */
+    {
+        cache->unlock();              /* unlock the cache */
+    }
+}
+
+/**
+ * @brief     initialize the cache
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle structure
+ * @param[in] temperature_resolution temperature resolution of the chip
+ * @param[in] humidity_resolution humidity resolution of the chip
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or handle is NULL
+ *            - 4 resolution is invalid
+ * @note      the chip must be in HDC1080_MODE_SEQUENCE, every read of the handle should go through the cache
+ *            because a blocking read in between breaks the conversion in flight,
+ *            without hdc1080_cache_set_lock the cache must only be used from one context
+ */
+uint8_t hdc1080_cache_init(hdc1080_cache_t *cache, hdc1080_handle_t *handle,
+                           hdc1080_temperature_resolution_t temperature_resolution,
+                           hdc1080_humidity_resolution_t humidity_resolution)
+{
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    
+    if ((cache == NULL) || (handle == NULL))                                    /* check the args */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (hdc1080_get_conversion_time(temperature_resolution, humidity_resolution,
+                                    &temperature_us, &humidity_us) != 0)        /* get the conversion time */
+    {
+        return 4;                                                               /* return error */
+    }
+    
+    memset(cache, 0, sizeof(hdc1080_cache_t));                                  /* clear all */
+    cache->handle = handle;                                                     /* set the handle */
+    cache->wait_ms = (temperature_us + humidity_us) / 1000 + 1;                 /* round the conversion time up */
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the cache lock
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *lock pointer to a lock function address, NULL removes the lock
+ * @param[in] *unlock pointer to an unlock function address, NULL removes the lock
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache is NULL
+ *            - 4 lock and unlock are not paired
+ * @note      call it after hdc1080_cache_init when several threads share the cache, request, poll and invalidate
+ *            run under the lock, the start and the fetch on the bus run under it too, so it must not be
+ *            the lock linked to the handle
+ */
+uint8_t hdc1080_cache_set_lock(hdc1080_cache_t *cache, uint8_t (*lock)(void), void (*unlock)(void))
+{
+    if (cache == NULL)                             /* check the cache */
+    {
+        return 2;                                  /* return error */
+    }
+    if ((lock == NULL) != (unlock == NULL))        /* check lock and unlock */
+    {
+        return 4;                                  /* return error */
+    }
+    
+    cache->lock = lock;                            /* set the lock */
+    cache->unlock = unlock;                        /* set the unlock */
+    
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief      request a sample no older than a max age
+ * @param[in]  *cache pointer to a cache structure
+ * @param[in]  now_ms current time in ms
+ * @param[in]  max_age_ms max age of the sample in ms
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *ready_ms pointer to a ready time buffer
+ * @return     status code
+ *             - 0 success, the sample is served from the cache without bus access
+ *             - 1 start conversion failed or lock failed
+ *             - 2 cache, sample or ready_ms is NULL
+ *             - 4 pending, call hdc1080_cache_poll at ready_ms
+ * @note       a request while a conversion is in flight attaches to it instead of starting a new one,
+ *             the chip holds one conversion, so a max age shorter than the conversion in flight attaches as well
+ */
+uint8_t hdc1080_cache_request(hdc1080_cache_t *cache, uint32_t now_ms, uint32_t max_age_ms,
+                              hdc1080_cache_sample_t *sample, uint32_t *ready_ms)
+{
+    if ((cache == NULL) || (sample == NULL) || (ready_ms == NULL))                         /* check the args */
+    {
+        return 2;                                                                          /* return error */
+    }
+    
+    if (a_hdc1080_cache_lock(cache) != 0)                                                  /* lock the cache */
+    {
+        return 1;                                                                          /* return error */
+    }
+    cache->requests++;                                                                     /* count the request */
+    if ((cache->valid != 0) && (now_ms - cache->sample.timestamp_ms <= max_age_ms))        /* cached sample is young enough */
+    {
+        *sample = cache->sample;                                                           /* copy the sample */
+        cache->hits++;                                                                     /* count the hit */
+        a_hdc1080_cache_unlock(cache);                                                     /* unlock the cache */
+        
+        return 0;                                                                          /* hit */
+    }
+    if (cache->busy != 0)                                                                  /* conversion in flight */
+    {
+        *ready_ms = cache->start_ms + cache->wait_ms;                                      /* ready with the conversion in flight */
+        cache->joins++;                                                                    /* count the join */
+        a_hdc1080_cache_unlock(cache);                                                     /* unlock the cache */
+        
+        return 4;                                                                          /* pending */
+    }
+    if (hdc1080_start_temperature_humidity(cache->handle) != 0)                            /* start a conversion */
+    {
+        cache->errors++;                                                                   /* count the error */
+        a_hdc1080_cache_unlock(cache);                                                     /* unlock the cache */
+        
+        return 1;                                                                          /* return error */
+    }
+    cache->start_ms = now_ms;                                                              /* save the trigger time */
+    cache->busy = 1;                                                                       /* set busy */
+    cache->conversions++;                                                                  /* count the conversion */
+    *ready_ms = now_ms + cache->wait_ms;                                                   /* ready after the conversion time */
+    a_hdc1080_cache_unlock(cache);                                                         /* unlock the cache */
+    
+    return 4;                                                                              /* pending */
+}
+
+/**
+ * @brief      poll a pending request
+ * @param[in]  *cache pointer to a cache structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed, no sample or lock failed
+ *             - 2 cache or sample is NULL
+ *             - 4 conversion is not finished
+ * @note       the first poll after the conversion time fetches the sample, the attached requests get the same
+ *             sample from the cache
+ */
+uint8_t hdc1080_cache_poll(hdc1080_cache_t *cache, uint32_t now_ms, hdc1080_cache_sample_t *sample)
+{
+    if ((cache == NULL) || (sample == NULL))                                                                      /* check the args */
+    {
+        return 2;                                                                                                 /* return error */
+    }
+    
+    if (a_hdc1080_cache_lock(cache) != 0)                                                                         /* lock the cache */
+    {
+        return 1;                                                                                                 /* return error */
+    }
+    if (cache->busy != 0)                                                                                         /* conversion in flight */
+    {
+        if ((int32_t)(now_ms - cache->start_ms) < (int32_t)cache->wait_ms)                                        /* check the conversion time */
+        {
+            a_hdc1080_cache_unlock(cache);                                                                        /* unlock the cache */
+            
+            return 4;                                                                                             /* not finished */
+        }
+        cache->busy = 0;                                                                                          /* conversion done */
+        if (hdc1080_fetch_temperature_humidity(cache->handle, &cache->sample.temperature_raw, &cache->sample.temperature,
+                                               &cache->sample.humidity_raw, &cache->sample.humidity) != 0)        /* fetch the sample */
+        {
+            cache->valid = 0;                                                                                     /* drop the sample */
+            cache->errors++;                                                                                      /* count the error */
+            a_hdc1080_cache_unlock(cache);                                                                        /* unlock the cache */
+            
+            return 1;                                                                                             /* return error */
+        }
+        cache->sample.timestamp_ms = cache->start_ms;                                                             /* the age counts from the trigger */
+        cache->valid = 1;                                                                                         /* set valid */
+    }
+    if (cache->valid == 0)                                                                                        /* no sample */
+    {
+        a_hdc1080_cache_unlock(cache);                                                                            /* unlock the cache */
+        
+        return 1;                                                                                                 /* return error */
+    }
+    *sample = cache->sample;                                                                                      /* copy the sample */
+    a_hdc1080_cache_unlock(cache);                                                                                /* unlock the cache */
+    
+    return 0;                                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     drop the cached sample
+ * @param[in] *cache pointer to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 cache is NULL
+ * @note      call it after the resolution or the heater is changed, a conversion in flight is kept
+ */
+uint8_t hdc1080_cache_invalidate(hdc1080_cache_t *cache)
+{
+    if (cache == NULL)                           /* check the cache */
+    {
+        return 2;                                /* return error */
+    }
+    
+    if (a_hdc1080_cache_lock(cache) != 0)        /* lock the cache */
+    {
+        return 1;                                /* return error */
+    }
+    cache->valid = 0;                            /* drop the sample */
+    a_hdc1080_cache_unlock(cache);               /* unlock the cache */
+    
+    return 0;                                    /* success return 0 */
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cache.h
+ * @brief     driver hdc1080 cache header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_CACHE_H
+#define DRIVER_HDC1080_CACHE_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_cache_driver hdc1080 cache driver function
+ * @brief    hdc1080 coalescing read cache driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 cache sample structure definition
+ */
+typedef struct hdc1080_cache_sample_s
+{
+    uint32_t timestamp_ms;        /**< trigger time of the conversion in ms */
+    uint16_t temperature_raw;     /**< raw temperature */
+    uint16_t humidity_raw;        /**< raw humidity */
+    float temperature;            /**< converted temperature in C */
+    float humidity;               /**< converted humidity in % */
+} hdc1080_cache_sample_t;
+
+/**
+ * @brief hdc1080 cache structure definition
+ */
+typedef struct hdc1080_cache_s
+{
+    hdc1080_handle_t *handle;              /**< initialized handle in the sequence mode */
+    hdc1080_cache_sample_t sample;         /**< cached sample */
+    uint32_t wait_ms;                      /**< conversion time in ms */
+    uint32_t start_ms;                     /**< trigger time of the conversion in flight */
+    uint32_t requests;                     /**< requests */
+    uint32_t hits;                         /**< requests served from the cache */
+    uint32_t joins;                        /**< requests attached to the conversion in flight */
+    uint32_t conversions;                  /**< started conversions */
+    uint32_t errors;                       /**< failed conversions */
+    uint8_t valid;                         /**< cached sample flag */
+    uint8_t busy;                          /**< conversion in flight flag */
+    uint8_t (*lock)(void);                 /**< point to an optional lock function address */
+    void (*unlock)(void);                  /**< point to an optional unlock function address */
+} hdc1080_cache_t;
+
+/**
+ * @brief     initialize the cache
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle structure
+ * @param[in] temperature_resolution temperature resolution of the chip
+ * @param[in] humidity_resolution humidity resolution of the chip
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache or handle is NULL
+ *            - 4 resolution is invalid
+ * @note      the chip must be in HDC1080_MODE_SEQUENCE, every read of the handle should go through the cache
+ *            because a blocking read in between breaks the conversion in flight,
+ *            without hdc1080_cache_set_lock the cache must only be used from one context
+ */
+uint8_t hdc1080_cache_init(hdc1080_cache_t *cache, hdc1080_handle_t *handle,
+                           hdc1080_temperature_resolution_t temperature_resolution,
+                           hdc1080_humidity_resolution_t humidity_resolution);
+
+/**
+ * @brief     set the cache lock
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *lock pointer to a lock function address, NULL removes the lock
+ * @param[in] *unlock pointer to an unlock function address, NULL removes the lock
+ * @return    status code
+ *            - 0 success
+ *            - 2 cache is NULL
+ *            - 4 lock and unlock are not paired
+ * @note      call it after hdc1080_cache_init when several threads share the cache, request, poll and invalidate
+ *            run under the lock, the start and the fetch on the bus run under it too, so it must not be
+ *            the lock linked to the handle
+ */
+uint8_t hdc1080_cache_set_lock(hdc1080_cache_t *cache, uint8_t (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief      request a sample no older than a max age
+ * @param[in]  *cache pointer to a cache structure
+ * @param[in]  now_ms current time in ms
+ * @param[in]  max_age_ms max age of the sample in ms
+ * @param[out] *sample pointer to a sample buffer
+ * @param[out] *ready_ms pointer to a ready time buffer
+ * @return     status code
+ *             - 0 success, the sample is served from the cache without bus access
+ *             - 1 start conversion failed or lock failed
+ *             - 2 cache, sample or ready_ms is NULL
+ *             - 4 pending, call hdc1080_cache_poll at ready_ms
+ * @note       a request while a conversion is in flight attaches to it instead of starting a new one,
+ *             the chip holds one conversion, so a max age shorter than the conversion in flight attaches as well
+ */
+uint8_t hdc1080_cache_request(hdc1080_cache_t *cache, uint32_t now_ms, uint32_t max_age_ms,
+                              hdc1080_cache_sample_t *sample, uint32_t *ready_ms);
+
+/**
+ * @brief      poll a pending request
+ * @param[in]  *cache pointer to a cache structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fetch failed, no sample or lock failed
+ *             - 2 cache or sample is NULL
+ *             - 4 conversion is not finished
+ * @note       the first poll after the conversion time fetches the sample, the attached requests get the same
+ *             sample from the cache
+ */
+uint8_t hdc1080_cache_poll(hdc1080_cache_t *cache, uint32_t now_ms, hdc1080_cache_sample_t *sample);
+
+/**
+ * @brief     drop the cached sample
+ * @param[in] *cache pointer to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 lock failed
+ *            - 2 cache is NULL
+ * @note      call it after the resolution or the heater is changed, a conversion in flight is kept
+ */
+uint8_t hdc1080_cache_invalidate(hdc1080_cache_t *cache);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
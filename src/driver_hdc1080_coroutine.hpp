@@ -0,0 +1,636 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_coroutine.hpp
+ * @brief     driver hdc1080 c++20 coroutine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_COROUTINE_HPP
+#define DRIVER_HDC1080_COROUTINE_HPP
+
+#include "driver_hdc1080.hpp"
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @defgroup hdc1080_coroutine_driver hdc1080 coroutine driver function
+ * @brief    hdc1080 c++20 coroutine driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+namespace hdc1080
+{
+
+template <typename T>
+class task;
+
+/**
+ * @brief hdc1080 coroutine promise base definition
+ * @note  a finished coroutine resumes its awaiter by symmetric transfer, so a chain of awaits takes no stack
+ */
+struct promise_base
+{
+    std::coroutine_handle<> continuation;        /**< awaiting coroutine */
+    
+    /**
+     * @brief hdc1080 coroutine final awaiter definition
+     */
+    struct final_awaiter
+    {
+        /**
+         * @brief  check if ready
+         * @return false
+         * @note   none
+         */
+        bool await_ready() const noexcept
+        {
+            return false;        /* always suspend */
+        }
+        
+        /**
+         * @brief     transfer to the awaiting coroutine
+         * @param[in] h finished coroutine
+         * @return    next coroutine
+         * @note      none
+         */
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) const noexcept
+        {
+            if (h.promise().continuation)               /* check the awaiter */
+            {
+                return h.promise().continuation;        /* resume the awaiter */
+            }
+            
+            return std::noop_coroutine();               /* return to the executor */
+        }
+        
+        /**
+         * @brief resume
+         * @note  never resumed
+         */
+        void await_resume() const noexcept
+        {
+        }
+    };
+    
+    /**
+     * @brief  start lazily
+     * @return suspend
+     * @note   a task runs when it is awaited or spawned
+     */
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};        /* suspend */
+    }
+    
+    /**
+     * @brief  finish
+     * @return final awaiter
+     * @note   none
+     */
+    final_awaiter final_suspend() const noexcept
+    {
+        return {};        /* transfer to the awaiter */
+    }
+    
+    /**
+     * @brief unhandled exception
+     * @note  the driver reports status codes and throws nothing
+     */
+    void unhandled_exception() const noexcept
+    {
+        std::terminate();        /* terminate */
+    }
+};
+
+/**
+ * @brief hdc1080 coroutine promise definition
+ */
+template <typename T>
+struct promise : promise_base
+{
+    T value{};        /**< returned value */
+    
+    /**
+     * @brief  get the task
+     * @return task
+     * @note   none
+     */
+    task<T> get_return_object() noexcept;
+    
+    /**
+     * @brief     store the returned value
+     * @param[in] v returned value
+     * @note      none
+     */
+    void return_value(T v) noexcept
+    {
+        value = std::move(v);        /* store the value */
+    }
+};
+
+/**
+ * @brief hdc1080 coroutine void promise definition
+ */
+template <>
+struct promise<void> : promise_base
+{
+    /**
+     * @brief  get the task
+     * @return task
+     * @note   none
+     */
+    task<void> get_return_object() noexcept;
+    
+    /**
+     * @brief return
+     * @note  none
+     */
+    void return_void() const noexcept
+    {
+    }
+};
+
+/**
+ * @brief hdc1080 coroutine task definition
+ * @note  a lazy and awaitable coroutine owning its frame
+ */
+template <typename T>
+class task
+{
+    public:
+        using promise_type = promise<T>;
+        
+        /**
+         * @brief     construct from a coroutine
+         * @param[in] h coroutine handle
+         * @note      none
+         */
+        explicit task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h)
+        {
+        }
+        
+        /**
+         * @brief     move construct
+         * @param[in] &&other moved task
+         * @note      none
+         */
+        task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+        {
+        }
+        
+        /**
+         * @brief destroy the coroutine frame
+         * @note  none
+         */
+        ~task()
+        {
+            if (m_handle)                  /* check the handle */
+            {
+                m_handle.destroy();        /* destroy the frame */
+            }
+        }
+        
+        task(const task &) = delete;
+        task &operator=(const task &) = delete;
+        task &operator=(task &&) = delete;
+        
+        /**
+         * @brief  check if finished
+         * @return true if the coroutine returned
+         * @note   none
+         */
+        bool done() const noexcept
+        {
+            return !m_handle || m_handle.done();        /* check the frame */
+        }
+        
+        /**
+         * @brief  check if ready
+         * @return false
+         * @note   none
+         */
+        bool await_ready() const noexcept
+        {
+            return false;        /* always suspend */
+        }
+        
+        /**
+         * @brief     start the task
+         * @param[in] awaiter awaiting coroutine
+         * @return    task coroutine
+         * @note      none
+         */
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+        {
+            m_handle.promise().continuation = awaiter;        /* set the continuation */
+            
+            return m_handle;                                  /* run the task */
+        }
+        
+        /**
+         * @brief  get the returned value
+         * @return returned value
+         * @note   none
+         */
+        T await_resume() noexcept
+        {
+            if constexpr (!std::is_void_v<T>)                      /* resolved at compile time */
+            {
+                return std::move(m_handle.promise().value);        /* return the value */
+            }
+        }
+        
+        /**
+         * @brief  get the coroutine handle
+         * @return coroutine handle
+         * @note   used by the executor
+         */
+        std::coroutine_handle<> handle() const noexcept
+        {
+            return m_handle;        /* return the handle */
+        }
+        
+    private:
+        std::coroutine_handle<promise_type> m_handle;        /**< coroutine handle */
+};
+
+/**
+ * @brief  get the task
+ * @return task
+ * @note   none
+ */
+template <typename T>
+inline task<T> promise<T>::get_return_object() noexcept
+{
+    return task<T>(std::coroutine_handle<promise<T>>::from_promise(*this));        /* make the task */
+}
+
+/**
+ * @brief  get the task
+ * @return task
+ * @note   none
+ */
+inline task<void> promise<void>::get_return_object() noexcept
+{
+    return task<void>(std::coroutine_handle<promise<void>>::from_promise(*this));        /* make the task */
+}
+
+/**
+ * @brief hdc1080 single threaded executor definition
+ * @note  a ready queue and a timer heap, run() resumes the ready coroutines and waits for the next timer only
+ *        when nothing is ready, now_us and idle_us may be linked to a virtual clock for a simulation
+ */
+class executor
+{
+    public:
+        /**
+         * @brief     construct
+         * @param[in] *now_us pointer to a clock function, NULL uses the steady clock
+         * @param[in] *idle_us pointer to an idle function, NULL sleeps the thread
+         * @note      none
+         */
+        explicit executor(uint64_t (*now_us)(void) = nullptr, void (*idle_us)(uint64_t us) = nullptr) noexcept
+            : m_now_us(now_us), m_idle_us(idle_us), m_sequence(0)
+        {
+        }
+        
+        executor(const executor &) = delete;
+        executor &operator=(const executor &) = delete;
+        
+        /**
+         * @brief     spawn a task
+         * @param[in] &&t spawned task
+         * @note      the executor owns the task until run() returns
+         */
+        void spawn(task<void> &&t)
+        {
+            m_ready.push_back(t.handle());          /* schedule the task */
+            m_tasks.push_back(std::move(t));        /* keep the frame */
+        }
+        
+        /**
+         * @brief hdc1080 executor sleep awaiter definition
+         */
+        struct sleep_awaiter
+        {
+            executor *e;            /**< executor */
+            uint64_t us;            /**< suspended time in us */
+            
+            /**
+             * @brief  check if ready
+             * @return false
+             * @note   none
+             */
+            bool await_ready() const noexcept
+            {
+                return false;        /* always suspend */
+            }
+            
+            /**
+             * @brief     add the timer
+             * @param[in] h suspended coroutine
+             * @note      none
+             */
+            void await_suspend(std::coroutine_handle<> h) const
+            {
+                e->m_timers.push({e->a_now() + us, e->m_sequence++, h});        /* add the timer */
+            }
+            
+            /**
+             * @brief resume
+             * @note  none
+             */
+            void await_resume() const noexcept
+            {
+            }
+        };
+        
+        /**
+         * @brief     suspend the calling coroutine
+         * @param[in] us suspended time in us
+         * @return    awaiter
+         * @note      no thread sleeps, the coroutine is resumed by run()
+         */
+        sleep_awaiter sleep_us(uint64_t us) noexcept
+        {
+            return sleep_awaiter{this, us};        /* return the awaiter */
+        }
+        
+        /**
+         * @brief  schedule the calling coroutine again
+         * @return awaiter
+         * @note   lets the other ready coroutines run
+         */
+        sleep_awaiter yield() noexcept
+        {
+            return sleep_awaiter{this, 0};        /* expire at once */
+        }
+        
+        /**
+         * @brief  run until every spawned task returned
+         * @return number of resumed coroutines
+         * @note   none
+         */
+        uint64_t run()
+        {
+            uint64_t resumed = 0;
+            uint64_t now;
+            
+            while (!m_ready.empty() || !m_timers.empty())                               /* run until idle */
+            {
+                while (!m_ready.empty())                                                /* run the ready coroutines */
+                {
+                    std::coroutine_handle<> h = m_ready.front();
+                    
+                    m_ready.pop_front();                                                /* dequeue */
+                    h.resume();                                                         /* resume */
+                    resumed++;                                                          /* count */
+                }
+                if (m_timers.empty())                                                   /* check the timers */
+                {
+                    break;                                                              /* break */
+                }
+                now = a_now();                                                          /* get the time */
+                if (m_timers.top().deadline_us > now)                                   /* check the next timer */
+                {
+                    a_idle(m_timers.top().deadline_us - now);                           /* wait for it */
+                    now = a_now();                                                      /* get the time */
+                }
+                while (!m_timers.empty() && (m_timers.top().deadline_us <= now))        /* expire the timers */
+                {
+                    m_ready.push_back(m_timers.top().h);                                /* schedule */
+                    m_timers.pop();                                                     /* remove the timer */
+                }
+            }
+            m_tasks.clear();                                                            /* free the frames */
+            
+            return resumed;                                                             /* return the count */
+        }
+        
+        /**
+         * @brief  get the time
+         * @return time in us
+         * @note   none
+         */
+        uint64_t now_us() const
+        {
+            return a_now();        /* return the time */
+        }
+        
+    private:
+        /**
+         * @brief hdc1080 executor timer definition
+         */
+        struct timer
+        {
+            uint64_t deadline_us;              /**< deadline */
+            uint64_t sequence;                 /**< fifo order of the same deadline */
+            std::coroutine_handle<> h;         /**< suspended coroutine */
+            
+            /**
+             * @brief     compare the deadlines
+             * @param[in] &other compared timer
+             * @return    true if this expires later
+             * @note      none
+             */
+            bool operator>(const timer &other) const noexcept
+            {
+                if (deadline_us != other.deadline_us)              /* check the deadlines */
+                {
+                    return deadline_us > other.deadline_us;        /* later deadline */
+                }
+                
+                return sequence > other.sequence;                  /* later timer */
+            }
+        };
+        
+        /**
+         * @brief  get the time
+         * @return time in us
+         * @note   none
+         */
+        uint64_t a_now() const
+        {
+            if (m_now_us != nullptr)                                                 /* check the clock */
+            {
+                return m_now_us();                                                   /* linked clock */
+            }
+            
+            return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();        /* steady clock */
+        }
+        
+        /**
+         * @brief     wait for the next timer
+         * @param[in] us waited time in us
+         * @note      the only place the thread sleeps
+         */
+        void a_idle(uint64_t us) const
+        {
+            if (m_idle_us != nullptr)                                          /* check the idle function */
+            {
+                m_idle_us(us);                                                 /* linked idle */
+                
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(us));        /* sleep */
+        }
+        
+        uint64_t (*m_now_us)(void);                                                                        /**< clock */
+        void (*m_idle_us)(uint64_t us);                                                                    /**< idle */
+        uint64_t m_sequence;                                                                               /**< timer sequence */
+        std::deque<std::coroutine_handle<>> m_ready;                                                       /**< ready queue */
+        std::priority_queue<timer, std::vector<timer>, std::greater<timer>> m_timers;                      /**< timer heap */
+        std::vector<task<void>> m_tasks;                                                                   /**< spawned tasks */
+};
+
+/**
+ * @brief hdc1080 coroutine sensor definition
+ * @note  awaitable reads of an initialized c driver handle in HDC1080_MODE_SEQUENCE, built on
+ *        hdc1080_start_temperature_humidity and hdc1080_fetch_temperature_humidity, the conversion wait suspends
+ *        the coroutine on an executor timer, one read of a sensor is in flight at a time
+ */
+class sensor
+{
+    public:
+        /**
+         * @brief     construct
+         * @param[in] *handle pointer to an initialized hdc1080 handle
+         * @param[in] &e executor of the timers
+         * @param[in] temperature_resolution configured temperature resolution
+         * @param[in] humidity_resolution configured humidity resolution
+         * @note      the conversion wait is taken from the resolutions, no bus access
+         */
+        sensor(hdc1080_handle_t *handle, executor &e,
+               hdc1080_temperature_resolution_t temperature_resolution = HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+               hdc1080_humidity_resolution_t humidity_resolution = HDC1080_HUMIDITY_RESOLUTION_14_BIT) noexcept
+            : m_handle(handle), m_executor(e), m_wait_us(0), m_retries(0), m_busy(false)
+        {
+            uint32_t temperature_us;
+            uint32_t humidity_us;
+            
+            if (hdc1080_get_conversion_time(temperature_resolution, humidity_resolution,
+                                            &temperature_us, &humidity_us) == 0)        /* get the conversion time */
+            {
+                m_wait_us = temperature_us + humidity_us;                               /* the sequence takes both */
+            }
+        }
+        
+        sensor(const sensor &) = delete;
+        sensor &operator=(const sensor &) = delete;
+        
+        /**
+         * @brief  get the conversion wait
+         * @return wait in us
+         * @note   none
+         */
+        uint32_t conversion_us() const noexcept
+        {
+            return m_wait_us;        /* return the wait */
+        }
+        
+        /**
+         * @brief  read the temperature and humidity
+         * @return awaitable sample with status
+         *         - 0 success
+         *         - 1 read failed
+         *         - 2 handle is NULL
+         *         - 3 handle is not initialized
+         *         - 4 a read is in flight
+         * @note   co_await sensor.read(), the fetch is retried every ms while the chip naks
+         */
+        task<result<sample>> read()
+        {
+            result<sample> r = {4, {}};
+            sample &s = r.value;
+            uint8_t i;
+            
+            if (m_busy)                                                                                 /* check the read in flight */
+            {
+                co_return r;                                                                            /* return error */
+            }
+            m_busy = true;                                                                              /* set busy */
+            r.status = hdc1080_start_temperature_humidity(m_handle);                                    /* trigger the conversion */
+            if (r.status == 0)                                                                          /* check result */
+            {
+                co_await m_executor.sleep_us(m_wait_us);                                                /* suspend for the conversion */
+                for (i = 0; i < FETCH_RETRY; i++)                                                       /* retry the fetch */
+                {
+                    r.status = hdc1080_fetch_temperature_humidity(m_handle, &s.temperature_raw, &s.temperature,
+                                                                  &s.humidity_raw, &s.humidity);        /* fetch */
+                    if (r.status != 1)                                                                  /* done or not retried */
+                    {
+                        break;                                                                          /* break */
+                    }
+                    m_retries++;                                                                        /* count the nak */
+                    co_await m_executor.sleep_us(1000);                                                 /* suspend 1ms */
+                }
+            }
+            m_busy = false;                                                                             /* clear busy */
+            
+            co_return r;                                                                                /* return the sample */
+        }
+        
+        /**
+         * @brief  get the fetch retries
+         * @return retried fetches
+         * @note   none
+         */
+        uint32_t retries() const noexcept
+        {
+            return m_retries;        /* return the count */
+        }
+        
+    private:
+        hdc1080_handle_t *m_handle;        /**< c driver handle */
+        executor &m_executor;              /**< executor */
+        uint32_t m_wait_us;                /**< conversion wait */
+        uint32_t m_retries;                /**< fetch retries */
+        bool m_busy;                       /**< read in flight */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cov.c
+ * @brief     driver hdc1080 cov source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_cov.h"
+
+/**
+ * @brief     convert a band to raw code
+ * @param[in] band band value
+ * @param[in] span full scale of the channel
+ * @return    raw code
+ * @note      none
+ */
+static uint16_t a_hdc1080_cov_band(float band, float span)
+{
+    float raw;
+    
+    raw = band * HDC1080_RAW_SPAN / span + 0.5f;        /* to raw code */
+    if (raw > 65535.0f)                                 /* check the range */
+    {
+        return 65535;                                   /* clamp */
+    }
+    
+    return (uint16_t)raw;                               /* return the raw code */
+}
+
+/**
+ * @brief      check one channel
+ * @param[in]  *channel pointer to a channel structure
+ * @param[in]  raw raw code
+ * @return     1 if the channel leaves its band, else 0
+ * @note       none
+ */
+static uint8_t a_hdc1080_cov_channel(const hdc1080_cov_channel_t *channel, uint16_t raw)
+{
+    int32_t diff;
+    int32_t band;
+    
+    diff = (int32_t)raw - (int32_t)channel->last;                                                    /* change since the last report */
+    band = channel->deadband;                                                                        /* set the deadband */
+    if (((diff > 0) && (channel->direction < 0)) || ((diff < 0) && (channel->direction > 0)))        /* change of direction */
+    {
+        band += channel->hysteresis;                                                                 /* add the hysteresis */
+    }
+    
+    return ((diff > band) || (diff < -band)) ? 1 : 0;                                                /* check the band */
+}
+
+/**
+ * @brief     update one channel after a report
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] raw raw code
+ * @note      none
+ */
+static void a_hdc1080_cov_update(hdc1080_cov_channel_t *channel, uint16_t raw)
+{
+    if (raw > channel->last)             /* up */
+    {
+        channel->direction = 1;          /* set up */
+    }
+    else if (raw < channel->last)        /* down */
+    {
+        channel->direction = -1;         /* set down */
+    }
+    else
+    {
+                                         /* keep the direction */
+    }
+    channel->last = raw;                 /* save the raw code */
+}
+
+/**
+ * @brief     initialize the cov filter
+ * @param[in] *cov pointer to a cov structure
+ * @param[in] temperature_deadband temperature deadband in C
+ * @param[in] humidity_deadband humidity deadband in %
+ * @param[in] temperature_hysteresis temperature hysteresis in C
+ * @param[in] humidity_hysteresis humidity hysteresis in %
+ * @param[in] heartbeat_ms max interval between reports in ms, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 cov is NULL
+ *            - 4 param is invalid
+ * @note      the bands are converted to raw codes once here, the check itself has no float arithmetic
+ */
+uint8_t hdc1080_cov_init(hdc1080_cov_t *cov, float temperature_deadband, float humidity_deadband,
+                         float temperature_hysteresis, float humidity_hysteresis, uint32_t heartbeat_ms)
+{
+    if (cov == NULL)                                                                                           /* check cov */
+    {
+        return 2;                                                                                              /* return error */
+    }
+    if ((temperature_deadband < 0.0f) || (humidity_deadband < 0.0f) ||
+        (temperature_hysteresis < 0.0f) || (humidity_hysteresis < 0.0f))                                       /* check the bands */
+    {
+        return 4;                                                                                              /* return error */
+    }
+    
+    memset(cov, 0, sizeof(hdc1080_cov_t));                                                                     /* clear all */
+    cov->temperature.deadband = a_hdc1080_cov_band(temperature_deadband, HDC1080_TEMPERATURE_SPAN);            /* set temperature deadband */
+    cov->temperature.hysteresis = a_hdc1080_cov_band(temperature_hysteresis, HDC1080_TEMPERATURE_SPAN);        /* set temperature hysteresis */
+    cov->humidity.deadband = a_hdc1080_cov_band(humidity_deadband, HDC1080_HUMIDITY_SPAN);                     /* set humidity deadband */
+    cov->humidity.hysteresis = a_hdc1080_cov_band(humidity_hysteresis, HDC1080_HUMIDITY_SPAN);                 /* set humidity hysteresis */
+    cov->heartbeat_ms = heartbeat_ms;                                                                          /* set the heartbeat */
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      check a sample
+ * @param[in]  *cov pointer to a cov structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *report pointer to a report buffer, 0 means suppressed, else a HDC1080_COV_REPORT_* mask
+ * @return     status code
+ *             - 0 success
+ *             - 2 cov or report is NULL
+ * @note       a channel reports when it moves more than the deadband from the last report, or more than the deadband
+ *             plus the hysteresis when it moves against the direction of its last change, so a value that toggles
+ *             between two codes at the band edge does not report every sample, the heartbeat reports when heartbeat_ms
+ *             passed since the last report, a report updates both channels
+ */
+uint8_t hdc1080_cov_check(hdc1080_cov_t *cov, uint32_t timestamp_ms, uint16_t temperature_raw,
+                          uint16_t humidity_raw, uint8_t *report)
+{
+    uint8_t mask = 0;
+    
+    if ((cov == NULL) || (report == NULL))                                                           /* check cov */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    
+    if (cov->reported == 0)                                                                          /* first sample */
+    {
+        mask |= HDC1080_COV_REPORT_FIRST;                                                            /* report */
+    }
+    else
+    {
+        if (a_hdc1080_cov_channel(&cov->temperature, temperature_raw) != 0)                          /* temperature */
+        {
+            mask |= HDC1080_COV_REPORT_TEMPERATURE;                                                  /* report */
+        }
+        if (a_hdc1080_cov_channel(&cov->humidity, humidity_raw) != 0)                                /* humidity */
+        {
+            mask |= HDC1080_COV_REPORT_HUMIDITY;                                                     /* report */
+        }
+        if ((cov->heartbeat_ms != 0) && ((timestamp_ms - cov->last_ms) >= cov->heartbeat_ms))        /* heartbeat */
+        {
+            mask |= HDC1080_COV_REPORT_HEARTBEAT;                                                    /* report */
+        }
+    }
+    if (mask == 0)                                                                                   /* inside the bands */
+    {
+        cov->suppressed++;                                                                           /* suppressed + 1 */
+        *report = 0;                                                                                 /* suppress */
+        
+        return 0;                                                                                    /* success return 0 */
+    }
+    
+    if (cov->reported == 0)                                                                          /* first sample */
+    {
+        cov->temperature.last = temperature_raw;                                                     /* set temperature */
+        cov->humidity.last = humidity_raw;                                                           /* set humidity */
+        cov->reported = 1;                                                                           /* set reported */
+    }
+    else
+    {
+        a_hdc1080_cov_update(&cov->temperature, temperature_raw);                                    /* update temperature */
+        a_hdc1080_cov_update(&cov->humidity, humidity_raw);                                          /* update humidity */
+    }
+    cov->last_ms = timestamp_ms;                                                                     /* save the time */
+    *report = mask;                                                                                  /* set the report */
+    
+    return 0;                                                                                        /* success return 0 */
+}
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cov.h
+ * @brief     driver hdc1080 cov header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_COV_H
+#define DRIVER_HDC1080_COV_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_cov_driver hdc1080 cov driver function
+ * @brief    hdc1080 change of value driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 cov report reason definition
+ */
+#define HDC1080_COV_REPORT_FIRST              (1 << 0)        /**< first sample */
+#define HDC1080_COV_REPORT_TEMPERATURE        (1 << 1)        /**< temperature left the deadband */
+#define HDC1080_COV_REPORT_HUMIDITY           (1 << 2)        /**< humidity left the deadband */
+#define HDC1080_COV_REPORT_HEARTBEAT          (1 << 3)        /**< heartbeat interval elapsed */
+
+/**
+ * @brief hdc1080 cov channel structure definition
+ */
+typedef struct hdc1080_cov_channel_s
+{
+    uint16_t deadband;          /**< deadband in raw code */
+    uint16_t hysteresis;        /**< extra band for a change of direction in raw code */
+    uint16_t last;              /**< last reported raw code */
+    int8_t direction;           /**< direction of the last change, 1 up, -1 down, 0 none */
+} hdc1080_cov_channel_t;
+
+/**
+ * @brief hdc1080 cov structure definition
+ */
+typedef struct hdc1080_cov_s
+{
+    hdc1080_cov_channel_t temperature;        /**< temperature channel */
+    hdc1080_cov_channel_t humidity;           /**< humidity channel */
+    uint32_t heartbeat_ms;                    /**< max interval between reports in ms, 0 disables it */
+    uint32_t last_ms;                         /**< last report time in ms */
+    uint32_t suppressed;                      /**< suppressed sample number */
+    uint8_t reported;                         /**< reported flag */
+} hdc1080_cov_t;
+
+/**
+ * @brief     initialize the cov filter
+ * @param[in] *cov pointer to a cov structure
+ * @param[in] temperature_deadband temperature deadband in C
+ * @param[in] humidity_deadband humidity deadband in %
+ * @param[in] temperature_hysteresis temperature hysteresis in C
+ * @param[in] humidity_hysteresis humidity hysteresis in %
+ * @param[in] heartbeat_ms max interval between reports in ms, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 cov is NULL
+ *            - 4 param is invalid
+ * @note      the bands are converted to raw codes once here, the check itself has no float arithmetic
+ */
+uint8_t hdc1080_cov_init(hdc1080_cov_t *cov, float temperature_deadband, float humidity_deadband,
+                         float temperature_hysteresis, float humidity_hysteresis, uint32_t heartbeat_ms);
+
+/**
+ * @brief      check a sample
+ * @param[in]  *cov pointer to a cov structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *report pointer to a report buffer, 0 means suppressed, else a HDC1080_COV_REPORT_* mask
+ * @return     status code
+ *             - 0 success
+ *             - 2 cov or report is NULL
+ * @note       a channel reports when it moves more than the deadband from the last report, or more than the deadband
+ *             plus the hysteresis when it moves against the direction of its last change, so a value that toggles
+ *             between two codes at the band edge does not report every sample, the heartbeat reports when heartbeat_ms
+ *             passed since the last report, a report updates both channels
+ */
+uint8_t hdc1080_cov_check(hdc1080_cov_t *cov, uint32_t timestamp_ms, uint16_t temperature_raw,
+                          uint16_t humidity_raw, uint8_t *report);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
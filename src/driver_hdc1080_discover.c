@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_discover.c
+ * @brief     driver hdc1080 discover source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_discover.h"
+
+/**
+ * @brief     add a found sensor
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] mux 7 bit mux address, 0 if none
+ * @param[in] channel mux channel
+ * @param[in] *id pointer to a serial id
+ * @return    status code
+ *            - 0 success
+ *            - 1 entry buffer is full
+ * @note      none
+ */
+static uint8_t a_hdc1080_discover_add(hdc1080_discover_t *discover, uint8_t mux, uint8_t channel, const uint8_t id[6])
+{
+    hdc1080_discover_entry_t *e;
+    
+    if (discover->entry_num >= discover->entry_max)        /* check the buffer */
+    {
+        return 1;                                          /* return error */
+    }
+    
+    e = &discover->entry[discover->entry_num];             /* get the next entry */
+    memcpy(e->serial_id, id, 6);                           /* copy the serial id */
+    e->bus = discover->bus;                                /* set the bus */
+    e->mux = mux;                                          /* set the mux */
+    e->channel = channel;                                  /* set the channel */
+    discover->entry_num++;                                 /* one more sensor */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     initialize the discovery of one bus
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] bus bus index copied into the entries
+ * @param[in] *handle pointer to a linked hdc1080 handle of the bus
+ * @param[in] *mux_write pointer to a mux control write function, it may be NULL without muxes
+ * @param[in] *entry pointer to an entry buffer
+ * @param[in] entry_max entry buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 discover, handle or entry is NULL
+ *            - 3 iic_init or iic_deinit of the handle is NULL
+ * @note      mux_write writes the control byte of a TCA9548A style mux, bit n opens channel n
+ */
+uint8_t hdc1080_discover_init(hdc1080_discover_t *discover, uint8_t bus, hdc1080_handle_t *handle,
+                              uint8_t (*mux_write)(uint8_t addr, uint8_t mask),
+                              hdc1080_discover_entry_t *entry, uint16_t entry_max)
+{
+    if ((discover == NULL) || (handle == NULL) || (entry == NULL))         /* check the args */
+    {
+        return 2;                                                          /* return error */
+    }
+    if ((handle->iic_init == NULL) || (handle->iic_deinit == NULL))        /* check the bus functions */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    memset(discover, 0, sizeof(hdc1080_discover_t));                       /* clear all */
+    discover->handle = handle;                                             /* set the handle */
+    discover->mux_write = mux_write;                                       /* set mux_write */
+    discover->entry = entry;                                               /* set the entry buffer */
+    discover->entry_max = entry_max;                                       /* set the buffer length */
+    discover->bus = bus;                                                   /* set the bus index */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     add a mux to probe
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] addr 7 bit mux address
+ * @return    status code
+ *            - 0 success
+ *            - 2 discover is NULL
+ *            - 4 too many muxes
+ *            - 5 addr is invalid or mux_write is NULL
+ * @note      TCA9548A muxes use 0x70 - 0x77
+ */
+uint8_t hdc1080_discover_add_mux(hdc1080_discover_t *discover, uint8_t addr)
+{
+    if (discover == NULL)                                                     /* check discover */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (discover->mux_num >= HDC1080_DISCOVER_MAX_MUX)                        /* check the mux number */
+    {
+        return 4;                                                             /* return error */
+    }
+    if ((addr == 0) || (addr > 0x7F) || (discover->mux_write == NULL))        /* check the address */
+    {
+        return 5;                                                             /* return error */
+    }
+    
+    discover->mux[discover->mux_num] = addr;                                  /* save the address */
+    discover->mux_num++;                                                      /* one more mux */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     scan the bus
+ * @param[in] *discover pointer to a discover structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init or deinit failed
+ *            - 2 discover is NULL
+ *            - 3 linked functions of the handle is NULL
+ *            - 4 entry buffer is full
+ * @note      every mux is closed first and a mux that does not take the write is skipped with its channels,
+ *            then the bus itself and every channel of the found muxes get one hdc1080_probe without a reset,
+ *            a chip on the bus itself answers on every channel so the channels are not probed then,
+ *            all muxes are closed at the end, runs of independent buses may be called from parallel threads
+ */
+uint8_t hdc1080_discover_run(hdc1080_discover_t *discover)
+{
+    uint8_t res;
+    uint8_t full;
+    uint8_t i;
+    uint8_t c;
+    uint8_t id[6];
+    
+    if (discover == NULL)                                                                    /* check discover */
+    {
+        return 2;                                                                            /* return error */
+    }
+    
+    discover->entry_num = 0;                                                                 /* clear the entries */
+    discover->probes = 0;                                                                    /* clear the probes */
+    discover->mux_writes = 0;                                                                /* clear the mux writes */
+    discover->mux_found = 0;                                                                 /* no mux found yet */
+    full = 0;                                                                                /* not full */
+    if (discover->handle->iic_init() != 0)                                                   /* iic init */
+    {
+        return 1;                                                                            /* return error */
+    }
+    for (i = 0; i < discover->mux_num; i++)                                                  /* close every mux */
+    {
+        discover->mux_writes++;                                                              /* count the write */
+        if (discover->mux_write(discover->mux[i], 0x00) == 0)                                /* a missing mux naks */
+        {
+            discover->mux_found |= (uint8_t)(1 << i);                                        /* mark found */
+        }
+    }
+    discover->probes++;                                                                      /* count the probe */
+    res = hdc1080_probe(discover->handle, id);                                               /* probe the bus itself */
+    if (res == 0)                                                                            /* check result */
+    {
+        full = a_hdc1080_discover_add(discover, 0, 0, id);                                   /* add the sensor */
+    }
+    else if ((res == 2) || (res == 3))                                                       /* check the handle */
+    {
+        (void)discover->handle->iic_deinit();                                                /* iic deinit */
+        
+        return 3;                                                                            /* return error */
+    }
+    else
+    {
+        for (i = 0; (i < discover->mux_num) && (full == 0); i++)                             /* every found mux */
+        {
+            if ((discover->mux_found & (1 << i)) == 0)                                       /* check found */
+            {
+                continue;                                                                    /* skip the mux */
+            }
+            for (c = 0; (c < HDC1080_DISCOVER_CHANNELS) && (full == 0); c++)                 /* every channel */
+            {
+                discover->mux_writes++;                                                      /* count the write */
+                if (discover->mux_write(discover->mux[i], (uint8_t)(1 << c)) != 0)           /* open the channel */
+                {
+                    continue;                                                                /* skip the channel */
+                }
+                discover->probes++;                                                          /* count the probe */
+                if (hdc1080_probe(discover->handle, id) == 0)                                /* probe the channel */
+                {
+                    full = a_hdc1080_discover_add(discover, discover->mux[i], c, id);        /* add the sensor */
+                }
+            }
+            discover->mux_writes++;                                                          /* count the write */
+            (void)discover->mux_write(discover->mux[i], 0x00);                               /* close the mux */
+        }
+    }
+    if (discover->handle->iic_deinit() != 0)                                                 /* iic deinit */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    return (full != 0) ? 4 : 0;                                                              /* return the result */
+}
+
+/**
+ * @brief     route the bus to a found sensor
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] *entry pointer to a found entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux write failed
+ *            - 2 discover or entry is NULL
+ *            - 4 entry is of another bus
+ * @note      the channel of the entry is opened and every other found mux is closed,
+ *            hdc1080_init of the handle then only initializes the sensors that are used
+ */
+uint8_t hdc1080_discover_select(hdc1080_discover_t *discover, const hdc1080_discover_entry_t *entry)
+{
+    uint8_t i;
+    uint8_t mask;
+    
+    if ((discover == NULL) || (entry == NULL))                       /* check the args */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (entry->bus != discover->bus)                                 /* check the bus */
+    {
+        return 4;                                                    /* return error */
+    }
+    
+    for (i = 0; i < discover->mux_num; i++)                          /* every found mux */
+    {
+        if ((discover->mux_found & (1 << i)) == 0)                   /* check found */
+        {
+            continue;                                                /* skip the mux */
+        }
+        mask = 0x00;                                                 /* close the mux */
+        if (discover->mux[i] == entry->mux)                          /* check the mux of the entry */
+        {
+            mask = (uint8_t)(1 << entry->channel);                   /* open the channel */
+        }
+        if (discover->mux_write(discover->mux[i], mask) != 0)        /* write the control byte */
+        {
+            return 1;                                                /* return error */
+        }
+    }
+    
+    return 0;                                                        /* success return 0 */
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_discover.h
+ * @brief     driver hdc1080 discover header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_DISCOVER_H
+#define DRIVER_HDC1080_DISCOVER_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_discover_driver hdc1080 discover driver function
+ * @brief    hdc1080 sensor discovery driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 discover definition
+ */
+#define HDC1080_DISCOVER_MAX_MUX        8        /**< max muxes of one bus */
+#define HDC1080_DISCOVER_CHANNELS       8        /**< channels of one mux */
+
+/**
+ * @brief hdc1080 discover entry structure definition
+ */
+typedef struct hdc1080_discover_entry_s
+{
+    uint8_t serial_id[6];        /**< serial id */
+    uint8_t bus;                 /**< bus index */
+    uint8_t mux;                 /**< 7 bit mux address, 0 if the chip sits on the bus itself */
+    uint8_t channel;             /**< mux channel */
+} hdc1080_discover_entry_t;
+
+/**
+ * @brief hdc1080 discover structure definition
+ * @note  one structure scans one bus, the structures of independent buses share nothing
+ */
+typedef struct hdc1080_discover_s
+{
+    hdc1080_handle_t *handle;                               /**< linked handle of the bus, it is not initialized */
+    uint8_t (*mux_write)(uint8_t addr, uint8_t mask);       /**< point to a mux control write function address, 0 means written */
+    hdc1080_discover_entry_t *entry;                        /**< found sensors */
+    uint16_t entry_max;                                     /**< entry buffer length */
+    uint16_t entry_num;                                     /**< found sensor number */
+    uint16_t probes;                                        /**< probed positions of the last run */
+    uint16_t mux_writes;                                    /**< mux control writes of the last run */
+    uint8_t mux[HDC1080_DISCOVER_MAX_MUX];                  /**< 7 bit mux addresses */
+    uint8_t mux_num;                                        /**< mux number */
+    uint8_t mux_found;                                      /**< bit i is set when mux[i] answered */
+    uint8_t bus;                                            /**< bus index */
+} hdc1080_discover_t;
+
+/**
+ * @brief     initialize the discovery of one bus
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] bus bus index copied into the entries
+ * @param[in] *handle pointer to a linked hdc1080 handle of the bus
+ * @param[in] *mux_write pointer to a mux control write function, it may be NULL without muxes
+ * @param[in] *entry pointer to an entry buffer
+ * @param[in] entry_max entry buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 discover, handle or entry is NULL
+ *            - 3 iic_init or iic_deinit of the handle is NULL
+ * @note      mux_write writes the control byte of a TCA9548A style mux, bit n opens channel n
+ */
+uint8_t hdc1080_discover_init(hdc1080_discover_t *discover, uint8_t bus, hdc1080_handle_t *handle,
+                              uint8_t (*mux_write)(uint8_t addr, uint8_t mask),
+                              hdc1080_discover_entry_t *entry, uint16_t entry_max);
+
+/**
+ * @brief     add a mux to probe
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] addr 7 bit mux address
+ * @return    status code
+ *            - 0 success
+ *            - 2 discover is NULL
+ *            - 4 too many muxes
+ *            - 5 addr is invalid or mux_write is NULL
+ * @note      TCA9548A muxes use 0x70 - 0x77
+ */
+uint8_t hdc1080_discover_add_mux(hdc1080_discover_t *discover, uint8_t addr);
+
+/**
+ * @brief     scan the bus
+ * @param[in] *discover pointer to a discover structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init or deinit failed
+ *            - 2 discover is NULL
+ *            - 3 linked functions of the handle is NULL
+ *            - 4 entry buffer is full
+ * @note      every mux is closed first and a mux that does not take the write is skipped with its channels,
+ *            then the bus itself and every channel of the found muxes get one hdc1080_probe without a reset,
+ *            a chip on the bus itself answers on every channel so the channels are not probed then,
+ *            all muxes are closed at the end, runs of independent buses may be called from parallel threads
+ */
+uint8_t hdc1080_discover_run(hdc1080_discover_t *discover);
+
+/**
+ * @brief     route the bus to a found sensor
+ * @param[in] *discover pointer to a discover structure
+ * @param[in] *entry pointer to a found entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 mux write failed
+ *            - 2 discover or entry is NULL
+ *            - 4 entry is of another bus
+ * @note      the channel of the entry is opened and every other found mux is closed,
+ *            hdc1080_init of the handle then only initializes the sensors that are used
+ */
+uint8_t hdc1080_discover_select(hdc1080_discover_t *discover, const hdc1080_discover_entry_t *entry);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
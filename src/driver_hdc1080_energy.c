@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_energy.c
+ * @brief     driver hdc1080 energy source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_energy.h"
+
+/**
+ * @brief energy model iic bit definition
+ */
+#define HDC1080_ENERGY_TRIGGER_BITS           20        /**< start, address, pointer and stop */
+#define HDC1080_ENERGY_READ_HEADER_BITS       11        /**< start, address and stop */
+#define HDC1080_ENERGY_BYTE_BITS              9         /**< one byte and ack */
+
+/**
+ * @brief      initialize the energy parameter with the default values
+ * @param[out] *param pointer to an energy parameter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ * @note       none
+ */
+uint8_t hdc1080_energy_init_param(hdc1080_energy_param_t *param)
+{
+    if (param == NULL)                                                      /* check param */
+    {
+        return 2;                                                           /* return error */
+    }
+    
+    param->supply_v = HDC1080_ENERGY_DEFAULT_SUPPLY_V;                      /* set supply voltage */
+    param->temperature_ua = HDC1080_ENERGY_DEFAULT_TEMPERATURE_UA;          /* set temperature current */
+    param->humidity_ua = HDC1080_ENERGY_DEFAULT_HUMIDITY_UA;                /* set humidity current */
+    param->sensor_sleep_ua = HDC1080_ENERGY_DEFAULT_SENSOR_SLEEP_UA;        /* set sensor sleep current */
+    param->mcu_active_ua = HDC1080_ENERGY_DEFAULT_MCU_ACTIVE_UA;            /* set mcu run current */
+    param->mcu_sleep_ua = HDC1080_ENERGY_DEFAULT_MCU_SLEEP_UA;              /* set mcu sleep current */
+    param->mcu_wakeup_us = HDC1080_ENERGY_DEFAULT_MCU_WAKEUP_US;            /* set mcu wake up time */
+    param->mcu_process_us = HDC1080_ENERGY_DEFAULT_MCU_PROCESS_US;          /* set mcu processing time */
+    param->iic_hz = HDC1080_ENERGY_DEFAULT_IIC_HZ;                          /* set iic clock */
+    param->wait = HDC1080_ENERGY_WAIT_SLEEP;                                /* sleep across the conversion */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      estimate the energy per sample
+ * @param[in]  *param pointer to an energy parameter structure
+ * @param[in]  mode chip mode
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[in]  period_ms sample period in ms
+ * @param[out] *energy pointer to an energy result structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 period is shorter than one sample
+ *             - 2 param is NULL
+ *             - 4 param is invalid
+ * @note       one sample reads both channels, the sequence mode uses one trigger and one 4 byte read,
+ *             the or mode uses a trigger and a 2 byte read for each channel and wakes the mcu twice as often
+ */
+uint8_t hdc1080_energy_estimate(const hdc1080_energy_param_t *param, hdc1080_mode_t mode,
+                                hdc1080_temperature_resolution_t temperature_resolution,
+                                hdc1080_humidity_resolution_t humidity_resolution,
+                                uint32_t period_ms, hdc1080_energy_t *energy)
+{
+    uint32_t temperature_us;
+    uint32_t humidity_us;
+    uint32_t bits;
+    uint32_t wakeups;
+    float period_us;
+    float iic_us;
+    float busy_us;
+    
+    if ((param == NULL) || (energy == NULL))                                                               /* check param */
+    {
+        return 2;                                                                                          /* return error */
+    }
+    if (hdc1080_get_conversion_time(temperature_resolution, humidity_resolution,
+                                    &temperature_us, &humidity_us) != 0)                                   /* get conversion time */
+    {
+        return 4;                                                                                          /* return error */
+    }
+    if (param->iic_hz <= 0.0f)                                                                             /* check iic clock */
+    {
+        return 4;                                                                                          /* return error */
+    }
+    
+    if (mode == HDC1080_MODE_SEQUENCE)                                                                     /* sequence mode */
+    {
+        bits = HDC1080_ENERGY_TRIGGER_BITS + HDC1080_ENERGY_READ_HEADER_BITS +
+               4 * HDC1080_ENERGY_BYTE_BITS;                                                               /* one trigger and 4 bytes */
+        wakeups = 2;                                                                                       /* trigger and fetch */
+    }
+    else if (mode == HDC1080_MODE_OR)                                                                      /* or mode */
+    {
+        bits = 2 * (HDC1080_ENERGY_TRIGGER_BITS + HDC1080_ENERGY_READ_HEADER_BITS +
+               2 * HDC1080_ENERGY_BYTE_BITS);                                                              /* two triggers and 2 bytes each */
+        wakeups = 4;                                                                                       /* trigger and fetch twice */
+    }
+    else
+    {
+        return 4;                                                                                          /* return error */
+    }
+    
+    period_us = (float)period_ms * 1000.0f;                                                                /* get the period */
+    iic_us = (float)bits * 1000000.0f / param->iic_hz;                                                     /* get the bus time */
+    energy->conversion_us = (float)(temperature_us + humidity_us);                                         /* set conversion time */
+    energy->active_us = (float)wakeups * param->mcu_wakeup_us + iic_us + param->mcu_process_us;            /* set mcu run time */
+    busy_us = (param->wait == HDC1080_ENERGY_WAIT_BUSY) ? energy->conversion_us : 0.0f;                    /* busy wait time */
+    if ((energy->conversion_us + energy->active_us) > period_us)                                           /* check the period */
+    {
+        return 1;                                                                                          /* return error */
+    }
+    
+    energy->sensor_uj = param->supply_v * (param->temperature_ua * (float)temperature_us +
+                        param->humidity_ua * (float)humidity_us +
+                        param->sensor_sleep_ua * (period_us - energy->conversion_us)) / 1000000.0f;        /* sensor energy */
+    energy->mcu_uj = param->supply_v * (param->mcu_active_ua * (energy->active_us + busy_us) +
+                     param->mcu_sleep_ua * (period_us - energy->active_us - busy_us)) / 1000000.0f;        /* mcu energy */
+    energy->total_uj = energy->sensor_uj + energy->mcu_uj;                                                 /* total energy */
+    energy->average_ua = energy->total_uj / param->supply_v / period_us * 1000000.0f;                      /* average current */
+    
+    return 0;                                                                                              /* success return 0 */
+}
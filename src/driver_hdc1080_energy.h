@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_energy.h
+ * @brief     driver hdc1080 energy header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_ENERGY_H
+#define DRIVER_HDC1080_ENERGY_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_energy_driver hdc1080 energy driver function
+ * @brief    hdc1080 energy driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 energy model default definition
+ * @note  the sensor values are datasheet typical values, the mcu values describe a low power node and must be
+ *        replaced with the numbers of the real board
+ */
+#define HDC1080_ENERGY_DEFAULT_SUPPLY_V                3.0f         /**< supply voltage */
+#define HDC1080_ENERGY_DEFAULT_TEMPERATURE_UA          160.0f       /**< temperature conversion current */
+#define HDC1080_ENERGY_DEFAULT_HUMIDITY_UA             190.0f       /**< humidity conversion current */
+#define HDC1080_ENERGY_DEFAULT_SENSOR_SLEEP_UA         0.1f         /**< sensor sleep current */
+#define HDC1080_ENERGY_DEFAULT_MCU_ACTIVE_UA           3000.0f      /**< mcu run current */
+#define HDC1080_ENERGY_DEFAULT_MCU_SLEEP_UA            2.0f         /**< mcu sleep current */
+#define HDC1080_ENERGY_DEFAULT_MCU_WAKEUP_US           50.0f        /**< mcu wake up time per wake up */
+#define HDC1080_ENERGY_DEFAULT_MCU_PROCESS_US          50.0f        /**< mcu processing time per sample */
+#define HDC1080_ENERGY_DEFAULT_IIC_HZ                  100000.0f    /**< iic bus clock */
+
+/**
+ * @brief hdc1080 energy wait enumeration definition
+ */
+typedef enum
+{
+    HDC1080_ENERGY_WAIT_SLEEP = 0x00,        /**< the mcu sleeps across the conversion */
+    HDC1080_ENERGY_WAIT_BUSY  = 0x01,        /**< the mcu busy waits across the conversion */
+} hdc1080_energy_wait_t;
+
+/**
+ * @brief hdc1080 energy parameter structure definition
+ */
+typedef struct hdc1080_energy_param_s
+{
+    float supply_v;                  /**< supply voltage */
+    float temperature_ua;            /**< temperature conversion current */
+    float humidity_ua;               /**< humidity conversion current */
+    float sensor_sleep_ua;           /**< sensor sleep current */
+    float mcu_active_ua;             /**< mcu run current */
+    float mcu_sleep_ua;              /**< mcu sleep current */
+    float mcu_wakeup_us;             /**< mcu wake up time per wake up */
+    float mcu_process_us;            /**< mcu processing time per sample */
+    float iic_hz;                    /**< iic bus clock */
+    hdc1080_energy_wait_t wait;      /**< conversion wait type */
+} hdc1080_energy_param_t;
+
+/**
+ * @brief hdc1080 energy result structure definition
+ */
+typedef struct hdc1080_energy_s
+{
+    float conversion_us;             /**< conversion time per sample */
+    float active_us;                 /**< mcu run time per sample */
+    float sensor_uj;                 /**< sensor energy per sample */
+    float mcu_uj;                    /**< mcu energy per sample */
+    float total_uj;                  /**< total energy per sample */
+    float average_ua;                /**< average current */
+} hdc1080_energy_t;
+
+/**
+ * @brief      initialize the energy parameter with the default values
+ * @param[out] *param pointer to an energy parameter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ * @note       none
+ */
+uint8_t hdc1080_energy_init_param(hdc1080_energy_param_t *param);
+
+/**
+ * @brief      estimate the energy per sample
+ * @param[in]  *param pointer to an energy parameter structure
+ * @param[in]  mode chip mode
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[in]  period_ms sample period in ms
+ * @param[out] *energy pointer to an energy result structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 period is shorter than one sample
+ *             - 2 param is NULL
+ *             - 4 param is invalid
+ * @note       one sample reads both channels, the sequence mode uses one trigger and one 4 byte read,
+ *             the or mode uses a trigger and a 2 byte read for each channel and wakes the mcu twice as often
+ */
+uint8_t hdc1080_energy_estimate(const hdc1080_energy_param_t *param, hdc1080_mode_t mode,
+                                hdc1080_temperature_resolution_t temperature_resolution,
+                                hdc1080_humidity_resolution_t humidity_resolution,
+                                uint32_t period_ms, hdc1080_energy_t *energy);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
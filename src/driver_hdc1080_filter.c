@@ -0,0 +1,309 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_filter.c
+ * @brief     driver hdc1080 filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_filter.h"
+
+/**
+ * @brief      convert a sigma to q8 raw code^2
+ * @param[in]  sigma one sigma noise
+ * @param[in]  span full scale of the channel
+ * @param[out] *var pointer to a variance buffer
+ * @return     1 if the sigma is out of range, else 0
+ * @note       none
+ */
+static uint8_t a_hdc1080_filter_var(float sigma, float span, uint32_t *var)
+{
+    float raw;
+    
+    raw = sigma * HDC1080_RAW_SPAN / span;               /* to raw code */
+    if ((raw < 0.0f) || (raw >= 2048.0f))                /* check the range */
+    {
+        return 1;                                        /* return error */
+    }
+    *var = (uint32_t)(raw * raw * 256.0f + 0.5f);        /* to q8 raw code^2 */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     run the ema on one channel
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] raw raw code
+ * @return    filtered raw code
+ * @note      x - x / 2^shift + z / 2^shift is a convex sum, so it stays in 32 bits without a signed difference
+ */
+static uint16_t a_hdc1080_filter_ema(hdc1080_filter_channel_t *channel, uint16_t raw)
+{
+    if (channel->started == 0)                                                                                       /* first sample */
+    {
+        channel->x = (uint32_t)raw << 16;                                                                            /* start from the sample */
+        channel->started = 1;                                                                                        /* set started */
+    }
+    else
+    {
+        channel->x = channel->x - (channel->x >> channel->shift) + (((uint32_t)raw << 16) >> channel->shift);        /* x += (z - x) / 2^shift */
+    }
+    
+    return (uint16_t)((channel->x + 0x8000U) >> 16);                                                                 /* round to raw code */
+}
+
+/**
+ * @brief     run the kalman filter on one channel
+ * @param[in] *channel pointer to a channel structure
+ * @param[in] raw raw code
+ * @return    filtered raw code
+ * @note      the gain is a 32 bit division on operands scaled below 2^16, so no 64 bit division is needed
+ */
+static uint16_t a_hdc1080_filter_kalman(hdc1080_filter_channel_t *channel, uint16_t raw)
+{
+    uint32_t p;
+    uint32_t s;
+    uint32_t k;
+    int32_t diff;
+    
+    if (channel->started == 0)                                                                 /* first sample */
+    {
+        channel->x = (uint32_t)raw << 16;                                                      /* start from the sample */
+        channel->p = channel->r;                                                               /* the error is one measurement */
+        channel->started = 1;                                                                  /* set started */
+        
+        return raw;                                                                            /* pass through */
+    }
+    
+    channel->p += channel->q;                                                                  /* predict */
+    p = channel->p;                                                                            /* copy the variance */
+    s = channel->p + channel->r;                                                               /* innovation variance */
+    while (s > 0xFFFFU)                                                                        /* scale below 2^16 */
+    {
+        p >>= 1;                                                                               /* p / 2 */
+        s >>= 1;                                                                               /* s / 2 */
+    }
+    k = (p << 16) / s;                                                                         /* gain in q16 */
+    diff = (int32_t)(((int64_t)((uint32_t)raw << 16) - (int64_t)channel->x) >> 8);             /* innovation in q8 */
+    channel->x = (uint32_t)((int64_t)channel->x + (((int64_t)diff * (int64_t)k) >> 8));        /* correct the estimate */
+    channel->p -= (uint32_t)(((uint64_t)channel->p * k) >> 16);                                /* p = (1 - k) * p */
+    
+    return (uint16_t)((channel->x + 0x8000U) >> 16);                                           /* round to raw code */
+}
+
+/**
+ * @brief      run the filter on one channel buffer
+ * @param[in]  type filter type
+ * @param[in]  *channel pointer to a channel structure
+ * @param[in]  *raw pointer to a raw code buffer
+ * @param[out] *out pointer to a filtered raw code buffer
+ * @param[in]  len sample number
+ * @note       the type is checked once per buffer, not once per sample
+ */
+static void a_hdc1080_filter_channel(uint8_t type, hdc1080_filter_channel_t *channel,
+                                     const uint16_t *raw, uint16_t *out, uint32_t len)
+{
+    uint32_t i;
+    
+    if (type == HDC1080_FILTER_TYPE_KALMAN)                           /* kalman */
+    {
+        for (i = 0; i < len; i++)                                     /* run all */
+        {
+            out[i] = a_hdc1080_filter_kalman(channel, raw[i]);        /* filter */
+        }
+    }
+    else
+    {
+        for (i = 0; i < len; i++)                                     /* run all */
+        {
+            out[i] = a_hdc1080_filter_ema(channel, raw[i]);           /* filter */
+        }
+    }
+}
+
+/**
+ * @brief     initialize an ema filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] temperature_shift temperature shift, the weight of a new sample is 2^-shift
+ * @param[in] humidity_shift humidity shift, the weight of a new sample is 2^-shift
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 shift is invalid
+ * @note      1 <= shift <= 15, a step reaches 63% after about 2^shift samples
+ */
+uint8_t hdc1080_filter_init_ema(hdc1080_filter_t *filter, uint8_t temperature_shift, uint8_t humidity_shift)
+{
+    if (filter == NULL)                                       /* check filter */
+    {
+        return 2;                                             /* return error */
+    }
+    if ((temperature_shift < 1) || (temperature_shift > 15) ||
+        (humidity_shift < 1) || (humidity_shift > 15))        /* check the shift */
+    {
+        return 4;                                             /* return error */
+    }
+    
+    memset(filter, 0, sizeof(hdc1080_filter_t));              /* clear all */
+    filter->temperature.shift = temperature_shift;            /* set temperature shift */
+    filter->humidity.shift = humidity_shift;                  /* set humidity shift */
+    filter->type = HDC1080_FILTER_TYPE_EMA;                   /* set ema */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     initialize a kalman filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] temperature_process temperature process noise per sample in C, one sigma
+ * @param[in] humidity_process humidity process noise per sample in %, one sigma
+ * @param[in] temperature_measurement temperature measurement noise in C, one sigma
+ * @param[in] humidity_measurement humidity measurement noise in %, one sigma
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 noise is invalid
+ * @note      the noise is converted to q8 raw code^2 once here, the update itself has no float arithmetic,
+ *            the measurement noise must be above 0 and every sigma must be less than 2048 raw codes
+ */
+uint8_t hdc1080_filter_init_kalman(hdc1080_filter_t *filter, float temperature_process, float humidity_process,
+                                   float temperature_measurement, float humidity_measurement)
+{
+    hdc1080_filter_t f;
+    
+    if (filter == NULL)                                                                                 /* check filter */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    
+    memset(&f, 0, sizeof(hdc1080_filter_t));                                                            /* clear all */
+    if ((a_hdc1080_filter_var(temperature_process, HDC1080_TEMPERATURE_SPAN, &f.temperature.q) != 0) ||
+        (a_hdc1080_filter_var(humidity_process, HDC1080_HUMIDITY_SPAN, &f.humidity.q) != 0) ||
+        (a_hdc1080_filter_var(temperature_measurement, HDC1080_TEMPERATURE_SPAN, &f.temperature.r) != 0) ||
+        (a_hdc1080_filter_var(humidity_measurement, HDC1080_HUMIDITY_SPAN, &f.humidity.r) != 0))        /* convert the noise */
+    {
+        return 4;                                                                                       /* return error */
+    }
+    if ((f.temperature.r == 0) || (f.humidity.r == 0))                                                  /* check the measurement noise */
+    {
+        return 4;                                                                                       /* return error */
+    }
+    f.type = HDC1080_FILTER_TYPE_KALMAN;                                                                /* set kalman */
+    *filter = f;                                                                                        /* copy the filter */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     reset a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      the next sample restarts the estimate, the settings are kept
+ */
+uint8_t hdc1080_filter_reset(hdc1080_filter_t *filter)
+{
+    if (filter == NULL)                     /* check filter */
+    {
+        return 2;                           /* return error */
+    }
+    
+    filter->temperature.started = 0;        /* restart temperature */
+    filter->humidity.started = 0;           /* restart humidity */
+    
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      filter a sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *temperature_out pointer to a filtered raw temperature buffer
+ * @param[out] *humidity_out pointer to a filtered raw humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or out is NULL
+ * @note       the first sample after init or reset is passed through
+ */
+uint8_t hdc1080_filter_update(hdc1080_filter_t *filter, uint16_t temperature_raw, uint16_t humidity_raw,
+                              uint16_t *temperature_out, uint16_t *humidity_out)
+{
+    if ((filter == NULL) || (temperature_out == NULL) || (humidity_out == NULL))                               /* check filter */
+    {
+        return 2;                                                                                              /* return error */
+    }
+    
+    a_hdc1080_filter_channel(filter->type, &filter->temperature, &temperature_raw, temperature_out, 1);        /* filter temperature */
+    a_hdc1080_filter_channel(filter->type, &filter->humidity, &humidity_raw, humidity_out, 1);                 /* filter humidity */
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      filter a batch of samples
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *temperature_raw pointer to a raw temperature buffer
+ * @param[in]  *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *temperature_out pointer to a filtered raw temperature buffer
+ * @param[out] *humidity_out pointer to a filtered raw humidity buffer
+ * @param[in]  len sample number
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or buffer is NULL
+ * @note       the result equals len calls of hdc1080_filter_update, the out buffers may be the raw buffers,
+ *             a channel whose raw and out buffers are both NULL is skipped and keeps its state
+ */
+uint8_t hdc1080_filter_batch(hdc1080_filter_t *filter, const uint16_t *temperature_raw, const uint16_t *humidity_raw,
+                             uint16_t *temperature_out, uint16_t *humidity_out, uint32_t len)
+{
+    if (filter == NULL)                                                                                             /* check filter */
+    {
+        return 2;                                                                                                   /* return error */
+    }
+    if (((temperature_raw == NULL) != (temperature_out == NULL)) ||
+        ((humidity_raw == NULL) != (humidity_out == NULL)))                                                         /* check the buffers */
+    {
+        return 2;                                                                                                   /* return error */
+    }
+    
+    if (temperature_raw != NULL)                                                                                    /* temperature */
+    {
+        a_hdc1080_filter_channel(filter->type, &filter->temperature, temperature_raw, temperature_out, len);        /* filter temperature */
+    }
+    if (humidity_raw != NULL)                                                                                       /* humidity */
+    {
+        a_hdc1080_filter_channel(filter->type, &filter->humidity, humidity_raw, humidity_out, len);                 /* filter humidity */
+    }
+    
+    return 0;                                                                                                       /* success return 0 */
+}
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_filter.h
+ * @brief     driver hdc1080 filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_FILTER_H
+#define DRIVER_HDC1080_FILTER_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_filter_driver hdc1080 filter driver function
+ * @brief    hdc1080 smoothing filter driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 filter type enumeration definition
+ */
+typedef enum
+{
+    HDC1080_FILTER_TYPE_EMA    = 0x00,        /**< exponential moving average */
+    HDC1080_FILTER_TYPE_KALMAN = 0x01,        /**< scalar kalman filter */
+} hdc1080_filter_type_t;
+
+/**
+ * @brief hdc1080 filter channel structure definition
+ */
+typedef struct hdc1080_filter_channel_s
+{
+    uint32_t x;            /**< estimate in q16 raw code */
+    uint32_t p;            /**< kalman error variance in q8 raw code^2 */
+    uint32_t q;            /**< kalman process noise in q8 raw code^2 */
+    uint32_t r;            /**< kalman measurement noise in q8 raw code^2 */
+    uint8_t shift;         /**< ema shift, the weight of a new sample is 2^-shift */
+    uint8_t started;       /**< started flag */
+} hdc1080_filter_channel_t;
+
+/**
+ * @brief hdc1080 filter structure definition
+ */
+typedef struct hdc1080_filter_s
+{
+    hdc1080_filter_channel_t temperature;        /**< temperature channel */
+    hdc1080_filter_channel_t humidity;           /**< humidity channel */
+    uint8_t type;                                /**< filter type */
+} hdc1080_filter_t;
+
+/**
+ * @brief     initialize an ema filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] temperature_shift temperature shift, the weight of a new sample is 2^-shift
+ * @param[in] humidity_shift humidity shift, the weight of a new sample is 2^-shift
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 shift is invalid
+ * @note      1 <= shift <= 15, a step reaches 63% after about 2^shift samples
+ */
+uint8_t hdc1080_filter_init_ema(hdc1080_filter_t *filter, uint8_t temperature_shift, uint8_t humidity_shift);
+
+/**
+ * @brief     initialize a kalman filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] temperature_process temperature process noise per sample in C, one sigma
+ * @param[in] humidity_process humidity process noise per sample in %, one sigma
+ * @param[in] temperature_measurement temperature measurement noise in C, one sigma
+ * @param[in] humidity_measurement humidity measurement noise in %, one sigma
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 noise is invalid
+ * @note      the noise is converted to q8 raw code^2 once here, the update itself has no float arithmetic,
+ *            the measurement noise must be above 0 and every sigma must be less than 2048 raw codes
+ */
+uint8_t hdc1080_filter_init_kalman(hdc1080_filter_t *filter, float temperature_process, float humidity_process,
+                                   float temperature_measurement, float humidity_measurement);
+
+/**
+ * @brief     reset a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      the next sample restarts the estimate, the settings are kept
+ */
+uint8_t hdc1080_filter_reset(hdc1080_filter_t *filter);
+
+/**
+ * @brief      filter a sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *temperature_out pointer to a filtered raw temperature buffer
+ * @param[out] *humidity_out pointer to a filtered raw humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or out is NULL
+ * @note       the first sample after init or reset is passed through
+ */
+uint8_t hdc1080_filter_update(hdc1080_filter_t *filter, uint16_t temperature_raw, uint16_t humidity_raw,
+                              uint16_t *temperature_out, uint16_t *humidity_out);
+
+/**
+ * @brief      filter a batch of samples
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *temperature_raw pointer to a raw temperature buffer
+ * @param[in]  *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *temperature_out pointer to a filtered raw temperature buffer
+ * @param[out] *humidity_out pointer to a filtered raw humidity buffer
+ * @param[in]  len sample number
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or buffer is NULL
+ * @note       the result equals len calls of hdc1080_filter_update, the out buffers may be the raw buffers,
+ *             a channel whose raw and out buffers are both NULL is skipped and keeps its state
+ */
+uint8_t hdc1080_filter_batch(hdc1080_filter_t *filter, const uint16_t *temperature_raw, const uint16_t *humidity_raw,
+                             uint16_t *temperature_out, uint16_t *humidity_out, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
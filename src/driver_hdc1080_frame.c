@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_frame.c
+ * @brief     driver hdc1080 frame source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_frame.h"
+
+/**
+ * @brief      cobs encode
+ * @param[in]  *in pointer to an input buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to an output buffer
+ * @return     output length
+ * @note       out must hold len + len / 254 + 1 bytes, no delimiter is added
+ */
+static uint16_t a_hdc1080_frame_cobs_encode(const uint8_t *in, uint16_t len, uint8_t *out)
+{
+    uint16_t i;
+    uint16_t code_index = 0;
+    uint16_t out_index = 1;
+    uint8_t code = 1;
+    
+    for (i = 0; i < len; i++)                    /* run all bytes */
+    {
+        if (in[i] == 0)                          /* zero byte */
+        {
+            out[code_index] = code;              /* close the block */
+            code_index = out_index++;            /* open a block */
+            code = 1;                            /* reset the code */
+        }
+        else
+        {
+            out[out_index++] = in[i];            /* copy the byte */
+            code++;                              /* next code */
+            if (code == 0xFF)                    /* full block */
+            {
+                out[code_index] = code;          /* close the block */
+                code_index = out_index++;        /* open a block */
+                code = 1;                        /* reset the code */
+            }
+        }
+    }
+    out[code_index] = code;                      /* close the last block */
+    
+    return out_index;                            /* return the length */
+}
+
+/**
+ * @brief      cobs decode
+ * @param[in]  *in pointer to an input buffer
+ * @param[in]  len input length
+ * @param[out] *out pointer to an output buffer
+ * @param[in]  out_len output buffer length
+ * @param[out] *decode_len pointer to a decoded length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ * @note       none
+ */
+static uint8_t a_hdc1080_frame_cobs_decode(const uint8_t *in, uint16_t len, uint8_t *out,
+                                           uint16_t out_len, uint16_t *decode_len)
+{
+    uint16_t i = 0;
+    uint16_t o = 0;
+    uint8_t j;
+    uint8_t code;
+    
+    while (i < len)                                                  /* run all blocks */
+    {
+        code = in[i++];                                              /* get the code */
+        if (code == 0)                                               /* check the code */
+        {
+            return 1;                                                /* return error */
+        }
+        for (j = 1; j < code; j++)                                   /* copy the block */
+        {
+            if ((i >= len) || (in[i] == 0) || (o >= out_len))        /* check the block */
+            {
+                return 1;                                            /* return error */
+            }
+            out[o++] = in[i++];                                      /* copy the byte */
+        }
+        if ((code != 0xFF) && (i < len))                             /* implicit zero */
+        {
+            if (o >= out_len)                                        /* check the length */
+            {
+                return 1;                                            /* return error */
+            }
+            out[o++] = 0;                                            /* add the zero */
+        }
+    }
+    *decode_len = o;                                                 /* set the length */
+    
+    return 0;                                                        /* success return 0 */
+}
+
+/**
+ * @brief     calculate the crc16
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc16 value
+ * @note      crc-16/ccitt-false, poly 0x1021 and init 0xFFFF
+ */
+uint16_t hdc1080_frame_crc16(const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t j;
+    uint16_t crc = 0xFFFF;
+    
+    for (i = 0; i < len; i++)                                 /* run all bytes */
+    {
+        crc ^= (uint16_t)((uint16_t)buf[i] << 8);             /* xor the byte */
+        for (j = 0; j < 8; j++)                               /* run all bits */
+        {
+            if ((crc & 0x8000) != 0)                          /* check the msb */
+            {
+                crc = (uint16_t)((crc << 1) ^ 0x1021);        /* shift and xor */
+            }
+            else
+            {
+                crc = (uint16_t)(crc << 1);                   /* shift */
+            }
+        }
+    }
+    
+    return crc;                                               /* return the crc */
+}
+
+/**
+ * @brief      encode a record to a frame
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a frame buffer
+ * @param[in]  len frame buffer length
+ * @param[out] *out_len pointer to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 record is NULL
+ * @note       the frame is cobs encoded and ends with the 0x00 delimiter,
+ *             all fields are little endian and the crc covers the payload before it
+ */
+uint8_t hdc1080_frame_encode(const hdc1080_frame_record_t *record, uint8_t *buf, uint16_t len, uint16_t *out_len)
+{
+    uint8_t payload[HDC1080_FRAME_PAYLOAD_SIZE];
+    uint16_t crc;
+    uint16_t l;
+    
+    if (record == NULL)                                                               /* check record */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (len < HDC1080_FRAME_MAX_SIZE)                                                 /* check the length */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    payload[0] = HDC1080_FRAME_TYPE_RECORD;                                           /* set the type */
+    payload[1] = (uint8_t)(record->seq >> 0);                                         /* set seq lsb */
+    payload[2] = (uint8_t)(record->seq >> 8);                                         /* set seq msb */
+    payload[3] = (uint8_t)(record->timestamp_ms >> 0);                                /* set timestamp */
+    payload[4] = (uint8_t)(record->timestamp_ms >> 8);                                /* set timestamp */
+    payload[5] = (uint8_t)(record->timestamp_ms >> 16);                               /* set timestamp */
+    payload[6] = (uint8_t)(record->timestamp_ms >> 24);                               /* set timestamp */
+    payload[7] = (uint8_t)(record->temperature_raw >> 0);                             /* set temperature lsb */
+    payload[8] = (uint8_t)(record->temperature_raw >> 8);                             /* set temperature msb */
+    payload[9] = (uint8_t)(record->humidity_raw >> 0);                                /* set humidity lsb */
+    payload[10] = (uint8_t)(record->humidity_raw >> 8);                               /* set humidity msb */
+    crc = hdc1080_frame_crc16(payload, HDC1080_FRAME_PAYLOAD_SIZE - 2);               /* get the crc */
+    payload[11] = (uint8_t)(crc >> 0);                                                /* set crc lsb */
+    payload[12] = (uint8_t)(crc >> 8);                                                /* set crc msb */
+    l = a_hdc1080_frame_cobs_encode(payload, HDC1080_FRAME_PAYLOAD_SIZE, buf);        /* cobs encode */
+    buf[l] = 0x00;                                                                    /* set the delimiter */
+    *out_len = l + 1;                                                                 /* set the length */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      decode a frame to a record
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[in]  len frame length
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is invalid
+ *             - 2 record is NULL
+ *             - 4 crc check failed
+ * @note       buf holds the bytes between two delimiters without the delimiter
+ */
+uint8_t hdc1080_frame_decode(const uint8_t *buf, uint16_t len, hdc1080_frame_record_t *record)
+{
+    uint8_t payload[HDC1080_FRAME_PAYLOAD_SIZE];
+    uint16_t l;
+    uint16_t crc;
+    
+    if (record == NULL)                                                                             /* check record */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    if (a_hdc1080_frame_cobs_decode(buf, len, payload, HDC1080_FRAME_PAYLOAD_SIZE, &l) != 0)        /* cobs decode */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    if ((l != HDC1080_FRAME_PAYLOAD_SIZE) || (payload[0] != HDC1080_FRAME_TYPE_RECORD))             /* check the payload */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    crc = (uint16_t)((uint16_t)payload[12] << 8 | payload[11]);                                     /* get the crc */
+    if (crc != hdc1080_frame_crc16(payload, HDC1080_FRAME_PAYLOAD_SIZE - 2))                        /* check the crc */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    record->seq = (uint16_t)((uint16_t)payload[2] << 8 | payload[1]);                               /* get seq */
+    record->timestamp_ms = (uint32_t)payload[3] | ((uint32_t)payload[4] << 8) |
+                           ((uint32_t)payload[5] << 16) | ((uint32_t)payload[6] << 24);             /* get timestamp */
+    record->temperature_raw = (uint16_t)((uint16_t)payload[8] << 8 | payload[7]);                   /* get temperature */
+    record->humidity_raw = (uint16_t)((uint16_t)payload[10] << 8 | payload[9]);                     /* get humidity */
+    
+    return 0;                                                                                       /* success return 0 */
+}
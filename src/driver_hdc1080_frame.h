@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_frame.h
+ * @brief     driver hdc1080 frame header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_FRAME_H
+#define DRIVER_HDC1080_FRAME_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_frame_driver hdc1080 frame driver function
+ * @brief    hdc1080 frame driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 frame size definition
+ */
+#define HDC1080_FRAME_TYPE_RECORD        0x01        /**< measurement record type */
+#define HDC1080_FRAME_PAYLOAD_SIZE       13          /**< type, seq, timestamp, raw data and crc */
+#define HDC1080_FRAME_MAX_SIZE           15          /**< cobs code byte, payload and delimiter */
+
+/**
+ * @brief hdc1080 frame record structure definition
+ */
+typedef struct hdc1080_frame_record_s
+{
+    uint16_t seq;                    /**< sequence number */
+    uint32_t timestamp_ms;           /**< timestamp in ms */
+    uint16_t temperature_raw;        /**< raw temperature */
+    uint16_t humidity_raw;           /**< raw humidity */
+} hdc1080_frame_record_t;
+
+/**
+ * @brief     calculate the crc16
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc16 value
+ * @note      crc-16/ccitt-false, poly 0x1021 and init 0xFFFF
+ */
+uint16_t hdc1080_frame_crc16(const uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      encode a record to a frame
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a frame buffer
+ * @param[in]  len frame buffer length
+ * @param[out] *out_len pointer to a frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is too small
+ *             - 2 record is NULL
+ * @note       the frame is cobs encoded and ends with the 0x00 delimiter,
+ *             all fields are little endian and the crc covers the payload before it
+ */
+uint8_t hdc1080_frame_encode(const hdc1080_frame_record_t *record, uint8_t *buf, uint16_t len, uint16_t *out_len);
+
+/**
+ * @brief      decode a frame to a record
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[in]  len frame length
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 frame is invalid
+ *             - 2 record is NULL
+ *             - 4 crc check failed
+ * @note       buf holds the bytes between two delimiters without the delimiter
+ */
+uint8_t hdc1080_frame_decode(const uint8_t *buf, uint16_t len, hdc1080_frame_record_t *record);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,371 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_health.c
+ * @brief     driver hdc1080 health source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_health.h"
+
+/**
+ * @brief health configuration definition
+ */
+#define HDC1080_HEALTH_REG_CONFIG         0x02          /**< configuration register */
+
+/**
+ * @brief     change the state
+ * @param[in] *health pointer to a health structure
+ * @param[in] state new state
+ * @note      only real changes are counted and reported
+ */
+static void a_hdc1080_health_set_state(hdc1080_health_t *health, hdc1080_health_state_t state)
+{
+    hdc1080_health_state_t old_state;
+    
+    old_state = (hdc1080_health_state_t)health->state;        /* save the old state */
+    if (old_state == state)                                   /* check the change */
+    {
+        return;                                               /* nothing changed */
+    }
+    health->state = (uint8_t)state;                           /* set the state */
+    health->transitions++;                                    /* count the change */
+    if (health->report != NULL)                               /* check report */
+    {
+        health->report(health, old_state, state);             /* report the change */
+    }
+}
+
+/**
+ * @brief     wait longer for the next probe
+ * @param[in] *health pointer to a health structure
+ * @param[in] now current time in ms
+ * @note      none
+ */
+static void a_hdc1080_health_backoff(hdc1080_health_t *health, uint32_t now)
+{
+    if (health->backoff_ms >= health->backoff_max_ms / 2)        /* check the longest delay */
+    {
+        health->backoff_ms = health->backoff_max_ms;             /* keep the longest delay */
+    }
+    else
+    {
+        health->backoff_ms *= 2;                                 /* double the delay */
+    }
+    health->probe_ms = now + health->backoff_ms;                 /* set the next probe */
+}
+
+/**
+ * @brief     initialize the health state machine
+ * @param[in] *health pointer to a health structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function
+ * @param[in] *report pointer to a state change report function, it may be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 save the configuration failed
+ *            - 2 health, handle or get_tick_ms is NULL
+ *            - 3 handle is not initialized
+ * @note      the configuration and the serial id are saved, call hdc1080_health_save after a configuration change
+ */
+uint8_t hdc1080_health_init(hdc1080_health_t *health, hdc1080_handle_t *handle, uint32_t (*get_tick_ms)(void),
+                            void (*report)(hdc1080_health_t *health, hdc1080_health_state_t old_state,
+                                           hdc1080_health_state_t new_state))
+{
+    if ((health == NULL) || (handle == NULL) || (get_tick_ms == NULL))        /* check the args */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    memset(health, 0, sizeof(hdc1080_health_t));                              /* clear all */
+    health->handle = handle;                                                  /* set the handle */
+    health->get_tick_ms = get_tick_ms;                                        /* set get_tick_ms */
+    health->report = report;                                                  /* set report */
+    health->state = HDC1080_HEALTH_STATE_HEALTHY;                             /* start healthy */
+    health->degraded_after = HDC1080_HEALTH_DEFAULT_DEGRADED;                 /* set the default degraded threshold */
+    health->lost_after = HDC1080_HEALTH_DEFAULT_LOST;                         /* set the default lost threshold */
+    health->backoff_min_ms = HDC1080_HEALTH_DEFAULT_BACKOFF_MIN;              /* set the default first delay */
+    health->backoff_max_ms = HDC1080_HEALTH_DEFAULT_BACKOFF_MAX;              /* set the default longest delay */
+    health->backoff_ms = health->backoff_min_ms;                              /* set the delay */
+    
+    return hdc1080_health_save(health);                                       /* save the configuration */
+}
+
+/**
+ * @brief     set the failure thresholds
+ * @param[in] *health pointer to a health structure
+ * @param[in] degraded consecutive failures to degraded
+ * @param[in] lost consecutive failures to lost
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 threshold is invalid
+ * @note      1 <= degraded <= lost
+ */
+uint8_t hdc1080_health_set_threshold(hdc1080_health_t *health, uint8_t degraded, uint8_t lost)
+{
+    if (health == NULL)                              /* check health */
+    {
+        return 2;                                    /* return error */
+    }
+    if ((degraded == 0) || (degraded > lost))        /* check the thresholds */
+    {
+        return 4;                                    /* return error */
+    }
+    
+    health->degraded_after = degraded;               /* set the degraded threshold */
+    health->lost_after = lost;                       /* set the lost threshold */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the probe backoff
+ * @param[in] *health pointer to a health structure
+ * @param[in] min_ms first probe delay
+ * @param[in] max_ms longest probe delay
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 backoff is invalid
+ * @note      the delay doubles after every failed probe, 1 <= min_ms <= max_ms
+ */
+uint8_t hdc1080_health_set_backoff(hdc1080_health_t *health, uint32_t min_ms, uint32_t max_ms)
+{
+    if (health == NULL)                            /* check health */
+    {
+        return 2;                                  /* return error */
+    }
+    if ((min_ms == 0) || (min_ms > max_ms))        /* check the delays */
+    {
+        return 4;                                  /* return error */
+    }
+    
+    health->backoff_min_ms = min_ms;               /* set the first delay */
+    health->backoff_max_ms = max_ms;               /* set the longest delay */
+    health->backoff_ms = min_ms;                   /* restart the delay */
+    
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief     save the configuration of the chip
+ * @param[in] *health pointer to a health structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ *            - 2 health is NULL
+ * @note      the mode, the resolutions and the heater are restored after a recovery
+ */
+uint8_t hdc1080_health_save(hdc1080_health_t *health)
+{
+    uint16_t data;
+    
+    if (health == NULL)                                                                /* check health */
+    {
+        return 2;                                                                      /* return error */
+    }
+    
+    if (hdc1080_get_reg(health->handle, HDC1080_HEALTH_REG_CONFIG, &data) != 0)        /* read the configuration */
+    {
+        return 1;                                                                      /* return error */
+    }
+    if (hdc1080_get_serial_id(health->handle, health->serial_id) != 0)                 /* read the serial id */
+    {
+        return 1;                                                                      /* return error */
+    }
+    health->config = data & HDC1080_CONFIG_MASK;                                       /* save the configuration */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     feed the result of a driver call
+ * @param[in] *health pointer to a health structure
+ * @param[in] res status code of the call, 0 is a success
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ * @note      for callers of the other read apis, only count real failures, not a nacked early fetch
+ */
+uint8_t hdc1080_health_update(hdc1080_health_t *health, uint8_t res)
+{
+    if (health == NULL)                                                           /* check health */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (health->state == HDC1080_HEALTH_STATE_LOST)                               /* a lost chip is only probed */
+    {
+        return 0;                                                                 /* success return 0 */
+    }
+    
+    if (res == 0)                                                                 /* check the result */
+    {
+        health->failures = 0;                                                     /* clear the failures */
+        a_hdc1080_health_set_state(health, HDC1080_HEALTH_STATE_HEALTHY);         /* confirmed */
+        
+        return 0;                                                                 /* success return 0 */
+    }
+    if (health->failures < 0xFF)                                                  /* check the counter */
+    {
+        health->failures++;                                                       /* count the failure */
+    }
+    if (health->state == HDC1080_HEALTH_STATE_RECOVERING)                         /* the recovery did not hold */
+    {
+        a_hdc1080_health_backoff(health, health->get_tick_ms());                  /* wait longer */
+        a_hdc1080_health_set_state(health, HDC1080_HEALTH_STATE_LOST);            /* lost again */
+    }
+    else if (health->failures >= health->lost_after)                              /* check the lost threshold */
+    {
+        health->backoff_ms = health->backoff_min_ms;                              /* restart the delay */
+        health->probe_ms = health->get_tick_ms() + health->backoff_ms;            /* set the first probe */
+        a_hdc1080_health_set_state(health, HDC1080_HEALTH_STATE_LOST);            /* lost */
+    }
+    else if (health->failures >= health->degraded_after)                          /* check the degraded threshold */
+    {
+        a_hdc1080_health_set_state(health, HDC1080_HEALTH_STATE_DEGRADED);        /* degraded */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     probe a lost chip when its backoff is due
+ * @param[in] *health pointer to a health structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ * @note      it does nothing unless the chip is lost and the backoff passed, a found chip is reinitialized
+ *            and gets the saved configuration back
+ */
+uint8_t hdc1080_health_poll(hdc1080_health_t *health)
+{
+    uint32_t now;
+    uint16_t data;
+    uint8_t id[6];
+    
+    if (health == NULL)                                                                /* check health */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (health->state != HDC1080_HEALTH_STATE_LOST)                                    /* check lost */
+    {
+        return 0;                                                                      /* nothing to do */
+    }
+    now = health->get_tick_ms();                                                       /* get the time */
+    if ((int32_t)(now - health->probe_ms) < 0)                                         /* check the backoff */
+    {
+        return 0;                                                                      /* not due */
+    }
+    
+    health->probes++;                                                                  /* count the probe */
+    if (hdc1080_probe(health->handle, id) != 0)                                        /* one id read */
+    {
+        a_hdc1080_health_backoff(health, now);                                         /* still gone */
+        
+        return 0;                                                                      /* success return 0 */
+    }
+    (void)hdc1080_deinit(health->handle);                                              /* close the old session */
+    if (hdc1080_init(health->handle) != 0)                                             /* reinit, the chip was reset by the power cycle */
+    {
+        a_hdc1080_health_backoff(health, health->get_tick_ms());                       /* try again later */
+        
+        return 0;                                                                      /* success return 0 */
+    }
+    if (hdc1080_get_reg(health->handle, HDC1080_HEALTH_REG_CONFIG, &data) != 0)        /* read the configuration */
+    {
+        a_hdc1080_health_backoff(health, health->get_tick_ms());                       /* try again later */
+        
+        return 0;                                                                      /* success return 0 */
+    }
+    data = (uint16_t)((data & ~HDC1080_CONFIG_MASK) | health->config);                 /* set the saved bits */
+    if (hdc1080_set_reg(health->handle, HDC1080_HEALTH_REG_CONFIG, data) != 0)         /* restore the configuration */
+    {
+        a_hdc1080_health_backoff(health, health->get_tick_ms());                       /* try again later */
+        
+        return 0;                                                                      /* success return 0 */
+    }
+    if (memcmp(id, health->serial_id, 6) != 0)                                         /* check the serial id */
+    {
+        memcpy(health->serial_id, id, 6);                                              /* another chip */
+        health->replaced++;                                                            /* count the replacement */
+    }
+    health->recoveries++;                                                              /* count the recovery */
+    health->failures = 0;                                                              /* clear the failures */
+    health->backoff_ms = health->backoff_min_ms;                                       /* restart the delay */
+    a_hdc1080_health_set_state(health, HDC1080_HEALTH_STATE_RECOVERING);               /* wait for a good read */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature and humidity data with the health state machine
+ * @param[in]  *health pointer to a health structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 health is NULL
+ *             - 4 chip is lost
+ * @note       a healthy chip costs exactly the bus traffic of hdc1080_read_temperature_humidity,
+ *             a lost chip is not read and only probed when its backoff is due
+ */
+uint8_t hdc1080_health_read(hdc1080_health_t *health, uint16_t *temperature_raw, float *temperature_s,
+                            uint16_t *humidity_raw, float *humidity_s)
+{
+    uint8_t res;
+    
+    if (health == NULL)                                                       /* check health */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (health->state == HDC1080_HEALTH_STATE_LOST)                           /* check lost */
+    {
+        (void)hdc1080_health_poll(health);                                    /* probe if due */
+        if (health->state == HDC1080_HEALTH_STATE_LOST)                       /* check lost */
+        {
+            return 4;                                                         /* return error */
+        }
+    }
+    
+    res = hdc1080_read_temperature_humidity(health->handle, temperature_raw, temperature_s,
+                                            humidity_raw, humidity_s);        /* read */
+    (void)hdc1080_health_update(health, res);                                 /* feed the result */
+    
+    return (res != 0) ? 1 : 0;                                                /* return the result */
+}
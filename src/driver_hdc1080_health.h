@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_health.h
+ * @brief     driver hdc1080 health header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_HEALTH_H
+#define DRIVER_HDC1080_HEALTH_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_health_driver hdc1080 health driver function
+ * @brief    hdc1080 health driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 health default definition
+ */
+#define HDC1080_HEALTH_DEFAULT_DEGRADED         1            /**< consecutive failures to degraded */
+#define HDC1080_HEALTH_DEFAULT_LOST             3            /**< consecutive failures to lost */
+#define HDC1080_HEALTH_DEFAULT_BACKOFF_MIN      100          /**< first probe delay in ms */
+#define HDC1080_HEALTH_DEFAULT_BACKOFF_MAX      60000        /**< longest probe delay in ms */
+
+/**
+ * @brief hdc1080 health state enumeration definition
+ */
+typedef enum
+{
+    HDC1080_HEALTH_STATE_HEALTHY    = 0x00,        /**< reads succeed */
+    HDC1080_HEALTH_STATE_DEGRADED   = 0x01,        /**< some consecutive reads failed */
+    HDC1080_HEALTH_STATE_LOST       = 0x02,        /**< the chip is gone, it is probed on a backoff */
+    HDC1080_HEALTH_STATE_RECOVERING = 0x03,        /**< the chip is back and reinitialized, the next read confirms it */
+} hdc1080_health_state_t;
+
+/**
+ * @brief hdc1080 health structure definition
+ */
+typedef struct hdc1080_health_s
+{
+    hdc1080_handle_t *handle;                                                         /**< initialized handle */
+    uint32_t (*get_tick_ms)(void);                                                    /**< point to a get_tick_ms function address */
+    void (*report)(struct hdc1080_health_s *health, hdc1080_health_state_t old_state,
+                   hdc1080_health_state_t new_state);                                 /**< point to a state change report function address */
+    uint8_t state;                                                                    /**< hdc1080_health_state_t */
+    uint8_t failures;                                                                 /**< consecutive failures */
+    uint8_t degraded_after;                                                           /**< consecutive failures to degraded */
+    uint8_t lost_after;                                                               /**< consecutive failures to lost */
+    uint16_t config;                                                                  /**< saved configuration */
+    uint8_t serial_id[6];                                                             /**< serial id of the chip */
+    uint32_t backoff_min_ms;                                                          /**< first probe delay */
+    uint32_t backoff_max_ms;                                                          /**< longest probe delay */
+    uint32_t backoff_ms;                                                              /**< current probe delay */
+    uint32_t probe_ms;                                                                /**< time of the next probe */
+    uint32_t transitions;                                                             /**< state changes */
+    uint32_t probes;                                                                  /**< probes of a lost chip */
+    uint32_t recoveries;                                                              /**< reinitializations */
+    uint32_t replaced;                                                                /**< recoveries that found another serial id */
+} hdc1080_health_t;
+
+/**
+ * @brief     initialize the health state machine
+ * @param[in] *health pointer to a health structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function
+ * @param[in] *report pointer to a state change report function, it may be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 save the configuration failed
+ *            - 2 health, handle or get_tick_ms is NULL
+ *            - 3 handle is not initialized
+ * @note      the configuration and the serial id are saved, call hdc1080_health_save after a configuration change
+ */
+uint8_t hdc1080_health_init(hdc1080_health_t *health, hdc1080_handle_t *handle, uint32_t (*get_tick_ms)(void),
+                            void (*report)(hdc1080_health_t *health, hdc1080_health_state_t old_state,
+                                           hdc1080_health_state_t new_state));
+
+/**
+ * @brief     set the failure thresholds
+ * @param[in] *health pointer to a health structure
+ * @param[in] degraded consecutive failures to degraded
+ * @param[in] lost consecutive failures to lost
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 threshold is invalid
+ * @note      1 <= degraded <= lost
+ */
+uint8_t hdc1080_health_set_threshold(hdc1080_health_t *health, uint8_t degraded, uint8_t lost);
+
+/**
+ * @brief     set the probe backoff
+ * @param[in] *health pointer to a health structure
+ * @param[in] min_ms first probe delay
+ * @param[in] max_ms longest probe delay
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 backoff is invalid
+ * @note      the delay doubles after every failed probe, 1 <= min_ms <= max_ms
+ */
+uint8_t hdc1080_health_set_backoff(hdc1080_health_t *health, uint32_t min_ms, uint32_t max_ms);
+
+/**
+ * @brief     save the configuration of the chip
+ * @param[in] *health pointer to a health structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ *            - 2 health is NULL
+ * @note      the mode, the resolutions and the heater are restored after a recovery
+ */
+uint8_t hdc1080_health_save(hdc1080_health_t *health);
+
+/**
+ * @brief     feed the result of a driver call
+ * @param[in] *health pointer to a health structure
+ * @param[in] res status code of the call, 0 is a success
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ * @note      for callers of the other read apis, only count real failures, not a nacked early fetch
+ */
+uint8_t hdc1080_health_update(hdc1080_health_t *health, uint8_t res);
+
+/**
+ * @brief     probe a lost chip when its backoff is due
+ * @param[in] *health pointer to a health structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ * @note      it does nothing unless the chip is lost and the backoff passed, a found chip is reinitialized
+ *            and gets the saved configuration back
+ */
+uint8_t hdc1080_health_poll(hdc1080_health_t *health);
+
+/**
+ * @brief      read the temperature and humidity data with the health state machine
+ * @param[in]  *health pointer to a health structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 health is NULL
+ *             - 4 chip is lost
+ * @note       a healthy chip costs exactly the bus traffic of hdc1080_read_temperature_humidity,
+ *             a lost chip is not read and only probed when its backoff is due
+ */
+uint8_t hdc1080_health_read(hdc1080_health_t *health, uint16_t *temperature_raw, float *temperature_s,
+                            uint16_t *humidity_raw, float *humidity_s);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
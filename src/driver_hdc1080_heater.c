@@ -0,0 +1,452 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_heater.c
+ * @brief     driver hdc1080 heater source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_heater.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief heater magnus definition
+ */
+#define HDC1080_HEATER_MAGNUS_B        17.62f         /**< magnus b */
+#define HDC1080_HEATER_MAGNUS_C        243.12f        /**< magnus c in C */
+
+/**
+ * @brief     change the state
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] state new state
+ * @param[in] now current tick
+ * @note      none
+ */
+static void a_hdc1080_heater_set_state(hdc1080_heater_t *heater, hdc1080_heater_state_t state, uint32_t now)
+{
+    heater->state = (uint8_t)state;        /* set the state */
+    heater->state_ms = now;                /* save the time */
+}
+
+/**
+ * @brief     save the heater time of the elapsed time
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] now current tick
+ * @note      the credit grows at the duty up to the max
+ */
+static void a_hdc1080_heater_credit(hdc1080_heater_t *heater, uint32_t now)
+{
+    uint32_t elapsed;
+    
+    elapsed = now - heater->last_ms;                                                               /* elapsed time */
+    heater->last_ms = now;                                                                         /* save the time */
+    if ((heater->duty == 0) || (heater->credit >= (int32_t)heater->credit_max))                    /* check the growth */
+    {
+        return;                                                                                    /* nothing to add */
+    }
+    if (elapsed >= (uint32_t)((int32_t)heater->credit_max - heater->credit) / heater->duty)        /* check the max */
+    {
+        heater->credit = (int32_t)heater->credit_max;                                              /* full */
+    }
+    else
+    {
+        heater->credit += (int32_t)(elapsed * heater->duty);                                       /* add the heater time */
+    }
+}
+
+/**
+ * @brief         compensate a heated read to the air temperature
+ * @param[in]     *heater pointer to a heater structure
+ * @param[in,out] *temperature_s pointer to a converted temperature buffer
+ * @param[in,out] *humidity_s pointer to a converted humidity buffer
+ * @note          the vapour pressure at the die is the one of the air, so the humidity is scaled by the ratio of
+ *                the saturation vapour pressures of the die and the held air temperature
+ */
+static void a_hdc1080_heater_compensate(hdc1080_heater_t *heater, float *temperature_s, float *humidity_s)
+{
+    float x;
+    
+    x = HDC1080_HEATER_MAGNUS_B * (*temperature_s) / (HDC1080_HEATER_MAGNUS_C + (*temperature_s));        /* die exponent */
+    x -= HDC1080_HEATER_MAGNUS_B * heater->ambient / (HDC1080_HEATER_MAGNUS_C + heater->ambient);         /* air exponent */
+    *humidity_s = (*humidity_s) * expf(x);                                                                /* scale the humidity */
+    if (*humidity_s > 100.0f)                                                                             /* check the range */
+    {
+        *humidity_s = 100.0f;                                                                             /* saturate */
+    }
+    *temperature_s = heater->ambient;                                                                     /* air temperature */
+}
+
+/**
+ * @brief      run one heater burst
+ * @param[in]  *heater pointer to a heater structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 burst failed
+ * @note       the heater only runs during a conversion, so the burst converts back to back, the last read is kept,
+ *             the overrun of the last conversion is paid back from the next credit
+ */
+static uint8_t a_hdc1080_heater_burst(hdc1080_heater_t *heater, uint16_t *temperature_raw, float *temperature_s,
+                                      uint16_t *humidity_raw, float *humidity_s)
+{
+    uint8_t res;
+    uint32_t start;
+    uint32_t elapsed;
+    
+    if (hdc1080_set_heater(heater->handle, HDC1080_BOOL_TRUE) != 0)                      /* heater on */
+    {
+        return 1;                                                                        /* return error */
+    }
+    start = heater->get_tick_ms();                                                       /* burst start */
+    do
+    {
+        res = hdc1080_read_temperature_humidity(heater->handle, temperature_raw, temperature_s,
+                                                humidity_raw, humidity_s);               /* heated conversion */
+    } while ((res == 0) && ((heater->get_tick_ms() - start) < heater->burst_ms));        /* until the burst ends */
+    if (hdc1080_set_heater(heater->handle, HDC1080_BOOL_FALSE) != 0)                     /* heater off */
+    {
+        return 1;                                                                        /* return error */
+    }
+    elapsed = heater->get_tick_ms() - start;                                             /* heater time */
+    heater->credit -= (int32_t)(elapsed * 1000);                                         /* spend the credit */
+    heater->used_ms += elapsed;                                                          /* recovery heater time */
+    heater->heater_ms += elapsed;                                                        /* total heater time */
+    heater->bursts++;                                                                    /* count the burst */
+    
+    return res;                                                                          /* return the result */
+}
+
+/**
+ * @brief     initialize the heater scheduler
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function
+ * @return    status code
+ *            - 0 success
+ *            - 1 heater off failed
+ *            - 2 heater, handle or get_tick_ms is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip must run the sequence mode, the heater is switched off
+ */
+uint8_t hdc1080_heater_init(hdc1080_heater_t *heater, hdc1080_handle_t *handle, uint32_t (*get_tick_ms)(void))
+{
+    if ((heater == NULL) || (handle == NULL) || (get_tick_ms == NULL))        /* check the args */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    memset(heater, 0, sizeof(hdc1080_heater_t));                              /* clear all */
+    heater->handle = handle;                                                  /* set the handle */
+    heater->get_tick_ms = get_tick_ms;                                        /* set get_tick_ms */
+    heater->state = HDC1080_HEATER_STATE_IDLE;                                /* start idle */
+    heater->saturation = HDC1080_HEATER_DEFAULT_SATURATION;                   /* set the default saturation */
+    heater->dry = HDC1080_HEATER_DEFAULT_DRY;                                 /* set the default dry humidity */
+    heater->count = HDC1080_HEATER_DEFAULT_COUNT;                             /* set the default count */
+    heater->burst_ms = HDC1080_HEATER_DEFAULT_BURST_MS;                       /* set the default burst */
+    heater->cool_ms = HDC1080_HEATER_DEFAULT_COOL_MS;                         /* set the default cool down */
+    heater->episode_ms = HDC1080_HEATER_DEFAULT_EPISODE_MS;                   /* set the default heater time limit */
+    heater->holdoff_ms = HDC1080_HEATER_DEFAULT_HOLDOFF_MS;                   /* set the default holdoff */
+    heater->duty = HDC1080_HEATER_DEFAULT_DUTY;                               /* set the default duty */
+    heater->credit_max = HDC1080_HEATER_DEFAULT_CREDIT_MS * 1000;             /* set the default credit */
+    heater->credit = (int32_t)heater->credit_max;                             /* start with a full credit */
+    heater->heater_mw = HDC1080_HEATER_DEFAULT_HEATER_MW;                     /* set the default heater power */
+    heater->last_ms = get_tick_ms();                                          /* save the time */
+    heater->state_ms = heater->last_ms;                                       /* save the time */
+    if (hdc1080_set_heater(handle, HDC1080_BOOL_FALSE) != 0)                  /* heater off */
+    {
+        return 1;                                                             /* return error */
+    }
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the saturation detection
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] saturation humidity of a saturated sensor in %
+ * @param[in] dry heated humidity of a dry sensor in %
+ * @param[in] count consecutive saturated samples to start a recovery
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      0 < dry < saturation <= 100, count >= 1
+ */
+uint8_t hdc1080_heater_set_saturation(hdc1080_heater_t *heater, float saturation, float dry, uint8_t count)
+{
+    if (heater == NULL)                                                                       /* check heater */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((dry <= 0.0f) || (dry >= saturation) || (saturation > 100.0f) || (count == 0))        /* check the param */
+    {
+        return 4;                                                                             /* return error */
+    }
+    
+    heater->saturation = saturation;                                                          /* set the saturation */
+    heater->dry = dry;                                                                        /* set the dry humidity */
+    heater->count = count;                                                                    /* set the count */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the heater bursts
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] burst_ms longest heater burst of one read
+ * @param[in] cool_ms cool down time after a recovery
+ * @param[in] episode_ms heater time limit of one recovery
+ * @param[in] holdoff_ms wait after a recovery gave up
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      burst_ms is the longest time one read blocks besides its own conversion
+ */
+uint8_t hdc1080_heater_set_burst(hdc1080_heater_t *heater, uint32_t burst_ms, uint32_t cool_ms,
+                                 uint32_t episode_ms, uint32_t holdoff_ms)
+{
+    if (heater == NULL)                                                                              /* check heater */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if ((burst_ms == 0) || (episode_ms < burst_ms) || (burst_ms * 1000 > heater->credit_max))        /* check the param */
+    {
+        return 4;                                                                                    /* return error */
+    }
+    
+    heater->burst_ms = burst_ms;                                                                     /* set the burst */
+    heater->cool_ms = cool_ms;                                                                       /* set the cool down */
+    heater->episode_ms = episode_ms;                                                                 /* set the heater time limit */
+    heater->holdoff_ms = holdoff_ms;                                                                 /* set the holdoff */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the heater budget
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] duty heater duty in permille
+ * @param[in] credit_ms largest saved heater time
+ * @param[in] heater_mw heater power
+ * @param[in] power_mw average heater power budget, 0 means no power budget
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      the heater time is saved at the duty up to credit_ms and a burst needs burst_ms of it,
+ *            a power budget lowers the duty to power_mw / heater_mw, burst_ms <= credit_ms <= 2000000
+ */
+uint8_t hdc1080_heater_set_budget(hdc1080_heater_t *heater, uint16_t duty, uint32_t credit_ms,
+                                  float heater_mw, float power_mw)
+{
+    float limit;
+    
+    if (heater == NULL)                                      /* check heater */
+    {
+        return 2;                                            /* return error */
+    }
+    if ((duty > 1000) || (credit_ms < heater->burst_ms) || (credit_ms > 2000000) ||
+        (heater_mw <= 0.0f) || (power_mw < 0.0f))            /* check the param */
+    {
+        return 4;                                            /* return error */
+    }
+    
+    heater->duty = duty;                                     /* set the duty */
+    if (power_mw > 0.0f)                                     /* check the power budget */
+    {
+        limit = 1000.0f * power_mw / heater_mw;              /* duty of the power budget */
+        if (limit < (float)duty)                             /* check the limit */
+        {
+            heater->duty = (uint32_t)limit;                  /* lower the duty */
+        }
+    }
+    heater->credit_max = credit_ms * 1000;                   /* set the credit */
+    if (heater->credit > (int32_t)heater->credit_max)        /* check the credit */
+    {
+        heater->credit = (int32_t)heater->credit_max;        /* cut the credit */
+    }
+    heater->heater_mw = heater_mw;                           /* set the heater power */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature and humidity through the scheduler
+ * @param[in]  *heater pointer to a heater structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *flags pointer to a flags buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 heater or a buffer is NULL
+ *             - 3 heater is not initialized
+ * @note       call it at the sample period, a read during a recovery runs one burst of back to back conversions
+ *             with the heater on, the raw codes are the measured ones, a compensated read returns the held air
+ *             temperature and the humidity at it
+ */
+uint8_t hdc1080_heater_read(hdc1080_heater_t *heater, uint16_t *temperature_raw, float *temperature_s,
+                            uint16_t *humidity_raw, float *humidity_s, uint8_t *flags)
+{
+    uint32_t now;
+    
+    if ((heater == NULL) || (temperature_raw == NULL) || (temperature_s == NULL) ||
+        (humidity_raw == NULL) || (humidity_s == NULL) || (flags == NULL))                           /* check the args */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (heater->handle == NULL)                                                                      /* check the init */
+    {
+        return 3;                                                                                    /* return error */
+    }
+    
+    *flags = 0;                                                                                      /* clear the flags */
+    now = heater->get_tick_ms();                                                                     /* get the time */
+    a_hdc1080_heater_credit(heater, now);                                                            /* save the heater time */
+    if ((heater->state == HDC1080_HEATER_STATE_HOLDOFF) &&
+        ((now - heater->state_ms) >= heater->holdoff_ms))                                            /* check the holdoff */
+    {
+        a_hdc1080_heater_set_state(heater, HDC1080_HEATER_STATE_IDLE, now);                          /* heat again */
+        heater->saturated = 0;                                                                       /* count again */
+    }
+    if (heater->state == HDC1080_HEATER_STATE_HEATING)                                               /* check heating */
+    {
+        if (heater->credit >= (int32_t)(heater->burst_ms * 1000))                                    /* check the budget */
+        {
+            if (a_hdc1080_heater_burst(heater, temperature_raw, temperature_s,
+                                       humidity_raw, humidity_s) != 0)                               /* run a burst */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+        else
+        {
+            heater->skipped++;                                                                       /* count the skipped burst */
+            *flags |= HDC1080_HEATER_FLAG_BUDGET;                                                    /* no heater time */
+            if (hdc1080_read_temperature_humidity(heater->handle, temperature_raw, temperature_s,
+                                                  humidity_raw, humidity_s) != 0)                    /* plain read */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+        now = heater->get_tick_ms();                                                                 /* get the time */
+        if ((*humidity_s) < heater->dry)                                                             /* check the dry sensor */
+        {
+            heater->recoveries++;                                                                    /* count the recovery */
+            a_hdc1080_heater_set_state(heater, HDC1080_HEATER_STATE_COOLING, now);                   /* cool down */
+        }
+        else if (heater->used_ms >= heater->episode_ms)                                              /* check the heater time limit */
+        {
+            heater->give_ups++;                                                                      /* count the give up */
+            a_hdc1080_heater_set_state(heater, HDC1080_HEATER_STATE_HOLDOFF, now);                   /* wait */
+            *flags |= HDC1080_HEATER_FLAG_SATURATED;                                                 /* still saturated */
+        }
+        else
+        {
+            *flags |= HDC1080_HEATER_FLAG_SATURATED;                                                 /* still saturated */
+        }
+        *flags |= HDC1080_HEATER_FLAG_HEATED | HDC1080_HEATER_FLAG_COMPENSATED;                      /* warm die */
+        a_hdc1080_heater_compensate(heater, temperature_s, humidity_s);                              /* compensate */
+        
+        return 0;                                                                                    /* success return 0 */
+    }
+    
+    if (hdc1080_read_temperature_humidity(heater->handle, temperature_raw, temperature_s,
+                                          humidity_raw, humidity_s) != 0)                            /* plain read */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if (heater->state == HDC1080_HEATER_STATE_COOLING)                                               /* check cooling */
+    {
+        if ((now - heater->state_ms) < heater->cool_ms)                                              /* check the cool down */
+        {
+            *flags |= HDC1080_HEATER_FLAG_HEATED | HDC1080_HEATER_FLAG_COMPENSATED;                  /* warm die */
+            a_hdc1080_heater_compensate(heater, temperature_s, humidity_s);                          /* compensate */
+            
+            return 0;                                                                                /* success return 0 */
+        }
+        a_hdc1080_heater_set_state(heater, HDC1080_HEATER_STATE_IDLE, now);                          /* cooled down */
+        heater->saturated = 0;                                                                       /* count again */
+    }
+    if ((*humidity_s) >= heater->saturation)                                                         /* check the saturation */
+    {
+        *flags |= HDC1080_HEATER_FLAG_SATURATED;                                                     /* saturated */
+        if (heater->saturated < 0xFF)                                                                /* check the counter */
+        {
+            heater->saturated++;                                                                     /* count the sample */
+        }
+    }
+    else
+    {
+        heater->saturated = 0;                                                                       /* clear the counter */
+    }
+    if ((heater->state == HDC1080_HEATER_STATE_IDLE) && (heater->saturated >= heater->count))        /* check the start */
+    {
+        heater->ambient = *temperature_s;                                                            /* hold the air temperature */
+        heater->used_ms = 0;                                                                         /* clear the recovery heater time */
+        heater->episodes++;                                                                          /* count the recovery */
+        a_hdc1080_heater_set_state(heater, HDC1080_HEATER_STATE_HEATING, now);                       /* heat from the next read */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get the heater energy
+ * @param[in]  *heater pointer to a heater structure
+ * @param[out] *mj pointer to an energy buffer in mJ
+ * @return     status code
+ *             - 0 success
+ *             - 2 heater or mj is NULL
+ * @note       none
+ */
+uint8_t hdc1080_heater_get_energy(const hdc1080_heater_t *heater, float *mj)
+{
+    if ((heater == NULL) || (mj == NULL))                                /* check the args */
+    {
+        return 2;                                                        /* return error */
+    }
+    
+    *mj = heater->heater_mw * (float)heater->heater_ms / 1000.0f;        /* power x time */
+    
+    return 0;                                                            /* success return 0 */
+}
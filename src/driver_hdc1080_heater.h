@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_heater.h
+ * @brief     driver hdc1080 heater header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_HEATER_H
+#define DRIVER_HDC1080_HEATER_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_heater_driver hdc1080 heater driver function
+ * @brief    hdc1080 heater driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 heater default definition
+ * @note  the heater power is the datasheet typical 7.2mA at 3.3V, the heater only runs during a conversion
+ */
+#define HDC1080_HEATER_DEFAULT_SATURATION        95.0f         /**< humidity of a saturated sensor in % */
+#define HDC1080_HEATER_DEFAULT_DRY               90.0f         /**< heated humidity of a dry sensor in % */
+#define HDC1080_HEATER_DEFAULT_COUNT             3             /**< consecutive saturated samples to start */
+#define HDC1080_HEATER_DEFAULT_BURST_MS          200           /**< longest heater burst of one read */
+#define HDC1080_HEATER_DEFAULT_COOL_MS           5000          /**< cool down before a read is valid again */
+#define HDC1080_HEATER_DEFAULT_EPISODE_MS        120000        /**< heater time of one recovery before it gives up */
+#define HDC1080_HEATER_DEFAULT_HOLDOFF_MS        120000        /**< wait after a recovery gave up */
+#define HDC1080_HEATER_DEFAULT_DUTY              250           /**< heater duty budget in permille */
+#define HDC1080_HEATER_DEFAULT_CREDIT_MS         2000          /**< largest saved heater time */
+#define HDC1080_HEATER_DEFAULT_HEATER_MW         23.76f        /**< heater power in mW */
+
+/**
+ * @brief hdc1080 heater flag definition
+ */
+#define HDC1080_HEATER_FLAG_SATURATED          (1 << 0)        /**< the sensor reads saturated */
+#define HDC1080_HEATER_FLAG_HEATED             (1 << 1)        /**< taken during a recovery, the die is warm */
+#define HDC1080_HEATER_FLAG_COMPENSATED        (1 << 2)        /**< the values are compensated to the air temperature */
+#define HDC1080_HEATER_FLAG_BUDGET             (1 << 3)        /**< a burst was skipped by the budget */
+
+/**
+ * @brief hdc1080 heater state enumeration definition
+ */
+typedef enum
+{
+    HDC1080_HEATER_STATE_IDLE    = 0x00,        /**< normal reads, saturation is watched */
+    HDC1080_HEATER_STATE_HEATING = 0x01,        /**< every read runs one heater burst */
+    HDC1080_HEATER_STATE_COOLING = 0x02,        /**< the sensor is dry, the die cools down */
+    HDC1080_HEATER_STATE_HOLDOFF = 0x03,        /**< the recovery gave up, no heating until the holdoff ends */
+} hdc1080_heater_state_t;
+
+/**
+ * @brief hdc1080 heater structure definition
+ */
+typedef struct hdc1080_heater_s
+{
+    hdc1080_handle_t *handle;               /**< initialized handle */
+    uint32_t (*get_tick_ms)(void);          /**< point to a get_tick_ms function address */
+    uint8_t state;                          /**< hdc1080_heater_state_t */
+    uint8_t count;                          /**< consecutive saturated samples to start */
+    uint8_t saturated;                      /**< consecutive saturated samples */
+    float saturation;                       /**< humidity of a saturated sensor */
+    float dry;                              /**< heated humidity of a dry sensor */
+    float ambient;                          /**< air temperature held at the start of the recovery */
+    uint32_t burst_ms;                      /**< longest heater burst of one read */
+    uint32_t cool_ms;                       /**< cool down time */
+    uint32_t episode_ms;                    /**< heater time limit of one recovery */
+    uint32_t holdoff_ms;                    /**< wait after a recovery gave up */
+    uint32_t duty;                          /**< heater duty budget in permille */
+    int32_t credit;                         /**< saved heater time in ms x permille, negative after a burst overran it */
+    uint32_t credit_max;                    /**< largest saved heater time in ms x permille */
+    uint32_t last_ms;                       /**< tick of the last credit update */
+    uint32_t state_ms;                      /**< tick of the last state change */
+    uint32_t used_ms;                       /**< heater time of the current recovery */
+    float heater_mw;                        /**< heater power */
+    uint32_t heater_ms;                     /**< total heater time */
+    uint32_t bursts;                        /**< heater bursts */
+    uint32_t skipped;                       /**< bursts skipped by the budget */
+    uint32_t episodes;                      /**< started recoveries */
+    uint32_t recoveries;                    /**< recoveries that dried the sensor */
+    uint32_t give_ups;                      /**< recoveries that hit the heater time limit */
+} hdc1080_heater_t;
+
+/**
+ * @brief     initialize the heater scheduler
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] *handle pointer to an initialized hdc1080 handle
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function
+ * @return    status code
+ *            - 0 success
+ *            - 1 heater off failed
+ *            - 2 heater, handle or get_tick_ms is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip must run the sequence mode, the heater is switched off
+ */
+uint8_t hdc1080_heater_init(hdc1080_heater_t *heater, hdc1080_handle_t *handle, uint32_t (*get_tick_ms)(void));
+
+/**
+ * @brief     set the saturation detection
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] saturation humidity of a saturated sensor in %
+ * @param[in] dry heated humidity of a dry sensor in %
+ * @param[in] count consecutive saturated samples to start a recovery
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      0 < dry < saturation <= 100, count >= 1
+ */
+uint8_t hdc1080_heater_set_saturation(hdc1080_heater_t *heater, float saturation, float dry, uint8_t count);
+
+/**
+ * @brief     set the heater bursts
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] burst_ms longest heater burst of one read
+ * @param[in] cool_ms cool down time after a recovery
+ * @param[in] episode_ms heater time limit of one recovery
+ * @param[in] holdoff_ms wait after a recovery gave up
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      burst_ms is the longest time one read blocks besides its own conversion
+ */
+uint8_t hdc1080_heater_set_burst(hdc1080_heater_t *heater, uint32_t burst_ms, uint32_t cool_ms,
+                                 uint32_t episode_ms, uint32_t holdoff_ms);
+
+/**
+ * @brief     set the heater budget
+ * @param[in] *heater pointer to a heater structure
+ * @param[in] duty heater duty in permille
+ * @param[in] credit_ms largest saved heater time
+ * @param[in] heater_mw heater power
+ * @param[in] power_mw average heater power budget, 0 means no power budget
+ * @return    status code
+ *            - 0 success
+ *            - 2 heater is NULL
+ *            - 4 param is invalid
+ * @note      the heater time is saved at the duty up to credit_ms and a burst needs burst_ms of it,
+ *            a power budget lowers the duty to power_mw / heater_mw, burst_ms <= credit_ms <= 2000000
+ */
+uint8_t hdc1080_heater_set_budget(hdc1080_heater_t *heater, uint16_t duty, uint32_t credit_ms,
+                                  float heater_mw, float power_mw);
+
+/**
+ * @brief      read the temperature and humidity through the scheduler
+ * @param[in]  *heater pointer to a heater structure
+ * @param[out] *temperature_raw pointer to a raw temperature buffer
+ * @param[out] *temperature_s pointer to a converted temperature buffer
+ * @param[out] *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *humidity_s pointer to a converted humidity buffer
+ * @param[out] *flags pointer to a flags buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 heater or a buffer is NULL
+ *             - 3 heater is not initialized
+ * @note       call it at the sample period, a read during a recovery runs one burst of back to back conversions
+ *             with the heater on, the raw codes are the measured ones, a compensated read returns the held air
+ *             temperature and the humidity at it
+ */
+uint8_t hdc1080_heater_read(hdc1080_heater_t *heater, uint16_t *temperature_raw, float *temperature_s,
+                            uint16_t *humidity_raw, float *humidity_s, uint8_t *flags);
+
+/**
+ * @brief      get the heater energy
+ * @param[in]  *heater pointer to a heater structure
+ * @param[out] *mj pointer to an energy buffer in mJ
+ * @return     status code
+ *             - 0 success
+ *             - 2 heater or mj is NULL
+ * @note       none
+ */
+uint8_t hdc1080_heater_get_energy(const hdc1080_heater_t *heater, float *mj);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_log.c
+ * @brief     driver hdc1080 log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_log.h"
+
+/**
+ * @brief log max message id definition
+ */
+#define HDC1080_LOG_MAX_ID        0x1A        /**< max message id */
+
+/**
+ * @brief log message text table
+ */
+static const char *const gsc_hdc1080_log_text[HDC1080_LOG_MAX_ID + 1] =
+{
+    NULL,
+    HDC1080_DEBUG_TEXT_IIC_INIT_NULL,
+    HDC1080_DEBUG_TEXT_IIC_DEINIT_NULL,
+    HDC1080_DEBUG_TEXT_IIC_READ_NULL,
+    HDC1080_DEBUG_TEXT_IIC_READ_WITH_WAIT_NULL,
+    HDC1080_DEBUG_TEXT_IIC_WRITE_NULL,
+    HDC1080_DEBUG_TEXT_DELAY_MS_NULL,
+    HDC1080_DEBUG_TEXT_IIC_INIT_FAILED,
+    HDC1080_DEBUG_TEXT_IIC_DEINIT_FAILED,
+    HDC1080_DEBUG_TEXT_READ_MANUFACTURER_ID_FAILED,
+    HDC1080_DEBUG_TEXT_MANUFACTURER_ID_INVALID,
+    HDC1080_DEBUG_TEXT_READ_DEVICE_ID_FAILED,
+    HDC1080_DEBUG_TEXT_DEVICE_ID_INVALID,
+    HDC1080_DEBUG_TEXT_READ_CONFIG_FAILED,
+    HDC1080_DEBUG_TEXT_WRITE_CONFIG_FAILED,
+    HDC1080_DEBUG_TEXT_READ_TEMPERATURE_FAILED,
+    HDC1080_DEBUG_TEXT_READ_HUMIDITY_FAILED,
+    HDC1080_DEBUG_TEXT_READ_SERIAL_ID_FAILED,
+    HDC1080_DEBUG_TEXT_IIC_READ_CMD_NULL,
+    HDC1080_DEBUG_TEXT_START_MEASUREMENT_FAILED,
+    HDC1080_DEBUG_TEXT_FETCH_MEASUREMENT_FAILED,
+    HDC1080_DEBUG_TEXT_LOCK_NOT_PAIRED,
+    HDC1080_DEBUG_TEXT_BUS_LOCK_NOT_PAIRED,
+    HDC1080_DEBUG_TEXT_LOCK_FAILED,
+    HDC1080_DEBUG_TEXT_BUS_LOCK_FAILED,
+    HDC1080_DEBUG_TEXT_CONFIG_INVALID,
+    HDC1080_DEBUG_TEXT_MODE_INVALID,
+};
+
+/**
+ * @brief     initialize the log
+ * @param[in] *handle pointer to an hdc1080 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      a zero initialized handle is also an empty log
+ */
+uint8_t hdc1080_log_init(hdc1080_log_handle_t *handle)
+{
+    if (handle == NULL)                                     /* check handle */
+    {
+        return 2;                                           /* return error */
+    }
+    
+    memset(handle, 0, sizeof(hdc1080_log_handle_t));        /* clear the log */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief     write a record to the log
+ * @param[in] *handle pointer to an hdc1080 log handle structure
+ * @param[in] id debug message id
+ * @param[in] arg debug message argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 log is full
+ *            - 2 handle is NULL
+ * @note      it never formats or blocks and can be linked as the driver debug_log function,
+ *            it is safe with one writer and one reader
+ */
+uint8_t hdc1080_log_write(hdc1080_log_handle_t *handle, uint8_t id, uint16_t arg)
+{
+    uint32_t head;
+    hdc1080_log_record_t *record;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    head = handle->head;                                                  /* get the head */
+    if ((head - handle->tail) >= HDC1080_LOG_MAX_RECORD)                  /* check the space */
+    {
+        handle->seq++;                                                    /* the gap shows in the sequence */
+        handle->lost++;                                                   /* lost one record */
+        
+        return 1;                                                         /* return error */
+    }
+    record = &handle->record[head & (HDC1080_LOG_MAX_RECORD - 1)];        /* get the slot */
+    record->id = id;                                                      /* set the id */
+    record->seq = handle->seq;                                            /* set the sequence */
+    record->arg = arg;                                                    /* set the argument */
+    handle->seq++;                                                        /* next sequence */
+    handle->head = head + 1;                                              /* publish the record */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read a record from the log
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 log is empty
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t hdc1080_log_read(hdc1080_log_handle_t *handle, hdc1080_log_record_t *record)
+{
+    uint32_t tail;
+    
+    if ((handle == NULL) || (record == NULL))                             /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    tail = handle->tail;                                                  /* get the tail */
+    if (tail == handle->head)                                             /* check the data */
+    {
+        return 1;                                                         /* return error */
+    }
+    *record = handle->record[tail & (HDC1080_LOG_MAX_RECORD - 1)];        /* copy the record */
+    handle->tail = tail + 1;                                              /* release the slot */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the lost records
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *lost pointer to a lost records buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       it counts the records lost since the last reset
+ */
+uint8_t hdc1080_log_get_lost(hdc1080_log_handle_t *handle, uint32_t *lost)
+{
+    if ((handle == NULL) || (lost == NULL))         /* check handle */
+    {
+        return 2;                                   /* return error */
+    }
+    
+    *lost = handle->lost - handle->reported;        /* get the lost records */
+    
+    return 0;                                       /* success return 0 */
+}
+
+/**
+ * @brief      get and reset the lost records
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *lost pointer to a lost records buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       only the reader calls it, the writer keeps counting so that no loss is missed
+ */
+uint8_t hdc1080_log_reset_lost(hdc1080_log_handle_t *handle, uint32_t *lost)
+{
+    uint32_t total;
+    
+    if ((handle == NULL) || (lost == NULL))        /* check handle */
+    {
+        return 2;                                  /* return error */
+    }
+    
+    total = handle->lost;                          /* read the counter once */
+    *lost = total - handle->reported;              /* get the lost records */
+    handle->reported = total;                      /* mark them reported */
+    
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief      pack a record to the binary format
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 record or buf is NULL
+ * @note       buf length must be HDC1080_LOG_RECORD_SIZE, the format is id, seq, arg lsb, arg msb
+ */
+uint8_t hdc1080_log_pack(const hdc1080_log_record_t *record, uint8_t buf[HDC1080_LOG_RECORD_SIZE])
+{
+    if ((record == NULL) || (buf == NULL))        /* check record and buf */
+    {
+        return 2;                                 /* return error */
+    }
+    
+    buf[0] = record->id;                          /* set the id */
+    buf[1] = record->seq;                         /* set the sequence */
+    buf[2] = (record->arg >> 0) & 0xFF;           /* set the argument lsb */
+    buf[3] = (record->arg >> 8) & 0xFF;           /* set the argument msb */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief      unpack a record from the binary format
+ * @param[in]  *buf pointer to a data buffer
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 record or buf is NULL
+ * @note       buf length must be HDC1080_LOG_RECORD_SIZE
+ */
+uint8_t hdc1080_log_unpack(const uint8_t buf[HDC1080_LOG_RECORD_SIZE], hdc1080_log_record_t *record)
+{
+    if ((record == NULL) || (buf == NULL))                             /* check record and buf */
+    {
+        return 2;                                                      /* return error */
+    }
+    
+    record->id = buf[0];                                               /* get the id */
+    record->seq = buf[1];                                              /* get the sequence */
+    record->arg = (uint16_t)(((uint16_t)buf[3] << 8) | buf[2]);        /* get the argument */
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      format a record to the text
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 id is invalid
+ *             - 2 record or buf is NULL
+ * @note       it links all message strings, so a port sends packed records and the host decoder formats them
+ */
+uint8_t hdc1080_log_format(const hdc1080_log_record_t *record, char *buf, uint16_t len)
+{
+    if ((record == NULL) || (buf == NULL) || (len == 0))                                                 /* check record and buf */
+    {
+        return 2;                                                                                        /* return error */
+    }
+    if ((record->id == 0) || (record->id > HDC1080_LOG_MAX_ID))                                          /* check the id */
+    {
+        (void)snprintf(buf, len, "hdc1080: unknown message 0x%02X.\n", (unsigned int)record->id);        /* unknown message */
+        
+        return 1;                                                                                        /* return error */
+    }
+    
+    (void)snprintf(buf, len, gsc_hdc1080_log_text[record->id], (unsigned int)record->arg);               /* format the message */
+    
+    return 0;                                                                                            /* success return 0 */
+}
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_log.h
+ * @brief     driver hdc1080 log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_LOG_H
+#define DRIVER_HDC1080_LOG_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_log_driver hdc1080 log driver function
+ * @brief    hdc1080 log driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 log max record definition
+ * @note  must be a power of 2
+ */
+#ifndef HDC1080_LOG_MAX_RECORD
+    #define HDC1080_LOG_MAX_RECORD 32
+#endif
+
+/**
+ * @brief hdc1080 log packed record size definition
+ */
+#define HDC1080_LOG_RECORD_SIZE        4        /**< 4 bytes */
+
+/**
+ * @brief hdc1080 log line definition
+ * @note  a port sends a packed record as the prefix, 8 hex digits and '\n', the strings stay on the host
+ */
+#define HDC1080_LOG_LINE_PREFIX        "hdc1080: log "             /**< prefix of a record line */
+#define HDC1080_LOG_LINE_LOST          "hdc1080: log lost "        /**< prefix of a lost records line */
+
+/**
+ * @brief hdc1080 log record structure definition
+ */
+typedef struct hdc1080_log_record_s
+{
+    uint8_t id;          /**< debug message id */
+    uint8_t seq;         /**< sequence number */
+    uint16_t arg;        /**< debug message argument */
+} hdc1080_log_record_t;
+
+/**
+ * @brief hdc1080 log handle structure definition
+ */
+typedef struct hdc1080_log_handle_s
+{
+    hdc1080_log_record_t record[HDC1080_LOG_MAX_RECORD];        /**< record ring */
+    volatile uint32_t head;                                     /**< write counter */
+    volatile uint32_t tail;                                     /**< read counter */
+    volatile uint32_t lost;                                     /**< lost records, only the writer changes it */
+    uint32_t reported;                                          /**< lost records already reported by the reader */
+    uint8_t seq;                                                /**< next sequence number */
+} hdc1080_log_handle_t;
+
+/**
+ * @brief     initialize the log
+ * @param[in] *handle pointer to an hdc1080 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      a zero initialized handle is also an empty log
+ */
+uint8_t hdc1080_log_init(hdc1080_log_handle_t *handle);
+
+/**
+ * @brief     write a record to the log
+ * @param[in] *handle pointer to an hdc1080 log handle structure
+ * @param[in] id debug message id
+ * @param[in] arg debug message argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 log is full
+ *            - 2 handle is NULL
+ * @note      it never formats or blocks and can be linked as the driver debug_log function,
+ *            it is safe with one writer and one reader
+ */
+uint8_t hdc1080_log_write(hdc1080_log_handle_t *handle, uint8_t id, uint16_t arg);
+
+/**
+ * @brief      read a record from the log
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 log is empty
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t hdc1080_log_read(hdc1080_log_handle_t *handle, hdc1080_log_record_t *record);
+
+/**
+ * @brief      get the lost records
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *lost pointer to a lost records buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       it counts the records lost since the last reset
+ */
+uint8_t hdc1080_log_get_lost(hdc1080_log_handle_t *handle, uint32_t *lost);
+
+/**
+ * @brief      get and reset the lost records
+ * @param[in]  *handle pointer to an hdc1080 log handle structure
+ * @param[out] *lost pointer to a lost records buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       only the reader calls it, the writer keeps counting so that no loss is missed
+ */
+uint8_t hdc1080_log_reset_lost(hdc1080_log_handle_t *handle, uint32_t *lost);
+
+/**
+ * @brief      pack a record to the binary format
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 record or buf is NULL
+ * @note       buf length must be HDC1080_LOG_RECORD_SIZE, the format is id, seq, arg lsb, arg msb
+ */
+uint8_t hdc1080_log_pack(const hdc1080_log_record_t *record, uint8_t buf[HDC1080_LOG_RECORD_SIZE]);
+
+/**
+ * @brief      unpack a record from the binary format
+ * @param[in]  *buf pointer to a data buffer
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 record or buf is NULL
+ * @note       buf length must be HDC1080_LOG_RECORD_SIZE
+ */
+uint8_t hdc1080_log_unpack(const uint8_t buf[HDC1080_LOG_RECORD_SIZE], hdc1080_log_record_t *record);
+
+/**
+ * @brief      format a record to the text
+ * @param[in]  *record pointer to a record structure
+ * @param[out] *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 id is invalid
+ *             - 2 record or buf is NULL
+ * @note       it links all message strings, so a port sends packed records and the host decoder formats them
+ */
+uint8_t hdc1080_log_format(const hdc1080_log_record_t *record, char *buf, uint16_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,597 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_metrics.c
+ * @brief     driver hdc1080 metrics source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_metrics.h"
+#include <math.h>
+
+/**
+ * @brief metrics constant definition
+ */
+#define HDC1080_METRICS_B                17.62f                                            /**< magnus b */
+#define HDC1080_METRICS_C                243.12f                                           /**< magnus c in C */
+#define HDC1080_METRICS_ES0              6.112f                                            /**< saturation vapour pressure at 0C in hPa */
+#define HDC1080_METRICS_AH               216.7f                                            /**< absolute humidity factor in g*K/(m3*hPa) */
+#define HDC1080_METRICS_KELVIN           273.15f                                           /**< 0C in K */
+#define HDC1080_METRICS_HUMIDITY_MIN     (HDC1080_HUMIDITY_SPAN / HDC1080_RAW_SPAN)        /**< one raw humidity code in % */
+#define HDC1080_METRICS_LN2              0.69314718f                                       /**< ln(2) */
+#define HDC1080_METRICS_LOG2E            1.44269504f                                       /**< log2(e) */
+
+/**
+ * @brief metrics fixed point constant definition
+ */
+#define HDC1080_METRICS_FIXED_C          24312                    /**< magnus c in 0.01C */
+#define HDC1080_METRICS_FIXED_C_Q8       62239                    /**< magnus c in C q8 */
+#define HDC1080_METRICS_FIXED_B_Q16      1154744                  /**< magnus b in q16 */
+#define HDC1080_METRICS_FIXED_B_Q12      72172                    /**< magnus b in q12 */
+#define HDC1080_METRICS_FIXED_LN2_Q16    45426                    /**< ln(2) in q16 */
+#define HDC1080_METRICS_FIXED_LOG2E_Q16  94548                    /**< log2(e) in q16 */
+#define HDC1080_METRICS_FIXED_ES0_Q8     156467                   /**< saturation vapour pressure at 0C in pa q8 */
+#define HDC1080_METRICS_FIXED_AH         216700                   /**< absolute humidity factor for mg/m3, pa and 0.01K */
+#define HDC1080_METRICS_FIXED_KELVIN     27315                    /**< 0C in 0.01K */
+
+/**
+ * @brief ln(1 + i / 32) table in q16
+ */
+static const int32_t gsc_hdc1080_metrics_ln_table[33] =
+{
+    0, 2017, 3973, 5873, 7719, 9515, 11262, 12965, 14624, 16242, 17821,
+    19364, 20870, 22343, 23783, 25193, 26573, 27924, 29248, 30546, 31818,
+    33067, 34292, 35494, 36675, 37835, 38975, 40095, 41196, 42280, 43345,
+    44394, 45426,
+};
+
+/**
+ * @brief 2^(i / 32) table in q16
+ */
+static const int32_t gsc_hdc1080_metrics_exp2_table[33] =
+{
+    65536, 66971, 68438, 69936, 71468, 73032, 74632, 76266, 77936, 79642, 81386,
+    83169, 84990, 86851, 88752, 90696, 92682, 94711, 96785, 98905, 101070,
+    103283, 105545, 107856, 110218, 112631, 115098, 117618, 120194, 122825, 125515,
+    128263, 131072,
+};
+
+/**
+ * @brief rothfusz heat index coefficient table in q40, the first column is the constant,
+ *        the second is the linear and the third is the square temperature term in F
+ */
+static const int64_t gsc_hdc1080_metrics_hi_table[3][3] =
+{
+    {-46596203273519LL, 2252916070875LL, -7518273594LL},        /* rh^0 */
+    {11152710675749LL, -247121186701LL, 1351013918LL},          /* rh^1 */
+    {-60272115817LL, 937685506LL, -2188028LL},                  /* rh^2 */
+};
+
+/**
+ * @brief     natural logarithm approximation
+ * @param[in] x input value, must be positive
+ * @return    ln(x)
+ * @note      x = m * 2^e with m in [sqrt(0.5), sqrt(2)), ln(m) = 2 * atanh((m - 1) / (m + 1)) to the 7th power
+ */
+static float a_hdc1080_metrics_fast_log(float x)
+{
+    uint32_t bits;
+    int32_t e;
+    float m;
+    float s;
+    float s2;
+    
+    memcpy(&bits, &x, sizeof(float));                                                      /* get the bits */
+    e = (int32_t)((bits >> 23) & 0xFF) - 127;                                              /* get the exponent */
+    bits = (bits & 0x007FFFFFU) | 0x3F800000U;                                             /* set the exponent to 0 */
+    memcpy(&m, &bits, sizeof(float));                                                      /* m in [1, 2) */
+    if (m > 1.41421356f)                                                                   /* keep m around 1 */
+    {
+        m *= 0.5f;                                                                         /* half */
+        e++;                                                                               /* exponent + 1 */
+    }
+    s = (m - 1.0f) / (m + 1.0f);                                                           /* atanh argument */
+    s2 = s * s;                                                                            /* square */
+    
+    return (float)e * HDC1080_METRICS_LN2 +
+           2.0f * s * (1.0f + s2 * (0.33333333f + s2 * (0.2f + s2 * 0.14285714f)));        /* return the result */
+}
+
+/**
+ * @brief     exponential approximation
+ * @param[in] x input value in [-60, 60]
+ * @return    e^x
+ * @note      e^x = 2^n * 2^f with f in [0, 1), 2^f is a 6th order taylor polynomial
+ */
+static float a_hdc1080_metrics_fast_exp(float x)
+{
+    uint32_t bits;
+    int32_t n;
+    float t;
+    float f;
+    float p;
+    float scale;
+    
+    t = x * HDC1080_METRICS_LOG2E;                                         /* to base 2 */
+    n = (int32_t)t;                                                        /* truncate */
+    if ((float)n > t)                                                      /* floor for negative value */
+    {
+        n--;                                                               /* n - 1 */
+    }
+    f = t - (float)n;                                                      /* fraction in [0, 1) */
+    p = 1.0f + f * (0.69314718f + f * (0.24022651f + f * (0.05550411f +
+        f * (0.00961813f + f * (0.00133336f + f * 0.00015404f)))));        /* 2^f */
+    bits = (uint32_t)(n + 127) << 23;                                      /* 2^n */
+    memcpy(&scale, &bits, sizeof(float));                                  /* to float */
+    
+    return p * scale;                                                      /* return the result */
+}
+
+/**
+ * @brief     square root approximation
+ * @param[in] x input value in [0, 1]
+ * @return    sqrt(x)
+ * @note      bit level guess and two newton steps
+ */
+static float a_hdc1080_metrics_fast_sqrt(float x)
+{
+    uint32_t bits;
+    float y;
+    
+    if (x <= 0.0f)                           /* check x */
+    {
+        return 0.0f;                         /* return zero */
+    }
+    memcpy(&bits, &x, sizeof(float));        /* get the bits */
+    bits = (bits >> 1) + 0x1FC00000U;        /* half the exponent */
+    memcpy(&y, &bits, sizeof(float));        /* first guess */
+    y = 0.5f * (y + x / y);                  /* newton step */
+    y = 0.5f * (y + x / y);                  /* newton step */
+    
+    return y;                                /* return the result */
+}
+
+/**
+ * @brief     calculate the heat index
+ * @param[in] temperature temperature in C
+ * @param[in] humidity relative humidity in %
+ * @param[in] fast 1 uses the fast square root
+ * @return    heat index in C
+ * @note      none
+ */
+static float a_hdc1080_metrics_heat_index(float temperature, float humidity, uint8_t fast)
+{
+    float tf;
+    float hi;
+    float x;
+    
+    tf = temperature * 1.8f + 32.0f;                                                /* to F */
+    hi = 0.5f * (tf + 61.0f + (tf - 68.0f) * 1.2f + humidity * 0.094f);             /* simple formula */
+    if ((hi + tf) * 0.5f >= 80.0f)                                                  /* rothfusz regression */
+    {
+        hi = -42.379f + 2.04901523f * tf + 10.14333127f * humidity
+             - 0.22475541f * tf * humidity - 0.00683783f * tf * tf
+             - 0.05481717f * humidity * humidity
+             + 0.00122874f * tf * tf * humidity
+             + 0.00085282f * tf * humidity * humidity
+             - 0.00000199f * tf * tf * humidity * humidity;                         /* regression */
+        if ((humidity < 13.0f) && (tf >= 80.0f) && (tf <= 112.0f))                  /* low humidity */
+        {
+            x = (17.0f - fabsf(tf - 95.0f)) / 17.0f;                                /* adjustment argument */
+            hi -= ((13.0f - humidity) / 4.0f) *
+                  ((fast != 0) ? a_hdc1080_metrics_fast_sqrt(x) : sqrtf(x));        /* low humidity adjustment */
+        }
+        else if ((humidity > 85.0f) && (tf >= 80.0f) && (tf <= 87.0f))              /* high humidity */
+        {
+            hi += ((humidity - 85.0f) / 10.0f) * ((87.0f - tf) / 5.0f);             /* high humidity adjustment */
+        }
+        else
+        {
+                                                                           /* no adjustment */
+        }
+    }
+    
+    return (hi - 32.0f) / 1.8f;                                                     /* to C */
+}
+
+/**
+ * @brief      calculate the metrics
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity relative humidity in %
+ * @param[in]  fast 1 uses the libm free approximations
+ * @param[out] *metrics pointer to a metrics structure
+ * @note       none
+ */
+static void a_hdc1080_metrics_calculate(float temperature, float humidity, uint8_t fast, hdc1080_metrics_t *metrics)
+{
+    float x;
+    float gamma;
+    float e;
+    
+    if (humidity < HDC1080_METRICS_HUMIDITY_MIN)                                                         /* check the min humidity */
+    {
+        humidity = HDC1080_METRICS_HUMIDITY_MIN;                                                         /* clamp */
+    }
+    if (humidity > 100.0f)                                                                               /* check the max humidity */
+    {
+        humidity = 100.0f;                                                                               /* clamp */
+    }
+    
+    x = HDC1080_METRICS_B * temperature / (HDC1080_METRICS_C + temperature);                             /* magnus exponent */
+    if (fast != 0)                                                                                       /* fast */
+    {
+        gamma = a_hdc1080_metrics_fast_log(humidity * 0.01f) + x;                                        /* dew point gamma */
+        e = HDC1080_METRICS_ES0 * a_hdc1080_metrics_fast_exp(x) * humidity * 0.01f;                      /* vapour pressure */
+    }
+    else
+    {
+        gamma = logf(humidity * 0.01f) + x;                                                              /* dew point gamma */
+        e = HDC1080_METRICS_ES0 * expf(x) * humidity * 0.01f;                                            /* vapour pressure */
+    }
+    metrics->dew_point = HDC1080_METRICS_C * gamma / (HDC1080_METRICS_B - gamma);                        /* dew point */
+    metrics->absolute_humidity = HDC1080_METRICS_AH * e / (HDC1080_METRICS_KELVIN + temperature);        /* absolute humidity */
+    metrics->heat_index = a_hdc1080_metrics_heat_index(temperature, humidity, fast);                     /* heat index */
+}
+
+/**
+ * @brief     arithmetic shift right of a signed 64 bit value
+ * @param[in] x input value
+ * @param[in] n shift bits
+ * @return    x / 2^n rounded toward zero
+ * @note      none
+ */
+static int64_t a_hdc1080_metrics_asr64(int64_t x, uint8_t n)
+{
+    if (x >= 0)                     /* positive */
+    {
+        return x >> n;              /* shift */
+    }
+    else
+    {
+        return -((-x) >> n);        /* shift the magnitude */
+    }
+}
+
+/**
+ * @brief     integer square root
+ * @param[in] x input value
+ * @return    floor(sqrt(x))
+ * @note      none
+ */
+static uint32_t a_hdc1080_metrics_isqrt(uint32_t x)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    
+    while (bit > x)                        /* find the top bit */
+    {
+        bit >>= 2;                         /* next bit */
+    }
+    while (bit != 0)                       /* run all bits */
+    {
+        if (x >= res + bit)                /* set the bit */
+        {
+            x -= res + bit;                /* remove */
+            res = (res >> 1) + bit;        /* update */
+        }
+        else
+        {
+            res >>= 1;                     /* update */
+        }
+        bit >>= 2;                         /* next bit */
+    }
+    
+    return res;                            /* return the result */
+}
+
+/**
+ * @brief      calculate the fixed point heat index
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @return     heat index in 0.01C
+ * @note       the temperature in F and the humidity in % are exact in q16 from the raw data,
+ *             the rothfusz regression is evaluated as a polynomial in the humidity with q40 coefficients
+ */
+static int32_t a_hdc1080_metrics_fixed_heat_index(uint16_t temperature_raw, uint16_t humidity_raw)
+{
+    int32_t tf;
+    int32_t rh;
+    int32_t hi;
+    int32_t tf12;
+    int32_t rh10;
+    int64_t c[3];
+    int64_t poly;
+    uint32_t x;
+    uint8_t i;
+    
+    tf = 297 * (int32_t)temperature_raw - 40 * 65536;                                                    /* temperature in F q16 */
+    rh = 100 * (int32_t)humidity_raw;                                                                    /* humidity in % q16 */
+    hi = (tf * 11) / 10 - 675021 + (rh * 47) / 1000;                                                     /* simple formula, 1.1t - 10.3 + 0.047rh */
+    if ((hi + tf) / 2 >= 80 * 65536)                                                                     /* rothfusz regression */
+    {
+        tf12 = tf / 16;                                                                                  /* temperature in q12 */
+        rh10 = rh / 64;                                                                                  /* humidity in q10 */
+        for (i = 0; i < 3; i++)                                                                          /* coefficients of rh^i */
+        {
+            c[i] = gsc_hdc1080_metrics_hi_table[i][1] +
+                   a_hdc1080_metrics_asr64(gsc_hdc1080_metrics_hi_table[i][2] * tf12, 12);               /* linear and square terms */
+            c[i] = gsc_hdc1080_metrics_hi_table[i][0] + a_hdc1080_metrics_asr64(c[i] * tf12, 12);        /* constant term */
+        }
+        poly = c[1] + a_hdc1080_metrics_asr64(c[2] * rh10, 10);                                          /* horner step */
+        poly = c[0] + a_hdc1080_metrics_asr64(poly * rh10, 10);                                          /* horner step */
+        hi = (int32_t)a_hdc1080_metrics_asr64(poly, 24);                                                 /* to q16 */
+        if ((rh < 13 * 65536) && (tf >= 80 * 65536) && (tf <= 112 * 65536))                              /* low humidity */
+        {
+            x = (uint32_t)((17 * 65536 - ((tf > 95 * 65536) ? (tf - 95 * 65536) :
+                           (95 * 65536 - tf))) / 17);                                                    /* adjustment argument in q16 */
+            if (x > 65535)                                                                               /* check the range */
+            {
+                x = 65535;                                                                               /* clamp */
+            }
+            x = a_hdc1080_metrics_isqrt(x << 16);                                                        /* square root in q16 */
+            hi -= (int32_t)(((int64_t)((13 * 65536 - rh) / 4) * x) >> 16);                               /* low humidity adjustment */
+        }
+        else if ((rh > 85 * 65536) && (tf >= 80 * 65536) && (tf <= 87 * 65536))                          /* high humidity */
+        {
+            hi += (int32_t)(((int64_t)((rh - 85 * 65536) / 10) *
+                            ((87 * 65536 - tf) / 5)) >> 16);                                             /* high humidity adjustment */
+        }
+        else
+        {
+                                                                                               /* no adjustment */
+        }
+    }
+    
+    return (int32_t)(a_hdc1080_metrics_asr64((int64_t)(hi - 32 * 65536) * 500, 16) / 9);                 /* to 0.01C */
+}
+
+/**
+ * @brief      calculate the metrics with the reference formulas
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity relative humidity in %
+ * @param[out] *metrics pointer to a metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       magnus formula with b = 17.62 and c = 243.12C for the dew point and the saturation vapour pressure,
+ *             nws rothfusz regression with both adjustments for the heat index,
+ *             the humidity is clamped to the range of one raw code to 100%
+ */
+uint8_t hdc1080_metrics_exact(float temperature, float humidity, hdc1080_metrics_t *metrics)
+{
+    if (metrics == NULL)                                                   /* check metrics */
+    {
+        return 2;                                                          /* return error */
+    }
+    
+    a_hdc1080_metrics_calculate(temperature, humidity, 0, metrics);        /* calculate */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      calculate the metrics with the libm free approximations
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity relative humidity in %
+ * @param[out] *metrics pointer to a metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       logf, expf and sqrtf are replaced by polynomials on the float exponent and mantissa,
+ *             the error against a double precision reference over -40C to 125C and 1% to 100% is below
+ *             0.001C for the dew point, 0.001% of the value for the absolute humidity and 0.001C for the heat index,
+ *             it is meant for a libm whose logf and expf are slow software routines or missing, next to a fast
+ *             host libm it takes about the time of hdc1080_metrics_exact
+ */
+uint8_t hdc1080_metrics_fast(float temperature, float humidity, hdc1080_metrics_t *metrics)
+{
+    if (metrics == NULL)                                                   /* check metrics */
+    {
+        return 2;                                                          /* return error */
+    }
+    
+    a_hdc1080_metrics_calculate(temperature, humidity, 1, metrics);        /* calculate */
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      calculate the metrics in fixed point from the raw data
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *metrics pointer to a fixed point metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       it only uses integer arithmetic, the logarithm and the exponential come from 33 entry tables with
+ *             linear interpolation, the error against a double precision reference over -40C to 125C and 1% to 100%
+ *             is below 0.025C for the dew point, 0.5mg/m3 plus 0.025% of the value for the absolute humidity and
+ *             0.011C for the heat index, a heat index next to a branch of the nws algorithm may take the other branch
+ */
+uint8_t hdc1080_metrics_fixed(uint16_t temperature_raw, uint16_t humidity_raw, hdc1080_metrics_fixed_t *metrics)
+{
+    int32_t t;
+    int32_t t8;
+    int32_t x;
+    int32_t ln;
+    int32_t bx;
+    int32_t gamma;
+    int32_t l2;
+    int32_t n;
+    uint32_t m;
+    uint32_t idx;
+    uint32_t frac;
+    uint32_t p;
+    uint32_t es;
+    uint32_t k_ah;
+    uint32_t recip;
+    uint8_t k;
+    
+    if (metrics == NULL)                                                                                       /* check metrics */
+    {
+        return 2;                                                                                              /* return error */
+    }
+    
+    if (humidity_raw == 0)                                                                                     /* check the min humidity */
+    {
+        humidity_raw = 1;                                                                                      /* clamp */
+    }
+    t = (int32_t)(((uint32_t)temperature_raw * 16500U + 32768U) >> 16) - 4000;                                 /* temperature in 0.01C */
+    
+    m = humidity_raw;                                                                                          /* set the mantissa */
+    k = 0;                                                                                                     /* init 0 */
+    while (m < 32768)                                                                                          /* normalize */
+    {
+        m <<= 1;                                                                                               /* left shift */
+        k++;                                                                                                   /* k + 1 */
+    }
+    idx = (m - 32768) >> 10;                                                                                   /* table index */
+    frac = (m - 32768) & 0x3FF;                                                                                /* interpolation */
+    ln = gsc_hdc1080_metrics_ln_table[idx] +
+         (((gsc_hdc1080_metrics_ln_table[idx + 1] - gsc_hdc1080_metrics_ln_table[idx]) *
+         (int32_t)frac) >> 10) - (int32_t)(k + 1) * HDC1080_METRICS_FIXED_LN2_Q16;                             /* ln(rh) in q16 */
+    t8 = (int32_t)(((uint32_t)temperature_raw * 165U + 128U) >> 8) - 10240;                                    /* temperature in q8 */
+    x = (t8 * 65536) / (HDC1080_METRICS_FIXED_C_Q8 + t8);                                                      /* t / (c + t) in q16 */
+    x = x * 256 + ((t8 * 65536) % (HDC1080_METRICS_FIXED_C_Q8 + t8)) * 256 /
+        (HDC1080_METRICS_FIXED_C_Q8 + t8);                                                                     /* refine to q24 with the remainder */
+    bx = (int32_t)a_hdc1080_metrics_asr64((int64_t)x * HDC1080_METRICS_FIXED_B_Q16, 24);                       /* b * t / (c + t) in q16 */
+    gamma = (ln + bx) / 16;                                                                                    /* gamma in q12 */
+    metrics->dew_point = HDC1080_METRICS_FIXED_C * gamma / (HDC1080_METRICS_FIXED_B_Q12 - gamma);              /* dew point */
+    
+    l2 = (int32_t)a_hdc1080_metrics_asr64((int64_t)bx * HDC1080_METRICS_FIXED_LOG2E_Q16, 16);                  /* to base 2 */
+    n = (l2 >= 0) ? (l2 / 65536) : -((65535 - l2) / 65536);                                                    /* floor */
+    frac = (uint32_t)(l2 - n * 65536);                                                                         /* fraction in q16 */
+    idx = frac >> 11;                                                                                          /* table index */
+    frac &= 0x7FF;                                                                                             /* interpolation */
+    p = (uint32_t)gsc_hdc1080_metrics_exp2_table[idx] +
+        ((((uint32_t)gsc_hdc1080_metrics_exp2_table[idx + 1] -
+        (uint32_t)gsc_hdc1080_metrics_exp2_table[idx]) * frac) >> 11);                                         /* 2^f in q16 */
+    es = (uint32_t)(((uint64_t)HDC1080_METRICS_FIXED_ES0_Q8 * p) >> 16);                                       /* saturation vapour pressure in pa q8 */
+    if (n >= 0)                                                                                                /* positive */
+    {
+        es <<= n;                                                                                              /* 2^n */
+    }
+    else
+    {
+        es >>= -n;                                                                                             /* 2^n */
+    }
+    recip = (1UL << 31) / (uint32_t)(HDC1080_METRICS_FIXED_KELVIN + t);                                        /* 2^31 / t in 0.01K */
+    k_ah = (uint32_t)(((uint64_t)HDC1080_METRICS_FIXED_AH * recip) >> 16);                                     /* factor / t in q15 */
+    metrics->absolute_humidity = (uint32_t)(((uint64_t)es * humidity_raw * k_ah + (1ULL << 38)) >> 39);        /* absolute humidity */
+    metrics->heat_index = a_hdc1080_metrics_fixed_heat_index(temperature_raw, humidity_raw);                   /* heat index */
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      calculate the metrics of a batch with the reference formulas
+ * @param[in]  *temperature pointer to a temperature buffer
+ * @param[in]  *humidity pointer to a humidity buffer
+ * @param[out] *metrics pointer to a metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_exact_batch(const float *temperature, const float *humidity, hdc1080_metrics_t *metrics, uint32_t len)
+{
+    uint32_t i;
+    
+    if ((temperature == NULL) || (humidity == NULL) || (metrics == NULL))                /* check buffer */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                            /* run all samples */
+    {
+        a_hdc1080_metrics_calculate(temperature[i], humidity[i], 0, &metrics[i]);        /* calculate */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      calculate the metrics of a batch with the libm free approximations
+ * @param[in]  *temperature pointer to a temperature buffer
+ * @param[in]  *humidity pointer to a humidity buffer
+ * @param[out] *metrics pointer to a metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_fast_batch(const float *temperature, const float *humidity, hdc1080_metrics_t *metrics, uint32_t len)
+{
+    uint32_t i;
+    
+    if ((temperature == NULL) || (humidity == NULL) || (metrics == NULL))                /* check buffer */
+    {
+        return 2;                                                                        /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                            /* run all samples */
+    {
+        a_hdc1080_metrics_calculate(temperature[i], humidity[i], 1, &metrics[i]);        /* calculate */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      calculate the metrics of a batch in fixed point from the raw data
+ * @param[in]  *temperature_raw pointer to a raw temperature buffer
+ * @param[in]  *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *metrics pointer to a fixed point metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_fixed_batch(const uint16_t *temperature_raw, const uint16_t *humidity_raw,
+                                    hdc1080_metrics_fixed_t *metrics, uint32_t len)
+{
+    uint32_t i;
+    
+    if ((temperature_raw == NULL) || (humidity_raw == NULL) || (metrics == NULL))             /* check buffer */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                 /* run all samples */
+    {
+        (void)hdc1080_metrics_fixed(temperature_raw[i], humidity_raw[i], &metrics[i]);        /* calculate */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_metrics.h
+ * @brief     driver hdc1080 metrics header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_METRICS_H
+#define DRIVER_HDC1080_METRICS_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_metrics_driver hdc1080 metrics driver function
+ * @brief    hdc1080 metrics driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 metrics structure definition
+ */
+typedef struct hdc1080_metrics_s
+{
+    float dew_point;                 /**< dew point in C */
+    float absolute_humidity;         /**< absolute humidity in g/m3 */
+    float heat_index;                /**< heat index in C */
+} hdc1080_metrics_t;
+
+/**
+ * @brief hdc1080 fixed point metrics structure definition
+ */
+typedef struct hdc1080_metrics_fixed_s
+{
+    int32_t dew_point;               /**< dew point in 0.01C */
+    uint32_t absolute_humidity;      /**< absolute humidity in mg/m3 */
+    int32_t heat_index;              /**< heat index in 0.01C */
+} hdc1080_metrics_fixed_t;
+
+/**
+ * @brief      calculate the metrics with the reference formulas
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity relative humidity in %
+ * @param[out] *metrics pointer to a metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       magnus formula with b = 17.62 and c = 243.12C for the dew point and the saturation vapour pressure,
+ *             nws rothfusz regression with both adjustments for the heat index,
+ *             the humidity is clamped to the range of one raw code to 100%
+ */
+uint8_t hdc1080_metrics_exact(float temperature, float humidity, hdc1080_metrics_t *metrics);
+
+/**
+ * @brief      calculate the metrics with the libm free approximations
+ * @param[in]  temperature temperature in C
+ * @param[in]  humidity relative humidity in %
+ * @param[out] *metrics pointer to a metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       logf, expf and sqrtf are replaced by polynomials on the float exponent and mantissa,
+ *             the error against a double precision reference over -40C to 125C and 1% to 100% is below
+ *             0.001C for the dew point, 0.001% of the value for the absolute humidity and 0.001C for the heat index,
+ *             it is meant for a libm whose logf and expf are slow software routines or missing, next to a fast
+ *             host libm it takes about the time of hdc1080_metrics_exact
+ */
+uint8_t hdc1080_metrics_fast(float temperature, float humidity, hdc1080_metrics_t *metrics);
+
+/**
+ * @brief      calculate the metrics in fixed point from the raw data
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *metrics pointer to a fixed point metrics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 metrics is NULL
+ * @note       it only uses integer arithmetic, the logarithm and the exponential come from 33 entry tables with
+ *             linear interpolation, the error against a double precision reference over -40C to 125C and 1% to 100%
+ *             is below 0.025C for the dew point, 0.5mg/m3 plus 0.025% of the value for the absolute humidity and
+ *             0.011C for the heat index, a heat index next to a branch of the nws algorithm may take the other branch
+ */
+uint8_t hdc1080_metrics_fixed(uint16_t temperature_raw, uint16_t humidity_raw, hdc1080_metrics_fixed_t *metrics);
+
+/**
+ * @brief      calculate the metrics of a batch with the reference formulas
+ * @param[in]  *temperature pointer to a temperature buffer
+ * @param[in]  *humidity pointer to a humidity buffer
+ * @param[out] *metrics pointer to a metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_exact_batch(const float *temperature, const float *humidity, hdc1080_metrics_t *metrics, uint32_t len);
+
+/**
+ * @brief      calculate the metrics of a batch with the libm free approximations
+ * @param[in]  *temperature pointer to a temperature buffer
+ * @param[in]  *humidity pointer to a humidity buffer
+ * @param[out] *metrics pointer to a metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_fast_batch(const float *temperature, const float *humidity, hdc1080_metrics_t *metrics, uint32_t len);
+
+/**
+ * @brief      calculate the metrics of a batch in fixed point from the raw data
+ * @param[in]  *temperature_raw pointer to a raw temperature buffer
+ * @param[in]  *humidity_raw pointer to a raw humidity buffer
+ * @param[out] *metrics pointer to a fixed point metrics buffer
+ * @param[in]  len number of samples
+ * @return     status code
+ *             - 0 success
+ *             - 2 buffer is NULL
+ * @note       none
+ */
+uint8_t hdc1080_metrics_fixed_batch(const uint16_t *temperature_raw, const uint16_t *humidity_raw,
+                                    hdc1080_metrics_fixed_t *metrics, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
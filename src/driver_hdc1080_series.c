@@ -0,0 +1,619 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_series.c
+ * @brief     driver hdc1080 series source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_series.h"
+#include "driver_hdc1080_frame.h"
+
+/**
+ * @brief series token definition
+ */
+#define HDC1080_SERIES_TOKEN_SHORT        0x00        /**< 0ttthhhh, same period, small deltas */
+#define HDC1080_SERIES_TOKEN_MEDIUM       0x80        /**< 10tttttt hhhhhhhh, same period, medium deltas */
+#define HDC1080_SERIES_TOKEN_RUN          0xC0        /**< 110rrrrr, r + 1 unchanged samples */
+#define HDC1080_SERIES_TOKEN_FULL         0xE0        /**< 1110000d, varints of the period change and the deltas */
+#define HDC1080_SERIES_TOKEN_JITTER       0xF0        /**< 1111pppp tttthhhh, small period change, small deltas */
+#define HDC1080_SERIES_MAX_RUN            32          /**< longest run of one token */
+
+/**
+ * @brief series resolution shift table
+ */
+static const uint8_t gsc_hdc1080_series_shift[3] = {2, 5, 8};
+
+/**
+ * @brief     zigzag encode a value
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static uint32_t a_hdc1080_series_zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(-(int32_t)((uint32_t)v >> 31));        /* small magnitudes to small codes */
+}
+
+/**
+ * @brief     zigzag decode a value
+ * @param[in] v unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int32_t a_hdc1080_series_unzigzag(uint32_t v)
+{
+    return (int32_t)((v >> 1) ^ (uint32_t)(-(int32_t)(v & 1)));        /* back to signed */
+}
+
+/**
+ * @brief     write a varint
+ * @param[in] *buf pointer to a buffer
+ * @param[in] v value
+ * @return    written length
+ * @note      7 bits per byte, the top bit marks a following byte
+ */
+static uint8_t a_hdc1080_series_put_varint(uint8_t *buf, uint32_t v)
+{
+    uint8_t n = 0;
+    
+    while (v >= 0x80)                          /* more than 7 bits */
+    {
+        buf[n++] = (uint8_t)(v | 0x80);        /* low 7 bits and the flag */
+        v >>= 7;                               /* next 7 bits */
+    }
+    buf[n++] = (uint8_t)v;                     /* last byte */
+    
+    return n;                                  /* return the length */
+}
+
+/**
+ * @brief         read a varint
+ * @param[in]     *buf pointer to a buffer
+ * @param[in,out] *pos pointer to a position buffer
+ * @param[in]     end end of the buffer
+ * @param[out]    *v pointer to a value buffer
+ * @return        1 if the varint is invalid, else 0
+ * @note          none
+ */
+static uint8_t a_hdc1080_series_get_varint(const uint8_t *buf, uint32_t *pos, uint32_t end, uint32_t *v)
+{
+    uint8_t shift = 0;
+    uint8_t b;
+    
+    *v = 0;                                         /* init 0 */
+    do
+    {
+        if ((*pos >= end) || (shift > 28))          /* check the range */
+        {
+            return 1;                               /* return error */
+        }
+        b = buf[(*pos)++];                          /* get one byte */
+        *v |= (uint32_t)(b & 0x7F) << shift;        /* add 7 bits */
+        shift += 7;                                 /* next 7 bits */
+    } while ((b & 0x80) != 0);
+    
+    return 0;                                       /* success return 0 */
+}
+
+/**
+ * @brief     write a little endian uint16
+ * @param[in] *buf pointer to a buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_hdc1080_series_put_u16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)(v >> 0);        /* low byte */
+    buf[1] = (uint8_t)(v >> 8);        /* high byte */
+}
+
+/**
+ * @brief     read a little endian uint16
+ * @param[in] *buf pointer to a buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_hdc1080_series_get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | ((uint16_t)buf[1] << 8));        /* little endian */
+}
+
+/**
+ * @brief     write the pending run
+ * @param[in] *encoder pointer to an encoder structure
+ * @note      none
+ */
+static void a_hdc1080_series_put_run(hdc1080_series_encoder_t *encoder)
+{
+    if (encoder->run != 0)                                                                            /* pending run */
+    {
+        encoder->buf[encoder->len++] = HDC1080_SERIES_TOKEN_RUN | (uint8_t)(encoder->run - 1);        /* run token */
+        encoder->run = 0;                                                                             /* clear the run */
+    }
+}
+
+/**
+ * @brief     finish the open block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    block length
+ * @note      none
+ */
+static uint16_t a_hdc1080_series_finish(hdc1080_series_encoder_t *encoder)
+{
+    uint16_t len;
+    
+    if (encoder->count == 0)                                                          /* no sample */
+    {
+        return 0;                                                                     /* nothing to finish */
+    }
+    
+    a_hdc1080_series_put_run(encoder);                                                /* write the run */
+    len = encoder->len + 2;                                                           /* with the crc */
+    a_hdc1080_series_put_u16(&encoder->buf[10], len);                                 /* set the length */
+    a_hdc1080_series_put_u16(&encoder->buf[12], encoder->count);                      /* set the count */
+    a_hdc1080_series_put_u16(&encoder->buf[encoder->len],
+                             hdc1080_frame_crc16(encoder->buf, encoder->len));        /* set the crc */
+    encoder->len = 0;                                                                 /* clear the length */
+    encoder->count = 0;                                                               /* the next sample starts a block */
+    
+    return len;                                                                       /* return the length */
+}
+
+/**
+ * @brief     set the resolution of the encoder
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] temperature_resolution temperature resolution
+ * @param[in] humidity_resolution humidity resolution
+ * @return    1 if the resolution is invalid, else 0
+ * @note      none
+ */
+static uint8_t a_hdc1080_series_resolution(hdc1080_series_encoder_t *encoder,
+                                           hdc1080_temperature_resolution_t temperature_resolution,
+                                           hdc1080_humidity_resolution_t humidity_resolution)
+{
+    if ((temperature_resolution > HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (humidity_resolution > HDC1080_HUMIDITY_RESOLUTION_8_BIT))                               /* check the resolution */
+    {
+        return 1;                                                                                /* return error */
+    }
+    encoder->resolution = (uint8_t)(temperature_resolution | (humidity_resolution << 2));        /* pack the resolution */
+    encoder->temperature_shift = gsc_hdc1080_series_shift[temperature_resolution];               /* set the temperature shift */
+    encoder->humidity_shift = gsc_hdc1080_series_shift[humidity_resolution];                     /* set the humidity shift */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     initialize a series encoder
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *buf pointer to a block buffer
+ * @param[in] size block buffer size
+ * @param[in] *id pointer to a 6 bytes sensor serial id
+ * @param[in] temperature_resolution temperature resolution
+ * @param[in] humidity_resolution humidity resolution
+ * @return    status code
+ *            - 0 success
+ *            - 2 encoder, buf or id is NULL
+ *            - 4 size or resolution is invalid
+ * @note      HDC1080_SERIES_MIN_BLOCK_SIZE <= size <= 65535, the buffer is the whole ram the encoder needs,
+ *            a larger block spreads its header over more samples
+ */
+uint8_t hdc1080_series_encoder_init(hdc1080_series_encoder_t *encoder, uint8_t *buf, uint16_t size, const uint8_t *id,
+                                    hdc1080_temperature_resolution_t temperature_resolution,
+                                    hdc1080_humidity_resolution_t humidity_resolution)
+{
+    if ((encoder == NULL) || (buf == NULL) || (id == NULL))                                            /* check encoder */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (size < HDC1080_SERIES_MIN_BLOCK_SIZE)                                                          /* check the size */
+    {
+        return 4;                                                                                      /* return error */
+    }
+    
+    memset(encoder, 0, sizeof(hdc1080_series_encoder_t));                                              /* clear all */
+    if (a_hdc1080_series_resolution(encoder, temperature_resolution, humidity_resolution) != 0)        /* set the resolution */
+    {
+        return 4;                                                                                      /* return error */
+    }
+    encoder->buf = buf;                                                                                /* set the buffer */
+    encoder->size = size;                                                                              /* set the size */
+    memcpy(encoder->id, id, 6);                                                                        /* copy the serial id */
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      add a sample to the block
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means the block is still open
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ * @note       when block_len is not 0 the buffer holds a finished block with this sample as its last one,
+ *             store or send it before the next call, the bits below the resolution are dropped
+ */
+uint8_t hdc1080_series_encoder_add(hdc1080_series_encoder_t *encoder, uint32_t timestamp_ms, uint16_t temperature_raw,
+                                   uint16_t humidity_raw, uint16_t *block_len)
+{
+    uint8_t *p;
+    uint16_t t;
+    uint16_t h;
+    int32_t delta;
+    int32_t dod;
+    uint32_t zd;
+    uint32_t zt;
+    uint32_t zh;
+    
+    if ((encoder == NULL) || (block_len == NULL))                                                        /* check encoder */
+    {
+        return 2;                                                                                        /* return error */
+    }
+    
+    *block_len = 0;                                                                                      /* block is open */
+    t = temperature_raw >> encoder->temperature_shift;                                                   /* drop the zero bits */
+    h = humidity_raw >> encoder->humidity_shift;                                                         /* drop the zero bits */
+    if (encoder->count == 0)                                                                             /* first sample */
+    {
+        p = encoder->buf;                                                                                /* header */
+        a_hdc1080_series_put_u16(&p[0], HDC1080_SERIES_MAGIC);                                           /* set the magic */
+        p[2] = HDC1080_SERIES_VERSION;                                                                   /* set the version */
+        p[3] = encoder->resolution;                                                                      /* set the resolution */
+        memcpy(&p[4], encoder->id, 6);                                                                   /* set the serial id */
+        p[14] = (uint8_t)(timestamp_ms >> 0);                                                            /* set the timestamp */
+        p[15] = (uint8_t)(timestamp_ms >> 8);                                                            /* set the timestamp */
+        p[16] = (uint8_t)(timestamp_ms >> 16);                                                           /* set the timestamp */
+        p[17] = (uint8_t)(timestamp_ms >> 24);                                                           /* set the timestamp */
+        a_hdc1080_series_put_u16(&p[18], t);                                                             /* set the temperature */
+        a_hdc1080_series_put_u16(&p[20], h);                                                             /* set the humidity */
+        encoder->len = HDC1080_SERIES_HEADER_SIZE;                                                       /* header length */
+        encoder->last_delta = 0;                                                                         /* no period yet */
+    }
+    else
+    {
+        delta = (int32_t)(timestamp_ms - encoder->last_ms);                                              /* period */
+        dod = (int32_t)((uint32_t)delta - (uint32_t)encoder->last_delta);                                /* period change */
+        zt = a_hdc1080_series_zigzag((int32_t)t - (int32_t)encoder->last_temperature);                   /* temperature delta */
+        zh = a_hdc1080_series_zigzag((int32_t)h - (int32_t)encoder->last_humidity);                      /* humidity delta */
+        zd = a_hdc1080_series_zigzag(dod);                                                               /* period change */
+        if ((dod == 0) && (zt == 0) && (zh == 0))                                                        /* unchanged */
+        {
+            encoder->run++;                                                                              /* run + 1 */
+            if (encoder->run == HDC1080_SERIES_MAX_RUN)                                                  /* longest run */
+            {
+                a_hdc1080_series_put_run(encoder);                                                       /* write the run */
+            }
+        }
+        else
+        {
+            a_hdc1080_series_put_run(encoder);                                                           /* write the run */
+            p = &encoder->buf[encoder->len];                                                             /* token */
+            if ((dod == 0) && (zt < 8) && (zh < 16))                                                     /* short */
+            {
+                p[0] = HDC1080_SERIES_TOKEN_SHORT | (uint8_t)(zt << 4) | (uint8_t)zh;                    /* one byte */
+                encoder->len += 1;                                                                       /* length + 1 */
+            }
+            else if ((dod == 0) && (zt < 64) && (zh < 256))                                              /* medium */
+            {
+                p[0] = HDC1080_SERIES_TOKEN_MEDIUM | (uint8_t)zt;                                        /* temperature */
+                p[1] = (uint8_t)zh;                                                                      /* humidity */
+                encoder->len += 2;                                                                       /* length + 2 */
+            }
+            else if ((zd < 16) && (zt < 16) && (zh < 16))                                                /* jitter */
+            {
+                p[0] = HDC1080_SERIES_TOKEN_JITTER | (uint8_t)zd;                                        /* period change */
+                p[1] = (uint8_t)((zt << 4) | zh);                                                        /* deltas */
+                encoder->len += 2;                                                                       /* length + 2 */
+            }
+            else
+            {
+                p[0] = HDC1080_SERIES_TOKEN_FULL | ((dod != 0) ? 1 : 0);                                 /* full */
+                encoder->len += 1;                                                                       /* length + 1 */
+                if (dod != 0)                                                                            /* period changed */
+                {
+                    encoder->len += a_hdc1080_series_put_varint(&encoder->buf[encoder->len], zd);        /* period change */
+                }
+                encoder->len += a_hdc1080_series_put_varint(&encoder->buf[encoder->len], zt);            /* temperature delta */
+                encoder->len += a_hdc1080_series_put_varint(&encoder->buf[encoder->len], zh);            /* humidity delta */
+            }
+        }
+        encoder->last_delta = delta;                                                                     /* save the period */
+    }
+    encoder->last_ms = timestamp_ms;                                                                     /* save the timestamp */
+    encoder->last_temperature = t;                                                                       /* save the temperature */
+    encoder->last_humidity = h;                                                                          /* save the humidity */
+    encoder->count++;                                                                                    /* count + 1 */
+    
+    if ((encoder->count == 0xFFFF) ||
+        ((uint32_t)encoder->size - encoder->len < 1 + HDC1080_SERIES_MAX_SAMPLE_SIZE + 2))               /* no room for the worst case */
+    {
+        *block_len = a_hdc1080_series_finish(encoder);                                                   /* finish the block */
+    }
+    
+    return 0;                                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      finish the open block
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means there was no sample
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ * @note       the next sample starts a new block
+ */
+uint8_t hdc1080_series_encoder_flush(hdc1080_series_encoder_t *encoder, uint16_t *block_len)
+{
+    if ((encoder == NULL) || (block_len == NULL))         /* check encoder */
+    {
+        return 2;                                         /* return error */
+    }
+    
+    *block_len = a_hdc1080_series_finish(encoder);        /* finish the block */
+    
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief      change the resolution of the next samples
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means no block was finished
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ *             - 4 resolution is invalid
+ * @note       a block has one resolution, so a change finishes the open block
+ */
+uint8_t hdc1080_series_encoder_set_resolution(hdc1080_series_encoder_t *encoder,
+                                              hdc1080_temperature_resolution_t temperature_resolution,
+                                              hdc1080_humidity_resolution_t humidity_resolution, uint16_t *block_len)
+{
+    if ((encoder == NULL) || (block_len == NULL))                                                       /* check encoder */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if ((temperature_resolution > HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (humidity_resolution > HDC1080_HUMIDITY_RESOLUTION_8_BIT))                                      /* check the resolution */
+    {
+        return 4;                                                                                       /* return error */
+    }
+    
+    *block_len = 0;                                                                                     /* no block */
+    if (encoder->resolution != (uint8_t)(temperature_resolution | (humidity_resolution << 2)))          /* changed */
+    {
+        *block_len = a_hdc1080_series_finish(encoder);                                                  /* finish the block */
+        (void)a_hdc1080_series_resolution(encoder, temperature_resolution, humidity_resolution);        /* set the resolution */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      read a block header
+ * @param[in]  *buf pointer to a block buffer
+ * @param[in]  len available length
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 header is invalid or the block is longer than len
+ *             - 2 buf or header is NULL
+ * @note       it does not check the crc, use it to find the block length in a stream
+ */
+uint8_t hdc1080_series_read_header(const uint8_t *buf, uint32_t len, hdc1080_series_header_t *header)
+{
+    if ((buf == NULL) || (header == NULL))                                                           /* check buf */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if (len < HDC1080_SERIES_HEADER_SIZE + 2)                                                        /* check the length */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if ((a_hdc1080_series_get_u16(&buf[0]) != HDC1080_SERIES_MAGIC) ||
+        (buf[2] != HDC1080_SERIES_VERSION))                                                          /* check the magic */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if (((buf[3] & 0x03) > HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (((buf[3] >> 2) & 0x03) > HDC1080_HUMIDITY_RESOLUTION_8_BIT) || ((buf[3] >> 4) != 0))        /* check the resolution */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    header->temperature_resolution = (hdc1080_temperature_resolution_t)(buf[3] & 0x03);              /* get the temperature resolution */
+    header->humidity_resolution = (hdc1080_humidity_resolution_t)((buf[3] >> 2) & 0x03);             /* get the humidity resolution */
+    memcpy(header->id, &buf[4], 6);                                                                  /* get the serial id */
+    header->len = a_hdc1080_series_get_u16(&buf[10]);                                                /* get the length */
+    header->count = a_hdc1080_series_get_u16(&buf[12]);                                              /* get the count */
+    if ((header->len < HDC1080_SERIES_HEADER_SIZE + 2) || (header->len > len) ||
+        (header->count == 0))                                                                        /* check the length */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      decode a block
+ * @param[in]  *buf pointer to a block buffer
+ * @param[in]  len available length
+ * @param[out] *header pointer to a header structure
+ * @param[out] *samples pointer to a sample buffer
+ * @param[in]  max sample buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 buf, header or samples is NULL
+ *             - 4 crc check failed
+ *             - 5 sample buffer is too small
+ * @note       header->count samples are written
+ */
+uint8_t hdc1080_series_decode(const uint8_t *buf, uint32_t len, hdc1080_series_header_t *header,
+                              hdc1080_series_sample_t *samples, uint16_t max)
+{
+    uint8_t res;
+    uint8_t b;
+    uint8_t ts;
+    uint8_t hs;
+    uint8_t n;
+    uint16_t i;
+    uint32_t pos;
+    uint32_t end;
+    uint32_t v;
+    uint32_t ms;
+    int32_t delta;
+    int32_t t;
+    int32_t h;
+    
+    if ((buf == NULL) || (header == NULL) || (samples == NULL))                                        /* check buf */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    res = hdc1080_series_read_header(buf, len, header);                                                /* read the header */
+    if (res != 0)
+    {
+        return res;                                                                                    /* return error */
+    }
+    end = header->len - 2;                                                                             /* payload end */
+    if (hdc1080_frame_crc16(buf, (uint16_t)end) != a_hdc1080_series_get_u16(&buf[end]))                /* check the crc */
+    {
+        return 4;                                                                                      /* return error */
+    }
+    if (header->count > max)                                                                           /* check the buffer */
+    {
+        return 5;                                                                                      /* return error */
+    }
+    
+    ts = gsc_hdc1080_series_shift[header->temperature_resolution];                                     /* temperature shift */
+    hs = gsc_hdc1080_series_shift[header->humidity_resolution];                                        /* humidity shift */
+    ms = (uint32_t)buf[14] | ((uint32_t)buf[15] << 8) |
+         ((uint32_t)buf[16] << 16) | ((uint32_t)buf[17] << 24);                                        /* first timestamp */
+    t = a_hdc1080_series_get_u16(&buf[18]);                                                            /* first temperature */
+    h = a_hdc1080_series_get_u16(&buf[20]);                                                            /* first humidity */
+    delta = 0;                                                                                         /* no period yet */
+    samples[0].timestamp_ms = ms;                                                                      /* set the timestamp */
+    samples[0].temperature_raw = (uint16_t)(t << ts);                                                  /* set the temperature */
+    samples[0].humidity_raw = (uint16_t)(h << hs);                                                     /* set the humidity */
+    pos = HDC1080_SERIES_HEADER_SIZE;                                                                  /* payload start */
+    i = 1;                                                                                             /* next sample */
+    while (i < header->count)                                                                          /* decode all */
+    {
+        if (pos >= end)                                                                                /* check the range */
+        {
+            return 1;                                                                                  /* return error */
+        }
+        b = buf[pos++];                                                                                /* get the token */
+        n = 1;                                                                                         /* one sample */
+        if ((b & 0x80) == HDC1080_SERIES_TOKEN_SHORT)                                                  /* short */
+        {
+            t += a_hdc1080_series_unzigzag((b >> 4) & 0x07);                                           /* temperature delta */
+            h += a_hdc1080_series_unzigzag(b & 0x0F);                                                  /* humidity delta */
+        }
+        else if ((b & 0xC0) == HDC1080_SERIES_TOKEN_MEDIUM)                                            /* medium */
+        {
+            if (pos >= end)                                                                            /* check the range */
+            {
+                return 1;                                                                              /* return error */
+            }
+            t += a_hdc1080_series_unzigzag(b & 0x3F);                                                  /* temperature delta */
+            h += a_hdc1080_series_unzigzag(buf[pos++]);                                                /* humidity delta */
+        }
+        else if ((b & 0xE0) == HDC1080_SERIES_TOKEN_RUN)                                               /* run */
+        {
+            n = (uint8_t)((b & 0x1F) + 1);                                                             /* run length */
+            if ((uint32_t)i + n > header->count)                                                       /* check the count */
+            {
+                return 1;                                                                              /* return error */
+            }
+        }
+        else if ((b & 0xF0) == HDC1080_SERIES_TOKEN_JITTER)                                            /* jitter */
+        {
+            if (pos >= end)                                                                            /* check the range */
+            {
+                return 1;                                                                              /* return error */
+            }
+            delta = (int32_t)((uint32_t)delta + (uint32_t)a_hdc1080_series_unzigzag(b & 0x0F));        /* new period */
+            t += a_hdc1080_series_unzigzag(buf[pos] >> 4);                                             /* temperature delta */
+            h += a_hdc1080_series_unzigzag(buf[pos++] & 0x0F);                                         /* humidity delta */
+        }
+        else if ((b & 0xFE) == HDC1080_SERIES_TOKEN_FULL)                                              /* full */
+        {
+            if ((b & 0x01) != 0)                                                                       /* period changed */
+            {
+                if (a_hdc1080_series_get_varint(buf, &pos, end, &v) != 0)                              /* get the period change */
+                {
+                    return 1;                                                                          /* return error */
+                }
+                delta = (int32_t)((uint32_t)delta + (uint32_t)a_hdc1080_series_unzigzag(v));           /* new period */
+            }
+            if (a_hdc1080_series_get_varint(buf, &pos, end, &v) != 0)                                  /* get the temperature delta */
+            {
+                return 1;                                                                              /* return error */
+            }
+            t += a_hdc1080_series_unzigzag(v);                                                         /* temperature delta */
+            if (a_hdc1080_series_get_varint(buf, &pos, end, &v) != 0)                                  /* get the humidity delta */
+            {
+                return 1;                                                                              /* return error */
+            }
+            h += a_hdc1080_series_unzigzag(v);                                                         /* humidity delta */
+        }
+        else
+        {
+            return 1;                                                                                  /* reserved token */
+        }
+        if ((t < 0) || (t > (0xFFFF >> ts)) || (h < 0) || (h > (0xFFFF >> hs)))                        /* check the codes */
+        {
+            return 1;                                                                                  /* return error */
+        }
+        while (n != 0)                                                                                 /* write the samples */
+        {
+            ms += (uint32_t)delta;                                                                     /* next timestamp */
+            samples[i].timestamp_ms = ms;                                                              /* set the timestamp */
+            samples[i].temperature_raw = (uint16_t)(t << ts);                                          /* set the temperature */
+            samples[i].humidity_raw = (uint16_t)(h << hs);                                             /* set the humidity */
+            i++;                                                                                       /* next sample */
+            n--;                                                                                       /* run - 1 */
+        }
+    }
+    if (pos != end)                                                                                    /* check the end */
+    {
+        return 1;                                                                                      /* return error */
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_series.h
+ * @brief     driver hdc1080 series header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_SERIES_H
+#define DRIVER_HDC1080_SERIES_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_series_driver hdc1080 series driver function
+ * @brief    hdc1080 compressed time series driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 series format definition
+ */
+#define HDC1080_SERIES_MAGIC              0x5348        /**< "HS" in little endian */
+#define HDC1080_SERIES_VERSION            0x01          /**< format version */
+#define HDC1080_SERIES_HEADER_SIZE        22            /**< block header size */
+#define HDC1080_SERIES_MAX_SAMPLE_SIZE    12            /**< worst case encoded sample size */
+#define HDC1080_SERIES_MIN_BLOCK_SIZE     64            /**< min block buffer size */
+
+/**
+ * @brief hdc1080 series sample structure definition
+ */
+typedef struct hdc1080_series_sample_s
+{
+    uint32_t timestamp_ms;           /**< timestamp in ms */
+    uint16_t temperature_raw;        /**< raw temperature */
+    uint16_t humidity_raw;           /**< raw humidity */
+} hdc1080_series_sample_t;
+
+/**
+ * @brief hdc1080 series block header structure definition
+ */
+typedef struct hdc1080_series_header_s
+{
+    uint8_t id[6];                                               /**< sensor serial id */
+    hdc1080_temperature_resolution_t temperature_resolution;     /**< temperature resolution */
+    hdc1080_humidity_resolution_t humidity_resolution;           /**< humidity resolution */
+    uint16_t len;                                                /**< block length in bytes with header and crc */
+    uint16_t count;                                              /**< sample number */
+} hdc1080_series_header_t;
+
+/**
+ * @brief hdc1080 series encoder structure definition
+ */
+typedef struct hdc1080_series_encoder_s
+{
+    uint8_t *buf;                     /**< block buffer */
+    uint16_t size;                    /**< block buffer size */
+    uint16_t len;                     /**< used length */
+    uint16_t count;                   /**< sample number of the block */
+    uint8_t run;                      /**< pending run of unchanged samples */
+    uint8_t id[6];                    /**< sensor serial id */
+    uint8_t resolution;               /**< packed resolution */
+    uint8_t temperature_shift;        /**< zero bits below the temperature resolution */
+    uint8_t humidity_shift;           /**< zero bits below the humidity resolution */
+    uint32_t last_ms;                 /**< last timestamp */
+    int32_t last_delta;               /**< last timestamp delta */
+    uint16_t last_temperature;        /**< last shifted temperature */
+    uint16_t last_humidity;           /**< last shifted humidity */
+} hdc1080_series_encoder_t;
+
+/**
+ * @brief     initialize a series encoder
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *buf pointer to a block buffer
+ * @param[in] size block buffer size
+ * @param[in] *id pointer to a 6 bytes sensor serial id
+ * @param[in] temperature_resolution temperature resolution
+ * @param[in] humidity_resolution humidity resolution
+ * @return    status code
+ *            - 0 success
+ *            - 2 encoder, buf or id is NULL
+ *            - 4 size or resolution is invalid
+ * @note      HDC1080_SERIES_MIN_BLOCK_SIZE <= size <= 65535, the buffer is the whole ram the encoder needs,
+ *            a larger block spreads its header over more samples
+ */
+uint8_t hdc1080_series_encoder_init(hdc1080_series_encoder_t *encoder, uint8_t *buf, uint16_t size, const uint8_t *id,
+                                    hdc1080_temperature_resolution_t temperature_resolution,
+                                    hdc1080_humidity_resolution_t humidity_resolution);
+
+/**
+ * @brief      add a sample to the block
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[in]  temperature_raw raw temperature
+ * @param[in]  humidity_raw raw humidity
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means the block is still open
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ * @note       when block_len is not 0 the buffer holds a finished block with this sample as its last one,
+ *             store or send it before the next call, the bits below the resolution are dropped
+ */
+uint8_t hdc1080_series_encoder_add(hdc1080_series_encoder_t *encoder, uint32_t timestamp_ms, uint16_t temperature_raw,
+                                   uint16_t humidity_raw, uint16_t *block_len);
+
+/**
+ * @brief      finish the open block
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means there was no sample
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ * @note       the next sample starts a new block
+ */
+uint8_t hdc1080_series_encoder_flush(hdc1080_series_encoder_t *encoder, uint16_t *block_len);
+
+/**
+ * @brief      change the resolution of the next samples
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *block_len pointer to a finished block length buffer, 0 means no block was finished
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder or block_len is NULL
+ *             - 4 resolution is invalid
+ * @note       a block has one resolution, so a change finishes the open block
+ */
+uint8_t hdc1080_series_encoder_set_resolution(hdc1080_series_encoder_t *encoder,
+                                              hdc1080_temperature_resolution_t temperature_resolution,
+                                              hdc1080_humidity_resolution_t humidity_resolution, uint16_t *block_len);
+
+/**
+ * @brief      read a block header
+ * @param[in]  *buf pointer to a block buffer
+ * @param[in]  len available length
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 header is invalid or the block is longer than len
+ *             - 2 buf or header is NULL
+ * @note       it does not check the crc, use it to find the block length in a stream
+ */
+uint8_t hdc1080_series_read_header(const uint8_t *buf, uint32_t len, hdc1080_series_header_t *header);
+
+/**
+ * @brief      decode a block
+ * @param[in]  *buf pointer to a block buffer
+ * @param[in]  len available length
+ * @param[out] *header pointer to a header structure
+ * @param[out] *samples pointer to a sample buffer
+ * @param[in]  max sample buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 buf, header or samples is NULL
+ *             - 4 crc check failed
+ *             - 5 sample buffer is too small
+ * @note       header->count samples are written
+ */
+uint8_t hdc1080_series_decode(const uint8_t *buf, uint32_t len, hdc1080_series_header_t *header,
+                              hdc1080_series_sample_t *samples, uint16_t max);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
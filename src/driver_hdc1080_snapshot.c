@@ -0,0 +1,438 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_snapshot.c
+ * @brief     driver hdc1080 snapshot source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_snapshot.h"
+#include "driver_hdc1080_frame.h"
+#include <string.h>
+
+/**
+ * @brief snapshot configuration definition
+ */
+#define HDC1080_SNAPSHOT_REG_CONFIG         0x02          /**< configuration register */
+#define HDC1080_SNAPSHOT_CHANNEL_SIZE       18            /**< packed filter channel size */
+
+/**
+ * @brief     write a little endian uint16
+ * @param[in] *buf pointer to a buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_hdc1080_snapshot_put_u16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)(v >> 0);        /* low byte */
+    buf[1] = (uint8_t)(v >> 8);        /* high byte */
+}
+
+/**
+ * @brief     read a little endian uint16
+ * @param[in] *buf pointer to a buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_hdc1080_snapshot_get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | ((uint16_t)buf[1] << 8));        /* little endian */
+}
+
+/**
+ * @brief     write a little endian uint32
+ * @param[in] *buf pointer to a buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_hdc1080_snapshot_put_u32(uint8_t *buf, uint32_t v)
+{
+    a_hdc1080_snapshot_put_u16(&buf[0], (uint16_t)(v >> 0));         /* low half */
+    a_hdc1080_snapshot_put_u16(&buf[2], (uint16_t)(v >> 16));        /* high half */
+}
+
+/**
+ * @brief     read a little endian uint32
+ * @param[in] *buf pointer to a buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_hdc1080_snapshot_get_u32(const uint8_t *buf)
+{
+    return (uint32_t)a_hdc1080_snapshot_get_u16(&buf[0]) |
+           ((uint32_t)a_hdc1080_snapshot_get_u16(&buf[2]) << 16);        /* little endian */
+}
+
+/**
+ * @brief     pack a filter channel
+ * @param[in] *channel pointer to a filter channel structure
+ * @param[in] *buf pointer to a buffer
+ * @note      none
+ */
+static void a_hdc1080_snapshot_put_channel(const hdc1080_filter_channel_t *channel, uint8_t *buf)
+{
+    a_hdc1080_snapshot_put_u32(&buf[0], channel->x);         /* set the estimate */
+    a_hdc1080_snapshot_put_u32(&buf[4], channel->p);         /* set the error variance */
+    a_hdc1080_snapshot_put_u32(&buf[8], channel->q);         /* set the process noise */
+    a_hdc1080_snapshot_put_u32(&buf[12], channel->r);        /* set the measurement noise */
+    buf[16] = channel->shift;                                /* set the ema shift */
+    buf[17] = channel->started;                              /* set the started flag */
+}
+
+/**
+ * @brief     unpack a filter channel
+ * @param[in] *buf pointer to a buffer
+ * @param[in] *channel pointer to a filter channel structure
+ * @note      none
+ */
+static void a_hdc1080_snapshot_get_channel(const uint8_t *buf, hdc1080_filter_channel_t *channel)
+{
+    channel->x = a_hdc1080_snapshot_get_u32(&buf[0]);         /* get the estimate */
+    channel->p = a_hdc1080_snapshot_get_u32(&buf[4]);         /* get the error variance */
+    channel->q = a_hdc1080_snapshot_get_u32(&buf[8]);         /* get the process noise */
+    channel->r = a_hdc1080_snapshot_get_u32(&buf[12]);        /* get the measurement noise */
+    channel->shift = buf[16];                                 /* get the ema shift */
+    channel->started = buf[17];                               /* get the started flag */
+}
+
+/**
+ * @brief     add a calibration offset to a raw code
+ * @param[in] raw raw code
+ * @param[in] offset offset in raw code
+ * @return    calibrated raw code
+ * @note      it saturates at 0 and 0xFFFF
+ */
+static uint16_t a_hdc1080_snapshot_offset(uint16_t raw, int16_t offset)
+{
+    int32_t v;
+    
+    v = (int32_t)raw + offset;        /* add the offset */
+    if (v < 0)                        /* check the low limit */
+    {
+        v = 0;                        /* saturate */
+    }
+    if (v > 0xFFFF)                   /* check the high limit */
+    {
+        v = 0xFFFF;                   /* saturate */
+    }
+    
+    return (uint16_t)v;               /* return the code */
+}
+
+/**
+ * @brief      capture the state of a handle
+ * @param[in]  *handle pointer to an initialized hdc1080 handle
+ * @param[in]  *filter pointer to a filter structure, it may be NULL
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read the chip failed
+ *             - 2 handle or snapshot is NULL
+ *             - 3 handle is not initialized
+ * @note       it reads the config register and the serial id, the calibration offsets are left as they are
+ */
+uint8_t hdc1080_snapshot_capture(hdc1080_handle_t *handle, const hdc1080_filter_t *filter,
+                                 hdc1080_snapshot_t *snapshot)
+{
+    uint16_t config;
+    
+    if ((handle == NULL) || (snapshot == NULL))                                    /* check the pointers */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    if (hdc1080_get_reg(handle, HDC1080_SNAPSHOT_REG_CONFIG, &config) != 0)        /* read the config */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (hdc1080_get_serial_id(handle, snapshot->serial_id) != 0)                   /* read the serial id */
+    {
+        return 1;                                                                  /* return error */
+    }
+    snapshot->config = config & HDC1080_CONFIG_MASK;                               /* keep the settings */
+    snapshot->filter_valid = 0;                                                    /* no filter state */
+    if (filter != NULL)                                                            /* check the filter */
+    {
+        snapshot->filter = *filter;                                                /* copy the filter state */
+        snapshot->filter_valid = 1;                                                /* filter state is valid */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      pack a snapshot to the binary format
+ * @param[in]  *snapshot pointer to a snapshot structure
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 snapshot or buf is NULL
+ * @note       buf length must be HDC1080_SNAPSHOT_SIZE, all fields are little endian,
+ *             the crc-16 of hdc1080_frame_crc16 covers the bytes before it
+ */
+uint8_t hdc1080_snapshot_pack(const hdc1080_snapshot_t *snapshot, uint8_t buf[HDC1080_SNAPSHOT_SIZE])
+{
+    if ((snapshot == NULL) || (buf == NULL))                                                /* check the pointers */
+    {
+        return 2;                                                                           /* return error */
+    }
+    
+    memset(buf, 0, HDC1080_SNAPSHOT_SIZE);                                                  /* clear the buffer */
+    a_hdc1080_snapshot_put_u16(&buf[0], HDC1080_SNAPSHOT_MAGIC);                            /* set the magic */
+    buf[2] = HDC1080_SNAPSHOT_VERSION;                                                      /* set the version */
+    buf[3] = HDC1080_SNAPSHOT_SIZE;                                                         /* set the length */
+    a_hdc1080_snapshot_put_u16(&buf[4], snapshot->config);                                  /* set the config */
+    memcpy(&buf[6], snapshot->serial_id, 6);                                                /* set the serial id */
+    a_hdc1080_snapshot_put_u16(&buf[12], (uint16_t)snapshot->temperature_offset);           /* set the temperature offset */
+    a_hdc1080_snapshot_put_u16(&buf[14], (uint16_t)snapshot->humidity_offset);              /* set the humidity offset */
+    if (snapshot->filter_valid != 0)                                                        /* check the filter state */
+    {
+        buf[16] = snapshot->filter.type;                                                    /* set the filter type */
+        buf[17] = 1;                                                                        /* filter state is valid */
+        a_hdc1080_snapshot_put_channel(&snapshot->filter.temperature, &buf[18]);            /* set the temperature channel */
+        a_hdc1080_snapshot_put_channel(&snapshot->filter.humidity,
+                                       &buf[18 + HDC1080_SNAPSHOT_CHANNEL_SIZE]);           /* set the humidity channel */
+    }
+    a_hdc1080_snapshot_put_u16(&buf[HDC1080_SNAPSHOT_SIZE - 2],
+                               hdc1080_frame_crc16(buf, HDC1080_SNAPSHOT_SIZE - 2));        /* set the crc */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      unpack a snapshot from the binary format
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 snapshot is invalid
+ *             - 2 buf or snapshot is NULL
+ *             - 4 crc check failed
+ *             - 5 version is not supported
+ * @note       an erased flash page or a zeroed ram is an invalid snapshot
+ */
+uint8_t hdc1080_snapshot_unpack(const uint8_t *buf, uint16_t len, hdc1080_snapshot_t *snapshot)
+{
+    uint16_t config;
+    
+    if ((buf == NULL) || (snapshot == NULL))                                                 /* check the pointers */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if ((len < 4) || (a_hdc1080_snapshot_get_u16(&buf[0]) != HDC1080_SNAPSHOT_MAGIC))        /* check the magic */
+    {
+        return 1;                                                                            /* return error */
+    }
+    if (buf[2] != HDC1080_SNAPSHOT_VERSION)                                                  /* check the version */
+    {
+        return 5;                                                                            /* return error */
+    }
+    if ((buf[3] != HDC1080_SNAPSHOT_SIZE) || (len < HDC1080_SNAPSHOT_SIZE))                  /* check the length */
+    {
+        return 1;                                                                            /* return error */
+    }
+    if (hdc1080_frame_crc16(buf, HDC1080_SNAPSHOT_SIZE - 2) !=
+        a_hdc1080_snapshot_get_u16(&buf[HDC1080_SNAPSHOT_SIZE - 2]))                         /* check the crc */
+    {
+        return 4;                                                                            /* return error */
+    }
+    config = a_hdc1080_snapshot_get_u16(&buf[4]);                                            /* get the config */
+    if (((config & ~HDC1080_CONFIG_MASK) != 0) || ((config & 0x0300) == 0x0300))             /* check the settings */
+    {
+        return 1;                                                                            /* return error */
+    }
+    if ((buf[17] > 1) || (buf[16] > HDC1080_FILTER_TYPE_KALMAN))                             /* check the filter */
+    {
+        return 1;                                                                            /* return error */
+    }
+    
+    memset(snapshot, 0, sizeof(hdc1080_snapshot_t));                                         /* clear the snapshot */
+    snapshot->config = config;                                                               /* set the config */
+    memcpy(snapshot->serial_id, &buf[6], 6);                                                 /* get the serial id */
+    snapshot->temperature_offset = (int16_t)a_hdc1080_snapshot_get_u16(&buf[12]);            /* get the temperature offset */
+    snapshot->humidity_offset = (int16_t)a_hdc1080_snapshot_get_u16(&buf[14]);               /* get the humidity offset */
+    snapshot->filter_valid = buf[17];                                                        /* get the filter flag */
+    if (snapshot->filter_valid != 0)                                                         /* check the filter state */
+    {
+        snapshot->filter.type = buf[16];                                                     /* get the filter type */
+        a_hdc1080_snapshot_get_channel(&buf[18], &snapshot->filter.temperature);             /* get the temperature channel */
+        a_hdc1080_snapshot_get_channel(&buf[18 + HDC1080_SNAPSHOT_CHANNEL_SIZE],
+                                       &snapshot->filter.humidity);                          /* get the humidity channel */
+    }
+    
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     save a snapshot to the storage
+ * @param[in] *storage pointer to a storage structure
+ * @param[in] *snapshot pointer to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 storage save failed
+ *            - 2 storage, save or snapshot is NULL
+ * @note      none
+ */
+uint8_t hdc1080_snapshot_save(const hdc1080_snapshot_storage_t *storage, const hdc1080_snapshot_t *snapshot)
+{
+    uint8_t buf[HDC1080_SNAPSHOT_SIZE];
+    
+    if ((storage == NULL) || (storage->save == NULL) || (snapshot == NULL))        /* check the pointers */
+    {
+        return 2;                                                                  /* return error */
+    }
+    
+    (void)hdc1080_snapshot_pack(snapshot, buf);                                    /* pack the snapshot */
+    if (storage->save(buf, HDC1080_SNAPSHOT_SIZE) != 0)                            /* write the storage */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      load a snapshot from the storage
+ * @param[in]  *storage pointer to a storage structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 storage load failed or snapshot is invalid
+ *             - 2 storage, load or snapshot is NULL
+ *             - 4 crc check failed
+ *             - 5 version is not supported
+ * @note       fall back to the full init and configuration on an error
+ */
+uint8_t hdc1080_snapshot_load(const hdc1080_snapshot_storage_t *storage, hdc1080_snapshot_t *snapshot)
+{
+    uint8_t buf[HDC1080_SNAPSHOT_SIZE];
+    
+    if ((storage == NULL) || (storage->load == NULL) || (snapshot == NULL))        /* check the pointers */
+    {
+        return 2;                                                                  /* return error */
+    }
+    
+    if (storage->load(buf, HDC1080_SNAPSHOT_SIZE) != 0)                            /* read the storage */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    return hdc1080_snapshot_unpack(buf, HDC1080_SNAPSHOT_SIZE, snapshot);          /* unpack the snapshot */
+}
+
+/**
+ * @brief      initialize a handle from a snapshot
+ * @param[in]  *handle pointer to a linked hdc1080 handle
+ * @param[in]  *snapshot pointer to a loaded snapshot structure
+ * @param[out] *filter pointer to a filter structure, it may be NULL
+ * @param[out] *reset pointer to a bool value buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ *             - 2 handle or snapshot is NULL
+ *             - 4 read serial id failed
+ *             - 5 chip was replaced
+ * @note       it runs hdc1080_init_fast with the saved configuration and compares the serial id, so a chip that
+ *             kept it costs six reads, the serial id is compared even without a reset because a replaced chip
+ *             may run the saved configuration from its power on default, a replaced chip leaves the handle
+ *             initialized but the filter is not restored and the calibration must not be used
+ */
+uint8_t hdc1080_snapshot_restore(hdc1080_handle_t *handle, const hdc1080_snapshot_t *snapshot,
+                                 hdc1080_filter_t *filter, hdc1080_bool_t *reset)
+{
+    uint8_t id[6];
+    hdc1080_bool_t chip_reset;
+    hdc1080_bool_t heater;
+    hdc1080_mode_t mode;
+    hdc1080_temperature_resolution_t t_resolution;
+    hdc1080_humidity_resolution_t h_resolution;
+    
+    if ((handle == NULL) || (snapshot == NULL))                                                       /* check the pointers */
+    {
+        return 2;                                                                                     /* return error */
+    }
+    
+    mode = (hdc1080_mode_t)((snapshot->config >> 12) & 0x01);                                         /* get the mode */
+    heater = (hdc1080_bool_t)((snapshot->config >> 13) & 0x01);                                       /* get the heater */
+    t_resolution = (hdc1080_temperature_resolution_t)((snapshot->config >> 10) & 0x01);               /* get the temperature resolution */
+    h_resolution = (hdc1080_humidity_resolution_t)((snapshot->config >> 8) & 0x03);                   /* get the humidity resolution */
+    if (hdc1080_init_fast(handle, mode, heater, t_resolution, h_resolution, &chip_reset) != 0)        /* init with the saved config */
+    {
+        return 1;                                                                                     /* return error */
+    }
+    if (reset != NULL)                                                                                /* check the reset buffer */
+    {
+        *reset = chip_reset;                                                                          /* set the reset flag */
+    }
+    if (hdc1080_get_serial_id(handle, id) != 0)                                                       /* read the serial id */
+    {
+        return 4;                                                                                     /* return error */
+    }
+    if (memcmp(id, snapshot->serial_id, 6) != 0)                                                      /* check the chip */
+    {
+        return 5;                                                                                     /* another chip */
+    }
+    if ((filter != NULL) && (snapshot->filter_valid != 0))                                            /* check the filter */
+    {
+        *filter = snapshot->filter;                                                                   /* restore the filter state */
+    }
+    
+    return 0;                                                                                         /* success return 0 */
+}
+
+/**
+ * @brief         apply the calibration offsets
+ * @param[in]     *snapshot pointer to a snapshot structure
+ * @param[in,out] *temperature_raw pointer to a raw temperature buffer
+ * @param[in,out] *humidity_raw pointer to a raw humidity buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 snapshot, temperature_raw or humidity_raw is NULL
+ * @note          the offsets are added with saturation
+ */
+uint8_t hdc1080_snapshot_calibrate(const hdc1080_snapshot_t *snapshot, uint16_t *temperature_raw,
+                                   uint16_t *humidity_raw)
+{
+    if ((snapshot == NULL) || (temperature_raw == NULL) || (humidity_raw == NULL))                       /* check the pointers */
+    {
+        return 2;                                                                                        /* return error */
+    }
+    
+    *temperature_raw = a_hdc1080_snapshot_offset(*temperature_raw, snapshot->temperature_offset);        /* calibrate */
+    *humidity_raw = a_hdc1080_snapshot_offset(*humidity_raw, snapshot->humidity_offset);                 /* calibrate */
+    
+    return 0;                                                                                            /* success return 0 */
+}
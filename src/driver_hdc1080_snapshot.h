@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_snapshot.h
+ * @brief     driver hdc1080 snapshot header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_SNAPSHOT_H
+#define DRIVER_HDC1080_SNAPSHOT_H
+
+#include "driver_hdc1080.h"
+#include "driver_hdc1080_filter.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_snapshot_driver hdc1080 snapshot driver function
+ * @brief    hdc1080 snapshot driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 snapshot format definition
+ */
+#define HDC1080_SNAPSHOT_MAGIC          0x5348        /**< "HS" */
+#define HDC1080_SNAPSHOT_VERSION        0x01          /**< format version */
+#define HDC1080_SNAPSHOT_SIZE           56            /**< packed snapshot size in bytes with the crc */
+
+/**
+ * @brief hdc1080 snapshot structure definition
+ */
+typedef struct hdc1080_snapshot_s
+{
+    uint16_t config;                  /**< heater, mode and resolution bits of the config register */
+    uint8_t serial_id[6];             /**< serial id of the chip */
+    int16_t temperature_offset;       /**< temperature calibration offset in raw code */
+    int16_t humidity_offset;          /**< humidity calibration offset in raw code */
+    uint8_t filter_valid;             /**< 1 if filter holds a state */
+    hdc1080_filter_t filter;          /**< smoothing filter state */
+} hdc1080_snapshot_t;
+
+/**
+ * @brief hdc1080 snapshot storage structure definition
+ */
+typedef struct hdc1080_snapshot_storage_s
+{
+    uint8_t (*load)(uint8_t *buf, uint16_t len);              /**< point to a storage read function address */
+    uint8_t (*save)(const uint8_t *buf, uint16_t len);        /**< point to a storage write function address */
+} hdc1080_snapshot_storage_t;
+
+/**
+ * @brief      capture the state of a handle
+ * @param[in]  *handle pointer to an initialized hdc1080 handle
+ * @param[in]  *filter pointer to a filter structure, it may be NULL
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read the chip failed
+ *             - 2 handle or snapshot is NULL
+ *             - 3 handle is not initialized
+ * @note       it reads the config register and the serial id, the calibration offsets are left as they are
+ */
+uint8_t hdc1080_snapshot_capture(hdc1080_handle_t *handle, const hdc1080_filter_t *filter,
+                                 hdc1080_snapshot_t *snapshot);
+
+/**
+ * @brief      pack a snapshot to the binary format
+ * @param[in]  *snapshot pointer to a snapshot structure
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 snapshot or buf is NULL
+ * @note       buf length must be HDC1080_SNAPSHOT_SIZE, all fields are little endian,
+ *             the crc-16 of hdc1080_frame_crc16 covers the bytes before it
+ */
+uint8_t hdc1080_snapshot_pack(const hdc1080_snapshot_t *snapshot, uint8_t buf[HDC1080_SNAPSHOT_SIZE]);
+
+/**
+ * @brief      unpack a snapshot from the binary format
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 snapshot is invalid
+ *             - 2 buf or snapshot is NULL
+ *             - 4 crc check failed
+ *             - 5 version is not supported
+ * @note       an erased flash page or a zeroed ram is an invalid snapshot
+ */
+uint8_t hdc1080_snapshot_unpack(const uint8_t *buf, uint16_t len, hdc1080_snapshot_t *snapshot);
+
+/**
+ * @brief     save a snapshot to the storage
+ * @param[in] *storage pointer to a storage structure
+ * @param[in] *snapshot pointer to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 storage save failed
+ *            - 2 storage, save or snapshot is NULL
+ * @note      none
+ */
+uint8_t hdc1080_snapshot_save(const hdc1080_snapshot_storage_t *storage, const hdc1080_snapshot_t *snapshot);
+
+/**
+ * @brief      load a snapshot from the storage
+ * @param[in]  *storage pointer to a storage structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 storage load failed or snapshot is invalid
+ *             - 2 storage, load or snapshot is NULL
+ *             - 4 crc check failed
+ *             - 5 version is not supported
+ * @note       fall back to the full init and configuration on an error
+ */
+uint8_t hdc1080_snapshot_load(const hdc1080_snapshot_storage_t *storage, hdc1080_snapshot_t *snapshot);
+
+/**
+ * @brief      initialize a handle from a snapshot
+ * @param[in]  *handle pointer to a linked hdc1080 handle
+ * @param[in]  *snapshot pointer to a loaded snapshot structure
+ * @param[out] *filter pointer to a filter structure, it may be NULL
+ * @param[out] *reset pointer to a bool value buffer, it may be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ *             - 2 handle or snapshot is NULL
+ *             - 4 read serial id failed
+ *             - 5 chip was replaced
+ * @note       it runs hdc1080_init_fast with the saved configuration and compares the serial id, so a chip that
+ *             kept it costs six reads, the serial id is compared even without a reset because a replaced chip
+ *             may run the saved configuration from its power on default, a replaced chip leaves the handle
+ *             initialized but the filter is not restored and the calibration must not be used
+ */
+uint8_t hdc1080_snapshot_restore(hdc1080_handle_t *handle, const hdc1080_snapshot_t *snapshot,
+                                 hdc1080_filter_t *filter, hdc1080_bool_t *reset);
+
+/**
+ * @brief         apply the calibration offsets
+ * @param[in]     *snapshot pointer to a snapshot structure
+ * @param[in,out] *temperature_raw pointer to a raw temperature buffer
+ * @param[in,out] *humidity_raw pointer to a raw humidity buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 snapshot, temperature_raw or humidity_raw is NULL
+ * @note          the offsets are added with saturation
+ */
+uint8_t hdc1080_snapshot_calibrate(const hdc1080_snapshot_t *snapshot, uint16_t *temperature_raw,
+                                   uint16_t *humidity_raw);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
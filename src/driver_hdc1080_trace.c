@@ -0,0 +1,778 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_trace.c
+ * @brief     driver hdc1080 trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_trace.h"
+
+/**
+ * @brief trace event flag definition
+ */
+#define HDC1080_TRACE_STATUS_FAILED        0x80        /**< the hook returned an error */
+#define HDC1080_TRACE_MAX_EVENT_HEAD       16          /**< max event size without the data */
+
+static hdc1080_trace_handle_t *gs_hdc1080_trace = NULL;        /**< attached trace, the hooks carry no context */
+
+/**
+ * @brief     put a varint
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @return    length
+ * @note      none
+ */
+static uint8_t a_hdc1080_trace_put_varint(uint8_t *buf, uint32_t v)
+{
+    uint8_t n = 0;
+    
+    while (v >= 0x80)                          /* more than 7 bits */
+    {
+        buf[n++] = (uint8_t)(v | 0x80);        /* low 7 bits and the flag */
+        v >>= 7;                               /* next 7 bits */
+    }
+    buf[n++] = (uint8_t)v;                     /* last byte */
+    
+    return n;                                  /* return the length */
+}
+
+/**
+ * @brief         get a varint
+ * @param[in]     *buf pointer to a data buffer
+ * @param[in,out] *pos pointer to a position
+ * @param[in]     end buffer end
+ * @param[out]    *v pointer to a value buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 varint is invalid
+ * @note          none
+ */
+static uint8_t a_hdc1080_trace_get_varint(const uint8_t *buf, uint32_t *pos, uint32_t end, uint32_t *v)
+{
+    uint8_t shift = 0;
+    uint8_t b;
+    
+    *v = 0;                                         /* init 0 */
+    do
+    {
+        if ((*pos >= end) || (shift > 28))          /* check the range */
+        {
+            return 1;                               /* return error */
+        }
+        b = buf[(*pos)++];                          /* get one byte */
+        *v |= (uint32_t)(b & 0x7F) << shift;        /* add 7 bits */
+        shift += 7;                                 /* next 7 bits */
+    } while ((b & 0x80) != 0);                      /* until the last byte */
+    
+    return 0;                                       /* success return 0 */
+}
+
+/**
+ * @brief     append an event to the record
+ * @param[in] type event type
+ * @param[in] status returned status
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] delay delay time in ms
+ * @note      the record stops at the first event that does not fit, so a trace never has a gap
+ */
+static void a_hdc1080_trace_put(uint8_t type, uint8_t status, uint8_t addr, uint8_t reg,
+                                const uint8_t *data, uint16_t len, uint32_t delay)
+{
+    hdc1080_trace_handle_t *trace = gs_hdc1080_trace;
+    uint8_t *p;
+    uint32_t now;
+    uint32_t dt;
+    
+    if ((trace == NULL) || (trace->mode != HDC1080_TRACE_MODE_RECORD))                                          /* check the record */
+    {
+        return;                                                                                                 /* return */
+    }
+    if ((trace->lost != 0) || (trace->size - trace->len < (uint32_t)HDC1080_TRACE_MAX_EVENT_HEAD + len))        /* full or already lost */
+    {
+        trace->lost++;                                                                                          /* count the lost event */
+        
+        return;                                                                                                 /* return */
+    }
+    
+    dt = 0;                                                                                                     /* no time by default */
+    if (trace->get_tick_ms != NULL)                                                                             /* check the tick */
+    {
+        now = trace->get_tick_ms();                                                                             /* get the tick */
+        dt = now - trace->last_ms;                                                                              /* time since the last event */
+        trace->last_ms = now;                                                                                   /* save the tick */
+    }
+    p = &trace->buf[trace->len];                                                                                /* set the pointer */
+    p[0] = (uint8_t)(type | ((status != 0) ? HDC1080_TRACE_STATUS_FAILED : 0));                                 /* set the type and the status */
+    trace->len += 1;                                                                                            /* type byte */
+    trace->len += a_hdc1080_trace_put_varint(&trace->buf[trace->len], dt);                                      /* set the time */
+    if (type == HDC1080_TRACE_EVENT_DELAY)                                                                      /* delay */
+    {
+        trace->len += a_hdc1080_trace_put_varint(&trace->buf[trace->len], delay);                               /* set the delay */
+        trace->trace_delay_ms += delay;                                                                         /* count the delay */
+    }
+    else if ((type != HDC1080_TRACE_EVENT_IIC_INIT) && (type != HDC1080_TRACE_EVENT_IIC_DEINIT))                /* bus transfer */
+    {
+        trace->buf[trace->len++] = addr;                                                                        /* set the iic address */
+        if (type != HDC1080_TRACE_EVENT_IIC_READ_CMD)                                                           /* read_cmd has no register */
+        {
+            trace->buf[trace->len++] = reg;                                                                     /* set the register */
+        }
+        trace->len += a_hdc1080_trace_put_varint(&trace->buf[trace->len], len);                                 /* set the length */
+        if (len != 0)                                                                                           /* check the length */
+        {
+            memcpy(&trace->buf[trace->len], data, len);                                                         /* copy the data */
+            trace->len += len;                                                                                  /* add the data */
+        }
+    }
+    else
+    {
+        /* no payload */
+    }
+    trace->elapsed_ms += dt;                                                                                    /* add the time */
+    trace->events++;                                                                                            /* count the event */
+}
+
+/**
+ * @brief  record iic_init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_trace_record_iic_init(void)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_init();                                              /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_INIT, res, 0, 0, NULL, 0, 0);        /* record the call */
+    
+    return res;                                                                      /* return the status */
+}
+
+/**
+ * @brief  record iic_deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_trace_record_iic_deinit(void)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_deinit();                                              /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_DEINIT, res, 0, 0, NULL, 0, 0);        /* record the call */
+    
+    return res;                                                                        /* return the status */
+}
+
+/**
+ * @brief      record iic_read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_record_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_read(addr, reg, buf, len);                                 /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_READ, res, addr, reg, buf, len, 0);        /* record the call and the read data */
+    
+    return res;                                                                            /* return the status */
+}
+
+/**
+ * @brief     record iic_write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      none
+ */
+static uint8_t a_hdc1080_trace_record_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_write(addr, reg, buf, len);                                 /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_WRITE, res, addr, reg, buf, len, 0);        /* record the call and the written data */
+    
+    return res;                                                                             /* return the status */
+}
+
+/**
+ * @brief      record iic_read_cmd
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_record_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_read_cmd(addr, buf, len);                                    /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_READ_CMD, res, addr, 0, buf, len, 0);        /* record the call and the read data */
+    
+    return res;                                                                              /* return the status */
+}
+
+/**
+ * @brief      record iic_read_with_wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_record_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_hdc1080_trace->iic_read_with_wait(addr, reg, buf, len);                                 /* run the hook */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_IIC_READ_WITH_WAIT, res, addr, reg, buf, len, 0);        /* record the call and the read data */
+    
+    return res;                                                                                      /* return the status */
+}
+
+/**
+ * @brief     record delay_ms
+ * @param[in] ms delay time
+ * @note      none
+ */
+static void a_hdc1080_trace_record_delay_ms(uint32_t ms)
+{
+    gs_hdc1080_trace->delay_ms(ms);                                              /* run the delay */
+    a_hdc1080_trace_put(HDC1080_TRACE_EVENT_DELAY, 0, 0, 0, NULL, 0, ms);        /* record the delay */
+}
+
+/**
+ * @brief     note a replay mismatch
+ * @param[in] pos trace offset of the event
+ * @return    1
+ * @note      none
+ */
+static uint8_t a_hdc1080_trace_mismatch(uint32_t pos)
+{
+    if (gs_hdc1080_trace->mismatch == 0)             /* first mismatch */
+    {
+        gs_hdc1080_trace->mismatch_pos = pos;        /* save the first position */
+    }
+    gs_hdc1080_trace->mismatch++;                    /* count the mismatch */
+    
+    return 1;                                        /* return error */
+}
+
+/**
+ * @brief      get the next bus event of the replay
+ * @param[in]  type expected event type
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 mismatch
+ * @note       the recorded delays before the event are skipped
+ */
+static uint8_t a_hdc1080_trace_next(uint8_t type, hdc1080_trace_event_t *event)
+{
+    hdc1080_trace_handle_t *trace = gs_hdc1080_trace;
+    uint32_t pos;
+    
+    while (1)                                                                               /* skip the delays */
+    {
+        pos = trace->len;                                                                   /* save the position */
+        if (hdc1080_trace_parse(trace->trace, trace->size, &trace->len, event) != 0)        /* end or invalid */
+        {
+            trace->len = pos;                                                               /* stay at the event */
+            
+            return a_hdc1080_trace_mismatch(pos);                                           /* mismatch */
+        }
+        trace->elapsed_ms += event->dt_ms;                                                  /* add the time */
+        if (event->type != HDC1080_TRACE_EVENT_DELAY)                                       /* not a delay */
+        {
+            break;                                                                          /* a bus event */
+        }
+        trace->trace_delay_ms += event->delay_ms;                                           /* count the recorded delay */
+        trace->events++;                                                                    /* count the event */
+    }
+    if (event->type != type)                                                                /* check the type */
+    {
+        return a_hdc1080_trace_mismatch(pos);                                               /* mismatch */
+    }
+    trace->events++;                                                                        /* count the event */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief  replay iic_init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_trace_replay_iic_init(void)
+{
+    hdc1080_trace_event_t event;
+    
+    if (a_hdc1080_trace_next(HDC1080_TRACE_EVENT_IIC_INIT, &event) != 0)        /* get the event */
+    {
+        return 1;                                                               /* return error */
+    }
+    
+    return event.status;                                                        /* return the recorded status */
+}
+
+/**
+ * @brief  replay iic_deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_trace_replay_iic_deinit(void)
+{
+    hdc1080_trace_event_t event;
+    
+    if (a_hdc1080_trace_next(HDC1080_TRACE_EVENT_IIC_DEINIT, &event) != 0)        /* get the event */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    return event.status;                                                          /* return the recorded status */
+}
+
+/**
+ * @brief      replay a bus read
+ * @param[in]  type event type
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_replay_read(uint8_t type, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint32_t pos;
+    hdc1080_trace_event_t event;
+    
+    pos = gs_hdc1080_trace->len;                                                 /* save the position */
+    if (a_hdc1080_trace_next(type, &event) != 0)                                 /* get the event */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((event.addr != addr) || (event.reg != reg) || (event.len != len))        /* check the call */
+    {
+        return a_hdc1080_trace_mismatch(pos);                                    /* mismatch */
+    }
+    if (len != 0)                                                                /* check the length */
+    {
+        memcpy(buf, event.data, len);                                            /* copy the recorded data */
+    }
+    
+    return event.status;                                                         /* return the recorded status */
+}
+
+/**
+ * @brief      replay iic_read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_replay_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_hdc1080_trace_replay_read(HDC1080_TRACE_EVENT_IIC_READ, addr, reg, buf, len);        /* replay the read */
+}
+
+/**
+ * @brief      replay iic_read_with_wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_replay_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return a_hdc1080_trace_replay_read(HDC1080_TRACE_EVENT_IIC_READ_WITH_WAIT, addr, reg, buf, len);        /* replay the read */
+}
+
+/**
+ * @brief      replay iic_read_cmd
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_trace_replay_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_hdc1080_trace_replay_read(HDC1080_TRACE_EVENT_IIC_READ_CMD, addr, 0, buf, len);        /* replay the read */
+}
+
+/**
+ * @brief     replay iic_write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      the written data must match the trace
+ */
+static uint8_t a_hdc1080_trace_replay_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint32_t pos;
+    hdc1080_trace_event_t event;
+    
+    pos = gs_hdc1080_trace->len;                                                 /* save the position */
+    if (a_hdc1080_trace_next(HDC1080_TRACE_EVENT_IIC_WRITE, &event) != 0)        /* get the event */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((event.addr != addr) || (event.reg != reg) || (event.len != len) ||
+        ((len != 0) && (memcmp(event.data, buf, len) != 0)))                     /* check the call */
+    {
+        return a_hdc1080_trace_mismatch(pos);                                    /* mismatch */
+    }
+    
+    return event.status;                                                         /* return the recorded status */
+}
+
+/**
+ * @brief     replay delay_ms
+ * @param[in] ms delay time
+ * @note      it never sleeps, a recorded delay right here is consumed
+ */
+static void a_hdc1080_trace_replay_delay_ms(uint32_t ms)
+{
+    hdc1080_trace_handle_t *trace = gs_hdc1080_trace;
+    uint32_t pos;
+    hdc1080_trace_event_t event;
+    
+    trace->replay_delay_ms += ms;                         /* count the delay */
+    pos = trace->len;                                     /* save the position */
+    if ((hdc1080_trace_parse(trace->trace, trace->size, &pos, &event) == 0) &&
+        (event.type == HDC1080_TRACE_EVENT_DELAY))        /* a recorded delay is next */
+    {
+        trace->len = pos;                                 /* stay at the event */
+        trace->elapsed_ms += event.dt_ms;                 /* add the time */
+        trace->trace_delay_ms += event.delay_ms;          /* count the recorded delay */
+        trace->events++;                                  /* count the event */
+    }
+}
+
+/**
+ * @brief     save and check the hooks of a handle
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      none
+ */
+static void a_hdc1080_trace_save(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle)
+{
+    trace->iic_init = handle->iic_init;                            /* save iic_init */
+    trace->iic_deinit = handle->iic_deinit;                        /* save iic_deinit */
+    trace->iic_read = handle->iic_read;                            /* save iic_read */
+    trace->iic_write = handle->iic_write;                          /* save iic_write */
+    trace->iic_read_cmd = handle->iic_read_cmd;                    /* save iic_read_cmd */
+    trace->iic_read_with_wait = handle->iic_read_with_wait;        /* save iic_read_with_wait */
+    trace->delay_ms = handle->delay_ms;                            /* save delay_ms */
+}
+
+/**
+ * @brief     start recording the bus of a handle
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to a linked hdc1080 handle structure
+ * @param[in] *buf pointer to a record buffer
+ * @param[in] size record buffer size
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function, NULL records no time
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace, handle or buf is NULL
+ *            - 4 size is too small or a bus hook is not linked
+ *            - 5 another trace is attached
+ * @note      call it after the link macros and before hdc1080_init, the bus and delay hooks of the handle
+ *            are wrapped, one trace can be attached at a time because the hooks carry no context
+ */
+uint8_t hdc1080_trace_record(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle, uint8_t *buf, uint32_t size,
+                             uint32_t (*get_tick_ms)(void))
+{
+    if ((trace == NULL) || (handle == NULL) || (buf == NULL))                      /* check the args */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if ((size < HDC1080_TRACE_HEADER_SIZE) || (handle->iic_init == NULL) || (handle->iic_deinit == NULL) ||
+        (handle->iic_read == NULL) || (handle->iic_write == NULL) || (handle->iic_read_cmd == NULL) ||
+        (handle->iic_read_with_wait == NULL) || (handle->delay_ms == NULL))        /* check the size and the hooks */
+    {
+        return 4;                                                                  /* return error */
+    }
+    if (gs_hdc1080_trace != NULL)                                                  /* check the attached trace */
+    {
+        return 5;                                                                  /* return error */
+    }
+    
+    memset(trace, 0, sizeof(hdc1080_trace_handle_t));                              /* clear the trace */
+    a_hdc1080_trace_save(trace, handle);                                           /* save the hooks */
+    trace->buf = buf;                                                              /* set the buffer */
+    trace->size = size;                                                            /* set the size */
+    trace->get_tick_ms = get_tick_ms;                                              /* set the tick */
+    if (get_tick_ms != NULL)                                                       /* check the tick */
+    {
+        trace->last_ms = get_tick_ms();                                            /* start tick */
+    }
+    buf[0] = (uint8_t)(HDC1080_TRACE_MAGIC >> 0);                                  /* set the magic */
+    buf[1] = (uint8_t)(HDC1080_TRACE_MAGIC >> 8);                                  /* set the magic */
+    buf[2] = HDC1080_TRACE_VERSION;                                                /* set the version */
+    buf[3] = 0;                                                                    /* reserved */
+    trace->len = HDC1080_TRACE_HEADER_SIZE;                                        /* after the header */
+    trace->mode = HDC1080_TRACE_MODE_RECORD;                                       /* set record */
+    gs_hdc1080_trace = trace;                                                      /* attach */
+    
+    handle->iic_init = a_hdc1080_trace_record_iic_init;                            /* record iic_init */
+    handle->iic_deinit = a_hdc1080_trace_record_iic_deinit;                        /* record iic_deinit */
+    handle->iic_read = a_hdc1080_trace_record_iic_read;                            /* record iic_read */
+    handle->iic_write = a_hdc1080_trace_record_iic_write;                          /* record iic_write */
+    handle->iic_read_cmd = a_hdc1080_trace_record_iic_read_cmd;                    /* record iic_read_cmd */
+    handle->iic_read_with_wait = a_hdc1080_trace_record_iic_read_with_wait;        /* record iic_read_with_wait */
+    handle->delay_ms = a_hdc1080_trace_record_delay_ms;                            /* record delay_ms */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     start replaying a trace as the bus of a handle
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @param[in] *buf pointer to a recorded trace
+ * @param[in] len trace length
+ * @return    status code
+ *            - 0 success
+ *            - 1 trace header is invalid
+ *            - 2 trace, handle or buf is NULL
+ *            - 5 another trace is attached
+ * @note      the bus and delay hooks of the handle are replaced, a bus call returns the recorded status and data,
+ *            a call that differs from the trace or runs past its end is a mismatch and fails,
+ *            the delays only count and never sleep, so a replay is deterministic and runs at host speed
+ */
+uint8_t hdc1080_trace_replay(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle, const uint8_t *buf, uint32_t len)
+{
+    if ((trace == NULL) || (handle == NULL) || (buf == NULL))                                        /* check the args */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if ((len < HDC1080_TRACE_HEADER_SIZE) || (buf[0] != (uint8_t)(HDC1080_TRACE_MAGIC >> 0)) ||
+        (buf[1] != (uint8_t)(HDC1080_TRACE_MAGIC >> 8)) || (buf[2] != HDC1080_TRACE_VERSION))        /* check the header */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if (gs_hdc1080_trace != NULL)                                                                    /* check the attached trace */
+    {
+        return 5;                                                                                    /* return error */
+    }
+    
+    memset(trace, 0, sizeof(hdc1080_trace_handle_t));                                                /* clear the trace */
+    a_hdc1080_trace_save(trace, handle);                                                             /* save the hooks */
+    trace->trace = buf;                                                                              /* set the trace */
+    trace->size = len;                                                                               /* set the trace length */
+    trace->len = HDC1080_TRACE_HEADER_SIZE;                                                          /* after the header */
+    trace->mode = HDC1080_TRACE_MODE_REPLAY;                                                         /* set replay */
+    gs_hdc1080_trace = trace;                                                                        /* attach */
+    
+    handle->iic_init = a_hdc1080_trace_replay_iic_init;                                              /* replay iic_init */
+    handle->iic_deinit = a_hdc1080_trace_replay_iic_deinit;                                          /* replay iic_deinit */
+    handle->iic_read = a_hdc1080_trace_replay_iic_read;                                              /* replay iic_read */
+    handle->iic_write = a_hdc1080_trace_replay_iic_write;                                            /* replay iic_write */
+    handle->iic_read_cmd = a_hdc1080_trace_replay_iic_read_cmd;                                      /* replay iic_read_cmd */
+    handle->iic_read_with_wait = a_hdc1080_trace_replay_iic_read_with_wait;                          /* replay iic_read_with_wait */
+    handle->delay_ms = a_hdc1080_trace_replay_delay_ms;                                              /* replay delay_ms */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     stop a record or a replay
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace or handle is NULL
+ *            - 4 trace is not attached
+ * @note      a recorded handle gets its own hooks back
+ */
+uint8_t hdc1080_trace_detach(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle)
+{
+    if ((trace == NULL) || (handle == NULL))                                            /* check the args */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if ((gs_hdc1080_trace != trace) || (trace->mode == HDC1080_TRACE_MODE_NONE))        /* check the trace */
+    {
+        return 4;                                                                       /* return error */
+    }
+    
+    handle->iic_init = trace->iic_init;                                                 /* restore iic_init */
+    handle->iic_deinit = trace->iic_deinit;                                             /* restore iic_deinit */
+    handle->iic_read = trace->iic_read;                                                 /* restore iic_read */
+    handle->iic_write = trace->iic_write;                                               /* restore iic_write */
+    handle->iic_read_cmd = trace->iic_read_cmd;                                         /* restore iic_read_cmd */
+    handle->iic_read_with_wait = trace->iic_read_with_wait;                             /* restore iic_read_with_wait */
+    handle->delay_ms = trace->delay_ms;                                                 /* restore delay_ms */
+    trace->mode = HDC1080_TRACE_MODE_NONE;                                              /* set none */
+    gs_hdc1080_trace = NULL;                                                            /* detach */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     check if a replay has bus events left
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @return    1 if a bus event is left, else 0
+ * @note      the delays at the end do not count
+ */
+uint8_t hdc1080_trace_replay_pending(const hdc1080_trace_handle_t *trace)
+{
+    uint32_t pos;
+    hdc1080_trace_event_t event;
+    
+    if ((trace == NULL) || (trace->mode != HDC1080_TRACE_MODE_REPLAY))               /* check the replay */
+    {
+        return 0;                                                                    /* success return 0 */
+    }
+    
+    pos = trace->len;                                                                /* save the position */
+    while (hdc1080_trace_parse(trace->trace, trace->size, &pos, &event) == 0)        /* scan the rest */
+    {
+        if (event.type != HDC1080_TRACE_EVENT_DELAY)                                 /* not a delay */
+        {
+            return 1;                                                                /* return error */
+        }
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief         parse the next event of a trace
+ * @param[in]     *buf pointer to a trace
+ * @param[in]     len trace length
+ * @param[in,out] *pos pointer to a trace offset, 0 starts at the header
+ * @param[out]    *event pointer to an event structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 end of the trace
+ *                - 2 buf, pos or event is NULL
+ *                - 4 trace is invalid
+ * @note          none
+ */
+uint8_t hdc1080_trace_parse(const uint8_t *buf, uint32_t len, uint32_t *pos, hdc1080_trace_event_t *event)
+{
+    uint8_t b;
+    uint32_t p;
+    uint32_t v;
+    
+    if ((buf == NULL) || (pos == NULL) || (event == NULL))                                                            /* check the args */
+    {
+        return 2;                                                                                                     /* return error */
+    }
+    
+    p = *pos;                                                                                                         /* get the position */
+    if (p == 0)                                                                                                       /* start of the trace */
+    {
+        if ((len < HDC1080_TRACE_HEADER_SIZE) || (buf[0] != (uint8_t)(HDC1080_TRACE_MAGIC >> 0)) ||
+            (buf[1] != (uint8_t)(HDC1080_TRACE_MAGIC >> 8)) || (buf[2] != HDC1080_TRACE_VERSION))                     /* check the header */
+        {
+            return 4;                                                                                                 /* return error */
+        }
+        p = HDC1080_TRACE_HEADER_SIZE;                                                                                /* skip the header */
+    }
+    if (p >= len)                                                                                                     /* check the end */
+    {
+        *pos = p;                                                                                                     /* set the next position */
+        
+        return 1;                                                                                                     /* return error */
+    }
+    
+    memset(event, 0, sizeof(hdc1080_trace_event_t));                                                                  /* clear the event */
+    b = buf[p++];                                                                                                     /* get the type byte */
+    if ((b & 0x7F) > HDC1080_TRACE_EVENT_DELAY)                                                                       /* check the type */
+    {
+        return 4;                                                                                                     /* return error */
+    }
+    event->type = (hdc1080_trace_event_type_t)(b & 0x7F);                                                             /* get the type */
+    event->status = ((b & HDC1080_TRACE_STATUS_FAILED) != 0) ? 1 : 0;                                                 /* get the status */
+    if (a_hdc1080_trace_get_varint(buf, &p, len, &event->dt_ms) != 0)                                                 /* get the time */
+    {
+        return 4;                                                                                                     /* return error */
+    }
+    if (event->type == HDC1080_TRACE_EVENT_DELAY)                                                                     /* delay */
+    {
+        if (a_hdc1080_trace_get_varint(buf, &p, len, &event->delay_ms) != 0)                                          /* get the delay */
+        {
+            return 4;                                                                                                 /* return error */
+        }
+    }
+    else if ((event->type != HDC1080_TRACE_EVENT_IIC_INIT) && (event->type != HDC1080_TRACE_EVENT_IIC_DEINIT))        /* bus transfer */
+    {
+        if (p >= len)                                                                                                 /* check the end */
+        {
+            return 4;                                                                                                 /* return error */
+        }
+        event->addr = buf[p++];                                                                                       /* get the iic address */
+        if (event->type != HDC1080_TRACE_EVENT_IIC_READ_CMD)                                                          /* read_cmd has no register */
+        {
+            if (p >= len)                                                                                             /* check the end */
+            {
+                return 4;                                                                                             /* return error */
+            }
+            event->reg = buf[p++];                                                                                    /* get the register */
+        }
+        if ((a_hdc1080_trace_get_varint(buf, &p, len, &v) != 0) || (v > 0xFFFF) || (v > len - p))                     /* get the length and check the data */
+        {
+            return 4;                                                                                                 /* return error */
+        }
+        event->len = (uint16_t)v;                                                                                     /* set the length */
+        event->data = &buf[p];                                                                                        /* data inside the trace */
+        p += v;                                                                                                       /* skip the data */
+    }
+    else
+    {
+        /* no payload */
+    }
+    *pos = p;                                                                                                         /* set the next position */
+    
+    return 0;                                                                                                         /* success return 0 */
+}
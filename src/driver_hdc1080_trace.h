@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_trace.h
+ * @brief     driver hdc1080 trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_TRACE_H
+#define DRIVER_HDC1080_TRACE_H
+
+#include "driver_hdc1080.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_trace_driver hdc1080 trace driver function
+ * @brief    hdc1080 bus trace driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 trace format definition
+ */
+#define HDC1080_TRACE_MAGIC              0x5448        /**< "HT" in little endian */
+#define HDC1080_TRACE_VERSION            0x01          /**< format version */
+#define HDC1080_TRACE_HEADER_SIZE        4             /**< magic, version and a reserved byte */
+
+/**
+ * @brief hdc1080 trace event type enumeration definition
+ */
+typedef enum
+{
+    HDC1080_TRACE_EVENT_IIC_INIT           = 0x00,        /**< iic_init */
+    HDC1080_TRACE_EVENT_IIC_DEINIT         = 0x01,        /**< iic_deinit */
+    HDC1080_TRACE_EVENT_IIC_READ           = 0x02,        /**< iic_read */
+    HDC1080_TRACE_EVENT_IIC_WRITE          = 0x03,        /**< iic_write */
+    HDC1080_TRACE_EVENT_IIC_READ_CMD       = 0x04,        /**< iic_read_cmd */
+    HDC1080_TRACE_EVENT_IIC_READ_WITH_WAIT = 0x05,        /**< iic_read_with_wait */
+    HDC1080_TRACE_EVENT_DELAY              = 0x06,        /**< delay_ms */
+} hdc1080_trace_event_type_t;
+
+/**
+ * @brief hdc1080 trace mode enumeration definition
+ */
+typedef enum
+{
+    HDC1080_TRACE_MODE_NONE   = 0x00,        /**< detached */
+    HDC1080_TRACE_MODE_RECORD = 0x01,        /**< record the bus */
+    HDC1080_TRACE_MODE_REPLAY = 0x02,        /**< replay a trace as the bus */
+} hdc1080_trace_mode_t;
+
+/**
+ * @brief hdc1080 trace event structure definition
+ */
+typedef struct hdc1080_trace_event_s
+{
+    hdc1080_trace_event_type_t type;        /**< event type */
+    uint8_t status;                         /**< returned status */
+    uint32_t dt_ms;                         /**< time since the last event in ms */
+    uint8_t addr;                           /**< iic address */
+    uint8_t reg;                            /**< register address */
+    uint16_t len;                           /**< data length */
+    const uint8_t *data;                    /**< read or written data inside the trace */
+    uint32_t delay_ms;                      /**< delay time in ms */
+} hdc1080_trace_event_t;
+
+/**
+ * @brief hdc1080 trace handle structure definition
+ */
+typedef struct hdc1080_trace_handle_s
+{
+    uint8_t *buf;                                                                      /**< record buffer */
+    const uint8_t *trace;                                                              /**< replayed trace */
+    uint32_t size;                                                                     /**< buffer or trace size */
+    uint32_t len;                                                                      /**< recorded length or replay position */
+    uint32_t events;                                                                   /**< recorded or replayed events */
+    uint32_t lost;                                                                     /**< events that did not fit the buffer */
+    uint32_t mismatch;                                                                 /**< replayed calls that differ from the trace */
+    uint32_t mismatch_pos;                                                             /**< trace offset of the first mismatch */
+    uint32_t elapsed_ms;                                                               /**< recorded time */
+    uint32_t trace_delay_ms;                                                           /**< delays in the trace */
+    uint32_t replay_delay_ms;                                                          /**< delays asked by the replaying driver */
+    uint32_t last_ms;                                                                  /**< tick of the last event */
+    uint32_t (*get_tick_ms)(void);                                                     /**< point to a get_tick_ms function address */
+    uint8_t (*iic_init)(void);                                                         /**< wrapped iic_init */
+    uint8_t (*iic_deinit)(void);                                                       /**< wrapped iic_deinit */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< wrapped iic_read */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< wrapped iic_write */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                 /**< wrapped iic_read_cmd */
+    uint8_t (*iic_read_with_wait)(uint8_t addr, uint8_t reg,
+                                  uint8_t *buf, uint16_t len);                         /**< wrapped iic_read_with_wait */
+    void (*delay_ms)(uint32_t ms);                                                     /**< wrapped delay_ms */
+    uint8_t mode;                                                                      /**< trace mode */
+} hdc1080_trace_handle_t;
+
+/**
+ * @brief     start recording the bus of a handle
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to a linked hdc1080 handle structure
+ * @param[in] *buf pointer to a record buffer
+ * @param[in] size record buffer size
+ * @param[in] *get_tick_ms pointer to a get_tick_ms function, NULL records no time
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace, handle or buf is NULL
+ *            - 4 size is too small or a bus hook is not linked
+ *            - 5 another trace is attached
+ * @note      call it after the link macros and before hdc1080_init, the bus and delay hooks of the handle
+ *            are wrapped, one trace can be attached at a time because the hooks carry no context
+ */
+uint8_t hdc1080_trace_record(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle, uint8_t *buf, uint32_t size,
+                             uint32_t (*get_tick_ms)(void));
+
+/**
+ * @brief     start replaying a trace as the bus of a handle
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @param[in] *buf pointer to a recorded trace
+ * @param[in] len trace length
+ * @return    status code
+ *            - 0 success
+ *            - 1 trace header is invalid
+ *            - 2 trace, handle or buf is NULL
+ *            - 5 another trace is attached
+ * @note      the bus and delay hooks of the handle are replaced, a bus call returns the recorded status and data,
+ *            a call that differs from the trace or runs past its end is a mismatch and fails,
+ *            the delays only count and never sleep, so a replay is deterministic and runs at host speed
+ */
+uint8_t hdc1080_trace_replay(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     stop a record or a replay
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 trace or handle is NULL
+ *            - 4 trace is not attached
+ * @note      a recorded handle gets its own hooks back
+ */
+uint8_t hdc1080_trace_detach(hdc1080_trace_handle_t *trace, hdc1080_handle_t *handle);
+
+/**
+ * @brief     check if a replay has bus events left
+ * @param[in] *trace pointer to an hdc1080 trace handle structure
+ * @return    1 if a bus event is left, else 0
+ * @note      the delays at the end do not count
+ */
+uint8_t hdc1080_trace_replay_pending(const hdc1080_trace_handle_t *trace);
+
+/**
+ * @brief         parse the next event of a trace
+ * @param[in]     *buf pointer to a trace
+ * @param[in]     len trace length
+ * @param[in,out] *pos pointer to a trace offset, 0 starts at the header
+ * @param[out]    *event pointer to an event structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 end of the trace
+ *                - 2 buf, pos or event is NULL
+ *                - 4 trace is invalid
+ * @note          none
+ */
+uint8_t hdc1080_trace_parse(const uint8_t *buf, uint32_t len, uint32_t *pos, hdc1080_trace_event_t *event);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
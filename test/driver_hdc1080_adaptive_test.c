@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_adaptive_test.c
+ * @brief     driver hdc1080 adaptive test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_adaptive_test.h"
+#include <math.h>
+
+/**
+ * @brief adaptive test definition
+ */
+#define HDC1080_ADAPTIVE_TEST_SECONDS        14400        /**< trace length in s */
+#define HDC1080_ADAPTIVE_TEST_EVENT          3600         /**< window open time in s */
+#define HDC1080_ADAPTIVE_TEST_CLOSE          4200         /**< window close time in s */
+
+static hdc1080_adaptive_t gs_adaptive;        /**< adaptive structure */
+
+/**
+ * @brief      get the synthetic trace
+ * @param[in]  second trace time in s
+ * @param[out] *temperature pointer to a temperature buffer in raw code
+ * @param[out] *humidity pointer to a humidity buffer in raw code
+ * @note       a slow room drift, a window opens at 1h and closes 10 minutes later
+ */
+static void a_hdc1080_adaptive_test_trace(uint32_t second, float *temperature, float *humidity)
+{
+    float t;
+    float h;
+    float e;
+    
+    t = 22.0f + 0.5f * sinf((float)second * 6.2831853f / (float)HDC1080_ADAPTIVE_TEST_SECONDS);
+    h = 45.0f + 2.0f * sinf((float)second * 6.2831853f / (float)HDC1080_ADAPTIVE_TEST_SECONDS);
+    if (second >= HDC1080_ADAPTIVE_TEST_EVENT)
+    {
+        if (second < HDC1080_ADAPTIVE_TEST_CLOSE)
+        {
+            e = 1.0f - expf(-(float)(second - HDC1080_ADAPTIVE_TEST_EVENT) / 120.0f);
+        }
+        else
+        {
+            e = (1.0f - expf(-(float)(HDC1080_ADAPTIVE_TEST_CLOSE - HDC1080_ADAPTIVE_TEST_EVENT) / 120.0f)) *
+                expf(-(float)(second - HDC1080_ADAPTIVE_TEST_CLOSE) / 600.0f);
+        }
+        t -= 3.0f * e;
+        h += 8.0f * e;
+    }
+    *temperature = (t + 40.0f) * 65536.0f / 165.0f;
+    *humidity = h * 65536.0f / 100.0f;
+}
+
+/**
+ * @brief     quantize a raw code to a resolution
+ * @param[in] code raw code
+ * @param[in] step code step of the resolution
+ * @return    quantized raw code
+ * @note      the low bits are cut like the chip does
+ */
+static uint16_t a_hdc1080_adaptive_test_quantize(float code, uint32_t step)
+{
+    return (uint16_t)(((uint32_t)code) / step * step);
+}
+
+/**
+ * @brief  adaptive test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the period backoff, the ramp tracking and the resolution choice and replays a synthetic
+ *         four hour trace against a fixed 1s period, no sensor is needed
+ */
+uint8_t hdc1080_adaptive_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t ms;
+    uint32_t next_ms;
+    uint32_t inside;
+    uint32_t t_step;
+    uint32_t h_step;
+    uint16_t held_t;
+    uint16_t held_h;
+    float t;
+    float h;
+    float budget_t;
+    float budget_h;
+    hdc1080_adaptive_decision_t decision;
+    
+    /* start adaptive test */
+    hdc1080_interface_debug_print("hdc1080: start adaptive test.\n");
+    
+    /* check the params */
+    if ((hdc1080_adaptive_init(NULL, 1000, 60000, 0.2f, 1.0f, HDC1080_BOOL_TRUE) != 2) ||
+        (hdc1080_adaptive_init(&gs_adaptive, 0, 60000, 0.2f, 1.0f, HDC1080_BOOL_TRUE) != 4) ||
+        (hdc1080_adaptive_init(&gs_adaptive, 1000, 999, 0.2f, 1.0f, HDC1080_BOOL_TRUE) != 4) ||
+        (hdc1080_adaptive_init(&gs_adaptive, 1000, 60000, 0.0f, 1.0f, HDC1080_BOOL_TRUE) != 4) ||
+        (hdc1080_adaptive_update(&gs_adaptive, 0, 0, 0, NULL) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check params failed.\n");
+        
+        return 1;
+    }
+    
+    /* a stable signal doubles the period up to the max */
+    hdc1080_interface_debug_print("hdc1080: check the backoff.\n");
+    (void)hdc1080_adaptive_init(&gs_adaptive, 1000, 60000, 0.2f, 1.0f, HDC1080_BOOL_TRUE);
+    ms = 0;
+    for (i = 0; i < 8; i++)
+    {
+        (void)hdc1080_adaptive_update(&gs_adaptive, ms, 30000, 30000, &decision);
+        if (decision.period_ms != ((i < 6) ? (1000U << i) : 60000U))
+        {
+            hdc1080_interface_debug_print("hdc1080: sample %d period %dms is invalid.\n", i, decision.period_ms);
+            
+            return 1;
+        }
+        ms += decision.period_ms;
+    }
+    if ((decision.temperature_resolution != HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (decision.humidity_resolution != HDC1080_HUMIDITY_RESOLUTION_8_BIT))
+    {
+        hdc1080_interface_debug_print("hdc1080: a stable signal should use the coarse resolution.\n");
+        
+        return 1;
+    }
+    
+    /* a jump of 1000 codes in 60s shortens the period to 3/4 of the budget over the rate at once */
+    (void)hdc1080_adaptive_update(&gs_adaptive, ms, 31000, 30000, &decision);
+    if ((decision.period_ms < 3500) || (decision.period_ms > 3600) ||
+        (decision.temperature_resolution != HDC1080_TEMPERATURE_RESOLUTION_14_BIT))
+    {
+        hdc1080_interface_debug_print("hdc1080: jump period %dms is invalid.\n", decision.period_ms);
+        
+        return 1;
+    }
+    
+    /* a ramp of 1 code per second settles at 3/4 of the budget per sample */
+    hdc1080_interface_debug_print("hdc1080: check the ramp tracking.\n");
+    (void)hdc1080_adaptive_init(&gs_adaptive, 1000, 600000, 0.2f, 1.0f, HDC1080_BOOL_FALSE);
+    ms = 0;
+    for (i = 0; i < 64; i++)
+    {
+        (void)hdc1080_adaptive_update(&gs_adaptive, ms, (uint16_t)(20000 + ms / 1000), 30000, &decision);
+        ms += decision.period_ms;
+    }
+    if ((decision.period_ms < 59000) || (decision.period_ms > 60500) ||
+        (decision.temperature_resolution != HDC1080_TEMPERATURE_RESOLUTION_14_BIT) ||
+        (decision.humidity_resolution != HDC1080_HUMIDITY_RESOLUTION_14_BIT))
+    {
+        hdc1080_interface_debug_print("hdc1080: ramp period %dms is invalid.\n", decision.period_ms);
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: 1 code per second settles at %dms.\n", decision.period_ms);
+    
+    /* replay a synthetic trace */
+    hdc1080_interface_debug_print("hdc1080: replay a four hour trace.\n");
+    res = hdc1080_adaptive_init(&gs_adaptive, 1000, 60000, 0.2f, 1.0f, HDC1080_BOOL_TRUE);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    budget_t = 0.2f * 65536.0f / 165.0f;
+    budget_h = 1.0f * 65536.0f / 100.0f;
+    t_step = 4;
+    h_step = 4;
+    held_t = 0;
+    held_h = 0;
+    next_ms = 0;
+    inside = 0;
+    for (i = 0; i < HDC1080_ADAPTIVE_TEST_SECONDS; i++)
+    {
+        a_hdc1080_adaptive_test_trace(i, &t, &h);
+        if (i * 1000 >= next_ms)
+        {
+            held_t = a_hdc1080_adaptive_test_quantize(t, t_step);
+            held_h = a_hdc1080_adaptive_test_quantize(h, h_step);
+            (void)hdc1080_adaptive_update(&gs_adaptive, i * 1000, held_t, held_h, &decision);
+            next_ms = i * 1000 + decision.period_ms;
+            t_step = (decision.temperature_resolution == HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ? 32 : 4;
+            h_step = (decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_8_BIT) ? 256 :
+                     ((decision.humidity_resolution == HDC1080_HUMIDITY_RESOLUTION_11_BIT) ? 32 : 4);
+        }
+        if ((fabsf(t - (float)held_t) <= budget_t) && (fabsf(h - (float)held_h) <= budget_h))
+        {
+            inside++;
+        }
+    }
+    hdc1080_interface_debug_print("hdc1080: %d samples against %d at a fixed 1s period, %0.1f%% saved.\n",
+                                  gs_adaptive.samples, HDC1080_ADAPTIVE_TEST_SECONDS,
+                                  100.0f - (float)gs_adaptive.samples * 100.0f / (float)HDC1080_ADAPTIVE_TEST_SECONDS);
+    hdc1080_interface_debug_print("hdc1080: %0.2f%% of the time within 0.2C and 1%%.\n",
+                                  (float)inside * 100.0f / (float)HDC1080_ADAPTIVE_TEST_SECONDS);
+    if ((gs_adaptive.samples * 10 > HDC1080_ADAPTIVE_TEST_SECONDS) || (inside * 100 < HDC1080_ADAPTIVE_TEST_SECONDS * 99))
+    {
+        hdc1080_interface_debug_print("hdc1080: the trace replay is out of range.\n");
+        
+        return 1;
+    }
+    
+    /* finish adaptive test */
+    hdc1080_interface_debug_print("hdc1080: finish adaptive test.\n");
+    
+    return 0;
+}
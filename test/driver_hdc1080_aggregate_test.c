@@ -0,0 +1,343 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_aggregate_test.c
+ * @brief     driver hdc1080 aggregate test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_aggregate_test.h"
+#include <math.h>
+
+/**
+ * @brief aggregate test definition
+ */
+#define HDC1080_AGGREGATE_TEST_LEN          360           /**< sample number */
+#define HDC1080_AGGREGATE_TEST_PERIOD_MS    5000          /**< sample period */
+
+static uint32_t gs_timestamp[HDC1080_AGGREGATE_TEST_LEN];        /**< timestamp buffer */
+static float gs_temperature[HDC1080_AGGREGATE_TEST_LEN];         /**< temperature buffer */
+static float gs_humidity[HDC1080_AGGREGATE_TEST_LEN];            /**< humidity buffer */
+static uint32_t gs_seed;                                         /**< random seed */
+static hdc1080_aggregate_t gs_aggregate;                         /**< aggregate structure */
+
+/**
+ * @brief  get a pseudo random value
+ * @return value in [0, 1)
+ * @note   none
+ */
+static float a_hdc1080_aggregate_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+    
+    return (float)(gs_seed >> 8) / 16777216.0f;
+}
+
+/**
+ * @brief     check one channel against a two pass reference
+ * @param[in] *channel pointer to a channel summary structure
+ * @param[in] *value pointer to a value buffer
+ * @param[in] start_ms window start time in ms
+ * @param[in] end_ms window end time in ms
+ * @param[in] len sample number
+ * @param[out] *count pointer to a sample number buffer
+ * @return    1 if the summary matches, else 0
+ * @note      none
+ */
+static uint8_t a_hdc1080_aggregate_test_check(const hdc1080_aggregate_channel_t *channel, const float *value,
+                                              uint32_t start_ms, uint32_t end_ms, uint32_t len, uint32_t *count)
+{
+    uint32_t i;
+    uint32_t n = 0;
+    double sum = 0.0;
+    double sq = 0.0;
+    double mean;
+    double stddev;
+    float min = 0.0f;
+    float max = 0.0f;
+    
+    for (i = 0; i < len; i++)
+    {
+        if (((gs_timestamp[i] - start_ms) < (end_ms - start_ms)))
+        {
+            if ((n == 0) || (value[i] < min))
+            {
+                min = value[i];
+            }
+            if ((n == 0) || (value[i] > max))
+            {
+                max = value[i];
+            }
+            sum += value[i];
+            n++;
+        }
+    }
+    *count = n;
+    if (n == 0)
+    {
+        return 0;
+    }
+    mean = sum / n;
+    for (i = 0; i < len; i++)
+    {
+        if ((gs_timestamp[i] - start_ms) < (end_ms - start_ms))
+        {
+            sq += (value[i] - mean) * (value[i] - mean);
+        }
+    }
+    stddev = (n > 1) ? sqrt(sq / (n - 1)) : 0.0;
+    if ((channel->min != min) || (channel->max != max) ||
+        (fabs(channel->mean - mean) > 1e-3) || (fabs(channel->stddev - stddev) > 1e-3))
+    {
+        hdc1080_interface_debug_print("hdc1080: expect min %0.3f max %0.3f mean %0.4f stddev %0.4f.\n",
+                                      min, max, mean, stddev);
+        hdc1080_interface_debug_print("hdc1080: got min %0.3f max %0.3f mean %0.4f stddev %0.4f.\n",
+                                      channel->min, channel->max, channel->mean, channel->stddev);
+        
+        return 0;
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     check one summary against a two pass reference
+ * @param[in] *summary pointer to a summary structure
+ * @param[in] len sample number
+ * @return    1 if the summary matches, else 0
+ * @note      none
+ */
+static uint8_t a_hdc1080_aggregate_test_summary(const hdc1080_aggregate_summary_t *summary, uint32_t len)
+{
+    uint32_t count;
+    
+    if (a_hdc1080_aggregate_test_check(&summary->temperature, gs_temperature, summary->start_ms, 
+                                       summary->end_ms, len, &count) == 0)
+    {
+        return 0;
+    }
+    if (count != summary->count)
+    {
+        hdc1080_interface_debug_print("hdc1080: expect %d samples, got %d.\n", count, summary->count);
+        
+        return 0;
+    }
+    if (a_hdc1080_aggregate_test_check(&summary->humidity, gs_humidity, summary->start_ms, 
+                                       summary->end_ms, len, &count) == 0)
+    {
+        return 0;
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     run one window configuration
+ * @param[in] window_ms window length in ms
+ * @param[in] hop_ms window hop in ms
+ * @param[in] gap_start first sample index of a gap
+ * @param[in] gap_len sample number of the gap
+ * @param[in] offset value offset
+ * @param[out] *windows pointer to a window number buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the samples inside the gap are not added
+ */
+static uint8_t a_hdc1080_aggregate_test_run(uint32_t window_ms, uint32_t hop_ms, uint32_t gap_start, uint32_t gap_len,
+                                            float offset, uint32_t *windows)
+{
+    uint8_t res;
+    uint8_t ready;
+    uint32_t i;
+    uint32_t last_end = 0;
+    hdc1080_aggregate_summary_t summary;
+    
+    /* make the samples */
+    gs_seed = 1;
+    for (i = 0; i < HDC1080_AGGREGATE_TEST_LEN; i++)
+    {
+        gs_timestamp[i] = 0xFFFF0000U + i * HDC1080_AGGREGATE_TEST_PERIOD_MS + (i % 3);
+        gs_temperature[i] = offset + 20.0f + 10.0f * a_hdc1080_aggregate_test_random();
+        gs_humidity[i] = 40.0f + 30.0f * a_hdc1080_aggregate_test_random();
+        if ((i >= gap_start) && (i < gap_start + gap_len))
+        {
+            /* move the gap samples out of every window */
+            gs_timestamp[i] = 0xFFFF0000U - 1000000U;
+        }
+    }
+    
+    res = hdc1080_aggregate_init(&gs_aggregate, window_ms, hop_ms);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: aggregate init failed.\n");
+        
+        return 1;
+    }
+    *windows = 0;
+    for (i = 0; i < HDC1080_AGGREGATE_TEST_LEN; i++)
+    {
+        if ((i >= gap_start) && (i < gap_start + gap_len))
+        {
+            continue;
+        }
+        res = hdc1080_aggregate_add(&gs_aggregate, gs_timestamp[i], gs_temperature[i], gs_humidity[i], &summary, &ready);
+        if (res != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: aggregate add failed.\n");
+            
+            return 1;
+        }
+        if (ready != 0)
+        {
+            if ((summary.end_ms - summary.start_ms) != window_ms)
+            {
+                hdc1080_interface_debug_print("hdc1080: window length is invalid.\n");
+                
+                return 1;
+            }
+            if ((*windows != 0) && ((summary.end_ms - last_end) % hop_ms != 0))
+            {
+                hdc1080_interface_debug_print("hdc1080: window hop is invalid.\n");
+                
+                return 1;
+            }
+            if ((summary.seq != *windows) || (a_hdc1080_aggregate_test_summary(&summary, HDC1080_AGGREGATE_TEST_LEN) == 0))
+            {
+                hdc1080_interface_debug_print("hdc1080: window %d check failed.\n", *windows);
+                
+                return 1;
+            }
+            last_end = summary.end_ms;
+            (*windows)++;
+        }
+    }
+    
+    /* flush the open window */
+    res = hdc1080_aggregate_flush(&gs_aggregate, &summary, &ready);
+    if ((res != 0) || (ready == 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: aggregate flush failed.\n");
+        
+        return 1;
+    }
+    if (a_hdc1080_aggregate_test_summary(&summary, HDC1080_AGGREGATE_TEST_LEN) == 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: flush check failed.\n");
+        
+        return 1;
+    }
+    res = hdc1080_aggregate_flush(&gs_aggregate, &summary, &ready);
+    if ((res != 0) || (ready != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: second flush is not empty.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  aggregate test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks tumbling windows, sliding windows, gaps and flush against a two pass reference,
+ *         no sensor is needed
+ */
+uint8_t hdc1080_aggregate_test(void)
+{
+    uint8_t res;
+    uint32_t windows;
+    
+    /* start aggregate test */
+    hdc1080_interface_debug_print("hdc1080: start aggregate test.\n");
+    
+    /* check the params */
+    if ((hdc1080_aggregate_init(NULL, 60000, 60000) != 2) ||
+        (hdc1080_aggregate_init(&gs_aggregate, 60000, 0) != 4) ||
+        (hdc1080_aggregate_init(&gs_aggregate, 60000, 7000) != 4) ||
+        (hdc1080_aggregate_init(&gs_aggregate, 1000 * (HDC1080_AGGREGATE_MAX_PANES + 1), 1000) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check params failed.\n");
+        
+        return 1;
+    }
+    
+    /* tumbling window */
+    hdc1080_interface_debug_print("hdc1080: tumbling window 60000ms.\n");
+    res = a_hdc1080_aggregate_test_run(60000, 60000, HDC1080_AGGREGATE_TEST_LEN, 0, 0.0f, &windows);
+    if (res != 0)
+    {
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d windows ok.\n", windows);
+    
+    /* sliding window */
+    hdc1080_interface_debug_print("hdc1080: sliding window 60000ms hop 10000ms.\n");
+    res = a_hdc1080_aggregate_test_run(60000, 10000, HDC1080_AGGREGATE_TEST_LEN, 0, 0.0f, &windows);
+    if (res != 0)
+    {
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d windows ok.\n", windows);
+    
+    /* gap */
+    hdc1080_interface_debug_print("hdc1080: tumbling window 60000ms with a 200s gap.\n");
+    res = a_hdc1080_aggregate_test_run(60000, 60000, 100, 40, 0.0f, &windows);
+    if (res != 0)
+    {
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d windows ok.\n", windows);
+    hdc1080_interface_debug_print("hdc1080: sliding window 60000ms hop 20000ms with a 100s gap.\n");
+    res = a_hdc1080_aggregate_test_run(60000, 20000, 100, 20, 0.0f, &windows);
+    if (res != 0)
+    {
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d windows ok.\n", windows);
+    
+    /* large offset */
+    hdc1080_interface_debug_print("hdc1080: tumbling window 60000ms with a 1000 offset.\n");
+    res = a_hdc1080_aggregate_test_run(60000, 60000, HDC1080_AGGREGATE_TEST_LEN, 0, 1000.0f, &windows);
+    if (res != 0)
+    {
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d windows ok.\n", windows);
+    
+    /* finish aggregate test */
+    hdc1080_interface_debug_print("hdc1080: finish aggregate test.\n");
+    
+    return 0;
+}
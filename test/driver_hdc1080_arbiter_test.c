@@ -0,0 +1,310 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_arbiter_test.c
+ * @brief     driver hdc1080 arbiter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_arbiter_test.h"
+#include "driver_hdc1080_sim.h"
+
+/**
+ * @brief arbiter test definition
+ */
+#define HDC1080_ARBITER_TEST_TIMES            20          /**< read times */
+#define HDC1080_ARBITER_TEST_CONVERSION_US    7000        /**< simulated conversion time in us */
+#define HDC1080_ARBITER_TEST_TRANSFER_US      100         /**< simulated transaction time in us */
+
+static hdc1080_handle_t gs_handle;                  /**< hdc1080 handle */
+static hdc1080_sim_t gs_sim;                        /**< simulated chip */
+static hdc1080_arbiter_t gs_arbiter;                /**< arbiter of the simulated bus */
+static uint8_t gs_mutex;                            /**< simulated mutex */
+static uint8_t gs_check;                            /**< 1 checks the arbitration of every transaction */
+static uint32_t gs_unarbitrated;                    /**< transactions without the bus */
+static uint32_t gs_other;                           /**< second device transactions */
+static uint32_t gs_blocked;                         /**< second device transactions blocked by the hdc1080 */
+
+/**
+ * @brief  simulated non blocking mutex lock
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_arbiter_test_try_lock(void)
+{
+    if (gs_mutex != 0)
+    {
+        return 1;
+    }
+    gs_mutex = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief  simulated blocking mutex lock
+ * @return status code
+ * @note   there is no other thread to release it, so a busy mutex fails
+ */
+static uint8_t a_hdc1080_arbiter_test_lock(void)
+{
+    return a_hdc1080_arbiter_test_try_lock();
+}
+
+/**
+ * @brief simulated mutex unlock
+ * @note  none
+ */
+static void a_hdc1080_arbiter_test_unlock(void)
+{
+    gs_mutex = 0;
+}
+
+/**
+ * @brief  bus lock wrapper
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_arbiter_test_bus_lock(void)
+{
+    return hdc1080_arbiter_lock(&gs_arbiter);
+}
+
+/**
+ * @brief bus unlock wrapper
+ * @note  none
+ */
+static void a_hdc1080_arbiter_test_bus_unlock(void)
+{
+    (void)hdc1080_arbiter_unlock(&gs_arbiter);
+}
+
+/**
+ * @brief  simulated bus answer
+ * @return answering device
+ * @note   it checks the arbitration of every hdc1080 transaction
+ */
+static hdc1080_sim_answer_t a_hdc1080_arbiter_test_answer(void)
+{
+    if ((gs_check != 0) && (gs_arbiter.locked == 0))
+    {
+        gs_unarbitrated++;
+    }
+    
+    return HDC1080_SIM_ANSWER_CHIP;
+}
+
+/**
+ * @brief     simulated wait
+ * @param[in] ms delay time
+ * @note      the second device tries one transaction in every wait
+ */
+static void a_hdc1080_arbiter_test_delay(uint32_t ms)
+{
+    (void)ms;
+    if (hdc1080_arbiter_lock(&gs_arbiter) == 0)
+    {
+        gs_other++;
+        gs_sim.tick_us += gs_sim.transfer_us;
+        (void)hdc1080_arbiter_unlock(&gs_arbiter);
+    }
+    else
+    {
+        gs_blocked++;
+    }
+}
+
+/**
+ * @brief      read with one link setting
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_hdc1080_arbiter_test_run(hdc1080_arbiter_stats_t *stats)
+{
+    uint32_t i;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    if (hdc1080_init(&gs_handle) != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    (void)hdc1080_arbiter_clear_stats(&gs_arbiter);
+    gs_check = 1;
+    gs_unarbitrated = 0;
+    gs_sim.naks = 0;
+    gs_other = 0;
+    gs_blocked = 0;
+    for (i = 0; i < HDC1080_ARBITER_TEST_TIMES; i++)
+    {
+        if ((hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0) ||
+            (temperature_raw != 0x6000) || (humidity_raw != 0x6500))
+        {
+            hdc1080_interface_debug_print("hdc1080: read failed.\n");
+            gs_check = 0;
+            (void)hdc1080_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    gs_check = 0;
+    (void)hdc1080_arbiter_get_stats(&gs_arbiter, stats);
+    (void)hdc1080_deinit(&gs_handle);
+    hdc1080_interface_debug_print("hdc1080: %d acquisitions, hold max %dus avg %dus, %d naks, second device %d done %d blocked.\n",
+                                  stats->acquisitions, stats->hold_max_us,
+                                  (uint32_t)(stats->hold_total_us / stats->acquisitions), gs_sim.naks, gs_other, gs_blocked);
+    
+    return 0;
+}
+
+/**
+ * @brief  arbiter test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it shares a simulated bus with a second device and checks that every transaction is arbitrated,
+ *         that the bus is free during the conversion wait and that the fetch after it never naks, no sensor is needed
+ */
+uint8_t hdc1080_arbiter_test(void)
+{
+    uint16_t temperature_raw;
+    float temperature;
+    hdc1080_arbiter_stats_t stats;
+    
+    /* start arbiter test */
+    hdc1080_interface_debug_print("hdc1080: start arbiter test.\n");
+    
+    /* check the args */
+    gs_mutex = 0;
+    if ((hdc1080_arbiter_init(NULL, a_hdc1080_arbiter_test_try_lock, a_hdc1080_arbiter_test_lock,
+                              a_hdc1080_arbiter_test_unlock, hdc1080_sim_get_tick_us) != 2) ||
+        (hdc1080_arbiter_init(&gs_arbiter, a_hdc1080_arbiter_test_try_lock, a_hdc1080_arbiter_test_lock,
+                              a_hdc1080_arbiter_test_unlock, NULL) != 2) ||
+        (hdc1080_arbiter_init(&gs_arbiter, a_hdc1080_arbiter_test_try_lock, a_hdc1080_arbiter_test_lock,
+                              a_hdc1080_arbiter_test_unlock, hdc1080_sim_get_tick_us) != 0) ||
+        (hdc1080_arbiter_unlock(&gs_arbiter) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        
+        return 1;
+    }
+    
+    /* link the simulated bus */
+    hdc1080_sim_init(&gs_sim);
+    gs_sim.conversion_ms = HDC1080_ARBITER_TEST_CONVERSION_US / 1000;
+    gs_sim.transfer_us = HDC1080_ARBITER_TEST_TRANSFER_US;
+    gs_sim.busy_nak = 1;
+    gs_sim.answer = a_hdc1080_arbiter_test_answer;
+    gs_sim.delay = a_hdc1080_arbiter_test_delay;
+    hdc1080_sim_link(&gs_handle);
+    
+    /* the hooks must be linked in pairs */
+    hdc1080_interface_debug_print("hdc1080: check the hook pairs.\n");
+    DRIVER_HDC1080_LINK_BUS_LOCK(&gs_handle, a_hdc1080_arbiter_test_bus_lock);
+    if (hdc1080_init(&gs_handle) != 3)
+    {
+        hdc1080_interface_debug_print("hdc1080: check hook pairs failed.\n");
+        
+        return 1;
+    }
+    DRIVER_HDC1080_LINK_BUS_UNLOCK(&gs_handle, a_hdc1080_arbiter_test_bus_unlock);
+    
+    /* the bus is only held across the trigger and the fetch, one transaction each */
+    hdc1080_interface_debug_print("hdc1080: bus lock around the trigger and the fetch.\n");
+    if (a_hdc1080_arbiter_test_run(&stats) != 0)
+    {
+        return 1;
+    }
+    if ((gs_unarbitrated != 0) || (gs_blocked != 0) || (gs_other == 0) || (gs_sim.naks != 0) ||
+        (stats.hold_max_us > HDC1080_ARBITER_TEST_TRANSFER_US))
+    {
+        hdc1080_interface_debug_print("hdc1080: check bus lock failed.\n");
+        
+        return 1;
+    }
+    
+    /* a busy bus fails the read instead of breaking into the transaction */
+    hdc1080_interface_debug_print("hdc1080: check a busy bus.\n");
+    if ((hdc1080_init(&gs_handle) != 0) || (hdc1080_arbiter_lock(&gs_arbiter) != 0) ||
+        (hdc1080_read_temperature(&gs_handle, &temperature_raw, &temperature) != 1) ||
+        (hdc1080_arbiter_unlock(&gs_arbiter) != 0) ||
+        (hdc1080_read_temperature(&gs_handle, &temperature_raw, &temperature) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check busy bus failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* iic_read_cmd is only needed by the split transaction and the start and fetch api */
+    hdc1080_interface_debug_print("hdc1080: check the split transaction without iic_read_cmd.\n");
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, NULL);
+    if ((hdc1080_init(&gs_handle) != 0) ||
+        (hdc1080_read_temperature(&gs_handle, &temperature_raw, &temperature) != 1) ||
+        (hdc1080_start_temperature_humidity(&gs_handle) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check split transaction failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* holding the bus across whole calls blocks the second device in every wait */
+    hdc1080_interface_debug_print("hdc1080: handle lock around the whole call.\n");
+    hdc1080_sim_link(&gs_handle);
+    DRIVER_HDC1080_LINK_LOCK(&gs_handle, a_hdc1080_arbiter_test_bus_lock);
+    DRIVER_HDC1080_LINK_UNLOCK(&gs_handle, a_hdc1080_arbiter_test_bus_unlock);
+    if (a_hdc1080_arbiter_test_run(&stats) != 0)
+    {
+        return 1;
+    }
+    if ((gs_unarbitrated != 0) || (gs_other != 0) || (gs_blocked == 0) ||
+        (stats.hold_max_us < HDC1080_ARBITER_TEST_CONVERSION_US))
+    {
+        hdc1080_interface_debug_print("hdc1080: check handle lock failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish arbiter test */
+    hdc1080_interface_debug_print("hdc1080: finish arbiter test.\n");
+    
+    return 0;
+}
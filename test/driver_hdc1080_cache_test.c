@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cache_test.c
+ * @brief     driver hdc1080 cache test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_cache_test.h"
+#include "driver_hdc1080_sim.h"
+
+/**
+ * @brief cache test definition
+ */
+#define HDC1080_CACHE_TEST_CONSUMERS       4            /**< consumer number */
+#define HDC1080_CACHE_TEST_DURATION        60000        /**< simulated time in ms */
+
+static hdc1080_handle_t gs_handle;                                                             /**< hdc1080 handle */
+static hdc1080_cache_t gs_cache;                                                               /**< cache structure */
+static hdc1080_sim_t gs_sim;                                                                   /**< simulated chip */
+static uint8_t gs_locked;                                                                      /**< 1 if the cache lock is held */
+static uint8_t gs_lock_fail;                                                                   /**< 1 fails the next lock */
+static uint32_t gs_locks;                                                                      /**< cache locks */
+static const uint32_t gsc_period[HDC1080_CACHE_TEST_CONSUMERS] = {100, 150, 1000, 5000};        /**< consumer periods */
+static const uint32_t gsc_max_age[HDC1080_CACHE_TEST_CONSUMERS] = {50, 100, 500, 2000};        /**< consumer max ages */
+
+/**
+ * @brief simulated conversion
+ * @note  the temperature and the humidity drift on every conversion
+ */
+static void a_hdc1080_cache_test_convert(void)
+{
+    gs_sim.temperature += 4;
+    gs_sim.humidity -= 4;
+}
+
+/**
+ * @brief  simulated cache lock
+ * @return status code
+ * @note   a lock that is already held fails
+ */
+static uint8_t a_hdc1080_cache_test_lock(void)
+{
+    if ((gs_lock_fail != 0) || (gs_locked != 0))
+    {
+        gs_lock_fail = 0;
+        
+        return 1;
+    }
+    gs_locked = 1;
+    gs_locks++;
+    
+    return 0;
+}
+
+/**
+ * @brief simulated cache unlock
+ * @note  none
+ */
+static void a_hdc1080_cache_test_unlock(void)
+{
+    gs_locked = 0;
+}
+
+/**
+ * @brief  cache test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the hits, the joins, the max age and the lock on a simulated bus and runs four consumers with
+ *         different periods against one cache, no sensor is needed
+ */
+uint8_t hdc1080_cache_test(void)
+{
+    uint8_t res;
+    uint8_t pending[HDC1080_CACHE_TEST_CONSUMERS];
+    uint32_t i;
+    uint32_t now;
+    uint32_t ready;
+    uint32_t ready_ms[HDC1080_CACHE_TEST_CONSUMERS];
+    uint32_t next_ms[HDC1080_CACHE_TEST_CONSUMERS];
+    uint32_t served = 0;
+    uint32_t max_age = 0;
+    hdc1080_cache_sample_t sample;
+    hdc1080_cache_sample_t joined;
+    
+    /* start cache test */
+    hdc1080_interface_debug_print("hdc1080: start cache test.\n");
+    
+    /* link the simulated bus */
+    hdc1080_sim_init(&gs_sim);
+    hdc1080_sim_link(&gs_handle);
+    gs_sim.convert = a_hdc1080_cache_test_convert;
+    if ((hdc1080_init(&gs_handle) != 0) || (hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the args */
+    if ((hdc1080_cache_init(NULL, &gs_handle, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT) != 2) ||
+        (hdc1080_cache_init(&gs_cache, &gs_handle, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, (hdc1080_humidity_resolution_t)3) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_cache_init(&gs_cache, &gs_handle, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT);
+    hdc1080_interface_debug_print("hdc1080: conversion time is %dms.\n", gs_cache.wait_ms);
+    
+    /* two requests share one conversion */
+    hdc1080_interface_debug_print("hdc1080: check the join.\n");
+    gs_sim.triggers = 0;
+    gs_sim.fetches = 0;
+    now = 1000;
+    res = hdc1080_cache_request(&gs_cache, now, 1000, &sample, &ready);
+    if ((res != 4) || (gs_sim.triggers != 1) || (ready != now + gs_cache.wait_ms))
+    {
+        hdc1080_interface_debug_print("hdc1080: check first request failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc1080_cache_request(&gs_cache, now + 1, 0, &sample, &ready);
+    if ((res != 4) || (gs_sim.triggers != 1) || (gs_cache.joins != 1) || (ready != now + gs_cache.wait_ms))
+    {
+        hdc1080_interface_debug_print("hdc1080: check join failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((hdc1080_cache_poll(&gs_cache, ready - 1, &sample) != 4) || (gs_sim.fetches != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check early poll failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((hdc1080_cache_poll(&gs_cache, ready, &sample) != 0) || (hdc1080_cache_poll(&gs_cache, ready + 3, &joined) != 0) ||
+        (gs_sim.fetches != 1) || (sample.timestamp_ms != now) || (joined.temperature_raw != sample.temperature_raw))
+    {
+        hdc1080_interface_debug_print("hdc1080: check poll failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* hits are served without bus access */
+    hdc1080_interface_debug_print("hdc1080: check the max age.\n");
+    res = hdc1080_cache_request(&gs_cache, now + 1000, 1000, &sample, &ready);
+    if ((res != 0) || (gs_sim.triggers != 1) || (gs_sim.fetches != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check hit failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc1080_cache_request(&gs_cache, now + 1001, 1000, &sample, &ready);
+    if ((res != 4) || (gs_sim.triggers != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check expired sample failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a failed fetch drops the sample */
+    hdc1080_interface_debug_print("hdc1080: check a failed fetch.\n");
+    gs_sim.fetch_fail = 1;
+    if ((hdc1080_cache_poll(&gs_cache, ready, &sample) != 1) || (hdc1080_cache_poll(&gs_cache, ready, &sample) != 1) ||
+        (gs_cache.errors != 1) || (hdc1080_cache_request(&gs_cache, ready, 60000, &sample, &ready) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check failed fetch failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_cache_poll(&gs_cache, ready, &sample);
+    
+    /* request and poll run under the cache lock */
+    hdc1080_interface_debug_print("hdc1080: check the cache lock.\n");
+    gs_locked = 0;
+    gs_lock_fail = 0;
+    gs_locks = 0;
+    if ((hdc1080_cache_set_lock(&gs_cache, a_hdc1080_cache_test_lock, NULL) != 4) ||
+        (hdc1080_cache_set_lock(&gs_cache, a_hdc1080_cache_test_lock, a_hdc1080_cache_test_unlock) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check lock args failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    now = ready + 60000;
+    res = hdc1080_cache_request(&gs_cache, now, 0, &sample, &ready);
+    if ((res != 4) || (hdc1080_cache_poll(&gs_cache, ready, &sample) != 0) || (hdc1080_cache_invalidate(&gs_cache) != 0) ||
+        (gs_locks != 3) || (gs_locked != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check lock pairs failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    i = gs_sim.triggers;
+    gs_lock_fail = 1;
+    if ((hdc1080_cache_request(&gs_cache, ready, 0, &sample, &ready) != 1) || (gs_sim.triggers != i) || (gs_locked != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check failed lock failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d locks, all released.\n", gs_locks);
+    
+    /* four consumers with their own period and max age */
+    hdc1080_interface_debug_print("hdc1080: run %d consumers for %ds.\n", HDC1080_CACHE_TEST_CONSUMERS,
+                                  HDC1080_CACHE_TEST_DURATION / 1000);
+    (void)hdc1080_cache_init(&gs_cache, &gs_handle, HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT);
+    gs_sim.triggers = 0;
+    gs_sim.fetches = 0;
+    for (i = 0; i < HDC1080_CACHE_TEST_CONSUMERS; i++)
+    {
+        pending[i] = 0;
+        next_ms[i] = i * 5;
+    }
+    for (now = 0; now < HDC1080_CACHE_TEST_DURATION; now++)
+    {
+        for (i = 0; i < HDC1080_CACHE_TEST_CONSUMERS; i++)
+        {
+            if ((pending[i] == 0) && (now >= next_ms[i]))
+            {
+                next_ms[i] += gsc_period[i];
+                res = hdc1080_cache_request(&gs_cache, now, gsc_max_age[i], &sample, &ready_ms[i]);
+                if (res == 4)
+                {
+                    pending[i] = 1;
+                    
+                    continue;
+                }
+            }
+            else if ((pending[i] != 0) && (now >= ready_ms[i]))
+            {
+                pending[i] = 0;
+                res = hdc1080_cache_poll(&gs_cache, now, &sample);
+            }
+            else
+            {
+                continue;
+            }
+            if (res != 0)
+            {
+                hdc1080_interface_debug_print("hdc1080: consumer %d failed.\n", i);
+                (void)hdc1080_deinit(&gs_handle);
+                
+                return 1;
+            }
+            served++;
+            if (now - sample.timestamp_ms > max_age)
+            {
+                max_age = now - sample.timestamp_ms;
+            }
+            if (now - sample.timestamp_ms > gsc_max_age[i] + gs_cache.wait_ms)
+            {
+                hdc1080_interface_debug_print("hdc1080: consumer %d got a sample of %dms.\n", i, now - sample.timestamp_ms);
+                (void)hdc1080_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+    }
+    hdc1080_interface_debug_print("hdc1080: %d requests, %d hits, %d joins, %d conversions, %d served.\n",
+                                  gs_cache.requests, gs_cache.hits, gs_cache.joins, gs_cache.conversions, served);
+    hdc1080_interface_debug_print("hdc1080: %d bus triggers and %d fetches against %d conversions without the cache, %0.1f%% saved.\n",
+                                  gs_sim.triggers, gs_sim.fetches, gs_cache.requests,
+                                  100.0f - (float)gs_sim.triggers * 100.0f / (float)gs_cache.requests);
+    hdc1080_interface_debug_print("hdc1080: oldest served sample is %dms.\n", max_age);
+    if ((gs_sim.triggers != gs_cache.conversions) || (gs_sim.fetches != gs_sim.triggers) || (served != gs_cache.requests))
+    {
+        hdc1080_interface_debug_print("hdc1080: check bus access failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* finish cache test */
+    hdc1080_interface_debug_print("hdc1080: finish cache test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_cov_test.c
+ * @brief     driver hdc1080 cov test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_cov_test.h"
+
+/**
+ * @brief cov test step definition
+ */
+typedef struct hdc1080_cov_test_step_s
+{
+    uint32_t timestamp_ms;        /**< sample time */
+    uint16_t temperature;         /**< raw temperature */
+    uint16_t humidity;            /**< raw humidity */
+    uint8_t report;               /**< expected report */
+} hdc1080_cov_test_step_t;
+
+/**
+ * @brief cov test step table, the deadband is 10 codes, the hysteresis is 5 codes and the heartbeat is 10000ms
+ */
+static const hdc1080_cov_test_step_t gsc_step[] =
+{
+    {0xFFFFF000U, 1000, 2000, HDC1080_COV_REPORT_FIRST},
+    {0xFFFFF400U, 1010, 1990, 0},
+    {0xFFFFF800U, 1011, 2000, HDC1080_COV_REPORT_TEMPERATURE},
+    {0xFFFFFC00U, 1000, 2000, 0},
+    {0x00000000U, 1011, 2000, 0},
+    {0x00000400U, 1000, 2000, 0},
+    {0x00000800U, 995, 2000, HDC1080_COV_REPORT_TEMPERATURE},
+    {0x00000C00U, 1006, 2000, 0},
+    {0x00001000U, 984, 2011, HDC1080_COV_REPORT_TEMPERATURE | HDC1080_COV_REPORT_HUMIDITY},
+    {0x00001400U, 985, 2011, 0},
+    {0x00001800U, 975, 2000, 0},
+    {0x00001C00U, 973, 2000, HDC1080_COV_REPORT_TEMPERATURE},
+    {0x00004000U, 973, 2000, 0},
+    {0x00004400U, 973, 2000, HDC1080_COV_REPORT_HEARTBEAT},
+    {0x00004800U, 973, 2000, 0},
+};
+
+static hdc1080_cov_t gs_cov;        /**< cov structure */
+
+/**
+ * @brief  cov test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the deadband, the hysteresis and the heartbeat on synthetic raw codes, no sensor is needed
+ */
+uint8_t hdc1080_cov_test(void)
+{
+    uint8_t res;
+    uint8_t report;
+    uint8_t hysteresis;
+    uint32_t i;
+    uint32_t reports[2];
+    uint32_t seed;
+    uint16_t temperature;
+    uint16_t humidity;
+    
+    /* start cov test */
+    hdc1080_interface_debug_print("hdc1080: start cov test.\n");
+    
+    /* check the params */
+    if ((hdc1080_cov_init(NULL, 0.2f, 1.0f, 0.0f, 0.0f, 0) != 2) ||
+        (hdc1080_cov_init(&gs_cov, -0.2f, 1.0f, 0.0f, 0.0f, 0) != 4) ||
+        (hdc1080_cov_check(&gs_cov, 0, 0, 0, NULL) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check params failed.\n");
+        
+        return 1;
+    }
+    
+    /* band conversion */
+    res = hdc1080_cov_init(&gs_cov, 0.2f, 1.0f, 0.05f, 0.25f, 0);
+    if ((res != 0) || (gs_cov.temperature.deadband != 79) || (gs_cov.humidity.deadband != 655) ||
+        (gs_cov.temperature.hysteresis != 20) || (gs_cov.humidity.hysteresis != 164))
+    {
+        hdc1080_interface_debug_print("hdc1080: band conversion failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: 0.2C is %d codes, 1%% is %d codes.\n", 
+                                  gs_cov.temperature.deadband, gs_cov.humidity.deadband);
+    
+    /* deadband, hysteresis and heartbeat */
+    hdc1080_interface_debug_print("hdc1080: check deadband, hysteresis and heartbeat.\n");
+    (void)hdc1080_cov_init(&gs_cov, 0.0f, 0.0f, 0.0f, 0.0f, 10000);
+    gs_cov.temperature.deadband = 10;
+    gs_cov.temperature.hysteresis = 5;
+    gs_cov.humidity.deadband = 10;
+    gs_cov.humidity.hysteresis = 5;
+    for (i = 0; i < sizeof(gsc_step) / sizeof(gsc_step[0]); i++)
+    {
+        res = hdc1080_cov_check(&gs_cov, gsc_step[i].timestamp_ms, gsc_step[i].temperature, gsc_step[i].humidity, &report);
+        if ((res != 0) || (report != gsc_step[i].report))
+        {
+            hdc1080_interface_debug_print("hdc1080: step %d expect 0x%02X, got 0x%02X.\n", i, gsc_step[i].report, report);
+            
+            return 1;
+        }
+    }
+    
+    /* noisy signal with and without hysteresis */
+    for (hysteresis = 0; hysteresis < 2; hysteresis++)
+    {
+        (void)hdc1080_cov_init(&gs_cov, 0.2f, 1.0f, hysteresis ? 0.05f : 0.0f, hysteresis ? 0.25f : 0.0f, 600000);
+        seed = 1;
+        reports[hysteresis] = 0;
+        for (i = 0; i < 3600; i++)
+        {
+            /* a slow ramp of 1C per hour with 0.3C of noise, 1s period */
+            seed = seed * 1664525U + 1013904223U;
+            temperature = (uint16_t)(26000 + i * 397 / 3600 + ((seed >> 16) % 120) - 60);
+            humidity = (uint16_t)(32768 + ((seed >> 24) % 200) - 100);
+            (void)hdc1080_cov_check(&gs_cov, i * 1000, temperature, humidity, &report);
+            if (report != 0)
+            {
+                reports[hysteresis]++;
+            }
+        }
+        hdc1080_interface_debug_print("hdc1080: hysteresis %s, %d of 3600 samples reported.\n",
+                                      hysteresis ? "on" : "off", reports[hysteresis]);
+        if (gs_cov.suppressed != 3600 - reports[hysteresis])
+        {
+            hdc1080_interface_debug_print("hdc1080: report number is invalid.\n");
+            
+            return 1;
+        }
+    }
+    
+    if (reports[1] * 2 > reports[0])
+    {
+        hdc1080_interface_debug_print("hdc1080: hysteresis does not reduce the chatter.\n");
+        
+        return 1;
+    }
+    
+    /* finish cov test */
+    hdc1080_interface_debug_print("hdc1080: finish cov test.\n");
+    
+    return 0;
+}
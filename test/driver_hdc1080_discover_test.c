@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_discover_test.c
+ * @brief     driver hdc1080 discover test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_discover_test.h"
+#include "driver_hdc1080_sim.h"
+
+/**
+ * @brief discover test definition
+ */
+#define HDC1080_DISCOVER_TEST_MUX            2           /**< simulated muxes, 0x70 and 0x71 */
+#define HDC1080_DISCOVER_TEST_TRANSFER_US    100         /**< simulated transaction time in us */
+#define HDC1080_DISCOVER_TEST_NONE           0           /**< empty channel */
+#define HDC1080_DISCOVER_TEST_CHIP           1           /**< hdc1080 on the channel */
+#define HDC1080_DISCOVER_TEST_OTHER          2           /**< another device at the same address */
+
+/**
+ * @brief discover test device table, one row per simulated mux
+ */
+static const uint8_t gsc_device[HDC1080_DISCOVER_TEST_MUX][HDC1080_DISCOVER_CHANNELS] =
+{
+    {1, 0, 0, 1, 0, 2, 0, 1},
+    {0, 0, 1, 0, 0, 0, 0, 0},
+};
+
+static hdc1080_handle_t gs_handle;                                   /**< hdc1080 handle */
+static hdc1080_sim_t gs_sim;                                         /**< simulated chips, serial id 1 follows the channel */
+static hdc1080_discover_t gs_discover;                               /**< discover of the simulated bus */
+static hdc1080_discover_entry_t gs_entry[8];                         /**< found sensors */
+static uint8_t gs_mask[HDC1080_DISCOVER_TEST_MUX];                   /**< control bytes of the muxes */
+static uint8_t gs_root;                                              /**< 1 puts a chip on the bus itself */
+static uint32_t gs_collisions;                                       /**< reads answered by two devices */
+
+/**
+ * @brief  simulated bus answer
+ * @return device that answers
+ * @note   the serial id of the answering chip is set from its mux and channel
+ */
+static hdc1080_sim_answer_t a_hdc1080_discover_test_answer(void)
+{
+    uint8_t m;
+    uint8_t c;
+    uint8_t n;
+    uint8_t type;
+    
+    n = 0;
+    type = HDC1080_DISCOVER_TEST_NONE;
+    if (gs_root != 0)
+    {
+        n++;
+        type = HDC1080_DISCOVER_TEST_CHIP;
+        gs_sim.serial[1] = 0xFFFF;
+    }
+    for (m = 0; m < HDC1080_DISCOVER_TEST_MUX; m++)
+    {
+        for (c = 0; c < HDC1080_DISCOVER_CHANNELS; c++)
+        {
+            if (((gs_mask[m] & (1 << c)) != 0) && (gsc_device[m][c] != HDC1080_DISCOVER_TEST_NONE))
+            {
+                n++;
+                type = gsc_device[m][c];
+                gs_sim.serial[1] = (uint16_t)(m << 8 | c);
+            }
+        }
+    }
+    if (n > 1)
+    {
+        gs_collisions++;
+    }
+    if (type == HDC1080_DISCOVER_TEST_CHIP)
+    {
+        return HDC1080_SIM_ANSWER_CHIP;
+    }
+    else if (type == HDC1080_DISCOVER_TEST_OTHER)
+    {
+        return HDC1080_SIM_ANSWER_OTHER;
+    }
+    else
+    {
+        return HDC1080_SIM_ANSWER_NONE;
+    }
+}
+
+/**
+ * @brief     simulated mux control write
+ * @param[in] addr 7 bit mux address
+ * @param[in] mask control byte
+ * @return    status code
+ * @note      the missing mux naks
+ */
+static uint8_t a_hdc1080_discover_test_mux_write(uint8_t addr, uint8_t mask)
+{
+    gs_sim.tick_us += gs_sim.transfer_us;
+    if ((addr < 0x70) || (addr >= 0x70 + HDC1080_DISCOVER_TEST_MUX))
+    {
+        return 1;
+    }
+    gs_mask[addr - 0x70] = mask;
+    
+    return 0;
+}
+
+/**
+ * @brief  scan every channel with hdc1080_init
+ * @return found sensor number
+ * @note   the way to find the sensors without the discovery
+ */
+static uint8_t a_hdc1080_discover_test_init_scan(void)
+{
+    uint8_t m;
+    uint8_t c;
+    uint8_t n;
+    
+    n = 0;
+    for (m = 0; m < HDC1080_DISCOVER_TEST_MUX; m++)
+    {
+        for (c = 0; c < HDC1080_DISCOVER_CHANNELS; c++)
+        {
+            (void)a_hdc1080_discover_test_mux_write((uint8_t)(0x70 + m), (uint8_t)(1 << c));
+            if (hdc1080_init(&gs_handle) == 0)
+            {
+                n++;
+                (void)hdc1080_deinit(&gs_handle);
+            }
+        }
+        (void)a_hdc1080_discover_test_mux_write((uint8_t)(0x70 + m), 0x00);
+    }
+    
+    return n;
+}
+
+/**
+ * @brief  discover test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it scans a simulated bus with two muxes and a missing one, checks the found serial ids,
+ *         that two chips never share the bus and compares the scan time with an init of every channel,
+ *         no sensor is needed
+ */
+uint8_t hdc1080_discover_test(void)
+{
+    uint8_t i;
+    uint8_t n;
+    uint8_t id[6];
+    uint32_t discover_us;
+    uint32_t init_us;
+    
+    /* start discover test */
+    hdc1080_interface_debug_print("hdc1080: start discover test.\n");
+    
+    /* link the simulated bus */
+    hdc1080_sim_init(&gs_sim);
+    gs_sim.serial[2] = 0xA580;
+    gs_sim.transfer_us = HDC1080_DISCOVER_TEST_TRANSFER_US;
+    gs_sim.answer = a_hdc1080_discover_test_answer;
+    hdc1080_sim_link(&gs_handle);
+    gs_mask[0] = 0xFF;
+    gs_mask[1] = 0xFF;
+    gs_root = 0;
+    gs_collisions = 0;
+    
+    /* check the args */
+    if ((hdc1080_discover_init(&gs_discover, 0, NULL, a_hdc1080_discover_test_mux_write, gs_entry, 8) != 2) ||
+        (hdc1080_discover_init(&gs_discover, 0, &gs_handle, NULL, gs_entry, 8) != 0) ||
+        (hdc1080_discover_add_mux(&gs_discover, 0x70) != 5) ||
+        (hdc1080_discover_init(&gs_discover, 0, &gs_handle, a_hdc1080_discover_test_mux_write, gs_entry, 8) != 0) ||
+        (hdc1080_discover_add_mux(&gs_discover, 0x80) != 5) ||
+        (hdc1080_discover_add_mux(&gs_discover, 0x70) != 0) ||
+        (hdc1080_discover_add_mux(&gs_discover, 0x71) != 0) ||
+        (hdc1080_discover_add_mux(&gs_discover, 0x72) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        
+        return 1;
+    }
+    
+    /* muxes left open by a reset board must not put two chips on the bus */
+    hdc1080_interface_debug_print("hdc1080: discover with muxes 0x70, 0x71 and a missing 0x72.\n");
+    gs_sim.tick_us = 0;
+    if ((hdc1080_discover_run(&gs_discover) != 0) || (gs_discover.entry_num != 4) ||
+        (gs_discover.mux_found != 0x03) || (gs_collisions != 0) || (gs_mask[0] != 0) || (gs_mask[1] != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: discover failed.\n");
+        
+        return 1;
+    }
+    discover_us = (uint32_t)gs_sim.tick_us;
+    for (i = 0; i < gs_discover.entry_num; i++)
+    {
+        if ((gs_discover.entry[i].serial_id[2] != gs_discover.entry[i].mux - 0x70) ||
+            (gs_discover.entry[i].serial_id[3] != gs_discover.entry[i].channel) ||
+            (gsc_device[gs_discover.entry[i].mux - 0x70][gs_discover.entry[i].channel] != HDC1080_DISCOVER_TEST_CHIP))
+        {
+            hdc1080_interface_debug_print("hdc1080: check serial id failed.\n");
+            
+            return 1;
+        }
+        hdc1080_interface_debug_print("hdc1080: mux 0x%02X channel %d serial id %02X%02X%02X%02X%02X%02X.\n",
+                                      gs_discover.entry[i].mux, gs_discover.entry[i].channel,
+                                      gs_discover.entry[i].serial_id[0], gs_discover.entry[i].serial_id[1],
+                                      gs_discover.entry[i].serial_id[2], gs_discover.entry[i].serial_id[3],
+                                      gs_discover.entry[i].serial_id[4], gs_discover.entry[i].serial_id[5]);
+    }
+    
+    /* the same bus scanned with an init of every channel */
+    gs_sim.tick_us = 0;
+    n = a_hdc1080_discover_test_init_scan();
+    init_us = (uint32_t)gs_sim.tick_us;
+    hdc1080_interface_debug_print("hdc1080: discover %d probes %d mux writes %dms, init scan %d found %dms.\n",
+                                  gs_discover.probes, gs_discover.mux_writes, discover_us / 1000, n, init_us / 1000);
+    if ((n != 4) || (discover_us * 10 > init_us))
+    {
+        hdc1080_interface_debug_print("hdc1080: check scan time failed.\n");
+        
+        return 1;
+    }
+    
+    /* only the used sensor is initialized */
+    hdc1080_interface_debug_print("hdc1080: init the sensor of one entry.\n");
+    if ((hdc1080_discover_select(&gs_discover, &gs_entry[2]) != 0) || (hdc1080_init(&gs_handle) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    if ((hdc1080_get_serial_id(&gs_handle, id) != 0) || (memcmp(id, gs_entry[2].serial_id, 6) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check selected sensor failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* a short entry buffer keeps the first sensors */
+    hdc1080_interface_debug_print("hdc1080: check a full entry buffer.\n");
+    gs_discover.entry_max = 2;
+    if ((hdc1080_discover_run(&gs_discover) != 4) || (gs_discover.entry_num != 2) || (gs_mask[0] != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check full entry buffer failed.\n");
+        
+        return 1;
+    }
+    gs_discover.entry_max = 8;
+    
+    /* a chip on the bus itself answers on every channel */
+    hdc1080_interface_debug_print("hdc1080: check a chip on the bus itself.\n");
+    gs_root = 1;
+    if ((hdc1080_discover_run(&gs_discover) != 0) || (gs_discover.entry_num != 1) || (gs_discover.entry[0].mux != 0) ||
+        (gs_discover.probes != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check chip on the bus failed.\n");
+        gs_root = 0;
+        
+        return 1;
+    }
+    gs_root = 0;
+    
+    /* finish discover test */
+    hdc1080_interface_debug_print("hdc1080: finish discover test.\n");
+    
+    return 0;
+}
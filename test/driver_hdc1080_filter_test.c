@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_filter_test.c
+ * @brief     driver hdc1080 filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_filter_test.h"
+#include <math.h>
+
+/**
+ * @brief filter test definition
+ */
+#define HDC1080_FILTER_TEST_LEN        1024        /**< simulated sample number */
+#define HDC1080_FILTER_TEST_ROUNDS     100         /**< rounds of the timing test */
+
+static uint16_t gs_temperature_truth[HDC1080_FILTER_TEST_LEN];        /**< true temperature buffer */
+static uint16_t gs_humidity_truth[HDC1080_FILTER_TEST_LEN];           /**< true humidity buffer */
+static uint16_t gs_temperature_raw[HDC1080_FILTER_TEST_LEN];          /**< raw temperature buffer */
+static uint16_t gs_humidity_raw[HDC1080_FILTER_TEST_LEN];             /**< raw humidity buffer */
+static uint16_t gs_temperature_out[HDC1080_FILTER_TEST_LEN];          /**< filtered temperature buffer */
+static uint16_t gs_humidity_out[HDC1080_FILTER_TEST_LEN];             /**< filtered humidity buffer */
+static uint32_t gs_seed;                                              /**< random seed */
+static hdc1080_filter_t gs_filter;                                    /**< filter structure */
+static hdc1080_filter_t gs_filter_batch;                              /**< batch filter structure */
+
+/**
+ * @brief  get a pseudo gaussian value
+ * @return value with a zero mean and a one sigma of about 1
+ * @note   the sum of four uniform values
+ */
+static float a_hdc1080_filter_test_gauss(void)
+{
+    uint8_t i;
+    float sum;
+    
+    sum = 0.0f;
+    for (i = 0; i < 4; i++)
+    {
+        gs_seed = gs_seed * 1664525U + 1013904223U;
+        sum += (float)(gs_seed >> 8) / 16777216.0f;
+    }
+    
+    return (sum - 2.0f) * 1.7320508f;
+}
+
+/**
+ * @brief     quantize a raw code to a low resolution
+ * @param[in] code raw code
+ * @param[in] step code step of the resolution
+ * @return    quantized raw code
+ * @note      none
+ */
+static uint16_t a_hdc1080_filter_test_quantize(float code, uint32_t step)
+{
+    uint32_t q;
+    
+    q = (uint32_t)(code + (float)step / 2.0f) / step * step;
+    if (q > 65535)
+    {
+        q = 65536 - step;
+    }
+    
+    return (uint16_t)q;
+}
+
+/**
+ * @brief     get the rms error of a buffer
+ * @param[in] *out pointer to a buffer
+ * @param[in] *truth pointer to a truth buffer
+ * @param[in] start first sample
+ * @return    rms error in raw code
+ * @note      none
+ */
+static float a_hdc1080_filter_test_rms(const uint16_t *out, const uint16_t *truth, uint32_t start)
+{
+    uint32_t i;
+    float e;
+    float sum;
+    
+    sum = 0.0f;
+    for (i = start; i < HDC1080_FILTER_TEST_LEN; i++)
+    {
+        e = (float)out[i] - (float)truth[i];
+        sum += e * e;
+    }
+    
+    return sqrtf(sum / (float)(HDC1080_FILTER_TEST_LEN - start));
+}
+
+/**
+ * @brief     get the step latency of a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    samples until the output crosses 63% of a 10000 code step
+ * @note      the filter runs 256 samples on the low level first so the kalman gain is settled
+ */
+static uint32_t a_hdc1080_filter_test_step(hdc1080_filter_t *filter)
+{
+    uint32_t i;
+    uint16_t t;
+    uint16_t h;
+    
+    (void)hdc1080_filter_reset(filter);
+    for (i = 0; i < 256; i++)
+    {
+        (void)hdc1080_filter_update(filter, 20000, 20000, &t, &h);
+    }
+    for (i = 1; i < 65536; i++)
+    {
+        (void)hdc1080_filter_update(filter, 30000, 30000, &t, &h);
+        if (t >= 26321)
+        {
+            break;
+        }
+    }
+    
+    return i;
+}
+
+/**
+ * @brief     run a filter over the simulated signal
+ * @param[in] *name filter name
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_hdc1080_filter_test_run(const char *name, hdc1080_filter_t *filter)
+{
+    uint32_t i;
+    uint32_t start;
+    uint16_t t;
+    uint16_t h;
+    float raw_t;
+    float raw_h;
+    float out_t;
+    float out_h;
+    float us;
+    
+    /* the batch equals the single sample update */
+    gs_filter_batch = *filter;
+    if (hdc1080_filter_batch(&gs_filter_batch, gs_temperature_raw, gs_humidity_raw,
+                             gs_temperature_out, gs_humidity_out, HDC1080_FILTER_TEST_LEN) != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: batch failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < HDC1080_FILTER_TEST_LEN; i++)
+    {
+        if ((hdc1080_filter_update(filter, gs_temperature_raw[i], gs_humidity_raw[i], &t, &h) != 0) ||
+            (t != gs_temperature_out[i]) || (h != gs_humidity_out[i]))
+        {
+            hdc1080_interface_debug_print("hdc1080: batch does not match the update at %d.\n", i);
+            
+            return 1;
+        }
+    }
+    
+    /* skip the start up */
+    start = HDC1080_FILTER_TEST_LEN / 4;
+    raw_t = a_hdc1080_filter_test_rms(gs_temperature_raw, gs_temperature_truth, start);
+    raw_h = a_hdc1080_filter_test_rms(gs_humidity_raw, gs_humidity_truth, start);
+    out_t = a_hdc1080_filter_test_rms(gs_temperature_out, gs_temperature_truth, start);
+    out_h = a_hdc1080_filter_test_rms(gs_humidity_out, gs_humidity_truth, start);
+    
+    /* time the batch */
+    us = (float)hdc1080_interface_get_tick_ms();
+    for (i = 0; i < HDC1080_FILTER_TEST_ROUNDS; i++)
+    {
+        (void)hdc1080_filter_batch(&gs_filter_batch, gs_temperature_raw, gs_humidity_raw,
+                                   gs_temperature_out, gs_humidity_out, HDC1080_FILTER_TEST_LEN);
+    }
+    us = ((float)hdc1080_interface_get_tick_ms() - us) * 1000.0f /
+         (float)(HDC1080_FILTER_TEST_ROUNDS * HDC1080_FILTER_TEST_LEN);
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: %s step latency %d samples, %0.3fus per sample.\n",
+                                  name, a_hdc1080_filter_test_step(filter), us);
+    hdc1080_interface_debug_print("hdc1080: %s temperature rms %0.3fC to %0.3fC, humidity rms %0.3f%% to %0.3f%%.\n", name,
+                                  raw_t * 165.0f / 65536.0f, out_t * 165.0f / 65536.0f,
+                                  raw_h * 100.0f / 65536.0f, out_h * 100.0f / 65536.0f);
+    if ((out_t * 2.0f > raw_t) || (out_h * 2.0f > raw_h))
+    {
+        hdc1080_interface_debug_print("hdc1080: %s does not halve the noise.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  filter test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the ema and the kalman filter on a simulated 11 bit temperature and 8 bit humidity signal
+ *         and prints the step latency, the noise reduction and the time per sample, no sensor is needed
+ */
+uint8_t hdc1080_filter_test(void)
+{
+    uint16_t i;
+    uint16_t t;
+    uint16_t h;
+    uint16_t level;
+    uint16_t value;
+    float truth_t;
+    float truth_h;
+    
+    /* start filter test */
+    hdc1080_interface_debug_print("hdc1080: start filter test.\n");
+    
+    /* check the params */
+    if ((hdc1080_filter_init_ema(NULL, 4, 4) != 2) ||
+        (hdc1080_filter_init_ema(&gs_filter, 0, 4) != 4) ||
+        (hdc1080_filter_init_ema(&gs_filter, 4, 16) != 4) ||
+        (hdc1080_filter_init_kalman(NULL, 0.01f, 0.01f, 0.05f, 0.15f) != 2) ||
+        (hdc1080_filter_init_kalman(&gs_filter, 0.01f, 0.01f, 0.0f, 0.15f) != 4) ||
+        (hdc1080_filter_init_kalman(&gs_filter, -0.01f, 0.01f, 0.05f, 0.15f) != 4) ||
+        (hdc1080_filter_init_kalman(&gs_filter, 0.01f, 0.01f, 10.0f, 0.15f) != 4) ||
+        (hdc1080_filter_reset(NULL) != 2) ||
+        (hdc1080_filter_update(NULL, 0, 0, &t, &h) != 2) ||
+        (hdc1080_filter_update(&gs_filter, 0, 0, NULL, &h) != 2) ||
+        (hdc1080_filter_batch(NULL, NULL, NULL, NULL, NULL, 0) != 2) ||
+        (hdc1080_filter_batch(&gs_filter, gs_temperature_raw, NULL, NULL, NULL, 1) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check params failed.\n");
+        
+        return 1;
+    }
+    
+    /* a constant input is passed through without a bias */
+    hdc1080_interface_debug_print("hdc1080: check constant input.\n");
+    for (level = 0; level < 3; level++)
+    {
+        value = (level == 0) ? 0 : ((level == 1) ? 12345 : 0xFFFC);
+        (void)hdc1080_filter_init_ema(&gs_filter, 15, 1);
+        (void)hdc1080_filter_init_kalman(&gs_filter_batch, 0.01f, 0.01f, 0.05f, 0.15f);
+        for (i = 0; i < 1000; i++)
+        {
+            (void)hdc1080_filter_update(&gs_filter, value, value, &t, &h);
+            if ((t != value) || (h != value))
+            {
+                hdc1080_interface_debug_print("hdc1080: ema changes a constant %d.\n", value);
+                
+                return 1;
+            }
+            (void)hdc1080_filter_update(&gs_filter_batch, value, value, &t, &h);
+            if ((t != value) || (h != value))
+            {
+                hdc1080_interface_debug_print("hdc1080: kalman changes a constant %d.\n", value);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* a ramp of 1C and 2% per hour at 1s period, 0.05C and 0.1% sensor noise, 11 bit and 8 bit codes */
+    gs_seed = 1;
+    for (i = 0; i < HDC1080_FILTER_TEST_LEN; i++)
+    {
+        truth_t = 26000.0f + (float)i * 397.0f / 3600.0f;
+        truth_h = 32768.0f + (float)i * 1311.0f / 3600.0f;
+        gs_temperature_truth[i] = (uint16_t)(truth_t + 0.5f);
+        gs_humidity_truth[i] = (uint16_t)(truth_h + 0.5f);
+        gs_temperature_raw[i] = a_hdc1080_filter_test_quantize(truth_t + a_hdc1080_filter_test_gauss() * 20.0f, 32);
+        gs_humidity_raw[i] = a_hdc1080_filter_test_quantize(truth_h + a_hdc1080_filter_test_gauss() * 66.0f, 256);
+    }
+    
+    /* ema */
+    (void)hdc1080_filter_init_ema(&gs_filter, 4, 4);
+    if (a_hdc1080_filter_test_run("ema", &gs_filter) != 0)
+    {
+        return 1;
+    }
+    
+    /* kalman */
+    (void)hdc1080_filter_init_kalman(&gs_filter, 0.01f, 0.01f, 0.055f, 0.15f);
+    if (a_hdc1080_filter_test_run("kalman", &gs_filter) != 0)
+    {
+        return 1;
+    }
+    
+    /* finish filter test */
+    hdc1080_interface_debug_print("hdc1080: finish filter test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_health_test.c
+ * @brief     driver hdc1080 health test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_health_test.h"
+#include "driver_hdc1080_sim.h"
+
+/**
+ * @brief health test definition
+ */
+#define HDC1080_HEALTH_TEST_PERIOD_MS        1000          /**< read period */
+#define HDC1080_HEALTH_TEST_CONVERSION_MS    13            /**< simulated conversion time */
+#define HDC1080_HEALTH_TEST_CONFIG           0x3600        /**< sequence mode, heater, 11 bit temperature and 8 bit humidity */
+
+static hdc1080_handle_t gs_handle;                  /**< hdc1080 handle */
+static hdc1080_health_t gs_health;                  /**< health of the simulated chip */
+static hdc1080_sim_t gs_sim;                        /**< simulated chip */
+static uint8_t gs_plugged;                          /**< 1 if the chip is connected */
+static uint32_t gs_reports;                         /**< reported state changes */
+static const char *const gsc_state[] = {"healthy", "degraded", "lost", "recovering"};        /**< state names */
+
+/**
+ * @brief     state change report
+ * @param[in] *health pointer to a health structure
+ * @param[in] old_state old state
+ * @param[in] new_state new state
+ * @note      none
+ */
+static void a_hdc1080_health_test_report(hdc1080_health_t *health, hdc1080_health_state_t old_state,
+                                         hdc1080_health_state_t new_state)
+{
+    (void)health;
+    gs_reports++;
+    hdc1080_interface_debug_print("hdc1080: %dms %s -> %s.\n", hdc1080_sim_get_tick_ms(), gsc_state[old_state],
+                                  gsc_state[new_state]);
+}
+
+/**
+ * @brief  simulated cable
+ * @return who answers
+ * @note   an unplugged chip naks
+ */
+static hdc1080_sim_answer_t a_hdc1080_health_test_answer(void)
+{
+    return (gs_plugged != 0) ? HDC1080_SIM_ANSWER_CHIP : HDC1080_SIM_ANSWER_NONE;
+}
+
+/**
+ * @brief     read for a time
+ * @param[in] ms run time
+ * @return    good reads
+ * @note      one read per period
+ */
+static uint32_t a_hdc1080_health_test_run(uint32_t ms)
+{
+    uint32_t end;
+    uint32_t good;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    good = 0;
+    end = hdc1080_sim_get_tick_ms() + ms;
+    while ((int32_t)(hdc1080_sim_get_tick_ms() - end) < 0)
+    {
+        if (hdc1080_health_read(&gs_health, &temperature_raw, &temperature, &humidity_raw, &humidity) == 0)
+        {
+            good++;
+        }
+        gs_sim.tick_us += HDC1080_HEALTH_TEST_PERIOD_MS * 1000;
+    }
+    
+    return good;
+}
+
+/**
+ * @brief  health test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it unplugs and replugs a simulated chip, checks the state changes, the probe backoff, the restored
+ *         configuration and that the healthy path adds no bus traffic, no sensor is needed
+ */
+uint8_t hdc1080_health_test(void)
+{
+    uint32_t i;
+    uint32_t plain;
+    uint32_t lost;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    /* start health test */
+    hdc1080_interface_debug_print("hdc1080: start health test.\n");
+    
+    /* link the simulated bus */
+    hdc1080_sim_init(&gs_sim);
+    hdc1080_sim_link(&gs_handle);
+    gs_sim.conversion_ms = HDC1080_HEALTH_TEST_CONVERSION_MS;
+    gs_sim.answer = a_hdc1080_health_test_answer;
+    gs_plugged = 1;
+    gs_reports = 0;
+    
+    /* check the args */
+    if ((hdc1080_health_init(&gs_health, &gs_handle, hdc1080_sim_get_tick_ms, NULL) != 3) ||
+        (hdc1080_init(&gs_handle) != 0) ||
+        (hdc1080_health_init(&gs_health, &gs_handle, NULL, NULL) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        
+        return 1;
+    }
+    
+    /* configure the chip, the configuration is saved by the init */
+    if ((hdc1080_set_heater(&gs_handle, HDC1080_BOOL_TRUE) != 0) ||
+        (hdc1080_set_temperature_resolution(&gs_handle, HDC1080_TEMPERATURE_RESOLUTION_11_BIT) != 0) ||
+        (hdc1080_set_humidity_resolution(&gs_handle, HDC1080_HUMIDITY_RESOLUTION_8_BIT) != 0) ||
+        (hdc1080_health_init(&gs_health, &gs_handle, hdc1080_sim_get_tick_ms,
+                             a_hdc1080_health_test_report) != 0) ||
+        (hdc1080_health_set_threshold(&gs_health, 0, 3) != 4) ||
+        (hdc1080_health_set_threshold(&gs_health, 4, 3) != 4) ||
+        (hdc1080_health_set_backoff(&gs_health, 100, 50) != 4) ||
+        (hdc1080_health_set_backoff(&gs_health, 100, 10000) != 0) ||
+        (gs_health.config != HDC1080_HEALTH_TEST_CONFIG))
+    {
+        hdc1080_interface_debug_print("hdc1080: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* the healthy path costs the bus traffic of the plain read */
+    hdc1080_interface_debug_print("hdc1080: check the healthy path traffic.\n");
+    gs_sim.transactions = 0;
+    for (i = 0; i < 10; i++)
+    {
+        (void)hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature, &humidity_raw, &humidity);
+    }
+    plain = gs_sim.transactions;
+    gs_sim.transactions = 0;
+    if ((a_hdc1080_health_test_run(10 * HDC1080_HEALTH_TEST_PERIOD_MS) != 10) || (gs_sim.transactions != plain) ||
+        (gs_health.state != HDC1080_HEALTH_STATE_HEALTHY) || (gs_reports != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check healthy path failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: 10 reads, %d transactions plain, %d transactions with health.\n",
+                                  plain, gs_sim.transactions);
+    
+    /* unplug for 30s, the lost chip is only probed on the backoff */
+    hdc1080_interface_debug_print("hdc1080: unplug the chip for 30s.\n");
+    gs_plugged = 0;
+    gs_sim.transactions = 0;
+    if ((a_hdc1080_health_test_run(30000) != 0) || (gs_health.state != HDC1080_HEALTH_STATE_LOST))
+    {
+        hdc1080_interface_debug_print("hdc1080: check lost failed.\n");
+        
+        return 1;
+    }
+    lost = gs_sim.transactions;
+    hdc1080_interface_debug_print("hdc1080: %d probes, %d transactions in 30s, next probe in %dms.\n",
+                                  gs_health.probes, lost, gs_health.backoff_ms);
+    if ((gs_health.probes > 10) || (gs_health.backoff_ms != gs_health.backoff_max_ms))
+    {
+        hdc1080_interface_debug_print("hdc1080: check backoff failed.\n");
+        
+        return 1;
+    }
+    
+    /* replug, the chip powers up with the default configuration */
+    hdc1080_interface_debug_print("hdc1080: replug the chip.\n");
+    gs_plugged = 1;
+    gs_sim.config = 0x1000;
+    if ((a_hdc1080_health_test_run(10000) == 0) || (gs_health.state != HDC1080_HEALTH_STATE_HEALTHY) ||
+        (gs_sim.config != HDC1080_HEALTH_TEST_CONFIG) || (gs_health.recoveries != 1) || (gs_health.replaced != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check recovery failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: config 0x%04X restored.\n", gs_sim.config);
+    
+    /* another chip on the same cable */
+    hdc1080_interface_debug_print("hdc1080: replace the chip.\n");
+    gs_plugged = 0;
+    (void)a_hdc1080_health_test_run(5000);
+    gs_plugged = 1;
+    gs_sim.config = 0x1000;
+    gs_sim.serial[1] = 0x0002;
+    if ((a_hdc1080_health_test_run(10000) == 0) || (gs_health.state != HDC1080_HEALTH_STATE_HEALTHY) ||
+        (gs_sim.config != HDC1080_HEALTH_TEST_CONFIG) || (gs_health.recoveries != 2) || (gs_health.replaced != 1) ||
+        (gs_health.serial_id[3] != 0x02))
+    {
+        hdc1080_interface_debug_print("hdc1080: check replacement failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d state changes, %d recoveries, %d replaced.\n",
+                                  gs_health.transitions, gs_health.recoveries, gs_health.replaced);
+    if (gs_reports != gs_health.transitions)
+    {
+        hdc1080_interface_debug_print("hdc1080: check reports failed.\n");
+        
+        return 1;
+    }
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* finish health test */
+    hdc1080_interface_debug_print("hdc1080: finish health test.\n");
+    
+    return 0;
+}
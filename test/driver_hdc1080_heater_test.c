@@ -0,0 +1,345 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_heater_test.c
+ * @brief     driver hdc1080 heater test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_heater_test.h"
+#include "driver_hdc1080_sim.h"
+#include <math.h>
+
+/**
+ * @brief heater test definition
+ */
+#define HDC1080_HEATER_TEST_PERIOD_MS        1000          /**< read period */
+#define HDC1080_HEATER_TEST_CONVERSION_MS    7             /**< simulated conversion time */
+#define HDC1080_HEATER_TEST_AMBIENT          15.0f         /**< simulated air temperature */
+#define HDC1080_HEATER_TEST_RISE             10.0f         /**< die temperature rise of the heater */
+
+static hdc1080_handle_t gs_handle;                  /**< hdc1080 handle */
+static hdc1080_sim_t gs_sim;                        /**< simulated chip, the codes follow the die */
+static hdc1080_heater_t gs_heater;                  /**< heater scheduler */
+static float gs_die;                                /**< simulated die temperature */
+static float gs_rh;                                 /**< simulated air humidity */
+static uint32_t gs_film_ms;                         /**< heater time to dry the water film */
+static uint8_t gs_fog;                              /**< 1 if the fog keeps the film wet */
+static uint8_t gs_heated;                           /**< 1 if the conversion in flight runs with the heater on */
+static uint32_t gs_block_ms;                        /**< longest read */
+static uint32_t gs_flagged;                         /**< compensated reads */
+static float gs_error;                              /**< largest error of a compensated dry read */
+static float gs_max;                                /**< largest compensated humidity */
+
+/**
+ * @brief     saturation vapour pressure
+ * @param[in] t temperature in C
+ * @return    pressure in hPa
+ * @note      none
+ */
+static float a_hdc1080_heater_test_psat(float t)
+{
+    return 6.112f * expf(17.62f * t / (243.12f + t));
+}
+
+/**
+ * @brief simulated conversion start
+ * @note  the heater only heats during the conversion and dries the film outside of the fog
+ */
+static void a_hdc1080_heater_test_convert(void)
+{
+    if ((gs_sim.config & 0x2000) != 0)
+    {
+        gs_die += (HDC1080_HEATER_TEST_AMBIENT + HDC1080_HEATER_TEST_RISE - gs_die) *
+                  (1.0f - expf(-(float)HDC1080_HEATER_TEST_CONVERSION_MS / 1000.0f));
+        if (gs_fog == 0)
+        {
+            gs_film_ms = (gs_film_ms > HDC1080_HEATER_TEST_CONVERSION_MS) ?
+                         (gs_film_ms - HDC1080_HEATER_TEST_CONVERSION_MS) : 0;
+        }
+        gs_heated = 1;
+    }
+}
+
+/**
+ * @brief     simulated wait
+ * @param[in] ms delay time
+ * @note      the die cools to the air unless the heater ran, then a wet film reads 100% and a dry die reads
+ *            the air vapour pressure at its temperature
+ */
+static void a_hdc1080_heater_test_delay(uint32_t ms)
+{
+    float v;
+    
+    if (gs_heated != 0)
+    {
+        gs_heated = 0;
+    }
+    else
+    {
+        gs_die = HDC1080_HEATER_TEST_AMBIENT + (gs_die - HDC1080_HEATER_TEST_AMBIENT) * expf(-(float)ms / 2000.0f);
+    }
+    v = (gs_die - HDC1080_TEMPERATURE_MIN) / HDC1080_TEMPERATURE_SPAN * HDC1080_RAW_SPAN;
+    gs_sim.temperature = (uint16_t)v;
+    v = (gs_film_ms > 0) ? 100.0f :
+        gs_rh * a_hdc1080_heater_test_psat(HDC1080_HEATER_TEST_AMBIENT) / a_hdc1080_heater_test_psat(gs_die);
+    v = v / HDC1080_HUMIDITY_SPAN * HDC1080_RAW_SPAN;
+    gs_sim.humidity = (v > 65535.0f) ? 65535 : (uint16_t)v;
+}
+
+/**
+ * @brief     read for a number of periods
+ * @param[in] n read times
+ * @param[in] state stop state
+ * @return    read times
+ * @note      it stops after the read that entered the stop state
+ */
+static uint32_t a_hdc1080_heater_test_run(uint32_t n, hdc1080_heater_state_t state)
+{
+    uint32_t i;
+    uint32_t start;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    uint8_t flags;
+    
+    for (i = 0; i < n; i++)
+    {
+        start = hdc1080_sim_get_tick_ms();
+        if (hdc1080_heater_read(&gs_heater, &temperature_raw, &temperature, &humidity_raw, &humidity, &flags) != 0)
+        {
+            return 0;
+        }
+        if ((hdc1080_sim_get_tick_ms() - start) > gs_block_ms)
+        {
+            gs_block_ms = hdc1080_sim_get_tick_ms() - start;
+        }
+        if ((flags & HDC1080_HEATER_FLAG_COMPENSATED) != 0)
+        {
+            gs_flagged++;
+            if (humidity > gs_max)
+            {
+                gs_max = humidity;
+            }
+            if (((flags & HDC1080_HEATER_FLAG_SATURATED) == 0) && (fabsf(humidity - gs_rh) > gs_error))
+            {
+                gs_error = fabsf(humidity - gs_rh);
+            }
+            if (temperature != gs_heater.ambient)
+            {
+                return 0;
+            }
+        }
+        hdc1080_sim_delay_ms(HDC1080_HEATER_TEST_PERIOD_MS);
+        if (gs_heater.state == (uint8_t)state)
+        {
+            return i + 1;
+        }
+    }
+    
+    return n;
+}
+
+/**
+ * @brief  heater test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it condenses water on a simulated chip, checks the saturation detection, the bounded bursts, the
+ *         compensated readings, the duty budget and the give up on a persistent fog, no sensor is needed
+ */
+uint8_t hdc1080_heater_test(void)
+{
+    uint32_t n;
+    uint32_t start;
+    uint32_t limit;
+    float mj;
+    
+    /* start heater test */
+    hdc1080_interface_debug_print("hdc1080: start heater test.\n");
+    
+    /* link the simulated bus */
+    hdc1080_sim_init(&gs_sim);
+    gs_sim.conversion_ms = HDC1080_HEATER_TEST_CONVERSION_MS;
+    gs_sim.convert = a_hdc1080_heater_test_convert;
+    gs_sim.delay = a_hdc1080_heater_test_delay;
+    hdc1080_sim_link(&gs_handle);
+    gs_die = HDC1080_HEATER_TEST_AMBIENT;
+    gs_rh = 60.0f;
+    gs_film_ms = 0;
+    gs_fog = 0;
+    gs_heated = 0;
+    
+    /* check the args */
+    if ((hdc1080_heater_init(&gs_heater, &gs_handle, hdc1080_sim_get_tick_ms) != 3) ||
+        (hdc1080_init(&gs_handle) != 0) ||
+        (hdc1080_heater_init(&gs_heater, &gs_handle, NULL) != 2) ||
+        (hdc1080_heater_init(&gs_heater, &gs_handle, hdc1080_sim_get_tick_ms) != 0) ||
+        (hdc1080_heater_set_saturation(&gs_heater, 90.0f, 95.0f, 3) != 4) ||
+        (hdc1080_heater_set_saturation(&gs_heater, 95.0f, 90.0f, 0) != 4) ||
+        (hdc1080_heater_set_burst(&gs_heater, 0, 5000, 60000, 300000) != 4) ||
+        (hdc1080_heater_set_burst(&gs_heater, 5000, 5000, 60000, 300000) != 4) ||
+        (hdc1080_heater_set_budget(&gs_heater, 1001, 2000, 23.76f, 0.0f) != 4) ||
+        (hdc1080_heater_set_budget(&gs_heater, 250, 100, 23.76f, 0.0f) != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        
+        return 1;
+    }
+    
+    /* the power budget lowers the duty */
+    if ((hdc1080_heater_set_budget(&gs_heater, 500, 2000, 23.76f, 2.376f) != 0) || (gs_heater.duty != 100) ||
+        (hdc1080_heater_set_budget(&gs_heater, 250, 2000, 23.76f, 0.0f) != 0) || (gs_heater.duty != 250))
+    {
+        hdc1080_interface_debug_print("hdc1080: check power budget failed.\n");
+        
+        return 1;
+    }
+    
+    /* dry air never heats */
+    hdc1080_interface_debug_print("hdc1080: check dry air.\n");
+    if ((a_hdc1080_heater_test_run(60, HDC1080_HEATER_STATE_HEATING) != 60) || (gs_sim.heater_writes != 0) ||
+        (gs_flagged != 0) || (gs_heater.state != HDC1080_HEATER_STATE_IDLE))
+    {
+        hdc1080_interface_debug_print("hdc1080: check dry air failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: 60 reads, no heater traffic.\n");
+    
+    /* water condenses on the chip */
+    hdc1080_interface_debug_print("hdc1080: condense water on the chip.\n");
+    gs_rh = 85.0f;
+    gs_film_ms = 1500;
+    n = a_hdc1080_heater_test_run(10, HDC1080_HEATER_STATE_HEATING);
+    if ((n != gs_heater.count) || (gs_heater.episodes != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check saturation failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: saturated after %d reads.\n", n);
+    start = hdc1080_sim_get_tick_ms();
+    n = a_hdc1080_heater_test_run(60, HDC1080_HEATER_STATE_COOLING);
+    if ((gs_heater.state != HDC1080_HEATER_STATE_COOLING) || (gs_film_ms != 0) || (gs_heater.recoveries != 1) ||
+        (gs_block_ms > gs_heater.burst_ms + 2 * HDC1080_HEATER_TEST_CONVERSION_MS) || (gs_max > 100.0f))
+    {
+        hdc1080_interface_debug_print("hdc1080: check recovery failed.\n");
+        
+        return 1;
+    }
+    (void)hdc1080_heater_get_energy(&gs_heater, &mj);
+    hdc1080_interface_debug_print("hdc1080: dry after %d reads in %dms, %d bursts, %dms heater, %0.1fmJ.\n",
+                                  n, hdc1080_sim_get_tick_ms() - start, gs_heater.bursts, gs_heater.heater_ms, mj);
+    hdc1080_interface_debug_print("hdc1080: longest read %dms.\n", gs_block_ms);
+    
+    /* the die cools down, the compensated reads follow the air */
+    n = a_hdc1080_heater_test_run(60, HDC1080_HEATER_STATE_IDLE);
+    if ((gs_heater.state != HDC1080_HEATER_STATE_IDLE) || (gs_error > 1.0f) ||
+        (a_hdc1080_heater_test_run(10, HDC1080_HEATER_STATE_HEATING) != 10) || (gs_heater.episodes != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check cool down failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d compensated reads, largest error %0.2f%%.\n", gs_flagged, gs_error);
+    
+    /* a low duty skips bursts */
+    hdc1080_interface_debug_print("hdc1080: condense water with a 10%% duty.\n");
+    if (hdc1080_heater_set_budget(&gs_heater, 100, 400, 23.76f, 0.0f) != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: set budget failed.\n");
+        
+        return 1;
+    }
+    gs_film_ms = 3000;
+    start = hdc1080_sim_get_tick_ms();
+    n = gs_heater.heater_ms;
+    (void)a_hdc1080_heater_test_run(10, HDC1080_HEATER_STATE_HEATING);
+    (void)a_hdc1080_heater_test_run(200, HDC1080_HEATER_STATE_COOLING);
+    limit = 400 + (hdc1080_sim_get_tick_ms() - start) / 10 + 2 * HDC1080_HEATER_TEST_CONVERSION_MS;
+    if ((gs_heater.state != HDC1080_HEATER_STATE_COOLING) || (gs_heater.skipped == 0) ||
+        (gs_heater.heater_ms - n > limit))
+    {
+        hdc1080_interface_debug_print("hdc1080: check budget failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %dms heater in %dms, limit %dms, %d bursts skipped.\n",
+                                  gs_heater.heater_ms - n, hdc1080_sim_get_tick_ms() - start, limit, gs_heater.skipped);
+    
+    /* a persistent fog gives up and holds off */
+    hdc1080_interface_debug_print("hdc1080: keep the chip in fog.\n");
+    (void)a_hdc1080_heater_test_run(60, HDC1080_HEATER_STATE_IDLE);
+    if ((hdc1080_heater_set_budget(&gs_heater, 250, 2000, 23.76f, 0.0f) != 0) ||
+        (hdc1080_heater_set_burst(&gs_heater, 200, 5000, 2000, 30000) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: set burst failed.\n");
+        
+        return 1;
+    }
+    gs_fog = 1;
+    gs_film_ms = 1;
+    (void)a_hdc1080_heater_test_run(100, HDC1080_HEATER_STATE_HOLDOFF);
+    n = gs_sim.heater_writes;
+    if ((gs_heater.state != HDC1080_HEATER_STATE_HOLDOFF) || (gs_heater.give_ups != 1) ||
+        (a_hdc1080_heater_test_run(20, HDC1080_HEATER_STATE_HEATING) != 20) || (gs_sim.heater_writes != n))
+    {
+        hdc1080_interface_debug_print("hdc1080: check give up failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: gave up after %dms heater, no heater traffic in the holdoff.\n",
+                                  gs_heater.used_ms);
+    if ((a_hdc1080_heater_test_run(60, HDC1080_HEATER_STATE_HEATING) == 60) || (gs_heater.episodes != 4))
+    {
+        hdc1080_interface_debug_print("hdc1080: check holdoff failed.\n");
+        
+        return 1;
+    }
+    gs_fog = 0;
+    if (a_hdc1080_heater_test_run(100, HDC1080_HEATER_STATE_COOLING) == 100)
+    {
+        hdc1080_interface_debug_print("hdc1080: check fog lifted failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d episodes, %d recoveries, %d give ups.\n",
+                                  gs_heater.episodes, gs_heater.recoveries, gs_heater.give_ups);
+    (void)hdc1080_set_heater(&gs_handle, HDC1080_BOOL_FALSE);
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* finish heater test */
+    hdc1080_interface_debug_print("hdc1080: finish heater test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_log_test.c
+ * @brief     driver hdc1080 log test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_log_test.h"
+
+/**
+ * @brief log test last message id definition
+ */
+#define HDC1080_LOG_TEST_LAST_ID        HDC1080_DEBUG_ID_MODE_INVALID           /**< last message id */
+
+static hdc1080_log_handle_t gs_log;        /**< log handle */
+
+/**
+ * @brief  log test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the record ring, the lost records, the packed format and the text of every message id,
+ *         no sensor is needed
+ */
+uint8_t hdc1080_log_test(void)
+{
+    uint32_t i;
+    uint32_t lost;
+    uint8_t buf[HDC1080_LOG_RECORD_SIZE];
+    char text[64];
+    hdc1080_log_record_t record;
+    hdc1080_log_record_t check;
+    
+    /* start log test */
+    hdc1080_interface_debug_print("hdc1080: start log test.\n");
+    
+    /* check the args */
+    if ((hdc1080_log_init(NULL) != 2) || (hdc1080_log_write(NULL, 1, 0) != 2) ||
+        (hdc1080_log_read(&gs_log, NULL) != 2) || (hdc1080_log_get_lost(&gs_log, NULL) != 2) ||
+        (hdc1080_log_reset_lost(NULL, &lost) != 2) || (hdc1080_log_pack(NULL, buf) != 2) ||
+        (hdc1080_log_unpack(buf, NULL) != 2) || (hdc1080_log_format(&record, text, 0) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check args failed.\n");
+        
+        return 1;
+    }
+    
+    /* fill the ring, the next record is lost and leaves a gap in the sequence */
+    hdc1080_interface_debug_print("hdc1080: check the record ring.\n");
+    if ((hdc1080_log_init(&gs_log) != 0) || (hdc1080_log_read(&gs_log, &record) != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check empty log failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < HDC1080_LOG_MAX_RECORD; i++)
+    {
+        if (hdc1080_log_write(&gs_log, (uint8_t)(i % HDC1080_LOG_TEST_LAST_ID + 1), (uint16_t)(i * 257)) != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: write record %d failed.\n", i);
+            
+            return 1;
+        }
+    }
+    if ((hdc1080_log_write(&gs_log, 1, 0) != 1) || (hdc1080_log_get_lost(&gs_log, &lost) != 0) || (lost != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check full log failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < HDC1080_LOG_MAX_RECORD; i++)
+    {
+        if ((hdc1080_log_read(&gs_log, &record) != 0) || (record.seq != (uint8_t)i) ||
+            (record.id != (uint8_t)(i % HDC1080_LOG_TEST_LAST_ID + 1)) || (record.arg != (uint16_t)(i * 257)))
+        {
+            hdc1080_interface_debug_print("hdc1080: read record %d failed.\n", i);
+            
+            return 1;
+        }
+    }
+    if ((hdc1080_log_write(&gs_log, 2, 0) != 0) || (hdc1080_log_read(&gs_log, &record) != 0) ||
+        (record.seq != (uint8_t)(HDC1080_LOG_MAX_RECORD + 1)))
+    {
+        hdc1080_interface_debug_print("hdc1080: check sequence gap failed.\n");
+        
+        return 1;
+    }
+    
+    /* the reset only clears the reported records */
+    if ((hdc1080_log_reset_lost(&gs_log, &lost) != 0) || (lost != 1) ||
+        (hdc1080_log_get_lost(&gs_log, &lost) != 0) || (lost != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check lost reset failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < HDC1080_LOG_MAX_RECORD + 3; i++)
+    {
+        (void)hdc1080_log_write(&gs_log, 1, 0);
+    }
+    if ((hdc1080_log_reset_lost(&gs_log, &lost) != 0) || (lost != 3))
+    {
+        hdc1080_interface_debug_print("hdc1080: check lost count failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d records, lost records counted and reset.\n", HDC1080_LOG_MAX_RECORD);
+    
+    /* packed format */
+    hdc1080_interface_debug_print("hdc1080: check the packed format.\n");
+    for (i = 0; i < 256; i++)
+    {
+        record.id = (uint8_t)i;
+        record.seq = (uint8_t)(255 - i);
+        record.arg = (uint16_t)(i * 0x0101 + 0x1234);
+        if ((hdc1080_log_pack(&record, buf) != 0) || (buf[0] != record.id) || (buf[1] != record.seq) ||
+            (buf[2] != (uint8_t)(record.arg >> 0)) || (buf[3] != (uint8_t)(record.arg >> 8)) ||
+            (hdc1080_log_unpack(buf, &check) != 0) || (check.id != record.id) || (check.seq != record.seq) ||
+            (check.arg != record.arg))
+        {
+            hdc1080_interface_debug_print("hdc1080: round trip of id 0x%02X failed.\n", i);
+            
+            return 1;
+        }
+    }
+    
+    /* every message id has a text */
+    hdc1080_interface_debug_print("hdc1080: check the message texts.\n");
+    for (i = 1; i <= HDC1080_LOG_TEST_LAST_ID; i++)
+    {
+        record.id = (uint8_t)i;
+        record.arg = 1;
+        if ((hdc1080_log_format(&record, text, sizeof(text)) != 0) || (strncmp(text, "hdc1080: ", 9) != 0) ||
+            (strncmp(text, "hdc1080: unknown", 16) == 0))
+        {
+            hdc1080_interface_debug_print("hdc1080: text of id 0x%02X failed.\n", i);
+            
+            return 1;
+        }
+    }
+    record.id = HDC1080_DEBUG_ID_MANUFACTURER_ID_INVALID;
+    record.arg = 0x5450;
+    if ((hdc1080_log_format(&record, text, sizeof(text)) != 0) ||
+        (strcmp(text, "hdc1080: manufacturer id 0x5450 is invalid.\n") != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check argument failed.\n");
+        
+        return 1;
+    }
+    record.id = 0;
+    if (hdc1080_log_format(&record, text, sizeof(text)) != 1)
+    {
+        hdc1080_interface_debug_print("hdc1080: check unknown id failed.\n");
+        
+        return 1;
+    }
+    record.id = HDC1080_LOG_TEST_LAST_ID + 1;
+    if (hdc1080_log_format(&record, text, sizeof(text)) != 1)
+    {
+        hdc1080_interface_debug_print("hdc1080: check unknown id failed.\n");
+        
+        return 1;
+    }
+    record.id = HDC1080_DEBUG_ID_READ_MANUFACTURER_ID_FAILED;
+    memset(text, 0x55, sizeof(text));
+    if ((hdc1080_log_format(&record, text, 8) != 0) || (text[7] != '\0') || ((uint8_t)text[8] != 0x55))
+    {
+        hdc1080_interface_debug_print("hdc1080: check short buffer failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d message ids formatted.\n", HDC1080_LOG_TEST_LAST_ID);
+    
+    /* finish log test */
+    hdc1080_interface_debug_print("hdc1080: finish log test.\n");
+    
+    return 0;
+}
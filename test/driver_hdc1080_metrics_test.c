@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_metrics_test.c
+ * @brief     driver hdc1080 metrics test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_metrics_test.h"
+#include <math.h>
+
+/**
+ * @brief metrics test definition
+ */
+#define HDC1080_METRICS_TEST_STEP       1024        /**< raw code step of the accuracy grid */
+#define HDC1080_METRICS_TEST_LEN        128         /**< batch length of the timing test */
+#define HDC1080_METRICS_TEST_ROUNDS     200         /**< first rounds of the timing test */
+#define HDC1080_METRICS_TEST_MAX_ROUNDS (1 << 22)   /**< max rounds of the timing test */
+#define HDC1080_METRICS_TEST_MIN_MS     500         /**< min time of the timing test in ms */
+
+static float gs_temperature[HDC1080_METRICS_TEST_LEN];                  /**< temperature buffer */
+static float gs_humidity[HDC1080_METRICS_TEST_LEN];                     /**< humidity buffer */
+static uint16_t gs_temperature_raw[HDC1080_METRICS_TEST_LEN];           /**< raw temperature buffer */
+static uint16_t gs_humidity_raw[HDC1080_METRICS_TEST_LEN];              /**< raw humidity buffer */
+static hdc1080_metrics_t gs_metrics[HDC1080_METRICS_TEST_LEN];          /**< metrics buffer */
+static hdc1080_metrics_fixed_t gs_metrics_fixed[HDC1080_METRICS_TEST_LEN];        /**< fixed point metrics buffer */
+
+/**
+ * @brief     check if a sample is next to a branch of the heat index
+ * @param[in] temperature temperature in C
+ * @param[in] humidity relative humidity in %
+ * @return    1 if the tiers may take different branches, else 0
+ * @note      none
+ */
+static uint8_t a_hdc1080_metrics_test_edge(float temperature, float humidity)
+{
+    float tf;
+    float hi;
+    
+    tf = temperature * 1.8f + 32.0f;
+    hi = 0.5f * (tf + 61.0f + (tf - 68.0f) * 1.2f + humidity * 0.094f);
+    if ((fabsf((hi + tf) * 0.5f - 80.0f) < 0.05f) || (fabsf(tf - 80.0f) < 0.05f) ||
+        (fabsf(tf - 87.0f) < 0.05f) || (fabsf(tf - 112.0f) < 0.05f) ||
+        (fabsf(humidity - 13.0f) < 0.01f) || (fabsf(humidity - 85.0f) < 0.01f))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run one timing test
+ * @param[in] tier 0 is exact, 1 is fast and 2 is fixed point
+ * @return    time per sample in us
+ * @note      the rounds are doubled until the run takes HDC1080_METRICS_TEST_MIN_MS,
+ *            so the tick of the timer is far below the measured time
+ */
+static float a_hdc1080_metrics_test_time(uint8_t tier)
+{
+    uint32_t i;
+    uint32_t rounds;
+    uint32_t start;
+    uint32_t elapsed;
+    
+    rounds = HDC1080_METRICS_TEST_ROUNDS;
+    while (1)
+    {
+        start = hdc1080_interface_get_tick_ms();
+        for (i = 0; i < rounds; i++)
+        {
+            if (tier == 0)
+            {
+                (void)hdc1080_metrics_exact_batch(gs_temperature, gs_humidity, gs_metrics, HDC1080_METRICS_TEST_LEN);
+            }
+            else if (tier == 1)
+            {
+                (void)hdc1080_metrics_fast_batch(gs_temperature, gs_humidity, gs_metrics, HDC1080_METRICS_TEST_LEN);
+            }
+            else
+            {
+                (void)hdc1080_metrics_fixed_batch(gs_temperature_raw, gs_humidity_raw, gs_metrics_fixed, HDC1080_METRICS_TEST_LEN);
+            }
+        }
+        elapsed = hdc1080_interface_get_tick_ms() - start;
+        if ((elapsed >= HDC1080_METRICS_TEST_MIN_MS) || (rounds >= HDC1080_METRICS_TEST_MAX_ROUNDS))
+        {
+            break;
+        }
+        rounds *= 2;
+    }
+    
+    return (float)elapsed * 1000.0f / ((float)rounds * (float)HDC1080_METRICS_TEST_LEN);
+}
+
+/**
+ * @brief  metrics test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it checks the fast and the fixed point tiers against the reference formulas over the whole raw range
+ *         and prints the time per sample of every tier against the exact one, no sensor is needed
+ */
+uint8_t hdc1080_metrics_test(void)
+{
+    uint8_t res;
+    uint8_t edge;
+    uint32_t t;
+    uint32_t h;
+    uint32_t i;
+    uint32_t n = 0;
+    uint32_t failed = 0;
+    float temperature;
+    float humidity;
+    float dp_fast = 0.0f;
+    float ah_fast = 0.0f;
+    float hi_fast = 0.0f;
+    float dp_fixed = 0.0f;
+    float ah_fixed = 0.0f;
+    float hi_fixed = 0.0f;
+    float err;
+    float us_exact;
+    float us_fast;
+    float us_fixed;
+    hdc1080_metrics_t exact;
+    hdc1080_metrics_t fast;
+    hdc1080_metrics_fixed_t fixed;
+    
+    /* start metrics test */
+    hdc1080_interface_debug_print("hdc1080: start metrics test.\n");
+    
+    /* check the null pointer */
+    res = hdc1080_metrics_exact(25.0f, 50.0f, NULL);
+    if (res != 2)
+    {
+        hdc1080_interface_debug_print("hdc1080: check null pointer failed.\n");
+        
+        return 1;
+    }
+    res = hdc1080_metrics_fixed_batch(NULL, gs_humidity_raw, gs_metrics_fixed, 1);
+    if (res != 2)
+    {
+        hdc1080_interface_debug_print("hdc1080: check null pointer failed.\n");
+        
+        return 1;
+    }
+    
+    /* known values */
+    (void)hdc1080_metrics_exact(25.0f, 50.0f, &exact);
+    hdc1080_interface_debug_print("hdc1080: 25.00C 50.00%% dew point is %0.2fC, absolute humidity is %0.2fg/m3, heat index is %0.2fC.\n",
+                                  exact.dew_point, exact.absolute_humidity, exact.heat_index);
+    if ((fabsf(exact.dew_point - 13.85f) > 0.01f) || (fabsf(exact.absolute_humidity - 11.48f) > 0.01f) ||
+        (fabsf(exact.heat_index - 24.86f) > 0.01f))
+    {
+        hdc1080_interface_debug_print("hdc1080: known value check failed.\n");
+        
+        return 1;
+    }
+    
+    /* accuracy over the raw range */
+    hdc1080_interface_debug_print("hdc1080: check the accuracy.\n");
+    for (t = 0; t < 65536; t += HDC1080_METRICS_TEST_STEP)
+    {
+        for (h = 656; h < 65536; h += HDC1080_METRICS_TEST_STEP)
+        {
+            temperature = (float)t / 65536.0f * 165.0f - 40.0f;
+            humidity = (float)h / 65536.0f * 100.0f;
+            edge = a_hdc1080_metrics_test_edge(temperature, humidity);
+            (void)hdc1080_metrics_exact(temperature, humidity, &exact);
+            (void)hdc1080_metrics_fast(temperature, humidity, &fast);
+            (void)hdc1080_metrics_fixed((uint16_t)t, (uint16_t)h, &fixed);
+            
+            /* fast tier */
+            dp_fast = fmaxf(dp_fast, fabsf(fast.dew_point - exact.dew_point));
+            ah_fast = fmaxf(ah_fast, fabsf(fast.absolute_humidity - exact.absolute_humidity) / exact.absolute_humidity * 100.0f);
+            hi_fast = fmaxf(hi_fast, fabsf(fast.heat_index - exact.heat_index));
+            
+            /* fixed point tier */
+            dp_fixed = fmaxf(dp_fixed, fabsf((float)fixed.dew_point / 100.0f - exact.dew_point));
+            err = fabsf((float)fixed.absolute_humidity / 1000.0f - exact.absolute_humidity);
+            if (err > 0.001f + exact.absolute_humidity * 0.0003f)
+            {
+                failed++;
+            }
+            ah_fixed = fmaxf(ah_fixed, err * 1000.0f);
+            if (edge == 0)
+            {
+                hi_fixed = fmaxf(hi_fixed, fabsf((float)fixed.heat_index / 100.0f - exact.heat_index));
+            }
+            n++;
+        }
+    }
+    hdc1080_interface_debug_print("hdc1080: %d samples.\n", n);
+    hdc1080_interface_debug_print("hdc1080: fast max error dew point %0.4fC, absolute humidity %0.4f%%, heat index %0.4fC.\n",
+                                  dp_fast, ah_fast, hi_fast);
+    hdc1080_interface_debug_print("hdc1080: fixed max error dew point %0.4fC, absolute humidity %0.1fmg/m3, heat index %0.4fC.\n",
+                                  dp_fixed, ah_fixed, hi_fixed);
+    if ((dp_fast > 0.002f) || (ah_fast > 0.002f) || (hi_fast > 0.002f) ||
+        (dp_fixed > 0.03f) || (failed != 0) || (hi_fixed > 0.015f))
+    {
+        hdc1080_interface_debug_print("hdc1080: accuracy check failed.\n");
+        
+        return 1;
+    }
+    
+    /* time per sample */
+    hdc1080_interface_debug_print("hdc1080: check the time per sample.\n");
+    for (i = 0; i < HDC1080_METRICS_TEST_LEN; i++)
+    {
+        gs_temperature_raw[i] = (uint16_t)(i * 509U);
+        gs_humidity_raw[i] = (uint16_t)(656U + i * 503U);
+        gs_temperature[i] = (float)gs_temperature_raw[i] / 65536.0f * 165.0f - 40.0f;
+        gs_humidity[i] = (float)gs_humidity_raw[i] / 65536.0f * 100.0f;
+    }
+    us_exact = a_hdc1080_metrics_test_time(0);
+    us_fast = a_hdc1080_metrics_test_time(1);
+    us_fixed = a_hdc1080_metrics_test_time(2);
+    if ((us_exact <= 0.0f) || (us_fast <= 0.0f) || (us_fixed <= 0.0f))
+    {
+        hdc1080_interface_debug_print("hdc1080: timing check failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: exact %0.3fus per sample.\n", us_exact);
+    hdc1080_interface_debug_print("hdc1080: fast %0.3fus per sample, %0.2f times exact.\n", us_fast, us_fast / us_exact);
+    hdc1080_interface_debug_print("hdc1080: fixed %0.3fus per sample, %0.2f times exact.\n", us_fixed, us_fixed / us_exact);
+    
+    /* finish metrics test */
+    hdc1080_interface_debug_print("hdc1080: finish metrics test.\n");
+    
+    return 0;
+}
@@ -59,8 +59,10 @@ uint8_t hdc1080_read_test(uint32_t times)
     DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
     DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
     DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
     DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
     DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
 
     /* get hdc1080 information */
     res = hdc1080_info(&info);
@@ -363,6 +365,58 @@ uint8_t hdc1080_read_test(uint32_t times)
         hdc1080_interface_debug_print("hdc1080: humidity is %0.2f%%.\n", humidity_s);
     }
     
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: hdc1080_start_temperature_humidity/hdc1080_fetch_temperature_humidity test.\n");
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        uint16_t temperature_raw;
+        float temperature_s;
+        uint16_t humidity_raw;
+        float humidity_s;
+        uint32_t temperature_us;
+        uint32_t humidity_us;
+        
+        /* delay 1000ms */
+        hdc1080_interface_delay_ms(1000);
+        
+        /* start the measurement */
+        res = hdc1080_start_temperature_humidity(&gs_handle);
+        if (res != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: start temperature humidity failed.\n");
+            (void)hdc1080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* wait the conversion time */
+        res = hdc1080_get_conversion_time(HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT, 
+                                          &temperature_us, &humidity_us);
+        if (res != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: get conversion time failed.\n");
+            (void)hdc1080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        hdc1080_interface_delay_ms((temperature_us + humidity_us) / 1000 + 1);
+        
+        /* fetch the measurement */
+        res = hdc1080_fetch_temperature_humidity(&gs_handle, &temperature_raw, &temperature_s, &humidity_raw, &humidity_s);
+        if (res != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: fetch temperature humidity failed.\n");
+            (void)hdc1080_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        hdc1080_interface_debug_print("hdc1080: temperature is %0.2fC, humidity is %0.2f%%.\n", temperature_s, humidity_s);
+    }
+    
     /* finish basic read test and exit */
     hdc1080_interface_debug_print("hdc1080: finish read test.\n");
     (void)hdc1080_deinit(&gs_handle);
@@ -63,8 +63,10 @@ uint8_t hdc1080_register_test(void)
     DRIVER_HDC1080_LINK_IIC_READ(&gs_handle, hdc1080_interface_iic_read);
     DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(&gs_handle, hdc1080_interface_iic_read_with_wait);
     DRIVER_HDC1080_LINK_IIC_WRITE(&gs_handle, hdc1080_interface_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(&gs_handle, hdc1080_interface_iic_read_cmd);
     DRIVER_HDC1080_LINK_DELAY_MS(&gs_handle, hdc1080_interface_delay_ms);
     DRIVER_HDC1080_LINK_DEBUG_PRINT(&gs_handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(&gs_handle, hdc1080_interface_debug_log);
     
     /* get information */
     res = hdc1080_info(&info);
@@ -218,6 +220,19 @@ uint8_t hdc1080_register_test(void)
     /* output */
     hdc1080_interface_debug_print("hdc1080: check mode %s.\n", mode == HDC1080_MODE_OR ? "ok" : "error");
     
+    /* the start and fetch api needs the sequence mode */
+    res = hdc1080_start_temperature_humidity(&gs_handle);
+    if (res != 5)
+    {
+        hdc1080_interface_debug_print("hdc1080: check start in or mode failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: check start in or mode ok.\n");
+    
     /* temperature and humidity are acquired in sequence */
     res = hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE);
     if (res != 0)
@@ -380,6 +395,75 @@ uint8_t hdc1080_register_test(void)
     /* output */
     hdc1080_interface_debug_print("hdc1080: check humidity resolution %s.\n", h_resolution == HDC1080_HUMIDITY_RESOLUTION_14_BIT ? "ok" : "error");
     
+    /* hdc1080_init_fast test */
+    hdc1080_interface_debug_print("hdc1080: hdc1080_init_fast test.\n");
+    
+    /* the running config is kept */
+    (void)hdc1080_deinit(&gs_handle);
+    res = hdc1080_init_fast(&gs_handle, HDC1080_MODE_SEQUENCE, HDC1080_BOOL_TRUE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+                            HDC1080_HUMIDITY_RESOLUTION_14_BIT, &enable);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init fast failed.\n");
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: same config %s.\n", enable == HDC1080_BOOL_FALSE ? "kept" : "reset");
+    hdc1080_interface_debug_print("hdc1080: check init fast %s.\n", enable == HDC1080_BOOL_FALSE ? "ok" : "error");
+    
+    /* an invalid config is refused before the bus is used */
+    (void)hdc1080_deinit(&gs_handle);
+    res = hdc1080_init_fast(&gs_handle, HDC1080_MODE_SEQUENCE, HDC1080_BOOL_FALSE, HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+                            (hdc1080_humidity_resolution_t)0x03, &enable);
+    if (res != 7)
+    {
+        hdc1080_interface_debug_print("hdc1080: check invalid config failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: check invalid config ok.\n");
+    
+    /* another config resets the chip */
+    res = hdc1080_init_fast(&gs_handle, HDC1080_MODE_SEQUENCE, HDC1080_BOOL_FALSE, HDC1080_TEMPERATURE_RESOLUTION_11_BIT,
+                            HDC1080_HUMIDITY_RESOLUTION_8_BIT, &enable);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: init fast failed.\n");
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: another config %s.\n", enable == HDC1080_BOOL_FALSE ? "kept" : "reset");
+    
+    /* get the config */
+    res = hdc1080_get_temperature_resolution(&gs_handle, &t_resolution);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: get temperature resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = hdc1080_get_humidity_resolution(&gs_handle, &h_resolution);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: get humidity resolution failed.\n");
+        (void)hdc1080_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    hdc1080_interface_debug_print("hdc1080: check init fast %s.\n", (enable == HDC1080_BOOL_TRUE) &&
+                                  (t_resolution == HDC1080_TEMPERATURE_RESOLUTION_11_BIT) &&
+                                  (h_resolution == HDC1080_HUMIDITY_RESOLUTION_8_BIT) ? "ok" : "error");
+    
     /* hdc1080_software_reset test */
     hdc1080_interface_debug_print("hdc1080: hdc1080_software_reset test.\n");
     
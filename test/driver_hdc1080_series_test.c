@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_series_test.c
+ * @brief     driver hdc1080 series test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_series_test.h"
+
+/**
+ * @brief series test definition
+ */
+#define HDC1080_SERIES_TEST_LEN           2048        /**< simulated sample number */
+#define HDC1080_SERIES_TEST_BLOCK_SIZE    256         /**< block buffer size */
+
+static hdc1080_series_sample_t gs_input[HDC1080_SERIES_TEST_LEN];          /**< input buffer */
+static hdc1080_series_sample_t gs_output[HDC1080_SERIES_TEST_LEN];         /**< output buffer */
+static uint8_t gs_block[HDC1080_SERIES_TEST_BLOCK_SIZE];                   /**< block buffer */
+static uint32_t gs_seed;                                                   /**< random seed */
+static hdc1080_series_encoder_t gs_encoder;                                /**< encoder structure */
+static const uint8_t gsc_id[6] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};     /**< serial id */
+
+/**
+ * @brief     generate the simulated samples
+ * @param[in] jitter max timestamp jitter in ms
+ * @param[in] temperature_step code step of the temperature resolution
+ * @param[in] humidity_step code step of the humidity resolution
+ * @note      a slow ramp with one step of noise, a door opening and a quiet stretch, the ticks wrap
+ */
+static void a_hdc1080_series_test_signal(uint32_t jitter, uint32_t temperature_step, uint32_t humidity_step)
+{
+    uint32_t i;
+    uint32_t t;
+    uint32_t h;
+    
+    gs_seed = 1;
+    for (i = 0; i < HDC1080_SERIES_TEST_LEN; i++)
+    {
+        gs_seed = gs_seed * 1664525U + 1013904223U;
+        
+        /* 1s period from 4096ms before the tick wrap */
+        gs_input[i].timestamp_ms = 0xFFFFF000U + i * 1000U;
+        if (jitter != 0)
+        {
+            gs_input[i].timestamp_ms += (gs_seed >> 8) % (jitter + 1);
+        }
+        
+        /* a ramp of about 1C and 3% per hour with one step of noise */
+        t = 26000 + i / 8 + ((gs_seed >> 16) % 3) * 4;
+        h = 30000 + i / 2 + ((gs_seed >> 20) % 5) * 4;
+        
+        /* the door opens for a minute */
+        if ((i >= 1000) && (i < 1060))
+        {
+            t -= 2000;
+            h += 6000;
+        }
+        
+        /* a quiet stretch */
+        if ((i >= 1500) && (i < 1600))
+        {
+            t = 27000;
+            h = 31000;
+        }
+        gs_input[i].temperature_raw = (uint16_t)(t / temperature_step * temperature_step);
+        gs_input[i].humidity_raw = (uint16_t)(h / humidity_step * humidity_step);
+    }
+}
+
+/**
+ * @brief         decode a finished block and compare it with the input
+ * @param[in]     len block length
+ * @param[in, out] *start pointer to the first input sample of the block
+ * @return        status code
+ *                - 0 success
+ *                - 1 check failed
+ * @note          none
+ */
+static uint8_t a_hdc1080_series_test_check(uint16_t len, uint32_t *start)
+{
+    uint8_t res;
+    uint32_t i;
+    hdc1080_series_header_t header;
+    
+    res = hdc1080_series_decode(gs_block, len, &header, gs_output, HDC1080_SERIES_TEST_LEN);
+    if ((res != 0) || (header.len != len) || (memcmp(header.id, gsc_id, 6) != 0) ||
+        (*start + header.count > HDC1080_SERIES_TEST_LEN))
+    {
+        hdc1080_interface_debug_print("hdc1080: decode block failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < header.count; i++)
+    {
+        if ((gs_output[i].timestamp_ms != gs_input[*start + i].timestamp_ms) ||
+            (gs_output[i].temperature_raw != gs_input[*start + i].temperature_raw) ||
+            (gs_output[i].humidity_raw != gs_input[*start + i].humidity_raw))
+        {
+            hdc1080_interface_debug_print("hdc1080: sample %d does not match.\n", *start + i);
+            
+            return 1;
+        }
+    }
+    *start += header.count;
+    
+    return 0;
+}
+
+/**
+ * @brief      encode the simulated samples and decode every block
+ * @param[in]  *name run name
+ * @param[in]  temperature_resolution temperature resolution
+ * @param[in]  humidity_resolution humidity resolution
+ * @param[out] *bytes pointer to a bytes per sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_hdc1080_series_test_run(const char *name, hdc1080_temperature_resolution_t temperature_resolution,
+                                         hdc1080_humidity_resolution_t humidity_resolution, float *bytes)
+{
+    uint32_t i;
+    uint32_t start;
+    uint32_t total;
+    uint32_t blocks;
+    uint16_t len;
+    
+    if (hdc1080_series_encoder_init(&gs_encoder, gs_block, HDC1080_SERIES_TEST_BLOCK_SIZE, gsc_id,
+                                    temperature_resolution, humidity_resolution) != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: encoder init failed.\n");
+        
+        return 1;
+    }
+    start = 0;
+    total = 0;
+    blocks = 0;
+    for (i = 0; i < HDC1080_SERIES_TEST_LEN; i++)
+    {
+        if (hdc1080_series_encoder_add(&gs_encoder, gs_input[i].timestamp_ms, gs_input[i].temperature_raw,
+                                       gs_input[i].humidity_raw, &len) != 0)
+        {
+            hdc1080_interface_debug_print("hdc1080: encoder add failed.\n");
+            
+            return 1;
+        }
+        if (len != 0)
+        {
+            if (a_hdc1080_series_test_check(len, &start) != 0)
+            {
+                return 1;
+            }
+            total += len;
+            blocks++;
+        }
+    }
+    (void)hdc1080_series_encoder_flush(&gs_encoder, &len);
+    if (len != 0)
+    {
+        if (a_hdc1080_series_test_check(len, &start) != 0)
+        {
+            return 1;
+        }
+        total += len;
+        blocks++;
+    }
+    if (start != HDC1080_SERIES_TEST_LEN)
+    {
+        hdc1080_interface_debug_print("hdc1080: %s lost samples.\n", name);
+        
+        return 1;
+    }
+    *bytes = (float)total / (float)HDC1080_SERIES_TEST_LEN;
+    hdc1080_interface_debug_print("hdc1080: %s %d samples in %d blocks, %0.2f bytes per sample.\n",
+                                  name, HDC1080_SERIES_TEST_LEN, blocks, *bytes);
+    
+    return 0;
+}
+
+/**
+ * @brief  series test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it round trips synthetic raw codes through the block encoder and the decoder, prints the bytes per sample
+ *         and checks the crc and the length checks of the decoder, no sensor is needed
+ */
+uint8_t hdc1080_series_test(void)
+{
+    uint32_t i;
+    uint16_t len;
+    float bytes;
+    hdc1080_series_header_t header;
+    
+    /* start series test */
+    hdc1080_interface_debug_print("hdc1080: start series test.\n");
+    
+    /* check the params */
+    if ((hdc1080_series_encoder_init(NULL, gs_block, HDC1080_SERIES_TEST_BLOCK_SIZE, gsc_id,
+                                     HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT) != 2) ||
+        (hdc1080_series_encoder_init(&gs_encoder, gs_block, HDC1080_SERIES_MIN_BLOCK_SIZE - 1, gsc_id,
+                                     HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT) != 4) ||
+        (hdc1080_series_encoder_add(&gs_encoder, 0, 0, 0, NULL) != 2) ||
+        (hdc1080_series_decode(gs_block, HDC1080_SERIES_TEST_BLOCK_SIZE, &header, NULL, 1) != 2))
+    {
+        hdc1080_interface_debug_print("hdc1080: check params failed.\n");
+        
+        return 1;
+    }
+    
+    /* scheduled samples */
+    a_hdc1080_series_test_signal(0, 4, 4);
+    if (a_hdc1080_series_test_run("t14 rh14", HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+                                  HDC1080_HUMIDITY_RESOLUTION_14_BIT, &bytes) != 0)
+    {
+        return 1;
+    }
+    if (bytes >= 2.0f)
+    {
+        hdc1080_interface_debug_print("hdc1080: scheduled samples are not below 2 bytes per sample.\n");
+        
+        return 1;
+    }
+    
+    /* coarse resolution */
+    a_hdc1080_series_test_signal(0, 32, 256);
+    if (a_hdc1080_series_test_run("t11 rh8", HDC1080_TEMPERATURE_RESOLUTION_11_BIT,
+                                  HDC1080_HUMIDITY_RESOLUTION_8_BIT, &bytes) != 0)
+    {
+        return 1;
+    }
+    
+    /* jittered timestamps use the full token */
+    a_hdc1080_series_test_signal(3, 4, 4);
+    if (a_hdc1080_series_test_run("jitter 3ms", HDC1080_TEMPERATURE_RESOLUTION_14_BIT,
+                                  HDC1080_HUMIDITY_RESOLUTION_14_BIT, &bytes) != 0)
+    {
+        return 1;
+    }
+    
+    /* a resolution change finishes the block */
+    hdc1080_interface_debug_print("hdc1080: check resolution change.\n");
+    a_hdc1080_series_test_signal(0, 32, 256);
+    (void)hdc1080_series_encoder_init(&gs_encoder, gs_block, HDC1080_SERIES_TEST_BLOCK_SIZE, gsc_id,
+                                      HDC1080_TEMPERATURE_RESOLUTION_14_BIT, HDC1080_HUMIDITY_RESOLUTION_14_BIT);
+    for (i = 0; i < 10; i++)
+    {
+        (void)hdc1080_series_encoder_add(&gs_encoder, gs_input[i].timestamp_ms, gs_input[i].temperature_raw,
+                                         gs_input[i].humidity_raw, &len);
+    }
+    if ((hdc1080_series_encoder_set_resolution(&gs_encoder, HDC1080_TEMPERATURE_RESOLUTION_11_BIT,
+                                               HDC1080_HUMIDITY_RESOLUTION_8_BIT, &len) != 0) || (len == 0) ||
+        (hdc1080_series_decode(gs_block, len, &header, gs_output, HDC1080_SERIES_TEST_LEN) != 0) ||
+        (header.count != 10) || (header.temperature_resolution != HDC1080_TEMPERATURE_RESOLUTION_14_BIT))
+    {
+        hdc1080_interface_debug_print("hdc1080: resolution change does not finish the block.\n");
+        
+        return 1;
+    }
+    for (i = 10; i < 20; i++)
+    {
+        (void)hdc1080_series_encoder_add(&gs_encoder, gs_input[i].timestamp_ms, gs_input[i].temperature_raw,
+                                         gs_input[i].humidity_raw, &len);
+    }
+    (void)hdc1080_series_encoder_flush(&gs_encoder, &len);
+    if ((hdc1080_series_decode(gs_block, len, &header, gs_output, HDC1080_SERIES_TEST_LEN) != 0) ||
+        (header.count != 10) || (header.temperature_resolution != HDC1080_TEMPERATURE_RESOLUTION_11_BIT) ||
+        (header.humidity_resolution != HDC1080_HUMIDITY_RESOLUTION_8_BIT) ||
+        (gs_output[9].humidity_raw != gs_input[19].humidity_raw))
+    {
+        hdc1080_interface_debug_print("hdc1080: block after the resolution change is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* damaged blocks */
+    hdc1080_interface_debug_print("hdc1080: check damaged blocks.\n");
+    if ((hdc1080_series_decode(gs_block, len - 1, &header, gs_output, HDC1080_SERIES_TEST_LEN) != 1) ||
+        (hdc1080_series_decode(gs_block, len, &header, gs_output, 9) != 5))
+    {
+        hdc1080_interface_debug_print("hdc1080: length check failed.\n");
+        
+        return 1;
+    }
+    gs_block[HDC1080_SERIES_HEADER_SIZE] ^= 0x01;
+    if (hdc1080_series_decode(gs_block, len, &header, gs_output, HDC1080_SERIES_TEST_LEN) != 4)
+    {
+        hdc1080_interface_debug_print("hdc1080: crc check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish series test */
+    hdc1080_interface_debug_print("hdc1080: finish series test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,337 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_sim.c
+ * @brief     driver hdc1080 simulated bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_sim.h"
+#include <string.h>
+
+/**
+ * @brief simulated bus definition
+ */
+#define HDC1080_SIM_CONVERSION_MS        7             /**< default conversion time */
+#define HDC1080_SIM_HEATER               0x2000        /**< heater bit of the config register */
+
+static hdc1080_sim_t *gs_sim;        /**< simulated chip on the bus */
+
+/**
+ * @brief  simulated bus transaction
+ * @return who answers
+ * @note   it counts the transaction and spends the transfer time
+ */
+static hdc1080_sim_answer_t a_hdc1080_sim_transfer(void)
+{
+    gs_sim->transactions++;
+    gs_sim->tick_us += gs_sim->transfer_us;
+    if (gs_sim->answer == NULL)
+    {
+        return HDC1080_SIM_ANSWER_CHIP;
+    }
+    
+    return gs_sim->answer();
+}
+
+/**
+ * @brief      simulated register value
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 unknown register
+ * @note       none
+ */
+static uint8_t a_hdc1080_sim_value(uint8_t reg, uint8_t *buf)
+{
+    uint16_t v;
+    
+    switch (reg)
+    {
+        case 0x00 : v = gs_sim->temperature; break;
+        case 0x01 : v = gs_sim->humidity; break;
+        case 0x02 : v = gs_sim->config; break;
+        case 0xFB : v = gs_sim->serial[0]; break;
+        case 0xFC : v = gs_sim->serial[1]; break;
+        case 0xFD : v = gs_sim->serial[2]; break;
+        case 0xFE : v = 0x5449; break;
+        case 0xFF : v = 0x1050; break;
+        default : return 1;
+    }
+    buf[0] = (uint8_t)(v >> 8);
+    buf[1] = (uint8_t)(v >> 0);
+    
+    return 0;
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_sim_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_hdc1080_sim_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated register read
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a 4 byte read of the temperature register also reads the humidity
+ */
+static uint8_t a_hdc1080_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    hdc1080_sim_answer_t answer;
+    
+    (void)addr;
+    answer = a_hdc1080_sim_transfer();
+    if ((answer == HDC1080_SIM_ANSWER_NONE) || ((len != 2) && ((len != 4) || (reg != 0x00))))
+    {
+        return 1;
+    }
+    if (answer == HDC1080_SIM_ANSWER_OTHER)
+    {
+        memset(buf, 0, len);
+        
+        return 0;
+    }
+    if (a_hdc1080_sim_value(reg, &buf[0]) != 0)
+    {
+        return 1;
+    }
+    if (len == 4)
+    {
+        (void)a_hdc1080_sim_value(0x01, &buf[2]);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated read with wait
+ * @param[in]  addr iic address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       it converts and waits for the conversion inside one transaction
+ */
+static uint8_t a_hdc1080_sim_iic_read_with_wait(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (gs_sim->convert != NULL)
+    {
+        gs_sim->convert();
+    }
+    hdc1080_sim_delay_ms(gs_sim->conversion_ms);
+    
+    return a_hdc1080_sim_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     simulated register write
+ * @param[in] addr iic address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      a config write with bit 15 set resets the chip, a pointer write without data triggers a conversion
+ */
+static uint8_t a_hdc1080_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t v;
+    hdc1080_sim_answer_t answer;
+    
+    (void)addr;
+    answer = a_hdc1080_sim_transfer();
+    if (answer == HDC1080_SIM_ANSWER_NONE)
+    {
+        return 1;
+    }
+    if (answer == HDC1080_SIM_ANSWER_OTHER)
+    {
+        return 0;
+    }
+    if ((reg == 0x02) && (len == 2))
+    {
+        v = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);
+        gs_sim->config = ((v & 0x8000) != 0) ? 0x1000 : (v & HDC1080_CONFIG_MASK);
+        if ((gs_sim->config & HDC1080_SIM_HEATER) != 0)
+        {
+            gs_sim->heater_writes++;
+        }
+    }
+    if (((reg == 0x00) || (reg == 0x01)) && (len == 0))
+    {
+        gs_sim->triggers++;
+        gs_sim->pending = reg;
+        gs_sim->ready_us = gs_sim->tick_us + (uint64_t)gs_sim->conversion_ms * 1000;
+        if (gs_sim->convert != NULL)
+        {
+            gs_sim->convert();
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      simulated command read
+ * @param[in]  addr iic address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       a 4 byte fetch reads the temperature and the humidity, a 2 byte fetch the triggered register
+ */
+static uint8_t a_hdc1080_sim_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    hdc1080_sim_answer_t answer;
+    
+    (void)addr;
+    answer = a_hdc1080_sim_transfer();
+    gs_sim->fetches++;
+    if ((answer == HDC1080_SIM_ANSWER_NONE) || ((len != 2) && (len != 4)))
+    {
+        return 1;
+    }
+    if (gs_sim->fetch_fail != 0)
+    {
+        gs_sim->fetch_fail--;
+        
+        return 1;
+    }
+    if ((gs_sim->busy_nak != 0) && (gs_sim->tick_us < gs_sim->ready_us))
+    {
+        gs_sim->naks++;
+        
+        return 1;
+    }
+    if (answer == HDC1080_SIM_ANSWER_OTHER)
+    {
+        memset(buf, 0, len);
+        
+        return 0;
+    }
+    if (len == 4)
+    {
+        (void)a_hdc1080_sim_value(0x00, &buf[0]);
+        (void)a_hdc1080_sim_value(0x01, &buf[2]);
+        
+        return 0;
+    }
+    
+    return a_hdc1080_sim_value(gs_sim->pending, buf);
+}
+
+/**
+ * @brief     reset a simulated chip to its power on state
+ * @param[in] *sim pointer to a simulated chip structure
+ * @note      it also makes the chip the one on the bus, the hooks are cleared
+ */
+void hdc1080_sim_init(hdc1080_sim_t *sim)
+{
+    memset(sim, 0, sizeof(hdc1080_sim_t));
+    sim->temperature = 0x6000;
+    sim->humidity = 0x6500;
+    sim->config = 0x1000;
+    sim->serial[0] = 0x1080;
+    sim->serial[1] = 0x0001;
+    sim->serial[2] = 0x4200;
+    sim->conversion_ms = HDC1080_SIM_CONVERSION_MS;
+    gs_sim = sim;
+}
+
+/**
+ * @brief     link a handle to the simulated bus
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      the handle is cleared first
+ */
+void hdc1080_sim_link(hdc1080_handle_t *handle)
+{
+    DRIVER_HDC1080_LINK_INIT(handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_IIC_INIT(handle, a_hdc1080_sim_iic_init);
+    DRIVER_HDC1080_LINK_IIC_DEINIT(handle, a_hdc1080_sim_iic_deinit);
+    DRIVER_HDC1080_LINK_IIC_READ(handle, a_hdc1080_sim_iic_read);
+    DRIVER_HDC1080_LINK_IIC_READ_WITH_WAIT(handle, a_hdc1080_sim_iic_read_with_wait);
+    DRIVER_HDC1080_LINK_IIC_WRITE(handle, a_hdc1080_sim_iic_write);
+    DRIVER_HDC1080_LINK_IIC_READ_CMD(handle, a_hdc1080_sim_iic_read_cmd);
+    DRIVER_HDC1080_LINK_DELAY_MS(handle, hdc1080_sim_delay_ms);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(handle, hdc1080_interface_debug_log);
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      it calls the delay hook and lets the time pass
+ */
+void hdc1080_sim_delay_ms(uint32_t ms)
+{
+    if (gs_sim->delay != NULL)
+    {
+        gs_sim->delay(ms);
+    }
+    gs_sim->tick_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief  simulated get tick
+ * @return current time in ms
+ * @note   none
+ */
+uint32_t hdc1080_sim_get_tick_ms(void)
+{
+    return (uint32_t)(gs_sim->tick_us / 1000);
+}
+
+/**
+ * @brief  simulated get tick
+ * @return current time in us
+ * @note   none
+ */
+uint32_t hdc1080_sim_get_tick_us(void)
+{
+    return (uint32_t)gs_sim->tick_us;
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_sim.h
+ * @brief     driver hdc1080 simulated bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_HDC1080_SIM_H
+#define DRIVER_HDC1080_SIM_H
+
+#include "driver_hdc1080_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup hdc1080_test_driver hdc1080 test driver function
+ * @brief    hdc1080 test driver modules
+ * @ingroup  hdc1080_driver
+ * @{
+ */
+
+/**
+ * @brief hdc1080 simulated bus answer enumeration definition
+ */
+typedef enum
+{
+    HDC1080_SIM_ANSWER_CHIP  = 0x00,        /**< the hdc1080 answers */
+    HDC1080_SIM_ANSWER_NONE  = 0x01,        /**< nobody answers, the transaction naks */
+    HDC1080_SIM_ANSWER_OTHER = 0x02,        /**< another device at the same address answers zeros */
+} hdc1080_sim_answer_t;
+
+/**
+ * @brief hdc1080 simulated chip structure definition
+ */
+typedef struct hdc1080_sim_s
+{
+    uint16_t temperature;                        /**< temperature code */
+    uint16_t humidity;                           /**< humidity code */
+    uint16_t config;                             /**< config register */
+    uint16_t serial[3];                          /**< serial id registers */
+    uint32_t conversion_ms;                      /**< conversion time */
+    uint32_t transfer_us;                        /**< time of one transaction */
+    uint8_t busy_nak;                            /**< 1 naks the fetch until the conversion is finished */
+    uint8_t fetch_fail;                          /**< fetches to nak */
+    uint8_t pending;                             /**< triggered register */
+    uint64_t tick_us;                            /**< simulated time in us */
+    uint64_t ready_us;                           /**< end of the conversion in flight */
+    uint32_t transactions;                       /**< bus transactions */
+    uint32_t triggers;                           /**< conversion triggers */
+    uint32_t fetches;                            /**< command reads */
+    uint32_t naks;                               /**< fetches before the end of the conversion */
+    uint32_t heater_writes;                      /**< config writes that switch the heater on */
+    hdc1080_sim_answer_t (*answer)(void);        /**< point to an answer function, NULL lets the chip answer */
+    void (*convert)(void);                       /**< point to a conversion start function, it may be NULL */
+    void (*delay)(uint32_t ms);                  /**< point to a delay function, it may be NULL */
+} hdc1080_sim_t;
+
+/**
+ * @brief     reset a simulated chip to its power on state
+ * @param[in] *sim pointer to a simulated chip structure
+ * @note      it also makes the chip the one on the bus, the hooks are cleared
+ */
+void hdc1080_sim_init(hdc1080_sim_t *sim);
+
+/**
+ * @brief     link a handle to the simulated bus
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @note      the handle is cleared first
+ */
+void hdc1080_sim_link(hdc1080_handle_t *handle);
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms delay time
+ * @note      it calls the delay hook and lets the time pass
+ */
+void hdc1080_sim_delay_ms(uint32_t ms);
+
+/**
+ * @brief  simulated get tick
+ * @return current time in ms
+ * @note   none
+ */
+uint32_t hdc1080_sim_get_tick_ms(void);
+
+/**
+ * @brief  simulated get tick
+ * @return current time in us
+ * @note   none
+ */
+uint32_t hdc1080_sim_get_tick_us(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
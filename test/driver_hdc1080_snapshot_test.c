@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_snapshot_test.c
+ * @brief     driver hdc1080 snapshot test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_snapshot_test.h"
+#include "driver_hdc1080_sim.h"
+#include <string.h>
+
+/**
+ * @brief snapshot test definition
+ */
+#define HDC1080_SNAPSHOT_TEST_CONFIG           0x1600        /**< sequence mode, 11 bit temperature and 8 bit humidity */
+
+static hdc1080_handle_t gs_handle;                          /**< hdc1080 handle */
+static hdc1080_sim_t gs_sim;                                /**< simulated chip, serial id 1 tells the chips apart */
+static uint8_t gs_storage[HDC1080_SNAPSHOT_SIZE];           /**< simulated backup ram */
+
+/**
+ * @brief      ram storage load
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ * @note       none
+ */
+static uint8_t a_hdc1080_snapshot_test_load(uint8_t *buf, uint16_t len)
+{
+    if (len > sizeof(gs_storage))
+    {
+        return 1;
+    }
+    memcpy(buf, gs_storage, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     ram storage save
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      none
+ */
+static uint8_t a_hdc1080_snapshot_test_save(const uint8_t *buf, uint16_t len)
+{
+    if (len > sizeof(gs_storage))
+    {
+        return 1;
+    }
+    memcpy(gs_storage, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief  simulate an mcu reset
+ * @note   the handle is lost, the chip keeps its state
+ */
+static void a_hdc1080_snapshot_test_mcu_reset(void)
+{
+    hdc1080_sim_link(&gs_handle);
+    gs_sim.transactions = 0;
+    gs_sim.tick_us = 0;
+}
+
+/**
+ * @brief     run the filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] times sample times
+ * @param[in] *out pointer to the last filtered temperature code
+ * @return    status code
+ * @note      none
+ */
+static uint8_t a_hdc1080_snapshot_test_filter(hdc1080_filter_t *filter, uint32_t times, uint16_t *out)
+{
+    uint32_t i;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    uint16_t humidity;
+    float temperature_s;
+    float humidity_s;
+    
+    for (i = 0; i < times; i++)
+    {
+        gs_sim.temperature = (uint16_t)(0x6000 + ((i & 1) != 0 ? 0x200 : 0));
+        if (hdc1080_read_temperature_humidity(&gs_handle, &temperature_raw, &temperature_s,
+                                              &humidity_raw, &humidity_s) != 0)
+        {
+            return 1;
+        }
+        if (hdc1080_filter_update(filter, temperature_raw, humidity_raw, out, &humidity) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  snapshot test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it boots a simulated chip from a ram stored snapshot after an mcu reset, a power cycle, a chip swap
+ *         and a chip swap that keeps a saved default config, compares the bus work with the full init and checks
+ *         damaged snapshots, no sensor is needed
+ */
+uint8_t hdc1080_snapshot_test(void)
+{
+    uint8_t res;
+    uint8_t buf[HDC1080_SNAPSHOT_SIZE];
+    uint16_t out;
+    uint16_t out_ref;
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    uint32_t cold_transactions;
+    uint32_t cold_ms;
+    hdc1080_bool_t reset;
+    hdc1080_filter_t filter;
+    hdc1080_filter_t filter_ref;
+    hdc1080_snapshot_t snapshot;
+    const hdc1080_snapshot_storage_t storage = {a_hdc1080_snapshot_test_load, a_hdc1080_snapshot_test_save};
+    
+    /* start snapshot test */
+    hdc1080_interface_debug_print("hdc1080: start snapshot test.\n");
+    
+    /* first boot, the storage is empty */
+    hdc1080_interface_debug_print("hdc1080: first boot with an empty storage.\n");
+    memset(gs_storage, 0, sizeof(gs_storage));
+    hdc1080_sim_init(&gs_sim);
+    a_hdc1080_snapshot_test_mcu_reset();
+    if (hdc1080_snapshot_load(&storage, &snapshot) != 1)
+    {
+        hdc1080_interface_debug_print("hdc1080: check empty storage failed.\n");
+        
+        return 1;
+    }
+    if ((hdc1080_init(&gs_handle) != 0) ||
+        (hdc1080_set_heater(&gs_handle, HDC1080_BOOL_FALSE) != 0) ||
+        (hdc1080_set_mode(&gs_handle, HDC1080_MODE_SEQUENCE) != 0) ||
+        (hdc1080_set_temperature_resolution(&gs_handle, HDC1080_TEMPERATURE_RESOLUTION_11_BIT) != 0) ||
+        (hdc1080_set_humidity_resolution(&gs_handle, HDC1080_HUMIDITY_RESOLUTION_8_BIT) != 0) ||
+        (hdc1080_get_serial_id(&gs_handle, snapshot.serial_id) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: full init failed.\n");
+        
+        return 1;
+    }
+    cold_transactions = gs_sim.transactions;
+    cold_ms = hdc1080_sim_get_tick_ms();
+    hdc1080_interface_debug_print("hdc1080: full init %d transactions %dms.\n", cold_transactions, cold_ms);
+    
+    /* calibrate, run the filter and save */
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.temperature_offset = -12;
+    snapshot.humidity_offset = 40;
+    if ((hdc1080_filter_init_ema(&filter, 3, 3) != 0) ||
+        (a_hdc1080_snapshot_test_filter(&filter, 16, &out) != 0) ||
+        (hdc1080_snapshot_capture(&gs_handle, &filter, &snapshot) != 0) ||
+        (hdc1080_snapshot_save(&storage, &snapshot) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: save snapshot failed.\n");
+        
+        return 1;
+    }
+    if (snapshot.config != HDC1080_SNAPSHOT_TEST_CONFIG)
+    {
+        hdc1080_interface_debug_print("hdc1080: check captured config failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: saved %d bytes, config 0x%04X.\n", HDC1080_SNAPSHOT_SIZE, snapshot.config);
+    filter_ref = filter;
+    
+    /* mcu reset, the chip keeps its config */
+    hdc1080_interface_debug_print("hdc1080: boot after an mcu reset.\n");
+    a_hdc1080_snapshot_test_mcu_reset();
+    memset(&snapshot, 0, sizeof(snapshot));
+    memset(&filter, 0, sizeof(filter));
+    if ((hdc1080_snapshot_load(&storage, &snapshot) != 0) ||
+        (hdc1080_snapshot_restore(&gs_handle, &snapshot, &filter, &reset) != 0) ||
+        (reset != HDC1080_BOOL_FALSE) || (gs_sim.transactions != 6) || (gs_sim.tick_us != 0) ||
+        (snapshot.temperature_offset != -12) || (snapshot.humidity_offset != 40) || (snapshot.serial_id[3] != 0x01))
+    {
+        hdc1080_interface_debug_print("hdc1080: check warm boot failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: restore %d transactions %dms, chip %s.\n", gs_sim.transactions, hdc1080_sim_get_tick_ms(),
+                                  reset == HDC1080_BOOL_TRUE ? "reset" : "kept");
+    
+    /* the restored filter continues where the saved one stopped */
+    if ((a_hdc1080_snapshot_test_filter(&filter, 4, &out) != 0) ||
+        (a_hdc1080_snapshot_test_filter(&filter_ref, 4, &out_ref) != 0) || (out != out_ref))
+    {
+        hdc1080_interface_debug_print("hdc1080: check restored filter failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: restored filter output 0x%04X, kept filter output 0x%04X.\n", out, out_ref);
+    
+    /* power cycle, the chip starts with the default config */
+    hdc1080_interface_debug_print("hdc1080: boot after a power cycle.\n");
+    gs_sim.config = 0x1000;
+    a_hdc1080_snapshot_test_mcu_reset();
+    if ((hdc1080_snapshot_load(&storage, &snapshot) != 0) ||
+        (hdc1080_snapshot_restore(&gs_handle, &snapshot, &filter, &reset) != 0) ||
+        (reset != HDC1080_BOOL_TRUE) || (gs_sim.config != HDC1080_SNAPSHOT_TEST_CONFIG))
+    {
+        hdc1080_interface_debug_print("hdc1080: check power cycle failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: restore %d transactions %dms, chip %s.\n", gs_sim.transactions, hdc1080_sim_get_tick_ms(),
+                                  reset == HDC1080_BOOL_TRUE ? "reset" : "kept");
+    
+    /* another chip, the calibration belongs to the old one */
+    hdc1080_interface_debug_print("hdc1080: boot with another chip.\n");
+    gs_sim.config = 0x1000;
+    gs_sim.serial[1] = 0x0002;
+    a_hdc1080_snapshot_test_mcu_reset();
+    if ((hdc1080_snapshot_load(&storage, &snapshot) != 0) ||
+        (hdc1080_snapshot_restore(&gs_handle, &snapshot, &filter, &reset) != 5) || (gs_handle.inited != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check replaced chip failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: replaced chip found.\n");
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* a saved default config, the replaced chip runs it from power on and is not reset */
+    hdc1080_interface_debug_print("hdc1080: boot with another chip and a saved default config.\n");
+    snapshot.config = 0x1000;
+    gs_sim.config = 0x1000;
+    a_hdc1080_snapshot_test_mcu_reset();
+    if ((hdc1080_snapshot_restore(&gs_handle, &snapshot, &filter, &reset) != 5) || (reset != HDC1080_BOOL_FALSE) ||
+        (gs_sim.tick_us != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check replaced chip without a reset failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: restore %d transactions %dms, replaced chip found.\n", gs_sim.transactions,
+                                  hdc1080_sim_get_tick_ms());
+    (void)hdc1080_deinit(&gs_handle);
+    
+    /* the calibration saturates */
+    temperature_raw = 0x0004;
+    humidity_raw = 0xFFF0;
+    if ((hdc1080_snapshot_calibrate(&snapshot, &temperature_raw, &humidity_raw) != 0) ||
+        (temperature_raw != 0x0000) || (humidity_raw != 0xFFFF))
+    {
+        hdc1080_interface_debug_print("hdc1080: check calibration failed.\n");
+        
+        return 1;
+    }
+    
+    /* damaged snapshots */
+    hdc1080_interface_debug_print("hdc1080: check damaged snapshots.\n");
+    (void)hdc1080_snapshot_pack(&snapshot, buf);
+    buf[20] ^= 0x01;
+    res = hdc1080_snapshot_unpack(buf, sizeof(buf), &snapshot);
+    if (res != 4)
+    {
+        hdc1080_interface_debug_print("hdc1080: check flipped bit failed.\n");
+        
+        return 1;
+    }
+    buf[20] ^= 0x01;
+    buf[2] = HDC1080_SNAPSHOT_VERSION + 1;
+    res = hdc1080_snapshot_unpack(buf, sizeof(buf), &snapshot);
+    if (res != 5)
+    {
+        hdc1080_interface_debug_print("hdc1080: check version failed.\n");
+        
+        return 1;
+    }
+    buf[2] = HDC1080_SNAPSHOT_VERSION;
+    if ((hdc1080_snapshot_unpack(buf, sizeof(buf) - 1, &snapshot) != 1) ||
+        (hdc1080_snapshot_unpack(buf, sizeof(buf), &snapshot) != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check length failed.\n");
+        
+        return 1;
+    }
+    memset(buf, 0xFF, sizeof(buf));
+    if (hdc1080_snapshot_unpack(buf, sizeof(buf), &snapshot) != 1)
+    {
+        hdc1080_interface_debug_print("hdc1080: check erased storage failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish snapshot test */
+    hdc1080_interface_debug_print("hdc1080: finish snapshot test.\n");
+    
+    return 0;
+}
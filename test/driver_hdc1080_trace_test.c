@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_hdc1080_trace_test.c
+ * @brief     driver hdc1080 trace test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_hdc1080_trace_test.h"
+#include "driver_hdc1080_sim.h"
+
+/**
+ * @brief trace test definition
+ */
+#define HDC1080_TRACE_TEST_SIZE        1024        /**< trace buffer size */
+#define HDC1080_TRACE_TEST_SMALL       48          /**< trace buffer size of the overflow test */
+#define HDC1080_TRACE_TEST_TIMES       8           /**< read times */
+
+static hdc1080_handle_t gs_handle;                                        /**< recorded handle */
+static hdc1080_handle_t gs_replay_handle;                                 /**< replayed handle */
+static hdc1080_trace_handle_t gs_trace;                                   /**< trace handle */
+static hdc1080_sim_t gs_sim;                                              /**< simulated chip */
+static uint8_t gs_buf[HDC1080_TRACE_TEST_SIZE];                           /**< trace buffer */
+static uint8_t gs_damaged[HDC1080_TRACE_TEST_SIZE];                       /**< damaged trace buffer */
+static uint16_t gs_raw[HDC1080_TRACE_TEST_TIMES][2];                      /**< recorded raw values */
+
+/**
+ * @brief simulated conversion
+ * @note  the temperature and the humidity drift on every conversion
+ */
+static void a_hdc1080_trace_test_convert(void)
+{
+    gs_sim.temperature += 37;
+    gs_sim.humidity -= 53;
+}
+
+/**
+ * @brief     link a handle
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @param[in] bus 1 links the simulated bus
+ * @note      none
+ */
+static void a_hdc1080_trace_test_link(hdc1080_handle_t *handle, uint8_t bus)
+{
+    if (bus != 0)
+    {
+        hdc1080_sim_link(handle);
+        
+        return;
+    }
+    DRIVER_HDC1080_LINK_INIT(handle, hdc1080_handle_t);
+    DRIVER_HDC1080_LINK_DEBUG_PRINT(handle, hdc1080_interface_debug_print);
+    DRIVER_HDC1080_LINK_DEBUG_LOG(handle, hdc1080_interface_debug_log);
+}
+
+/**
+ * @brief     run the traced session
+ * @param[in] *handle pointer to an hdc1080 handle structure
+ * @param[in] check 0 saves the values, 1 compares them with the record, 2 ignores them
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      init, set the resolution, read the serial id, read in both modes and deinit
+ */
+static uint8_t a_hdc1080_trace_test_session(hdc1080_handle_t *handle, uint8_t check)
+{
+    uint8_t i;
+    uint8_t id[6];
+    uint16_t temperature_raw;
+    uint16_t humidity_raw;
+    float temperature;
+    float humidity;
+    
+    if (hdc1080_init(handle) != 0)
+    {
+        return 1;
+    }
+    if ((hdc1080_set_mode(handle, HDC1080_MODE_SEQUENCE) != 0) ||
+        (hdc1080_set_temperature_resolution(handle, HDC1080_TEMPERATURE_RESOLUTION_14_BIT) != 0) ||
+        (hdc1080_get_serial_id(handle, id) != 0))
+    {
+        (void)hdc1080_deinit(handle);
+        
+        return 1;
+    }
+    for (i = 0; i < HDC1080_TRACE_TEST_TIMES; i++)
+    {
+        if ((i % 2) == 0)
+        {
+            if (hdc1080_read_temperature_humidity(handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0)
+            {
+                (void)hdc1080_deinit(handle);
+                
+                return 1;
+            }
+        }
+        else
+        {
+            if ((hdc1080_start_temperature_humidity(handle) != 0) ||
+                (hdc1080_fetch_temperature_humidity(handle, &temperature_raw, &temperature, &humidity_raw, &humidity) != 0))
+            {
+                (void)hdc1080_deinit(handle);
+                
+                return 1;
+            }
+        }
+        if (check == 0)
+        {
+            gs_raw[i][0] = temperature_raw;
+            gs_raw[i][1] = humidity_raw;
+        }
+        else if ((check == 1) && ((gs_raw[i][0] != temperature_raw) || (gs_raw[i][1] != humidity_raw)))
+        {
+            hdc1080_interface_debug_print("hdc1080: read %d differs from the record.\n", i);
+            (void)hdc1080_deinit(handle);
+            
+            return 1;
+        }
+        else
+        {
+            /* same as the record */
+        }
+    }
+    
+    return hdc1080_deinit(handle);
+}
+
+/**
+ * @brief  trace test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   it records the driver on a simulated bus, replays the trace into a second handle, checks the values,
+ *         the mismatch detection and the parser on damaged traces, no sensor is needed
+ */
+uint8_t hdc1080_trace_test(void)
+{
+    uint8_t res;
+    uint32_t len;
+    uint32_t pos;
+    uint32_t bus;
+    hdc1080_trace_event_t event;
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+    
+    /* start trace test */
+    hdc1080_interface_debug_print("hdc1080: start trace test.\n");
+    
+    /* check the args */
+    hdc1080_sim_init(&gs_sim);
+    gs_sim.convert = a_hdc1080_trace_test_convert;
+    a_hdc1080_trace_test_link(&gs_handle, 1);
+    iic_read = gs_handle.iic_read;
+    res = hdc1080_trace_record(NULL, &gs_handle, gs_buf, HDC1080_TRACE_TEST_SIZE, NULL);
+    if (res != 2)
+    {
+        hdc1080_interface_debug_print("hdc1080: check null pointer failed.\n");
+        
+        return 1;
+    }
+    a_hdc1080_trace_test_link(&gs_replay_handle, 0);
+    res = hdc1080_trace_record(&gs_trace, &gs_replay_handle, gs_buf, HDC1080_TRACE_TEST_SIZE, NULL);
+    if (res != 4)
+    {
+        hdc1080_interface_debug_print("hdc1080: check unlinked hooks failed.\n");
+        
+        return 1;
+    }
+    
+    /* record */
+    hdc1080_interface_debug_print("hdc1080: record the simulated bus.\n");
+    res = hdc1080_trace_record(&gs_trace, &gs_handle, gs_buf, HDC1080_TRACE_TEST_SIZE, hdc1080_interface_get_tick_ms);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: trace record failed.\n");
+        
+        return 1;
+    }
+    res = hdc1080_trace_record(&gs_trace, &gs_handle, gs_buf, HDC1080_TRACE_TEST_SIZE, NULL);
+    if (res != 5)
+    {
+        hdc1080_interface_debug_print("hdc1080: check attached trace failed.\n");
+        (void)hdc1080_trace_detach(&gs_trace, &gs_handle);
+        
+        return 1;
+    }
+    res = a_hdc1080_trace_test_session(&gs_handle, 0);
+    (void)hdc1080_trace_detach(&gs_trace, &gs_handle);
+    if ((res != 0) || (gs_trace.lost != 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: recorded session failed.\n");
+        
+        return 1;
+    }
+    if (gs_handle.iic_read != iic_read)
+    {
+        hdc1080_interface_debug_print("hdc1080: detach did not restore the hooks.\n");
+        
+        return 1;
+    }
+    len = gs_trace.len;
+    bus = gs_trace.events;
+    pos = 0;
+    while (hdc1080_trace_parse(gs_buf, len, &pos, &event) == 0)
+    {
+        if (event.type == HDC1080_TRACE_EVENT_DELAY)
+        {
+            bus--;
+        }
+    }
+    hdc1080_interface_debug_print("hdc1080: %d events, %d bus transactions, %d bytes, %0.2f bytes per transaction.\n",
+                                  gs_trace.events, bus, len, (float)(len - HDC1080_TRACE_HEADER_SIZE) / (float)bus);
+    hdc1080_interface_debug_print("hdc1080: recorded delays are %dms.\n", gs_trace.trace_delay_ms);
+    
+    /* replay */
+    hdc1080_interface_debug_print("hdc1080: replay into an unlinked handle.\n");
+    a_hdc1080_trace_test_link(&gs_replay_handle, 0);
+    res = hdc1080_trace_replay(&gs_trace, &gs_replay_handle, gs_buf, len);
+    if (res != 0)
+    {
+        hdc1080_interface_debug_print("hdc1080: trace replay failed.\n");
+        
+        return 1;
+    }
+    res = a_hdc1080_trace_test_session(&gs_replay_handle, 1);
+    if ((res != 0) || (gs_trace.mismatch != 0) || (hdc1080_trace_replay_pending(&gs_trace) != 0) ||
+        (gs_trace.replay_delay_ms != gs_trace.trace_delay_ms))
+    {
+        hdc1080_interface_debug_print("hdc1080: replayed session failed.\n");
+        (void)hdc1080_trace_detach(&gs_trace, &gs_replay_handle);
+        
+        return 1;
+    }
+    (void)hdc1080_trace_detach(&gs_trace, &gs_replay_handle);
+    hdc1080_interface_debug_print("hdc1080: replay matches with %d events and %dms of skipped delays.\n",
+                                  gs_trace.events, gs_trace.replay_delay_ms);
+    
+    /* a different call sequence */
+    hdc1080_interface_debug_print("hdc1080: replay a different call sequence.\n");
+    a_hdc1080_trace_test_link(&gs_replay_handle, 0);
+    (void)hdc1080_trace_replay(&gs_trace, &gs_replay_handle, gs_buf, len);
+    res = hdc1080_init(&gs_replay_handle);
+    if (res == 0)
+    {
+        res = hdc1080_set_heater(&gs_replay_handle, HDC1080_BOOL_TRUE);
+        (void)hdc1080_deinit(&gs_replay_handle);
+    }
+    (void)hdc1080_trace_detach(&gs_trace, &gs_replay_handle);
+    if ((res == 0) || (gs_trace.mismatch == 0))
+    {
+        hdc1080_interface_debug_print("hdc1080: check mismatch failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d mismatches, the first at offset %d.\n", gs_trace.mismatch, gs_trace.mismatch_pos);
+    
+    /* damaged traces */
+    hdc1080_interface_debug_print("hdc1080: check damaged traces.\n");
+    memcpy(gs_damaged, gs_buf, len);
+    gs_damaged[0] ^= 0xFF;
+    if (hdc1080_trace_replay(&gs_trace, &gs_replay_handle, gs_damaged, len) != 1)
+    {
+        hdc1080_interface_debug_print("hdc1080: check header failed.\n");
+        
+        return 1;
+    }
+    gs_damaged[0] ^= 0xFF;
+    gs_damaged[HDC1080_TRACE_HEADER_SIZE] = 0x7F;
+    pos = HDC1080_TRACE_HEADER_SIZE;
+    if (hdc1080_trace_parse(gs_damaged, len, &pos, &event) != 4)
+    {
+        hdc1080_interface_debug_print("hdc1080: check event type failed.\n");
+        
+        return 1;
+    }
+    pos = 0;
+    do
+    {
+        res = hdc1080_trace_parse(gs_buf, len - 1, &pos, &event);
+    } while (res == 0);
+    if (res != 4)
+    {
+        hdc1080_interface_debug_print("hdc1080: check truncated trace failed.\n");
+        
+        return 1;
+    }
+    
+    /* buffer overflow */
+    hdc1080_interface_debug_print("hdc1080: record into a small buffer.\n");
+    (void)hdc1080_trace_record(&gs_trace, &gs_handle, gs_buf, HDC1080_TRACE_TEST_SMALL, NULL);
+    res = a_hdc1080_trace_test_session(&gs_handle, 2);
+    (void)hdc1080_trace_detach(&gs_trace, &gs_handle);
+    len = gs_trace.len;
+    pos = 0;
+    do
+    {
+        res = hdc1080_trace_parse(gs_buf, len, &pos, &event);
+    } while (res == 0);
+    if ((gs_trace.lost == 0) || (res != 1))
+    {
+        hdc1080_interface_debug_print("hdc1080: check small buffer failed.\n");
+        
+        return 1;
+    }
+    hdc1080_interface_debug_print("hdc1080: %d events kept in %d bytes, %d lost.\n", gs_trace.events, len, gs_trace.lost);
+    
+    /* finish trace test */
+    hdc1080_interface_debug_print("hdc1080: finish trace test.\n");
+    
+    return 0;
+}